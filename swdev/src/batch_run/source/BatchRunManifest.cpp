@@ -0,0 +1,176 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "BatchRunManifest.hpp"
+
+#include <cstdio>
+#include <map>
+#include <vector>
+
+namespace
+{
+const char* const cHEADER = "run,scenario,case,seed,status,exit_code,start_time,duration_s";
+
+//! The number of fields of a record
+const size_t cFIELD_COUNT = 8;
+
+//! Quotes a field that contains a comma, a quote or a line break
+std::string QuoteField(const std::string& aField)
+{
+   if (aField.find_first_of(",\"\r\n") == std::string::npos)
+   {
+      return aField;
+   }
+   std::string quoted = "\"";
+   for (char c : aField)
+   {
+      quoted += c;
+      if (c == '"')
+      {
+         quoted += '"';
+      }
+   }
+   return quoted + '"';
+}
+
+//! Splits a line of the manifest into its fields
+std::vector<std::string> SplitFields(const std::string& aLine)
+{
+   std::vector<std::string> fields(1);
+   bool                     quoted = false;
+   for (size_t i = 0; i < aLine.size(); ++i)
+   {
+      char c = aLine[i];
+      if (c == '"')
+      {
+         if (quoted && i + 1 < aLine.size() && aLine[i + 1] == '"')
+         {
+            fields.back() += c;
+            ++i;
+         }
+         else
+         {
+            quoted = !quoted;
+         }
+      }
+      else if (c == ',' && !quoted)
+      {
+         fields.emplace_back();
+      }
+      else
+      {
+         fields.back() += c;
+      }
+   }
+   return fields;
+}
+} // namespace
+
+const char* const BatchRun::Manifest::cSUCCEEDED = "succeeded";
+
+bool BatchRun::Manifest::Read(const std::string& aPath, std::string& aError)
+{
+   mSucceeded.clear();
+   std::ifstream file(aPath, std::ios::binary);
+   if (!file)
+   {
+      return true;
+   }
+
+   // The status of each run is the status of its last record
+   std::map<std::string, std::string> statuses;
+   std::string                        line;
+   for (bool first = true; std::getline(file, line); first = false)
+   {
+      if (!line.empty() && line.back() == '\r')
+      {
+         line.pop_back();
+      }
+      if (first)
+      {
+         if (line != cHEADER)
+         {
+            aError = "\"" + aPath + "\" is not a batch_run manifest";
+            return false;
+         }
+         continue;
+      }
+      // A record that was cut short when the batch was interrupted is ignored
+      std::vector<std::string> fields = SplitFields(line);
+      if (fields.size() == cFIELD_COUNT)
+      {
+         statuses[fields[0]] = fields[4];
+      }
+   }
+   for (const auto& status : statuses)
+   {
+      if (status.second == cSUCCEEDED)
+      {
+         mSucceeded.insert(status.first);
+      }
+   }
+   return true;
+}
+
+bool BatchRun::Manifest::Open(const std::string& aPath, bool aAppend, std::string& aError)
+{
+   // A record that was cut short is ended, so the next record starts on its own line
+   bool needsHeader  = true;
+   bool needsNewline = false;
+   if (aAppend)
+   {
+      std::ifstream previous(aPath, std::ios::binary | std::ios::ate);
+      if (previous && previous.tellg() > 0)
+      {
+         char last = '\n';
+         previous.seekg(-1, std::ios::end);
+         previous.get(last);
+         needsHeader  = false;
+         needsNewline = (last != '\n');
+      }
+   }
+
+   mFile.open(aPath, std::ios::binary | (aAppend ? std::ios::app : std::ios::trunc));
+   if (!mFile)
+   {
+      aError = "Manifest \"" + aPath + "\" could not be opened";
+      return false;
+   }
+   if (needsNewline)
+   {
+      mFile << '\n';
+   }
+   if (needsHeader)
+   {
+      mFile << cHEADER << '\n';
+   }
+   if (!mFile.flush())
+   {
+      aError = "Manifest \"" + aPath + "\" could not be written";
+      return false;
+   }
+   return true;
+}
+
+bool BatchRun::Manifest::Write(const Record& aRecord)
+{
+   char duration[32];
+   std::snprintf(duration, sizeof(duration), "%.3f", aRecord.mDuration_sec);
+
+   std::string line = QuoteField(aRecord.mRunId) + ',' + QuoteField(aRecord.mScenario) + ',' +
+                      QuoteField(aRecord.mCase) + ',' + aRecord.mSeed + ',' + aRecord.mStatus + ',' +
+                      aRecord.mExitCode + ',' + aRecord.mStartTime + ',' + duration + '\n';
+
+   // Each record is flushed as it is written, so it survives an interruption of the batch
+   std::lock_guard<std::mutex> lock(mMutex);
+   mFile << line;
+   return static_cast<bool>(mFile.flush());
+}
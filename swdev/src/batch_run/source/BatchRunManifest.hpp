@@ -0,0 +1,70 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef BATCHRUNMANIFEST_HPP
+#define BATCHRUNMANIFEST_HPP
+
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+
+namespace BatchRun
+{
+//! The outcome of a run, as the manifest records it
+struct Record
+{
+   std::string mRunId;
+   std::string mScenario;
+   std::string mCase;
+   std::string mSeed;      //!< Empty if the run has no seed
+   std::string mStatus;    //!< succeeded, failed, terminated or not_started
+   std::string mExitCode;  //!< The exit code, or the signal that terminated the run.  Empty if it did not start.
+   std::string mStartTime; //!< UTC, in ISO 8601 format
+   double      mDuration_sec;
+};
+
+//! The manifest of a batch is a CSV file with a record for each finished run.  Each record is written as soon as
+//! its run finishes, so the manifest of an interrupted batch tells which runs have to be run again.
+//! When a run is run again, its new record is appended, and the last record of a run is the one that counts.
+class Manifest
+{
+public:
+   //! Reads the runs that succeeded in earlier invocations of the batch.  A missing manifest has no runs.
+   //! @param aPath  is the path of the manifest file
+   //! @param aError describes the failure, if any
+   //! @return whether the manifest could be read
+   bool Read(const std::string& aPath, std::string& aError);
+
+   //! Opens the manifest for writing
+   //! @param aPath   is the path of the manifest file
+   //! @param aAppend tells whether the records of earlier invocations are kept.  If not, the file is replaced.
+   //! @param aError  describes the failure, if any
+   //! @return whether the manifest could be opened
+   bool Open(const std::string& aPath, bool aAppend, std::string& aError);
+
+   //! Returns whether the last record of the run in an earlier invocation says it succeeded
+   bool HasSucceeded(const std::string& aRunId) const { return mSucceeded.count(aRunId) > 0; }
+
+   //! Appends a record to the manifest.  It may be called from several threads at once.
+   //! @return whether the record could be written
+   bool Write(const Record& aRecord);
+
+   static const char* const cSUCCEEDED;
+
+private:
+   std::set<std::string> mSucceeded;
+   std::ofstream         mFile;
+   std::mutex            mMutex;
+};
+} // namespace BatchRun
+
+#endif
@@ -0,0 +1,311 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "BatchRunMatrix.hpp"
+
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+
+#include "BatchRunSystem.hpp"
+
+namespace
+{
+//! The most runs a single seed_range command may add
+const unsigned long cMAX_SEED_RANGE = 1000000;
+
+//! Splits a line of the matrix file into words.  A '#' starts a comment, and double quotes enclose a word that
+//! contains spaces.
+bool SplitWords(const std::string& aLine, std::vector<std::string>& aWords)
+{
+   aWords.clear();
+   size_t i = 0;
+   while (i < aLine.size())
+   {
+      char c = aLine[i];
+      if (std::isspace(static_cast<unsigned char>(c)))
+      {
+         ++i;
+      }
+      else if (c == '#')
+      {
+         break;
+      }
+      else
+      {
+         std::string word;
+         bool        quoted = false;
+         for (; i < aLine.size() && (quoted || !std::isspace(static_cast<unsigned char>(aLine[i]))); ++i)
+         {
+            if (aLine[i] == '"')
+            {
+               quoted = !quoted;
+            }
+            else
+            {
+               word += aLine[i];
+            }
+         }
+         if (quoted)
+         {
+            return false;
+         }
+         aWords.push_back(word);
+      }
+   }
+   return true;
+}
+
+//! Parses a seed.  The random_seed command of the simulation requires a positive integer.
+bool ParseSeed(const std::string& aWord, unsigned long& aSeed)
+{
+   if (aWord.empty() || !std::isdigit(static_cast<unsigned char>(aWord[0])))
+   {
+      return false;
+   }
+   char* end = nullptr;
+   errno     = 0;
+   aSeed     = std::strtoul(aWord.c_str(), &end, 10);
+   return *end == '\0' && errno == 0 && aSeed > 0;
+}
+
+//! Case names become part of the names of the run directories, so they are limited to portable file name characters
+bool IsValidCaseName(const std::string& aName)
+{
+   for (char c : aName)
+   {
+      if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '.' && c != '-')
+      {
+         return false;
+      }
+   }
+   return !aName.empty() && aName[0] != '.';
+}
+
+//! Returns whether aName can be the name of a $define variable
+bool IsValidVariableName(const std::string& aName)
+{
+   for (char c : aName)
+   {
+      if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+      {
+         return false;
+      }
+   }
+   return !aName.empty();
+}
+} // namespace
+
+bool BatchRun::Matrix::Load(const std::string& aPath, std::string& aError)
+{
+   *this = Matrix();
+   std::ifstream file(aPath);
+   if (!file)
+   {
+      aError = "Matrix file \"" + aPath + "\" could not be opened";
+      return false;
+   }
+
+   // The run processes start in their own directories, so the relative paths are made absolute
+   std::string              directory = JoinPath(CurrentDirectory(), DirectoryOf(aPath));
+   std::string              line;
+   std::vector<std::string> words;
+   for (int lineNumber = 1; std::getline(file, line); ++lineNumber)
+   {
+      if (!line.empty() && line.back() == '\r')
+      {
+         line.pop_back();
+      }
+      std::string error = "Unmatched quote";
+      bool        ok    = SplitWords(line, words);
+      if (ok && !words.empty())
+      {
+         ok = ProcessCommand(words, directory, error);
+      }
+      if (!ok)
+      {
+         aError = aPath + ", line " + std::to_string(lineNumber) + ": " + error;
+         return false;
+      }
+   }
+
+   if (mScenarios.empty())
+   {
+      aError = aPath + ": No scenario files were specified";
+      return false;
+   }
+   if (mCases.empty())
+   {
+      mCases.push_back(Case{"default", {}});
+   }
+   if (mOutputDirectory.empty())
+   {
+      mOutputDirectory = JoinPath(directory, FileStem(aPath) + "_runs");
+   }
+   std::set<std::string> ids;
+   for (const auto& run : GetRuns())
+   {
+      if (!ids.insert(run.mId).second)
+      {
+         aError = aPath + ": More than one run is named " + run.mId +
+                  ". The names of the scenario files must differ, and seeds and cases may not be repeated.";
+         return false;
+      }
+   }
+   return true;
+}
+
+std::vector<BatchRun::Run> BatchRun::Matrix::GetRuns() const
+{
+   std::vector<Run> runs;
+   runs.reserve(GetRunCount());
+   for (const auto& scenario : mScenarios)
+   {
+      std::string stem = FileStem(scenario);
+      for (const auto& runCase : mCases)
+      {
+         std::string id = stem + '-' + runCase.mName;
+         if (mSeeds.empty())
+         {
+            runs.push_back(Run{id, scenario, &runCase, false, 0});
+         }
+         for (unsigned long seed : mSeeds)
+         {
+            runs.push_back(Run{id + '-' + std::to_string(seed), scenario, &runCase, true, seed});
+         }
+      }
+   }
+   return runs;
+}
+
+std::vector<std::string> BatchRun::Matrix::GetCommand() const
+{
+   std::vector<std::string> command(1, mApplication);
+   command.insert(command.end(), mArguments.begin(), mArguments.end());
+   return command;
+}
+
+bool BatchRun::Matrix::ProcessCommand(const std::vector<std::string>& aWords,
+                                      const std::string&              aDirectory,
+                                      std::string&                    aError)
+{
+   const std::string& command = aWords[0];
+   size_t             count   = aWords.size() - 1;
+   if (command == "application" || command == "output_directory")
+   {
+      if (count != 1)
+      {
+         aError = command + " requires one value";
+         return false;
+      }
+      if (command == "output_directory")
+      {
+         mOutputDirectory = JoinPath(aDirectory, aWords[1]);
+      }
+      else if (aWords[1].find_first_of("/\\") != std::string::npos)
+      {
+         mApplication = JoinPath(aDirectory, aWords[1]);
+      }
+      else
+      {
+         // A program without a directory is found with the PATH
+         mApplication = aWords[1];
+      }
+   }
+   else if (command == "arguments")
+   {
+      mArguments.insert(mArguments.end(), aWords.begin() + 1, aWords.end());
+   }
+   else if (command == "scenario")
+   {
+      if (count == 0)
+      {
+         aError = "scenario requires at least one file";
+         return false;
+      }
+      for (size_t i = 1; i < aWords.size(); ++i)
+      {
+         // The scenario is read with an include command, which does not accept spaces in file names
+         std::string scenario = JoinPath(aDirectory, aWords[i]);
+         if (scenario.find_first_of(" \t") != std::string::npos)
+         {
+            aError = "The path of scenario file " + scenario + " may not contain spaces";
+            return false;
+         }
+         mScenarios.push_back(scenario);
+      }
+   }
+   else if (command == "case")
+   {
+      if (count == 0 || !IsValidCaseName(aWords[1]))
+      {
+         aError = "case requires a name of letters, digits, '_', '.' and '-'";
+         return false;
+      }
+      Case runCase{aWords[1], {}};
+      for (size_t i = 2; i < aWords.size(); ++i)
+      {
+         size_t equals = aWords[i].find('=');
+         if (equals == std::string::npos || !IsValidVariableName(aWords[i].substr(0, equals)))
+         {
+            aError = "Expected <variable>=<value> instead of " + aWords[i];
+            return false;
+         }
+         runCase.mDefines.emplace_back(aWords[i].substr(0, equals), aWords[i].substr(equals + 1));
+      }
+      mCases.push_back(runCase);
+   }
+   else if (command == "seed")
+   {
+      if (count == 0)
+      {
+         aError = "seed requires at least one value";
+         return false;
+      }
+      for (size_t i = 1; i < aWords.size(); ++i)
+      {
+         unsigned long seed = 0;
+         if (!ParseSeed(aWords[i], seed))
+         {
+            aError = "A seed must be a positive integer instead of " + aWords[i];
+            return false;
+         }
+         mSeeds.push_back(seed);
+      }
+   }
+   else if (command == "seed_range")
+   {
+      unsigned long first = 0;
+      unsigned long last  = 0;
+      if (count != 2 || !ParseSeed(aWords[1], first) || !ParseSeed(aWords[2], last) || last < first)
+      {
+         aError = "seed_range requires a first and a last seed, which are positive integers";
+         return false;
+      }
+      if (last - first >= cMAX_SEED_RANGE)
+      {
+         aError = "seed_range may add at most " + std::to_string(cMAX_SEED_RANGE) + " seeds";
+         return false;
+      }
+      for (unsigned long seed = first; seed <= last; ++seed)
+      {
+         mSeeds.push_back(seed);
+      }
+   }
+   else
+   {
+      aError = "Unknown command: " + command;
+      return false;
+   }
+   return true;
+}
@@ -0,0 +1,75 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef BATCHRUNMATRIX_HPP
+#define BATCHRUNMATRIX_HPP
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace BatchRun
+{
+//! A named set of $define values that override the defaults of the scenario's variables
+struct Case
+{
+   std::string                                      mName;
+   std::vector<std::pair<std::string, std::string>> mDefines;
+};
+
+//! One run of the batch
+struct Run
+{
+   std::string   mId;       //!< Identifies the run in the manifest, and names its directory
+   std::string   mScenario; //!< The absolute path of the scenario file
+   const Case*   mCase;
+   bool          mHasSeed;
+   unsigned long mSeed;
+};
+
+//! The run matrix of a batch, read from a matrix file.  The batch runs every scenario with every case and every
+//! seed.  The relative paths of the matrix file are relative to the directory of the matrix file.
+//! See doc/batch_run.rst for the commands of the matrix file.
+class Matrix
+{
+public:
+   //! Reads a matrix file
+   //! @param aPath  is the path of the matrix file
+   //! @param aError describes the failure, if any
+   //! @return whether the matrix file was valid
+   bool Load(const std::string& aPath, std::string& aError);
+
+   //! Returns the runs of the batch, in scenario, case, seed order
+   std::vector<Run> GetRuns() const;
+
+   //! Returns the program and the arguments that precede the input files of a run
+   std::vector<std::string> GetCommand() const;
+
+   //! Returns the directory that holds the manifest and the run directories.  Unless the matrix file specifies it, it
+   //! is <matrix-file-name>_runs next to the matrix file.
+   const std::string& GetOutputDirectory() const { return mOutputDirectory; }
+
+   size_t GetRunCount() const { return mScenarios.size() * mCases.size() * std::max<size_t>(mSeeds.size(), 1); }
+
+private:
+   bool ProcessCommand(const std::vector<std::string>& aWords, const std::string& aDirectory, std::string& aError);
+
+   std::string                mApplication{"mission"};
+   std::vector<std::string>   mArguments;
+   std::string                mOutputDirectory;
+   std::vector<std::string>   mScenarios;
+   std::vector<Case>          mCases;
+   std::vector<unsigned long> mSeeds;
+};
+} // namespace BatchRun
+
+#endif
@@ -0,0 +1,335 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "BatchRunSystem.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#include <mutex>
+
+#include <direct.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#ifdef _WIN32
+const char* const cSEPARATORS = "/\\";
+#else
+const char* const cSEPARATORS = "/";
+#endif
+
+bool IsDirectory(const std::string& aPath)
+{
+#ifdef _WIN32
+   struct _stat64 status;
+   return _stat64(aPath.c_str(), &status) == 0 && (status.st_mode & _S_IFDIR) != 0;
+#else
+   struct stat status;
+   return stat(aPath.c_str(), &status) == 0 && S_ISDIR(status.st_mode);
+#endif
+}
+
+#ifdef _WIN32
+//! Quotes an argument of a command line so the C runtime of the process parses it back unchanged
+std::string QuoteArgument(const std::string& aArgument)
+{
+   if (!aArgument.empty() && aArgument.find_first_of(" \t\n\v\"") == std::string::npos)
+   {
+      return aArgument;
+   }
+   std::string quoted = "\"";
+   size_t      backslashes = 0;
+   for (char c : aArgument)
+   {
+      if (c == '\\')
+      {
+         ++backslashes;
+         continue;
+      }
+      // Backslashes are only special before a quote
+      quoted.append(c == '"' ? 2 * backslashes + 1 : backslashes, '\\');
+      quoted += c;
+      backslashes = 0;
+   }
+   quoted.append(2 * backslashes, '\\');
+   quoted += '"';
+   return quoted;
+}
+
+//! Serializes creating the inheritable handles of a process and the process, so that a process does not inherit
+//! the handles created for another process started at the same time
+std::mutex sCreateProcessMutex;
+#endif
+} // namespace
+
+std::string BatchRun::CurrentDirectory()
+{
+   std::vector<char> buffer(4096);
+   while (true)
+   {
+#ifdef _WIN32
+      if (_getcwd(buffer.data(), static_cast<int>(buffer.size())) != nullptr)
+#else
+      if (getcwd(buffer.data(), buffer.size()) != nullptr)
+#endif
+      {
+         return buffer.data();
+      }
+      if (errno != ERANGE)
+      {
+         return ".";
+      }
+      buffer.resize(buffer.size() * 2);
+   }
+}
+
+bool BatchRun::IsAbsolutePath(const std::string& aPath)
+{
+#ifdef _WIN32
+   // A path that starts with a separator is relative to the current drive, which is as good as absolute here
+   return (!aPath.empty() && (aPath[0] == '/' || aPath[0] == '\\')) || (aPath.size() > 1 && aPath[1] == ':');
+#else
+   return !aPath.empty() && aPath[0] == '/';
+#endif
+}
+
+std::string BatchRun::JoinPath(const std::string& aDirectory, const std::string& aPath)
+{
+   if (aDirectory.empty() || IsAbsolutePath(aPath))
+   {
+      return aPath;
+   }
+   // Leading "./" only makes the paths in the logs and the manifest harder to read
+   if (aPath == ".")
+   {
+      return aDirectory;
+   }
+   if (aPath.size() > 2 && aPath[0] == '.' && std::strchr(cSEPARATORS, aPath[1]) != nullptr)
+   {
+      return JoinPath(aDirectory, aPath.substr(2));
+   }
+   if (std::strchr(cSEPARATORS, aDirectory.back()) != nullptr)
+   {
+      return aDirectory + aPath;
+   }
+   return aDirectory + '/' + aPath;
+}
+
+std::string BatchRun::DirectoryOf(const std::string& aPath)
+{
+   size_t separator = aPath.find_last_of(cSEPARATORS);
+   if (separator == std::string::npos)
+   {
+      return ".";
+   }
+   return (separator == 0) ? aPath.substr(0, 1) : aPath.substr(0, separator);
+}
+
+std::string BatchRun::FileStem(const std::string& aPath)
+{
+   size_t      separator = aPath.find_last_of(cSEPARATORS);
+   std::string name      = (separator == std::string::npos) ? aPath : aPath.substr(separator + 1);
+   size_t      extension = name.rfind('.');
+   return (extension == std::string::npos || extension == 0) ? name : name.substr(0, extension);
+}
+
+bool BatchRun::MakeDirectories(const std::string& aPath)
+{
+   if (aPath.empty() || IsDirectory(aPath))
+   {
+      return !aPath.empty();
+   }
+   // Create the parents first.  A directory may also be created by another thread at the same time, so only the
+   // final check tells whether this succeeded.
+   size_t separator = aPath.find_last_of(cSEPARATORS);
+   if (separator != std::string::npos && separator > 0)
+   {
+      MakeDirectories(aPath.substr(0, separator));
+   }
+#ifdef _WIN32
+   _mkdir(aPath.c_str());
+#else
+   mkdir(aPath.c_str(), 0777);
+#endif
+   return IsDirectory(aPath);
+}
+
+#ifdef _WIN32
+
+BatchRun::ProcessResult BatchRun::RunProcess(const std::vector<std::string>& aCommand,
+                                             const std::string&              aDirectory,
+                                             const std::string&              aOutputPath,
+                                             const std::string&              aErrorPath)
+{
+   ProcessResult result;
+   std::string   commandLine;
+   for (const auto& argument : aCommand)
+   {
+      commandLine += (commandLine.empty() ? "" : " ") + QuoteArgument(argument);
+   }
+
+   PROCESS_INFORMATION process{};
+   {
+      std::lock_guard<std::mutex> lock(sCreateProcessMutex);
+
+      SECURITY_ATTRIBUTES inherit{sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE};
+      HANDLE              input =
+         CreateFileA("NUL", GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, &inherit, OPEN_EXISTING, 0, nullptr);
+      HANDLE output =
+         CreateFileA(aOutputPath.c_str(), GENERIC_WRITE, FILE_SHARE_READ, &inherit, CREATE_ALWAYS, 0, nullptr);
+      HANDLE error =
+         CreateFileA(aErrorPath.c_str(), GENERIC_WRITE, FILE_SHARE_READ, &inherit, CREATE_ALWAYS, 0, nullptr);
+
+      BOOL  created   = FALSE;
+      DWORD errorCode = 0;
+      if (input == INVALID_HANDLE_VALUE || output == INVALID_HANDLE_VALUE || error == INVALID_HANDLE_VALUE)
+      {
+         result.mMessage = "The log files \"" + aOutputPath + "\" and \"" + aErrorPath + "\" could not be opened";
+      }
+      else
+      {
+         STARTUPINFOA startup{};
+         startup.cb         = sizeof(startup);
+         startup.dwFlags    = STARTF_USESTDHANDLES;
+         startup.hStdInput  = input;
+         startup.hStdOutput = output;
+         startup.hStdError  = error;
+         created            = CreateProcessA(nullptr,
+                                  &commandLine[0],
+                                  nullptr,
+                                  nullptr,
+                                  TRUE,
+                                  CREATE_NO_WINDOW,
+                                  nullptr,
+                                  aDirectory.c_str(),
+                                  &startup,
+                                  &process);
+         errorCode          = GetLastError();
+      }
+      for (HANDLE handle : {input, output, error})
+      {
+         if (handle != INVALID_HANDLE_VALUE)
+         {
+            CloseHandle(handle);
+         }
+      }
+      if (!created)
+      {
+         if (result.mMessage.empty())
+         {
+            result.mMessage = aCommand[0] + " could not be started (error " + std::to_string(errorCode) + ")";
+         }
+         return result;
+      }
+   }
+
+   DWORD exitCode = 0;
+   WaitForSingleObject(process.hProcess, INFINITE);
+   GetExitCodeProcess(process.hProcess, &exitCode);
+   CloseHandle(process.hThread);
+   CloseHandle(process.hProcess);
+   result.mStatus = ProcessResult::cEXITED;
+   result.mCode   = static_cast<int>(exitCode);
+   return result;
+}
+
+#else
+
+BatchRun::ProcessResult BatchRun::RunProcess(const std::vector<std::string>& aCommand,
+                                             const std::string&              aDirectory,
+                                             const std::string&              aOutputPath,
+                                             const std::string&              aErrorPath)
+{
+   ProcessResult result;
+
+   // Everything the child needs is prepared before the fork, because only async-signal-safe functions may be
+   // called in the child of a multithreaded process.  The files are opened close-on-exec so that the processes
+   // started by other threads do not inherit them.
+   std::vector<char*> arguments;
+   for (const auto& argument : aCommand)
+   {
+      arguments.push_back(const_cast<char*>(argument.c_str()));
+   }
+   arguments.push_back(nullptr);
+   std::string execError = "batch_run: " + aCommand[0] + " could not be started\n";
+
+   int input  = open("/dev/null", O_RDONLY | O_CLOEXEC);
+   int output = open(aOutputPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+   int error  = open(aErrorPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+   pid_t pid  = -1;
+   if (input >= 0 && output >= 0 && error >= 0)
+   {
+      pid = fork();
+      if (pid == 0)
+      {
+         if (dup2(input, STDIN_FILENO) >= 0 && dup2(output, STDOUT_FILENO) >= 0 && dup2(error, STDERR_FILENO) >= 0 &&
+             chdir(aDirectory.c_str()) == 0)
+         {
+            execvp(arguments[0], arguments.data());
+         }
+         ssize_t written = write(STDERR_FILENO, execError.data(), execError.size());
+         static_cast<void>(written);
+         _exit(127);
+      }
+      else if (pid < 0)
+      {
+         result.mMessage = aCommand[0] + " could not be started: " + std::strerror(errno);
+      }
+   }
+   else
+   {
+      result.mMessage = "The log files \"" + aOutputPath + "\" and \"" + aErrorPath + "\" could not be opened";
+   }
+   for (int descriptor : {input, output, error})
+   {
+      if (descriptor >= 0)
+      {
+         close(descriptor);
+      }
+   }
+   if (pid < 0)
+   {
+      return result;
+   }
+
+   int status = 0;
+   while (waitpid(pid, &status, 0) < 0)
+   {
+      if (errno != EINTR)
+      {
+         result.mMessage = "The process of " + aCommand[0] + " was lost: " + std::strerror(errno);
+         return result;
+      }
+   }
+   if (WIFSIGNALED(status))
+   {
+      result.mStatus = ProcessResult::cTERMINATED;
+      result.mCode   = WTERMSIG(status);
+   }
+   else
+   {
+      result.mStatus = ProcessResult::cEXITED;
+      result.mCode   = WEXITSTATUS(status);
+   }
+   return result;
+}
+
+#endif
@@ -0,0 +1,66 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef BATCHRUNSYSTEM_HPP
+#define BATCHRUNSYSTEM_HPP
+
+#include <string>
+#include <vector>
+
+//! The operating system services batch_run needs: paths, directories and processes.
+namespace BatchRun
+{
+//! Returns the current working directory
+std::string CurrentDirectory();
+
+bool IsAbsolutePath(const std::string& aPath);
+
+//! Returns aPath if it is absolute, or else aPath relative to aDirectory
+std::string JoinPath(const std::string& aDirectory, const std::string& aPath);
+
+//! Returns the directory part of a path, or "." if the path has none
+std::string DirectoryOf(const std::string& aPath);
+
+//! Returns the file name of a path without its directory and extension
+std::string FileStem(const std::string& aPath);
+
+//! Creates a directory and its missing parents
+//! @return whether the directory exists
+bool MakeDirectories(const std::string& aPath);
+
+//! The outcome of a process
+struct ProcessResult
+{
+   enum Status
+   {
+      cEXITED,     //!< The process exited with mCode
+      cTERMINATED, //!< The process was terminated by signal mCode
+      cNOT_STARTED //!< The process could not be started.  mMessage tells why.
+   };
+
+   Status      mStatus{cNOT_STARTED};
+   int         mCode{0};
+   std::string mMessage;
+};
+
+//! Runs a process and waits for it to finish.  The process's standard input is empty, and its standard output and
+//! standard error are written to the given files.  Processes may be run from several threads at once.
+//! @param aCommand    is the program followed by its arguments.  A program without a directory is found with the PATH.
+//! @param aDirectory  is the working directory of the process
+//! @param aOutputPath is the file that receives the standard output.  It is replaced.
+//! @param aErrorPath  is the file that receives the standard error.  It is replaced.
+ProcessResult RunProcess(const std::vector<std::string>& aCommand,
+                         const std::string&              aDirectory,
+                         const std::string&              aOutputPath,
+                         const std::string&              aErrorPath);
+} // namespace BatchRun
+
+#endif
@@ -0,0 +1,343 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+//! batch_run runs the runs of a batch (scenario files x cases of $define values x random seeds, see
+//! BatchRun::Matrix) as simulation processes on the local machine, several at once.  Each run has its own directory,
+//! which receives its output files and the logs of its standard output and standard error.  The outcome and timing
+//! of each run are recorded in the manifest of the batch (see BatchRun::Manifest), which lets an interrupted batch
+//! resume with the runs that did not succeed.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BatchRunManifest.hpp"
+#include "BatchRunMatrix.hpp"
+#include "BatchRunSystem.hpp"
+
+namespace
+{
+void ShowUsage(const std::string& aName)
+{
+   // clang-format off
+   std::cerr << "Usage: " << aName << " <option(s)> MATRIX_FILE\n"
+             << "Runs the runs of the batch described by the matrix file, and records their outcomes in the\n"
+             << "manifest.csv file of the output directory. Runs that succeeded before are not run again.\n"
+             << "Options:\n"
+             << "\t-h,--help\t\t\tShow this help message.\n"
+             << "\t-j,--jobs <count>\t\tSpecify the number of runs at once.\n"
+             << "\t\t\t\t\tThe default is the number of processors.\n"
+             << "\t-o,--output <directory>\t\tSpecify the output directory, instead of the matrix file's.\n"
+             << "\t-r,--restart\t\t\tRun every run, discarding the manifest of earlier invocations.\n"
+             << "\t-n,--dry-run\t\t\tList the runs that would be run, without running them.\n"
+             << std::endl;
+   // clang-format on
+}
+
+//! Calls aFunction for each of aCount runs, with up to aJobs calls at once
+void ForEachRun(size_t aCount, unsigned int aJobs, const std::function<void(size_t)>& aFunction)
+{
+   std::atomic<size_t>      next(0);
+   std::vector<std::thread> threads;
+   auto                     work = [&]()
+   {
+      for (size_t i = next++; i < aCount; i = next++)
+      {
+         aFunction(i);
+      }
+   };
+   for (unsigned int i = 1; i < std::min<size_t>(aJobs, aCount); ++i)
+   {
+      threads.emplace_back(work);
+   }
+   work();
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+}
+
+//! Returns the current time (UTC) in ISO 8601 format
+std::string CurrentTime()
+{
+   std::time_t now = std::time(nullptr);
+   std::tm     utc;
+#ifdef _WIN32
+   gmtime_s(&utc, &now);
+#else
+   gmtime_r(&now, &utc);
+#endif
+   char text[32];
+   std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", &utc);
+   return text;
+}
+
+//! Writes the input file of a run.  It defines the variables of the run's case, includes the scenario, and then
+//! sets the run's seed, so the seed replaces any random_seed of the scenario.  The scenario may also use the
+//! BATCH_RUN_ID and BATCH_RUN_SEED variables, for instance to name its output files.
+bool WriteInputFile(const BatchRun::Run& aRun, const std::string& aPath)
+{
+   std::ofstream file(aPath, std::ios::trunc);
+   file << "# Generated by batch_run\n";
+   file << "$define BATCH_RUN_ID " << aRun.mId << '\n';
+   if (aRun.mHasSeed)
+   {
+      file << "$define BATCH_RUN_SEED " << aRun.mSeed << '\n';
+   }
+   for (const auto& define : aRun.mCase->mDefines)
+   {
+      file << "$define " << define.first << ' ' << define.second << '\n';
+   }
+   file << "include " << aRun.mScenario << '\n';
+   if (aRun.mHasSeed)
+   {
+      file << "random_seed " << aRun.mSeed << '\n';
+   }
+   return static_cast<bool>(file.flush());
+}
+
+//! Runs a run, and returns its record for the manifest
+BatchRun::Record Execute(const BatchRun::Run&            aRun,
+                         const std::vector<std::string>& aCommand,
+                         const std::string&              aOutputDirectory,
+                         std::string&                    aMessage)
+{
+   BatchRun::Record record;
+   record.mRunId        = aRun.mId;
+   record.mScenario     = aRun.mScenario;
+   record.mCase         = aRun.mCase->mName;
+   record.mSeed         = aRun.mHasSeed ? std::to_string(aRun.mSeed) : std::string();
+   record.mStatus       = "not_started";
+   record.mStartTime    = CurrentTime();
+   record.mDuration_sec = 0.0;
+
+   // A run that is run again replaces the files of its earlier attempt
+   std::string directory = BatchRun::JoinPath(aOutputDirectory, aRun.mId);
+   std::string inputFile = BatchRun::JoinPath(directory, "run.txt");
+   if (!BatchRun::MakeDirectories(directory))
+   {
+      aMessage = "Run directory \"" + directory + "\" could not be created";
+      return record;
+   }
+   if (!WriteInputFile(aRun, inputFile))
+   {
+      aMessage = "Input file \"" + inputFile + "\" could not be written";
+      return record;
+   }
+
+   std::vector<std::string> command = aCommand;
+   command.push_back(inputFile);
+   auto                    start   = std::chrono::steady_clock::now();
+   BatchRun::ProcessResult result  = BatchRun::RunProcess(command,
+                                                         directory,
+                                                         BatchRun::JoinPath(directory, "stdout.log"),
+                                                         BatchRun::JoinPath(directory, "stderr.log"));
+   record.mDuration_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+   switch (result.mStatus)
+   {
+   case BatchRun::ProcessResult::cEXITED:
+      record.mStatus   = (result.mCode == 0) ? BatchRun::Manifest::cSUCCEEDED : "failed";
+      record.mExitCode = std::to_string(result.mCode);
+      if (result.mCode != 0)
+      {
+         aMessage = "exit code " + record.mExitCode + ", see " + BatchRun::JoinPath(directory, "stderr.log");
+      }
+      break;
+   case BatchRun::ProcessResult::cTERMINATED:
+      record.mStatus   = "terminated";
+      record.mExitCode = std::to_string(result.mCode);
+      aMessage         = "terminated by signal " + record.mExitCode;
+      break;
+   default:
+      aMessage = result.mMessage;
+      break;
+   }
+   return record;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+   std::ios::sync_with_stdio(false);
+   std::string  matrixFile;
+   std::string  outputDirectory;
+   bool         restart = false;
+   bool         dryRun  = false;
+   unsigned int jobs    = std::max(1u, std::thread::hardware_concurrency());
+   for (int i = 1; i < argc; ++i)
+   {
+      std::string arg      = argv[i];
+      bool        hasValue = i + 1 < argc;
+      if (arg == "-h" || arg == "--help")
+      {
+         ShowUsage(argv[0]);
+         return 0;
+      }
+      else if (arg == "-r" || arg == "--restart")
+      {
+         restart = true;
+      }
+      else if (arg == "-n" || arg == "--dry-run")
+      {
+         dryRun = true;
+      }
+      else if (arg == "-j" || arg == "--jobs" || arg == "-o" || arg == "--output")
+      {
+         if (!hasValue)
+         {
+            std::cerr << arg << " option requires one argument." << std::endl;
+            return 1;
+         }
+         const char* value = argv[++i];
+         if (arg == "-o" || arg == "--output")
+         {
+            outputDirectory = BatchRun::JoinPath(BatchRun::CurrentDirectory(), value);
+         }
+         else
+         {
+            int count = std::atoi(value);
+            if (count < 1)
+            {
+               std::cerr << arg << " option requires a positive number." << std::endl;
+               return 1;
+            }
+            jobs = static_cast<unsigned int>(count);
+         }
+      }
+      else if (matrixFile.empty())
+      {
+         matrixFile = arg;
+      }
+      else
+      {
+         std::cerr << "Only one matrix file may be specified." << std::endl;
+         return 1;
+      }
+   }
+   if (matrixFile.empty())
+   {
+      ShowUsage(argv[0]);
+      return 1;
+   }
+
+   BatchRun::Matrix matrix;
+   std::string      error;
+   if (!matrix.Load(matrixFile, error))
+   {
+      std::cerr << "*ERROR: " << error << std::endl;
+      return 1;
+   }
+   if (outputDirectory.empty())
+   {
+      outputDirectory = matrix.GetOutputDirectory();
+   }
+   std::vector<std::string> command      = matrix.GetCommand();
+   std::string              manifestFile = BatchRun::JoinPath(outputDirectory, "manifest.csv");
+
+   BatchRun::Manifest manifest;
+   if (!restart && !manifest.Read(manifestFile, error))
+   {
+      std::cerr << "*ERROR: " << error << std::endl;
+      return 1;
+   }
+
+   std::vector<BatchRun::Run> runs = matrix.GetRuns();
+   std::vector<BatchRun::Run> pending;
+   for (const auto& run : runs)
+   {
+      if (!manifest.HasSucceeded(run.mId))
+      {
+         pending.push_back(run);
+      }
+   }
+   size_t skipped = runs.size() - pending.size();
+
+   if (dryRun)
+   {
+      for (const auto& run : pending)
+      {
+         std::cout << run.mId << ':';
+         for (const auto& word : command)
+         {
+            std::cout << ' ' << word;
+         }
+         std::cout << ' ' << BatchRun::JoinPath(BatchRun::JoinPath(outputDirectory, run.mId), "run.txt") << '\n';
+      }
+      std::cout << pending.size() << " of " << runs.size() << " runs would be run in " << outputDirectory << std::endl;
+      return 0;
+   }
+
+   if (!BatchRun::MakeDirectories(outputDirectory))
+   {
+      std::cerr << "*ERROR: Output directory \"" << outputDirectory << "\" could not be created" << std::endl;
+      return 1;
+   }
+   if (!manifest.Open(manifestFile, !restart, error))
+   {
+      std::cerr << "*ERROR: " << error << std::endl;
+      return 1;
+   }
+
+   std::cout << "Running " << pending.size() << " of " << runs.size() << " runs, "
+             << std::min<size_t>(jobs, pending.size()) << " at once, in " << outputDirectory << std::endl;
+
+   std::mutex          outputMutex;
+   std::atomic<size_t> finished(0);
+   std::atomic<size_t> succeeded(0);
+   bool                manifestOk = true;
+   ForEachRun(pending.size(),
+              jobs,
+              [&](size_t aRun)
+              {
+                 std::string      message;
+                 BatchRun::Record record = Execute(pending[aRun], command, outputDirectory, message);
+                 bool             ok     = record.mStatus == BatchRun::Manifest::cSUCCEEDED;
+                 bool             saved  = manifest.Write(record);
+                 if (ok)
+                 {
+                    ++succeeded;
+                 }
+
+                 std::lock_guard<std::mutex> lock(outputMutex);
+                 manifestOk = manifestOk && saved;
+                 std::cout << '[' << ++finished << '/' << pending.size() << "] " << record.mRunId << ' '
+                           << record.mStatus << " in " << static_cast<long>(record.mDuration_sec + 0.5) << " s";
+                 if (!message.empty())
+                 {
+                    std::cout << " (" << message << ')';
+                 }
+                 std::cout << std::endl;
+              });
+
+   size_t failed = pending.size() - succeeded;
+   std::cout << succeeded << " runs succeeded, " << failed << " did not";
+   if (skipped > 0)
+   {
+      std::cout << ", and " << skipped << " had succeeded before";
+   }
+   std::cout << ". See " << manifestFile << std::endl;
+   if (!manifestOk)
+   {
+      std::cerr << "*ERROR: The manifest \"" << manifestFile << "\" could not be written" << std::endl;
+   }
+   return (failed == 0 && manifestOk) ? 0 : 1;
+}
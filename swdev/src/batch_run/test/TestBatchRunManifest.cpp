@@ -0,0 +1,149 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BatchRunManifest.hpp"
+
+namespace
+{
+const char* const cHEADER = "run,scenario,case,seed,status,exit_code,start_time,duration_s\n";
+
+BatchRun::Record MakeRecord(const std::string& aRunId, const std::string& aStatus)
+{
+   return BatchRun::Record{aRunId, "/data/a.txt", "default", "1", aStatus, "0", "2022-01-01T00:00:00Z", 1.5};
+}
+} // namespace
+
+// Each test writes its manifest in the working directory
+class BatchRunManifestTest : public ::testing::Test
+{
+protected:
+   void TearDown() override { std::remove(mPath.c_str()); }
+
+   void WriteFile(const std::string& aText) { std::ofstream(mPath, std::ios::binary) << aText; }
+
+   std::string ReadFile() const
+   {
+      std::ostringstream text;
+      text << std::ifstream(mPath, std::ios::binary).rdbuf();
+      return text.str();
+   }
+
+   //! Opens the manifest and writes the records
+   void Append(bool aAppend, const std::vector<BatchRun::Record>& aRecords)
+   {
+      BatchRun::Manifest manifest;
+      ASSERT_TRUE(manifest.Open(mPath, aAppend, mError)) << mError;
+      for (const auto& record : aRecords)
+      {
+         EXPECT_TRUE(manifest.Write(record));
+      }
+   }
+
+   //! Reads the manifest
+   bool Read()
+   {
+      mError.clear();
+      return mManifest.Read(mPath, mError);
+   }
+
+   const std::string  mPath{"batch_run_test_manifest.csv"};
+   BatchRun::Manifest mManifest;
+   std::string        mError;
+};
+
+TEST_F(BatchRunManifestTest, MissingFile)
+{
+   EXPECT_TRUE(Read()) << mError;
+   EXPECT_FALSE(mManifest.HasSucceeded("a-default-1"));
+}
+
+TEST_F(BatchRunManifestTest, NotAManifest)
+{
+   WriteFile("run,scenario\na-default-1,/data/a.txt\n");
+   EXPECT_FALSE(Read());
+   EXPECT_EQ(mError, "\"" + mPath + "\" is not a batch_run manifest");
+}
+
+TEST_F(BatchRunManifestTest, RoundTrip)
+{
+   Append(false, {MakeRecord("a-default-1", BatchRun::Manifest::cSUCCEEDED), MakeRecord("a-default-2", "failed")});
+   EXPECT_EQ(ReadFile(),
+             std::string(cHEADER) + "a-default-1,/data/a.txt,default,1,succeeded,0,2022-01-01T00:00:00Z,1.500\n" +
+                "a-default-2,/data/a.txt,default,1,failed,0,2022-01-01T00:00:00Z,1.500\n");
+
+   ASSERT_TRUE(Read()) << mError;
+   EXPECT_TRUE(mManifest.HasSucceeded("a-default-1"));
+   EXPECT_FALSE(mManifest.HasSucceeded("a-default-2"));
+}
+
+TEST_F(BatchRunManifestTest, QuotedFields)
+{
+   BatchRun::Record record = MakeRecord("a-default-1", BatchRun::Manifest::cSUCCEEDED);
+   record.mScenario        = "/data/a,\"b\".txt";
+   Append(false, {record});
+   EXPECT_NE(ReadFile().find("a-default-1,\"/data/a,\"\"b\"\".txt\",default,"), std::string::npos) << ReadFile();
+
+   ASSERT_TRUE(Read()) << mError;
+   EXPECT_TRUE(mManifest.HasSucceeded("a-default-1"));
+}
+
+TEST_F(BatchRunManifestTest, LastRecordWins)
+{
+   Append(false, {MakeRecord("a-default-1", "failed"), MakeRecord("a-default-2", BatchRun::Manifest::cSUCCEEDED)});
+   Append(true, {MakeRecord("a-default-1", BatchRun::Manifest::cSUCCEEDED), MakeRecord("a-default-2", "terminated")});
+
+   // Appending does not repeat the header
+   std::string text = ReadFile();
+   EXPECT_EQ(text.find("run,scenario"), 0u);
+   EXPECT_EQ(text.find("run,scenario", 1), std::string::npos);
+
+   ASSERT_TRUE(Read()) << mError;
+   EXPECT_TRUE(mManifest.HasSucceeded("a-default-1"));
+   EXPECT_FALSE(mManifest.HasSucceeded("a-default-2"));
+}
+
+TEST_F(BatchRunManifestTest, TruncatedRecord)
+{
+   // The batch was interrupted while the second record of the run was written
+   WriteFile(std::string(cHEADER) + "a-default-1,/data/a.txt,default,1,succeeded,0,2022-01-01T00:00:00Z,1.500\r\n" +
+             "a-default-1,/data/a.txt,default,1,fail");
+   ASSERT_TRUE(Read()) << mError;
+   EXPECT_TRUE(mManifest.HasSucceeded("a-default-1"));
+
+   // The truncated record is ended, so the next record is read
+   Append(true, {MakeRecord("a-default-1", "failed")});
+   EXPECT_NE(ReadFile().find(",fail\na-default-1,"), std::string::npos) << ReadFile();
+   ASSERT_TRUE(Read()) << mError;
+   EXPECT_FALSE(mManifest.HasSucceeded("a-default-1"));
+}
+
+TEST_F(BatchRunManifestTest, Replace)
+{
+   Append(false, {MakeRecord("a-default-1", BatchRun::Manifest::cSUCCEEDED)});
+   Append(false, {MakeRecord("a-default-2", BatchRun::Manifest::cSUCCEEDED)});
+   ASSERT_TRUE(Read()) << mError;
+   EXPECT_FALSE(mManifest.HasSucceeded("a-default-1"));
+   EXPECT_TRUE(mManifest.HasSucceeded("a-default-2"));
+
+   // Appending to an empty file writes the header
+   WriteFile("");
+   Append(true, {MakeRecord("a-default-3", BatchRun::Manifest::cSUCCEEDED)});
+   ASSERT_TRUE(Read()) << mError;
+   EXPECT_TRUE(mManifest.HasSucceeded("a-default-3"));
+}
@@ -0,0 +1,153 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BatchRunMatrix.hpp"
+#include "BatchRunSystem.hpp"
+
+// Each test writes its matrix file in the working directory
+class BatchRunMatrixTest : public ::testing::Test
+{
+protected:
+   void TearDown() override { std::remove(mPath.c_str()); }
+
+   //! Writes the matrix file and loads it
+   bool Load(const std::string& aText)
+   {
+      std::ofstream(mPath, std::ios::binary) << aText;
+      mError.clear();
+      return mMatrix.Load(mPath, mError);
+   }
+
+   //! Returns the ids of the runs, in order
+   std::vector<std::string> GetRunIds() const
+   {
+      std::vector<std::string> ids;
+      for (const auto& run : mMatrix.GetRuns())
+      {
+         ids.push_back(run.mId);
+      }
+      return ids;
+   }
+
+   const std::string mPath{"batch_run_test.txt"};
+   BatchRun::Matrix  mMatrix;
+   std::string       mError;
+};
+
+TEST_F(BatchRunMatrixTest, RunIds)
+{
+   ASSERT_TRUE(Load("# A comment\n"
+                    "scenario a.txt dir/b.txt   # Two scenarios\n"
+                    "case low speed=100 \"label=two words\"\n"
+                    "case high speed=900\n"
+                    "seed 7\n"
+                    "seed_range 2 3\n"))
+      << mError;
+
+   // Scenario, case, seed order
+   const std::vector<std::string> expected{"a-low-7",  "a-low-2",  "a-low-3",  "a-high-7", "a-high-2", "a-high-3",
+                                           "b-low-7",  "b-low-2",  "b-low-3",  "b-high-7", "b-high-2", "b-high-3"};
+   EXPECT_EQ(GetRunIds(), expected);
+   EXPECT_EQ(mMatrix.GetRunCount(), expected.size());
+
+   const std::vector<BatchRun::Run> runs = mMatrix.GetRuns();
+   const std::string                directory = BatchRun::CurrentDirectory();
+   EXPECT_EQ(runs[0].mScenario, BatchRun::JoinPath(directory, "a.txt"));
+   EXPECT_EQ(runs[6].mScenario, BatchRun::JoinPath(directory, "dir/b.txt"));
+   EXPECT_TRUE(runs[0].mHasSeed);
+   EXPECT_EQ(runs[0].mSeed, 7u);
+   EXPECT_EQ(runs[0].mCase->mName, "low");
+   ASSERT_EQ(runs[0].mCase->mDefines.size(), 2u);
+   EXPECT_EQ(runs[0].mCase->mDefines[0], std::make_pair(std::string("speed"), std::string("100")));
+   EXPECT_EQ(runs[0].mCase->mDefines[1], std::make_pair(std::string("label"), std::string("two words")));
+}
+
+TEST_F(BatchRunMatrixTest, Defaults)
+{
+   ASSERT_TRUE(Load("scenario a.txt\r\n")) << mError;
+
+   // Without cases or seeds, there is one run of the default case
+   EXPECT_EQ(GetRunIds(), std::vector<std::string>{"a-default"});
+   const std::vector<BatchRun::Run> runs = mMatrix.GetRuns();
+   EXPECT_FALSE(runs[0].mHasSeed);
+   EXPECT_TRUE(runs[0].mCase->mDefines.empty());
+   EXPECT_EQ(mMatrix.GetCommand(), std::vector<std::string>{"mission"});
+   EXPECT_EQ(mMatrix.GetOutputDirectory(), BatchRun::JoinPath(BatchRun::CurrentDirectory(), "batch_run_test_runs"));
+}
+
+TEST_F(BatchRunMatrixTest, Command)
+{
+   ASSERT_TRUE(Load("application warlock\n"
+                    "arguments -es\n"
+                    "arguments -rt \"a b\"\n"
+                    "output_directory out\n"
+                    "scenario a.txt\n"))
+      << mError;
+   EXPECT_EQ(mMatrix.GetCommand(), (std::vector<std::string>{"warlock", "-es", "-rt", "a b"}));
+   EXPECT_EQ(mMatrix.GetOutputDirectory(), BatchRun::JoinPath(BatchRun::CurrentDirectory(), "out"));
+
+   // A program with a directory is relative to the matrix file
+   ASSERT_TRUE(Load("application bin/mission\nscenario a.txt\n")) << mError;
+   EXPECT_EQ(mMatrix.GetCommand()[0], BatchRun::JoinPath(BatchRun::CurrentDirectory(), "bin/mission"));
+}
+
+TEST_F(BatchRunMatrixTest, Errors)
+{
+   BatchRun::Matrix matrix;
+   EXPECT_FALSE(matrix.Load("batch_run_test_missing.txt", mError));
+   EXPECT_EQ(mError, "Matrix file \"batch_run_test_missing.txt\" could not be opened");
+
+   EXPECT_FALSE(Load("case low\n"));
+   EXPECT_EQ(mError, mPath + ": No scenario files were specified");
+
+   // The line of the first error is reported
+   const std::vector<std::pair<std::string, std::string>> lineErrors{
+      {"frobnicate", "Unknown command: frobnicate"},
+      {"scenario \"a.txt", "Unmatched quote"},
+      {"scenario", "scenario requires at least one file"},
+      {"scenario \"a b.txt\"", "The path of scenario file"},
+      {"application", "application requires one value"},
+      {"output_directory a b", "output_directory requires one value"},
+      {"case", "case requires a name"},
+      {"case a/b", "case requires a name"},
+      {"case .hidden", "case requires a name"},
+      {"case low speed", "Expected <variable>=<value> instead of speed"},
+      {"case low my-speed=1", "Expected <variable>=<value> instead of my-speed=1"},
+      {"seed", "seed requires at least one value"},
+      {"seed 0", "A seed must be a positive integer instead of 0"},
+      {"seed -1", "A seed must be a positive integer instead of -1"},
+      {"seed 12abc", "A seed must be a positive integer instead of 12abc"},
+      {"seed 99999999999999999999999", "A seed must be a positive integer"},
+      {"seed_range 5", "seed_range requires a first and a last seed"},
+      {"seed_range 5 4", "seed_range requires a first and a last seed"},
+      {"seed_range 1 1000001", "seed_range may add at most 1000000 seeds"}};
+   for (const auto& lineError : lineErrors)
+   {
+      EXPECT_FALSE(Load("scenario a.txt\n" + lineError.first + "\n")) << lineError.first;
+      EXPECT_EQ(mError.find(mPath + ", line 2: " + lineError.second), 0u) << mError;
+   }
+
+   // The run ids must be unique
+   EXPECT_FALSE(Load("scenario a.txt dir/a.txt\n"));
+   EXPECT_NE(mError.find("More than one run is named a-default"), std::string::npos) << mError;
+   EXPECT_FALSE(Load("scenario a.txt\nseed 1 2\nseed_range 2 3\n"));
+   EXPECT_NE(mError.find("More than one run is named a-default-2"), std::string::npos) << mError;
+   EXPECT_FALSE(Load("scenario a.txt\ncase x\ncase x\n"));
+   EXPECT_NE(mError.find("More than one run is named a-x"), std::string::npos) << mError;
+}
@@ -0,0 +1,311 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "EvtQueryEvent.hpp"
+
+#include <cstdlib>
+
+namespace
+{
+// The character classes of the evt_filter.pl regular expressions (\s, \d and [\w\-])
+bool IsSpace(char aChar)
+{
+   return aChar == ' ' || aChar == '\t' || aChar == '\n' || aChar == '\r' || aChar == '\f' || aChar == '\v';
+}
+
+bool IsDigit(char aChar)
+{
+   return aChar >= '0' && aChar <= '9';
+}
+
+bool IsNameChar(char aChar)
+{
+   return IsDigit(aChar) || (aChar >= 'a' && aChar <= 'z') || (aChar >= 'A' && aChar <= 'Z') || aChar == '_' ||
+          aChar == '-';
+}
+
+//! A whitespace-separated word of an event line, as [begin, end) character positions
+struct Word
+{
+   size_t mBegin;
+   size_t mEnd;
+};
+
+//! Splits off the first aMaxWords words of the line
+std::vector<Word> SplitWords(const std::string& aLine, size_t aMaxWords)
+{
+   std::vector<Word> words;
+   size_t            pos = 0;
+   while (words.size() < aMaxWords)
+   {
+      while (pos < aLine.size() && IsSpace(aLine[pos]))
+      {
+         ++pos;
+      }
+      if (pos == aLine.size())
+      {
+         break;
+      }
+      Word word{pos, pos};
+      while (word.mEnd < aLine.size() && !IsSpace(aLine[word.mEnd]))
+      {
+         ++word.mEnd;
+      }
+      words.push_back(word);
+      pos = word.mEnd;
+   }
+   return words;
+}
+
+//! Matches the digits in [aBegin, aEnd), returning the position after them
+size_t SkipDigits(const std::string& aText, size_t aBegin, size_t aEnd)
+{
+   while (aBegin < aEnd && IsDigit(aText[aBegin]))
+   {
+      ++aBegin;
+   }
+   return aBegin;
+}
+
+//! Matches \d*:\d\d:\d\d\.?\d*
+bool IsClockTime(const std::string& aLine, const Word& aWord)
+{
+   size_t pos = SkipDigits(aLine, aWord.mBegin, aWord.mEnd);
+   for (int i = 0; i < 2; ++i)
+   {
+      if (aWord.mEnd - pos < 3 || aLine[pos] != ':' || !IsDigit(aLine[pos + 1]) || !IsDigit(aLine[pos + 2]))
+      {
+         return false;
+      }
+      pos += 3;
+   }
+   if (pos < aWord.mEnd && aLine[pos] == '.')
+   {
+      ++pos;
+   }
+   return SkipDigits(aLine, pos, aWord.mEnd) == aWord.mEnd;
+}
+
+//! Matches \d+\.\d+
+bool IsSecondsTime(const std::string& aLine, const Word& aWord)
+{
+   size_t pos = SkipDigits(aLine, aWord.mBegin, aWord.mEnd);
+   if (pos == aWord.mBegin || pos == aWord.mEnd || aLine[pos] != '.')
+   {
+      return false;
+   }
+   size_t end = SkipDigits(aLine, pos + 1, aWord.mEnd);
+   return end > pos + 1 && end == aWord.mEnd;
+}
+
+//! Matches [\w\-]+
+bool IsName(const std::string& aLine, const Word& aWord)
+{
+   for (size_t i = aWord.mBegin; i < aWord.mEnd; ++i)
+   {
+      if (!IsNameChar(aLine[i]))
+      {
+         return false;
+      }
+   }
+   return aWord.mEnd > aWord.mBegin;
+}
+
+bool IsText(const std::string& aLine, const Word& aWord, const char* aText)
+{
+   return aLine.compare(aWord.mBegin, aWord.mEnd - aWord.mBegin, aText) == 0;
+}
+
+std::string Text(const std::string& aLine, const Word& aWord)
+{
+   return aLine.substr(aWord.mBegin, aWord.mEnd - aWord.mBegin);
+}
+
+//! Finds the detection flag of a clock time event, i.e. matches \s+.+\s+Detected:\s+(\d) starting at aBegin.
+//! As the .+ is greedy, the last "Detected:" that fits is used.
+bool FindClockDetected(const std::string& aLine, size_t aBegin, char& aDetected)
+{
+   static const char   cDETECTED[] = "Detected:";
+   static const size_t cLENGTH     = sizeof(cDETECTED) - 1;
+
+   size_t pos = aLine.rfind(cDETECTED);
+   while (pos != std::string::npos && pos >= aBegin + 3)
+   {
+      if (IsSpace(aLine[pos - 1]))
+      {
+         size_t flag = pos + cLENGTH;
+         while (flag < aLine.size() && IsSpace(aLine[flag]))
+         {
+            ++flag;
+         }
+         if (flag > pos + cLENGTH && flag < aLine.size() && IsDigit(aLine[flag]))
+         {
+            aDetected = aLine[flag];
+            return true;
+         }
+      }
+      pos = aLine.rfind(cDETECTED, pos - 1);
+   }
+   return false;
+}
+
+//! Converts a string of digits (and an optional fraction) to a number
+double ToNumber(const std::string& aText)
+{
+   return aText.empty() ? 0.0 : std::strtod(aText.c_str(), nullptr);
+}
+} // namespace
+
+void EvtQuery::SplitLines(const std::string& aText, std::vector<std::string>& aLines)
+{
+   aLines.clear();
+   size_t begin = 0;
+   while (begin < aText.size())
+   {
+      size_t end = aText.find('\n', begin);
+      if (end == std::string::npos)
+      {
+         end = aText.size();
+      }
+      aLines.emplace_back(aText, begin, end - begin);
+      begin = end + 1;
+   }
+}
+
+bool EvtQuery::IsContinued(const std::string& aLine)
+{
+   size_t end = aLine.size();
+   while (end > 0 && IsSpace(aLine[end - 1]))
+   {
+      --end;
+   }
+   return end > 0 && aLine[end - 1] == '\\';
+}
+
+std::string EvtQuery::JoinTrimmed(const std::vector<std::string>& aLines)
+{
+   std::string joined;
+   for (const auto& line : aLines)
+   {
+      AppendTrimmed(line.data(), line.data() + line.size(), joined);
+   }
+   return joined;
+}
+
+void EvtQuery::AppendTrimmed(const char* aBegin, const char* aEnd, std::string& aJoined)
+{
+   while (aBegin < aEnd && IsSpace(*aBegin))
+   {
+      ++aBegin;
+   }
+   while (aEnd > aBegin && IsSpace(*(aEnd - 1)))
+   {
+      --aEnd;
+   }
+   if (aEnd > aBegin && *(aEnd - 1) == '\\')
+   {
+      --aEnd;
+   }
+   aJoined.append(aBegin, aEnd);
+}
+
+std::vector<std::string> EvtQuery::FirstWords(const std::string& aLine, size_t aCount)
+{
+   std::vector<std::string> words;
+   for (const auto& word : SplitWords(aLine, aCount))
+   {
+      words.push_back(Text(aLine, word));
+   }
+   return words;
+}
+
+bool EvtQuery::ParseFields(const std::string& aLine, Fields& aFields)
+{
+   aFields = Fields();
+
+   // Every captured word must be followed by whitespace, so the line must have a word after it
+   std::vector<Word> words = SplitWords(aLine, 8);
+   auto              isFollowed = [&](size_t aIndex)
+   { return aIndex < words.size() && words[aIndex].mEnd < aLine.size() && IsSpace(aLine[words[aIndex].mEnd]); };
+   auto isName = [&](size_t aIndex) { return isFollowed(aIndex) && IsName(aLine, words[aIndex]); };
+
+   if (words.empty() || words[0].mBegin != 0 || !isFollowed(0))
+   {
+      return false;
+   }
+   bool isClockTime = IsClockTime(aLine, words[0]);
+   if ((!isClockTime && !IsSecondsTime(aLine, words[0])) || !isName(1))
+   {
+      return false;
+   }
+   aFields.mTime = Text(aLine, words[0]);
+   aFields.mType = Text(aLine, words[1]);
+   if (!isName(2))
+   {
+      return true;
+   }
+   aFields.mPlatform = Text(aLine, words[2]);
+   if (!isName(3))
+   {
+      return true;
+   }
+   aFields.mTarget = Text(aLine, words[3]);
+   if (!isFollowed(4) || !IsText(aLine, words[4], "Sensor:") || !isName(5))
+   {
+      return true;
+   }
+   aFields.mSensor = Text(aLine, words[5]);
+
+   // Clock time events may have other text before the detection flag, events in seconds may not
+   char detected = '\0';
+   if (isClockTime)
+   {
+      FindClockDetected(aLine, words[5].mEnd, detected);
+   }
+   else if (words.size() > 7 && isFollowed(6) && IsText(aLine, words[6], "Detected:") &&
+            IsDigit(aLine[words[7].mBegin]))
+   {
+      detected = aLine[words[7].mBegin];
+   }
+   if (detected == '1')
+   {
+      aFields.mDetected = "YES";
+   }
+   else if (detected == '0')
+   {
+      aFields.mDetected = "NO";
+   }
+   else if (detected != '\0')
+   {
+      aFields.mDetected = std::string(1, detected);
+   }
+   return true;
+}
+
+bool EvtQuery::TimeToSeconds(const std::string& aTime, double& aSeconds)
+{
+   Word word{0, aTime.size()};
+   if (IsSecondsTime(aTime, word))
+   {
+      aSeconds = ToNumber(aTime);
+      return true;
+   }
+   if (IsClockTime(aTime, word))
+   {
+      size_t minutes = aTime.find(':');
+      size_t seconds = aTime.find(':', minutes + 1);
+      double hours   = ToNumber(aTime.substr(0, minutes));
+      aSeconds       = 3600.0 * hours + 60.0 * ToNumber(aTime.substr(minutes + 1, seconds - minutes - 1)) +
+                 ToNumber(aTime.substr(seconds + 1));
+      return true;
+   }
+   return false;
+}
@@ -0,0 +1,64 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef EVTQUERYEVENT_HPP
+#define EVTQUERYEVENT_HPP
+
+#include <string>
+#include <vector>
+
+namespace EvtQuery
+{
+//! The fields of an event, as written to a row of the evt_filter.pl output.
+//! Fields the event does not have are "N/A".
+struct Fields
+{
+   std::string mTime{"N/A"};
+   std::string mType{"N/A"};
+   std::string mPlatform{"N/A"};
+   std::string mTarget{"N/A"};
+   std::string mSensor{"N/A"};
+   std::string mDetected{"N/A"};
+};
+
+//! Splits the text of an event into its lines.
+//! @param aText is the text of the event, as read from the event file
+//! @param aLines are the lines, without their line breaks
+void SplitLines(const std::string& aText, std::vector<std::string>& aLines);
+
+//! Returns whether the line is continued on the next line, i.e. whether it ends with a '\'
+//! once trailing whitespace is removed.
+bool IsContinued(const std::string& aLine);
+
+//! Joins the lines of an event the way evt_filter.pl does: each line is trimmed and the continuation
+//! character is removed before the lines are concatenated.
+std::string JoinTrimmed(const std::vector<std::string>& aLines);
+
+//! Appends a line to an event line being joined the way JoinTrimmed does.
+//! @param aBegin and aEnd delimit the line, without its line break
+//! @param aJoined is the event line being joined
+void AppendTrimmed(const char* aBegin, const char* aEnd, std::string& aJoined);
+
+//! Returns the first aCount whitespace-separated words of the line, or fewer if the line has fewer words
+std::vector<std::string> FirstWords(const std::string& aLine, size_t aCount);
+
+//! Extracts the fields of an event line joined by JoinTrimmed, using the same rules as evt_filter.pl.
+//! @param aLine is the joined event line
+//! @param aFields are the extracted fields
+//! @return false if the line does not start with an event time and an event type
+bool ParseFields(const std::string& aLine, Fields& aFields);
+
+//! Converts an event time, either in seconds (SSS.sss) or as a clock time (HHH:MM:SS.sss), to seconds.
+//! @return false if the time is in neither format
+bool TimeToSeconds(const std::string& aTime, double& aSeconds);
+} // namespace EvtQuery
+
+#endif
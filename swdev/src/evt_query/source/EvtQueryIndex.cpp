@@ -0,0 +1,277 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "EvtQueryIndex.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+
+#include <sys/stat.h>
+
+#include "EvtQueryEvent.hpp"
+
+namespace
+{
+//! Identifies a sidecar file, and the version of its layout
+const char cMAGIC[8] = {'E', 'V', 'T', 'I', 'D', 'X', '0', '1'};
+
+//! The number of characters read from the event file at a time while building the index
+const std::size_t cBLOCK_SIZE = 1 << 20;
+
+//! Gets the size and modification time of a file, which tell whether its sidecar file is out of date
+bool GetFileStatus(const std::string& aPath, std::uint64_t& aSize, std::int64_t& aModified)
+{
+#ifdef _WIN32
+   struct _stat64 status;
+   if (_stat64(aPath.c_str(), &status) != 0)
+#else
+   struct stat status;
+   if (stat(aPath.c_str(), &status) != 0)
+#endif
+   {
+      return false;
+   }
+   aSize     = static_cast<std::uint64_t>(status.st_size);
+   aModified = static_cast<std::int64_t>(status.st_mtime);
+   return true;
+}
+
+template<typename T>
+void WriteValue(std::ostream& aStream, const T& aValue)
+{
+   aStream.write(reinterpret_cast<const char*>(&aValue), sizeof(T));
+}
+
+template<typename T>
+bool ReadValue(std::istream& aStream, T& aValue)
+{
+   return static_cast<bool>(aStream.read(reinterpret_cast<char*>(&aValue), sizeof(T)));
+}
+} // namespace
+
+const std::uint32_t EvtQuery::Index::cNO_NAME;
+
+bool EvtQuery::Index::Open(const std::string& aEventFile, std::string& aError)
+{
+   mEventFile = aEventFile;
+   mNames.clear();
+   mEntries.clear();
+   mWasBuilt = false;
+
+   std::uint64_t fileSize = 0;
+   std::int64_t  modified = 0;
+   if (!GetFileStatus(mEventFile, fileSize, modified))
+   {
+      aError = "Event file \"" + mEventFile + "\" could not be opened";
+      return false;
+   }
+   if (Load(fileSize, modified))
+   {
+      return true;
+   }
+   if (!Build(aError))
+   {
+      return false;
+   }
+   mWasBuilt = true;
+   Save(fileSize, modified);
+   return true;
+}
+
+bool EvtQuery::Index::Read(const std::vector<std::uint32_t>&                               aEntries,
+                           const std::function<void(const Entry&, const std::string&)>& aFunction,
+                           std::string&                                                 aError) const
+{
+   std::ifstream file(mEventFile, std::ios::binary);
+   if (!file)
+   {
+      aError = "Event file \"" + mEventFile + "\" could not be opened";
+      return false;
+   }
+
+   // Consecutive events are read without seeking
+   std::uint64_t position = 0;
+   std::string   text;
+   for (std::uint32_t index : aEntries)
+   {
+      const Entry& entry = mEntries[index];
+      if (entry.mOffset != position)
+      {
+         file.seekg(static_cast<std::streamoff>(entry.mOffset));
+      }
+      text.resize(entry.mLength);
+      if (!file.read(&text[0], entry.mLength))
+      {
+         aError = "Event file \"" + mEventFile + "\" changed while it was read";
+         return false;
+      }
+      position = entry.mOffset + entry.mLength;
+      aFunction(entry, text);
+   }
+   return true;
+}
+
+bool EvtQuery::Index::Load(std::uint64_t aFileSize, std::int64_t aModified)
+{
+   std::ifstream sidecar(SidecarPath(mEventFile), std::ios::binary);
+   char          magic[sizeof(cMAGIC)];
+   std::uint64_t fileSize = 0;
+   std::int64_t  modified = 0;
+   if (!sidecar.read(magic, sizeof(magic)) || std::memcmp(magic, cMAGIC, sizeof(cMAGIC)) != 0 ||
+       !ReadValue(sidecar, fileSize) || !ReadValue(sidecar, modified) || fileSize != aFileSize || modified != aModified)
+   {
+      return false;
+   }
+
+   std::uint32_t nameCount = 0;
+   if (!ReadValue(sidecar, nameCount))
+   {
+      return false;
+   }
+   mNames.resize(nameCount);
+   for (auto& name : mNames)
+   {
+      std::uint32_t length = 0;
+      if (!ReadValue(sidecar, length))
+      {
+         return false;
+      }
+      name.resize(length);
+      if (length > 0 && !sidecar.read(&name[0], length))
+      {
+         return false;
+      }
+   }
+
+   std::uint64_t entryCount = 0;
+   if (!ReadValue(sidecar, entryCount))
+   {
+      return false;
+   }
+   mEntries.resize(static_cast<std::size_t>(entryCount));
+   if (entryCount > 0 && !sidecar.read(reinterpret_cast<char*>(mEntries.data()), entryCount * sizeof(Entry)))
+   {
+      mNames.clear();
+      mEntries.clear();
+      return false;
+   }
+   return true;
+}
+
+bool EvtQuery::Index::Build(std::string& aError)
+{
+   std::ifstream file(mEventFile, std::ios::binary);
+   if (!file)
+   {
+      aError = "Event file \"" + mEventFile + "\" could not be opened";
+      return false;
+   }
+
+   mNames.clear();
+   mEntries.clear();
+   std::unordered_map<std::string, std::uint32_t> nameIds;
+   mNames.emplace_back();
+   nameIds.emplace(std::string(), cNO_NAME);
+   auto getNameId = [&](const std::string& aName)
+   {
+      auto inserted = nameIds.emplace(aName, static_cast<std::uint32_t>(mNames.size()));
+      if (inserted.second)
+      {
+         mNames.push_back(aName);
+      }
+      return inserted.first->second;
+   };
+
+   // An event ends with the first of its lines that is not continued
+   std::uint64_t eventOffset = 0;
+   std::uint64_t offset      = 0;
+   std::string   eventLine;
+   auto          addEvent = [&]()
+   {
+      std::vector<std::string> words = FirstWords(eventLine, 5);
+      words.resize(5);
+
+      Entry entry   = Entry();
+      entry.mOffset = eventOffset;
+      entry.mLength = static_cast<std::uint32_t>(offset - eventOffset);
+      entry.mType   = getNameId(words[1]);
+      for (int i = 0; i < 3; ++i)
+      {
+         entry.mNames[i] = getNameId(words[i + 2]);
+      }
+      if (!TimeToSeconds(words[0], entry.mTime))
+      {
+         entry.mTime = std::numeric_limits<double>::quiet_NaN();
+      }
+      mEntries.push_back(entry);
+      eventOffset = offset;
+      eventLine.clear();
+   };
+
+   std::vector<char> block(cBLOCK_SIZE);
+   std::string       line;
+   while (file.read(block.data(), block.size()) || file.gcount() > 0)
+   {
+      const char* begin = block.data();
+      const char* end   = begin + file.gcount();
+      while (begin < end)
+      {
+         const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+         if (lineEnd == nullptr)
+         {
+            // The line continues in the next block
+            line.append(begin, end);
+            offset += end - begin;
+            break;
+         }
+         line.append(begin, lineEnd);
+         offset += lineEnd - begin + 1;
+         begin = lineEnd + 1;
+
+         AppendTrimmed(line.data(), line.data() + line.size(), eventLine);
+         if (!IsContinued(line))
+         {
+            addEvent();
+         }
+         line.clear();
+      }
+   }
+   // The last line may not have a line break, and the last event may not be finished
+   if (offset > eventOffset)
+   {
+      AppendTrimmed(line.data(), line.data() + line.size(), eventLine);
+      addEvent();
+   }
+   return true;
+}
+
+void EvtQuery::Index::Save(std::uint64_t aFileSize, std::int64_t aModified) const
+{
+   // The index is still usable if it cannot be saved, e.g. in a read-only directory, so failures are ignored
+   std::ofstream sidecar(SidecarPath(mEventFile), std::ios::binary | std::ios::trunc);
+   if (!sidecar)
+   {
+      return;
+   }
+   sidecar.write(cMAGIC, sizeof(cMAGIC));
+   WriteValue(sidecar, aFileSize);
+   WriteValue(sidecar, aModified);
+   WriteValue(sidecar, static_cast<std::uint32_t>(mNames.size()));
+   for (const auto& name : mNames)
+   {
+      WriteValue(sidecar, static_cast<std::uint32_t>(name.size()));
+      sidecar.write(name.data(), name.size());
+   }
+   WriteValue(sidecar, static_cast<std::uint64_t>(mEntries.size()));
+   sidecar.write(reinterpret_cast<const char*>(mEntries.data()), mEntries.size() * sizeof(Entry));
+}
@@ -0,0 +1,82 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef EVTQUERYINDEX_HPP
+#define EVTQUERYINDEX_HPP
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace EvtQuery
+{
+//! The index of an event (.evt) file.
+//! The index records where each event is in the file along with its time, type and the names that follow the type,
+//! so queries can select events without reading the file, and then read only the selected events.
+//! The index is kept in a sidecar file next to the event file (see SidecarPath), and is rebuilt when the event file
+//! changes.
+class Index
+{
+public:
+   //! An indexed event
+   struct Entry
+   {
+      std::uint64_t mOffset;   //!< The position of the event's first line in the event file
+      std::uint32_t mLength;   //!< The number of characters of the event's lines, including line breaks
+      std::uint32_t mType;     //!< The id of the event type (the second word of the event)
+      std::uint32_t mNames[3]; //!< The ids of the third through fifth words of the event (platform, target, ...)
+      double        mTime;     //!< The event time (seconds), or NaN if the event does not start with a time
+   };
+
+   //! The id of the empty name, used for the words an event does not have
+   static const std::uint32_t cNO_NAME = 0;
+
+   //! Returns the path of the sidecar file of the given event file
+   static std::string SidecarPath(const std::string& aEventFile) { return aEventFile + ".idx"; }
+
+   //! Loads the index of the event file from its sidecar file.  If the sidecar file is missing or out of date, the
+   //! index is built by scanning the event file, and written to the sidecar file.
+   //! @param aEventFile is the path of the event file
+   //! @param aError describes the failure, if any
+   //! @return whether the index could be loaded or built
+   bool Open(const std::string& aEventFile, std::string& aError);
+
+   //! Returns whether Open had to build the index instead of loading it
+   bool WasBuilt() const { return mWasBuilt; }
+
+   const std::string&        GetEventFile() const { return mEventFile; }
+   const std::vector<Entry>& GetEntries() const { return mEntries; }
+   const std::string&        GetName(std::uint32_t aId) const { return mNames[aId]; }
+   std::uint32_t             GetNameCount() const { return static_cast<std::uint32_t>(mNames.size()); }
+
+   //! Reads the text of the given events from the event file, in the given order
+   //! @param aEntries are the indices of the events in GetEntries(), in ascending order for sequential reads
+   //! @param aFunction is called with the entry and text of each event
+   //! @param aError describes the failure, if any
+   //! @return whether the events could be read
+   bool Read(const std::vector<std::uint32_t>&                               aEntries,
+             const std::function<void(const Entry&, const std::string&)>& aFunction,
+             std::string&                                                 aError) const;
+
+private:
+   bool Load(std::uint64_t aFileSize, std::int64_t aModified);
+   bool Build(std::string& aError);
+   void Save(std::uint64_t aFileSize, std::int64_t aModified) const;
+
+   std::string              mEventFile;
+   std::vector<std::string> mNames;
+   std::vector<Entry>       mEntries;
+   bool                     mWasBuilt{false};
+};
+} // namespace EvtQuery
+
+#endif
@@ -0,0 +1,327 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "EvtQueryQueries.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <functional>
+#include <map>
+
+#include "EvtQueryEvent.hpp"
+#include "EvtQueryIndex.hpp"
+
+namespace
+{
+bool EqualsNoCase(const std::string& aLhs, const std::string& aRhs)
+{
+   return aLhs.size() == aRhs.size() &&
+          std::equal(aLhs.begin(),
+                     aLhs.end(),
+                     aRhs.begin(),
+                     [](char aLeft, char aRight)
+                     {
+                        return std::tolower(static_cast<unsigned char>(aLeft)) ==
+                               std::tolower(static_cast<unsigned char>(aRight));
+                     });
+}
+
+//! Reads the selected events and splits them into lines
+bool ReadLines(const EvtQuery::Index&                                       aIndex,
+               const EvtQuery::Selection&                                   aSelection,
+               const std::function<void(const std::vector<std::string>&)>& aFunction,
+               std::string&                                                 aError)
+{
+   std::vector<std::string> lines;
+   return aIndex.Read(
+      EvtQuery::Select(aIndex, aSelection),
+      [&](const EvtQuery::Index::Entry&, const std::string& aText)
+      {
+         EvtQuery::SplitLines(aText, lines);
+         aFunction(lines);
+      },
+      aError);
+}
+
+//! Reads the selected events, and extracts the fields of the finished ones the way evt_filter.pl does
+bool ReadFields(const EvtQuery::Index&                               aIndex,
+                const EvtQuery::Selection&                           aSelection,
+                const std::function<void(const EvtQuery::Fields&)>& aFunction,
+                std::string&                                         aError)
+{
+   EvtQuery::Fields fields;
+   return ReadLines(
+      aIndex,
+      aSelection,
+      [&](const std::vector<std::string>& aLines)
+      {
+         // evt_filter.pl drops an event that is still continued at the end of the file
+         if (!aLines.empty() && !EvtQuery::IsContinued(aLines.back()) &&
+             EvtQuery::ParseFields(EvtQuery::JoinTrimmed(aLines), fields))
+         {
+            aFunction(fields);
+         }
+      },
+      aError);
+}
+
+//! Formats a number the way Perl does
+std::string FormatNumber(double aValue)
+{
+   char text[32];
+   std::snprintf(text, sizeof(text), "%.15g", aValue);
+   return text;
+}
+
+//! Writes the event counts of a kind of event
+void WriteCounts(std::ostream& aOutput, const std::string& aKind, const std::map<std::string, int>& aCounts)
+{
+   aOutput << "\n" << aKind << " Events,Count\n";
+   if (aCounts.empty())
+   {
+      aOutput << "NONE\n";
+   }
+   for (const auto& count : aCounts)
+   {
+      aOutput << count.first << ',' << count.second << '\n';
+   }
+}
+} // namespace
+
+std::vector<std::uint32_t> EvtQuery::Select(const Index& aIndex, const Selection& aSelection)
+{
+   // Each criterion is resolved to the names it accepts, so the events are selected by comparing ids
+   auto acceptNames = [&aIndex](const std::function<bool(const std::string&)>& aAccept)
+   {
+      std::vector<char> accepted(aIndex.GetNameCount());
+      for (std::uint32_t id = 0; id < aIndex.GetNameCount(); ++id)
+      {
+         accepted[id] = aAccept(aIndex.GetName(id));
+      }
+      return accepted;
+   };
+   auto isListed = [](const std::vector<std::string>& aList, const std::string& aName, bool aNoCase)
+   {
+      return std::any_of(aList.begin(),
+                         aList.end(),
+                         [&](const std::string& aListed)
+                         { return aNoCase ? EqualsNoCase(aListed, aName) : aListed == aName; });
+   };
+
+   std::vector<char> types;
+   std::vector<char> platforms;
+   std::vector<char> names;
+   if (!aSelection.mTypes.empty())
+   {
+      types = acceptNames([&](const std::string& aName) { return isListed(aSelection.mTypes, aName, true); });
+   }
+   if (!aSelection.mPlatforms.empty())
+   {
+      platforms =
+         acceptNames([&](const std::string& aName) { return isListed(aSelection.mPlatforms, aName, false); });
+   }
+   if (!aSelection.mName.empty())
+   {
+      names = acceptNames([&](const std::string& aName)
+                          { return aName.find(aSelection.mName) != std::string::npos; });
+   }
+   bool limitsTime = aSelection.mBeginTime > -std::numeric_limits<double>::infinity() ||
+                     aSelection.mEndTime < std::numeric_limits<double>::infinity();
+
+   std::vector<std::uint32_t> selected;
+   const auto&                entries = aIndex.GetEntries();
+   for (std::uint32_t i = 0; i < entries.size(); ++i)
+   {
+      const Index::Entry& entry = entries[i];
+      if ((!types.empty() && !types[entry.mType]) || (!platforms.empty() && !platforms[entry.mNames[0]]) ||
+          (!names.empty() && !names[entry.mNames[0]] && !names[entry.mNames[1]] && !names[entry.mNames[2]]) ||
+          (limitsTime && !(entry.mTime >= aSelection.mBeginTime && entry.mTime <= aSelection.mEndTime)))
+      {
+         continue;
+      }
+      selected.push_back(i);
+   }
+   return selected;
+}
+
+std::string EvtQuery::OutputPath(const std::string& aEventFile, const std::string& aSuffix)
+{
+   std::string root = aEventFile;
+   if (root.size() >= 4 && root.compare(root.size() - 4, 4, ".evt") == 0)
+   {
+      root.erase(root.size() - 4);
+   }
+   return root + aSuffix;
+}
+
+bool EvtQuery::Filter(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError)
+{
+   aOutput << "Time,Platform,Event,Sensor,Target,Detect Event\n";
+   return ReadFields(
+      aIndex,
+      aSelection,
+      [&aOutput](const Fields& aFields)
+      {
+         aOutput << aFields.mTime << ',' << aFields.mPlatform << ',' << aFields.mType << ',' << aFields.mSensor << ','
+                 << aFields.mTarget << ',' << aFields.mDetected << '\n';
+      },
+      aError);
+}
+
+bool EvtQuery::Summary(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError)
+{
+   static const char* const cFIRED       = "WEAPON_FIRED";
+   static const char* const cHIT         = "WEAPON_HIT";
+   static const char* const cMISSED      = "WEAPON_MISSED";
+   static const char* const cKILLED      = "PLATFORM_KILLED";
+   static const char* const cDETECTION   = "SENSOR_DETECTION_ATTEMPT";
+   static const char* const cTRACK_START = "SENSOR_TRACK_INITIATED";
+   static const char* const cTRACK_END   = "SENSOR_TRACK_DROPPED";
+
+   // Only the summarized events have to be read
+   Selection selection = aSelection;
+   if (selection.mTypes.empty())
+   {
+      selection.mTypes = {cFIRED, cHIT, cMISSED, cKILLED, cDETECTION, cTRACK_START, cTRACK_END};
+   }
+
+   std::map<std::string, int>    fired;
+   std::map<std::string, int>    hit;
+   std::map<std::string, int>    missed;
+   std::map<std::string, int>    killed;
+   std::map<std::string, int>    detections;
+   std::map<std::string, double> trackStarts;
+   std::map<std::string, double> trackTimes;
+   std::string                   trackError;
+   bool                          ok = ReadFields(
+      aIndex,
+      selection,
+      [&](const Fields& aFields)
+      {
+         double time = 0.0;
+         if (!trackError.empty() || !TimeToSeconds(aFields.mTime, time))
+         {
+            return;
+         }
+         const std::string& type = aFields.mType;
+         if (EqualsNoCase(type, cFIRED))
+         {
+            ++fired[aFields.mPlatform + '#' + type + '#' + aFields.mTarget];
+         }
+         else if (EqualsNoCase(type, cHIT))
+         {
+            ++hit[aFields.mPlatform + '#' + type + '#' + aFields.mTarget];
+         }
+         else if (EqualsNoCase(type, cMISSED))
+         {
+            ++missed[aFields.mPlatform + '#' + type + '#' + aFields.mTarget];
+         }
+         else if (EqualsNoCase(type, cKILLED))
+         {
+            ++killed[aFields.mPlatform + '#' + type];
+         }
+         else if (EqualsNoCase(type, cDETECTION))
+         {
+            ++detections[aFields.mPlatform + '#' + type + '#' + aFields.mSensor + '#' + aFields.mTarget + '#' +
+                         aFields.mDetected];
+         }
+         else if (EqualsNoCase(type, cTRACK_START) || EqualsNoCase(type, cTRACK_END))
+         {
+            std::string key   = aFields.mPlatform + '#' + aFields.mSensor + '#' + aFields.mTarget;
+            auto        start = trackStarts.find(key);
+            if (EqualsNoCase(type, cTRACK_START))
+            {
+               if (start != trackStarts.end())
+               {
+                  trackError = "SENSOR_TRACK_INITIATED Event already exists for Key = " + key;
+                  return;
+               }
+               trackStarts.emplace(key, time);
+            }
+            else
+            {
+               if (start == trackStarts.end())
+               {
+                  trackError = "SENSOR_TRACK_INITIATED Event does NOT exist for Key = " + key;
+                  return;
+               }
+               trackTimes[key] += time - start->second;
+               trackStarts.erase(start);
+            }
+         }
+      },
+      aError);
+   if (!ok)
+   {
+      return false;
+   }
+   if (!trackError.empty())
+   {
+      aError = trackError;
+      return false;
+   }
+
+   aOutput << "EVENT COUNT SUMMARY\n";
+   WriteCounts(aOutput, "WEAPON_FIRED Events", fired);
+   WriteCounts(aOutput, "WEAPON_HIT Events", hit);
+   WriteCounts(aOutput, "WEAPON_MISSED Events", missed);
+   WriteCounts(aOutput, "PLATFORM_KILLED Events", killed);
+   WriteCounts(aOutput, "SENSOR_DETECTION_ATTEMPT", detections);
+   aOutput << "\nPLATFORM#SENSOR#TARGET,Cumm Track Time (sec)\n";
+   if (trackTimes.empty())
+   {
+      aOutput << "NONE\n";
+   }
+   for (const auto& trackTime : trackTimes)
+   {
+      aOutput << trackTime.first << ',' << FormatNumber(trackTime.second) << '\n';
+   }
+   return true;
+}
+
+bool EvtQuery::Extract(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError)
+{
+   return ReadLines(
+      aIndex,
+      aSelection,
+      [&aOutput](const std::vector<std::string>& aLines)
+      {
+         for (const auto& line : aLines)
+         {
+            aOutput << line << '\n';
+         }
+      },
+      aError);
+}
+
+bool EvtQuery::Combine(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError)
+{
+   return ReadLines(
+      aIndex,
+      aSelection,
+      [&aOutput](const std::vector<std::string>& aLines)
+      {
+         // Only a '\' that ends the line joins it to the next line
+         for (const auto& line : aLines)
+         {
+            if (!line.empty() && line.back() == '\\')
+            {
+               aOutput.write(line.data(), line.size() - 1);
+            }
+            else
+            {
+               aOutput << line << '\n';
+            }
+         }
+      },
+      aError);
+}
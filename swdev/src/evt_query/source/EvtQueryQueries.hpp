@@ -0,0 +1,65 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef EVTQUERYQUERIES_HPP
+#define EVTQUERYQUERIES_HPP
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace EvtQuery
+{
+class Index;
+
+//! Selects the events a query applies to.  An empty selection selects every event.
+struct Selection
+{
+   //! The event types to select (compared without regard to case), or empty to select all types
+   std::vector<std::string> mTypes;
+   //! The platforms to select (the third word of an event), or empty to select all platforms
+   std::vector<std::string> mPlatforms;
+   //! Selects the events whose third, fourth or fifth word contains this text, if not empty
+   std::string mName;
+   //! The time range (seconds) to select.  Events without a time are not selected if the range is limited.
+   double mBeginTime{-std::numeric_limits<double>::infinity()};
+   double mEndTime{std::numeric_limits<double>::infinity()};
+};
+
+//! Returns the indices of the selected events of the index, in ascending order
+std::vector<std::uint32_t> Select(const Index& aIndex, const Selection& aSelection);
+
+//! Returns the path of an output file of a query: the event file's path, without its .evt extension, and with
+//! the given suffix
+std::string OutputPath(const std::string& aEventFile, const std::string& aSuffix);
+
+//! Writes the fields of the selected events as comma-separated values, as evt_filter.pl does.
+//! @return false if the event file could not be read, in which case aError describes the failure
+bool Filter(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError);
+
+//! Writes the event counts and cumulative track times of the selected events, as evt_summary.pl does for the
+//! output of evt_filter.pl.
+//! @return false if the event file could not be read or a track is inconsistent, in which case aError describes
+//!         the failure and nothing is written
+bool Summary(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError);
+
+//! Writes the lines of the selected events as they are, as ev-extract.pl does for the events of a player.
+//! @return false if the event file could not be read, in which case aError describes the failure
+bool Extract(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError);
+
+//! Writes each of the selected events on a single line, as ev-combine.pl does.
+//! @return false if the event file could not be read, in which case aError describes the failure
+bool Combine(const Index& aIndex, const Selection& aSelection, std::ostream& aOutput, std::string& aError);
+} // namespace EvtQuery
+
+#endif
@@ -0,0 +1,288 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+//! evt_query answers the queries of the evt_filter.pl, evt_summary.pl, ev-extract.pl and ev-combine.pl scripts
+//! for one or more event (.evt) files, such as the event files of the runs of a Monte Carlo batch.
+//! Each event file is indexed once (see EvtQuery::Index), so later queries only read the events they select,
+//! and the event files are processed in parallel.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "EvtQueryIndex.hpp"
+#include "EvtQueryQueries.hpp"
+
+namespace
+{
+void ShowUsage(const std::string& aName)
+{
+   // clang-format off
+   std::cerr << "Usage: " << aName << " <command> <option(s)> FILES\n"
+             << "Commands:\n"
+             << "\tindex\t\t\t\tBuild the index of each event file, unless it is up to date.\n"
+             << "\tfilter\t\t\t\tWrite the fields of the selected events to <file>_OUT.csv, as evt_filter.pl does.\n"
+             << "\tsummary\t\t\t\tWrite the event counts and track times of the selected events to\n"
+             << "\t\t\t\t\t<file>_SUMMARY.csv, as evt_summary.pl does.\n"
+             << "\textract\t\t\t\tWrite the selected events to the standard output, as ev-extract.pl does.\n"
+             << "\tcombine\t\t\t\tWrite the selected events on single lines to the standard output,\n"
+             << "\t\t\t\t\tas ev-combine.pl does.\n"
+             << "Options:\n"
+             << "\t-h,--help\t\t\tShow this help message.\n"
+             << "\t-t,--type <event-type>\t\tSelect the events of the type. May be repeated.\n"
+             << "\t-p,--platform <name>\t\tSelect the events of the platform. May be repeated.\n"
+             << "\t-n,--name <text>\t\tSelect the events whose third, fourth or fifth word contains the text.\n"
+             << "\t\t\t\t\tRequired by extract.\n"
+             << "\t-b,--begin <seconds>\t\tSelect the events at or after the time.\n"
+             << "\t-e,--end <seconds>\t\tSelect the events at or before the time.\n"
+             << "\t-j,--jobs <count>\t\tSpecify the number of event files processed at once.\n"
+             << "\t\t\t\t\tThe default is the number of processors.\n"
+             << std::endl;
+   // clang-format on
+}
+
+//! The outcome of a query of an event file
+struct Result
+{
+   bool        mOk{false};
+   std::string mMessage;
+};
+
+//! Calls aFunction for each of aCount event files, with up to aJobs calls at once
+void ForEachFile(size_t aCount, unsigned int aJobs, const std::function<void(size_t)>& aFunction)
+{
+   std::atomic<size_t>      next(0);
+   std::vector<std::thread> threads;
+   auto                     work = [&]()
+   {
+      for (size_t i = next++; i < aCount; i = next++)
+      {
+         aFunction(i);
+      }
+   };
+   for (unsigned int i = 1; i < std::min<size_t>(aJobs, aCount); ++i)
+   {
+      threads.emplace_back(work);
+   }
+   work();
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+}
+
+//! Runs a query that writes an output file next to the event file
+Result WriteOutput(const EvtQuery::Index& aIndex,
+                   const std::string&     aSuffix,
+                   const std::function<bool(const EvtQuery::Index&, std::ostream&, std::string&)>& aQuery)
+{
+   Result        result;
+   std::string   path = EvtQuery::OutputPath(aIndex.GetEventFile(), aSuffix);
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   if (!file)
+   {
+      result.mMessage = "Output file \"" + path + "\" could not be opened";
+      return result;
+   }
+   if (!aQuery(aIndex, file, result.mMessage))
+   {
+      // Do not leave incomplete output behind
+      file.close();
+      std::remove(path.c_str());
+      return result;
+   }
+   if (!file.flush())
+   {
+      result.mMessage = "Output file \"" + path + "\" could not be written";
+      return result;
+   }
+   result.mOk      = true;
+   result.mMessage = "Wrote processed output to file: " + path;
+   return result;
+}
+
+bool ParseTime(const std::string& aOption, const char* aValue, double& aTime)
+{
+   char* end = nullptr;
+   aTime     = std::strtod(aValue, &end);
+   if (end == aValue || *end != '\0')
+   {
+      std::cerr << aOption << " option requires a time in seconds." << std::endl;
+      return false;
+   }
+   return true;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+   std::ios::sync_with_stdio(false);
+   if (argc < 2)
+   {
+      ShowUsage(argv[0]);
+      return 1;
+   }
+   std::string command = argv[1];
+   if (command == "-h" || command == "--help")
+   {
+      ShowUsage(argv[0]);
+      return 0;
+   }
+   if (command != "index" && command != "filter" && command != "summary" && command != "extract" &&
+       command != "combine")
+   {
+      std::cerr << "Unknown command: " << command << std::endl;
+      ShowUsage(argv[0]);
+      return 1;
+   }
+
+   EvtQuery::Selection      selection;
+   std::vector<std::string> files;
+   unsigned int             jobs = std::max(1u, std::thread::hardware_concurrency());
+   for (int i = 2; i < argc; ++i)
+   {
+      std::string arg      = argv[i];
+      bool        hasValue = i + 1 < argc;
+      if (arg == "-h" || arg == "--help")
+      {
+         ShowUsage(argv[0]);
+         return 0;
+      }
+      else if (arg == "-t" || arg == "--type" || arg == "-p" || arg == "--platform" || arg == "-n" ||
+               arg == "--name" || arg == "-b" || arg == "--begin" || arg == "-e" || arg == "--end" || arg == "-j" ||
+               arg == "--jobs")
+      {
+         if (!hasValue)
+         {
+            std::cerr << arg << " option requires one argument." << std::endl;
+            return 1;
+         }
+         const char* value = argv[++i];
+         if (arg == "-t" || arg == "--type")
+         {
+            selection.mTypes.emplace_back(value);
+         }
+         else if (arg == "-p" || arg == "--platform")
+         {
+            selection.mPlatforms.emplace_back(value);
+         }
+         else if (arg == "-n" || arg == "--name")
+         {
+            selection.mName = value;
+         }
+         else if (arg == "-b" || arg == "--begin")
+         {
+            if (!ParseTime(arg, value, selection.mBeginTime))
+            {
+               return 1;
+            }
+         }
+         else if (arg == "-e" || arg == "--end")
+         {
+            if (!ParseTime(arg, value, selection.mEndTime))
+            {
+               return 1;
+            }
+         }
+         else
+         {
+            int count = std::atoi(value);
+            if (count < 1)
+            {
+               std::cerr << arg << " option requires a positive number." << std::endl;
+               return 1;
+            }
+            jobs = static_cast<unsigned int>(count);
+         }
+      }
+      else
+      {
+         files.push_back(arg);
+      }
+   }
+   if (files.empty())
+   {
+      std::cerr << "No event files were specified." << std::endl;
+      return 1;
+   }
+   if (command == "extract" && selection.mName.empty())
+   {
+      std::cerr << "extract requires the --name option." << std::endl;
+      return 1;
+   }
+
+   // Indexing and the queries that write output files run in parallel.  The queries that write to the standard
+   // output then run in the order of the event files.
+   std::vector<EvtQuery::Index> indices(files.size());
+   std::vector<Result>          results(files.size());
+   ForEachFile(files.size(),
+               jobs,
+               [&](size_t aFile)
+               {
+                  EvtQuery::Index& index  = indices[aFile];
+                  Result&          result = results[aFile];
+                  if (!index.Open(files[aFile], result.mMessage))
+                  {
+                     return;
+                  }
+                  if (command == "filter")
+                  {
+                     result = WriteOutput(index,
+                                          "_OUT.csv",
+                                          [&](const EvtQuery::Index& aIndex, std::ostream& aOutput, std::string& aError)
+                                          { return EvtQuery::Filter(aIndex, selection, aOutput, aError); });
+                  }
+                  else if (command == "summary")
+                  {
+                     result = WriteOutput(index,
+                                          "_SUMMARY.csv",
+                                          [&](const EvtQuery::Index& aIndex, std::ostream& aOutput, std::string& aError)
+                                          { return EvtQuery::Summary(aIndex, selection, aOutput, aError); });
+                  }
+                  else
+                  {
+                     result.mOk = true;
+                     if (command == "index")
+                     {
+                        result.mMessage = (index.WasBuilt() ? "Indexed " : "Index is up to date for ") + files[aFile];
+                     }
+                  }
+               });
+
+   int status = 0;
+   for (size_t i = 0; i < files.size(); ++i)
+   {
+      Result& result = results[i];
+      if (result.mOk && (command == "extract" || command == "combine"))
+      {
+         result.mOk = (command == "extract") ? EvtQuery::Extract(indices[i], selection, std::cout, result.mMessage) :
+                                              EvtQuery::Combine(indices[i], selection, std::cout, result.mMessage);
+      }
+      if (!result.mOk)
+      {
+         std::cerr << "*ERROR: " << result.mMessage << std::endl;
+         status = 1;
+      }
+      else if (!result.mMessage.empty())
+      {
+         std::cerr << result.mMessage << std::endl;
+      }
+   }
+   std::cout.flush();
+   return status;
+}
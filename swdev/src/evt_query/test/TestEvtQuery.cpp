@@ -0,0 +1,132 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "TestEvtQuery.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "EvtQueryIndex.hpp"
+#include "EvtQueryQueries.hpp"
+
+// The expected outputs in the data directory were written by the scripts of the tools folder for sample.evt:
+//    perl evt_filter.pl sample.evt                       -> sample_OUT.csv
+//    perl evt_summary.pl sample_OUT.csv                  -> sample_SUMMARY.csv
+//    perl ev-extract.pl sample.evt red_sam               -> sample_extract_red_sam.txt
+//    perl ev-combine.pl < sample.evt                     -> sample_combine.txt
+
+namespace
+{
+std::string ReadFile(const std::string& aPath)
+{
+   std::ifstream      file(aPath, std::ios::binary);
+   std::ostringstream text;
+   text << file.rdbuf();
+   return text.str();
+}
+
+std::string DataPath(const std::string& aName)
+{
+   return gDataDirectory + "/" + aName;
+}
+} // namespace
+
+// The index writes its sidecar file next to the event file, so each test indexes a copy of the sample in the
+// working directory
+class EvtQueryTest : public ::testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      std::remove(EvtQuery::Index::SidecarPath(mEventFile).c_str());
+      std::ofstream(mEventFile, std::ios::binary) << ReadFile(DataPath("sample.evt"));
+      ASSERT_TRUE(mIndex.Open(mEventFile, mError)) << mError;
+   }
+
+   void TearDown() override
+   {
+      std::remove(EvtQuery::Index::SidecarPath(mEventFile).c_str());
+      std::remove(mEventFile.c_str());
+   }
+
+   const std::string   mEventFile{"evt_query_test_sample.evt"};
+   EvtQuery::Index     mIndex;
+   EvtQuery::Selection mSelection;
+   std::string         mError;
+   std::ostringstream  mOutput;
+};
+
+TEST_F(EvtQueryTest, Index)
+{
+   EXPECT_TRUE(mIndex.WasBuilt());
+   EXPECT_EQ(mIndex.GetEntries().size(), 15u);
+   EXPECT_EQ(mIndex.GetName(mIndex.GetEntries()[0].mType), "SIMULATION_STARTING");
+   EXPECT_DOUBLE_EQ(mIndex.GetEntries()[14].mTime, 60.0);
+
+   // The second open loads the sidecar file
+   EvtQuery::Index index;
+   ASSERT_TRUE(index.Open(mEventFile, mError)) << mError;
+   EXPECT_FALSE(index.WasBuilt());
+   ASSERT_EQ(index.GetEntries().size(), mIndex.GetEntries().size());
+   for (size_t i = 0; i < index.GetEntries().size(); ++i)
+   {
+      EXPECT_EQ(index.GetEntries()[i].mOffset, mIndex.GetEntries()[i].mOffset);
+      EXPECT_EQ(index.GetEntries()[i].mLength, mIndex.GetEntries()[i].mLength);
+   }
+}
+
+TEST_F(EvtQueryTest, Filter)
+{
+   ASSERT_TRUE(EvtQuery::Filter(mIndex, mSelection, mOutput, mError)) << mError;
+   EXPECT_EQ(mOutput.str(), ReadFile(DataPath("sample_OUT.csv")));
+}
+
+TEST_F(EvtQueryTest, FilterByType)
+{
+   // The expected output is the header and the WEAPON_FIRED lines of the script's output
+   std::istringstream expectedLines(ReadFile(DataPath("sample_OUT.csv")));
+   std::string        expected;
+   std::string        line;
+   for (bool first = true; std::getline(expectedLines, line); first = false)
+   {
+      if (first || line.find(",WEAPON_FIRED,") != std::string::npos)
+      {
+         expected += line + '\n';
+      }
+   }
+
+   mSelection.mTypes.emplace_back("weapon_fired");
+   ASSERT_TRUE(EvtQuery::Filter(mIndex, mSelection, mOutput, mError)) << mError;
+   EXPECT_EQ(mOutput.str(), expected);
+}
+
+TEST_F(EvtQueryTest, Summary)
+{
+   ASSERT_TRUE(EvtQuery::Summary(mIndex, mSelection, mOutput, mError)) << mError;
+   EXPECT_EQ(mOutput.str(), ReadFile(DataPath("sample_SUMMARY.csv")));
+}
+
+TEST_F(EvtQueryTest, Extract)
+{
+   mSelection.mName = "red_sam";
+   ASSERT_TRUE(EvtQuery::Extract(mIndex, mSelection, mOutput, mError)) << mError;
+   EXPECT_EQ(mOutput.str(), ReadFile(DataPath("sample_extract_red_sam.txt")));
+}
+
+TEST_F(EvtQueryTest, Combine)
+{
+   ASSERT_TRUE(EvtQuery::Combine(mIndex, mSelection, mOutput, mError)) << mError;
+   EXPECT_EQ(mOutput.str(), ReadFile(DataPath("sample_combine.txt")));
+}
@@ -0,0 +1,20 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef TESTEVTQUERY_HPP
+#define TESTEVTQUERY_HPP
+
+#include <string>
+
+//! The directory of the test data, which is given on the command line
+extern std::string gDataDirectory;
+
+#endif
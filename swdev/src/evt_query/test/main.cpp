@@ -0,0 +1,31 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "TestEvtQuery.hpp"
+
+std::string gDataDirectory;
+
+int main(int argc, char* argv[])
+{
+   ::testing::InitGoogleTest(&argc, argv);
+   if (argc < 2)
+   {
+      std::cerr << "No test data path supplied" << std::endl;
+      return 1;
+   }
+   gDataDirectory = argv[1];
+   return RUN_ALL_TESTS();
+}
@@ -0,0 +1,12 @@
+# ****************************************************************************
+# CUI
+#
+# The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+#
+# The use, dissemination or disclosure of data in this file is subject to
+# limitation or restriction. See accompanying README and LICENSE for details.
+# ****************************************************************************
+# configuration for automatic inclusion as a WSF extension
+set(WSF_EXT_NAME evt_query)
+set(WSF_EXT_TYPE "exe")
+set(WSF_EXT_SOURCE_PATH .)
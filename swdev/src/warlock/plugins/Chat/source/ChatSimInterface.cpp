@@ -18,6 +18,13 @@
 Chat::SimInterface::SimInterface(const QString& aPluginName)
    : warlock::SimInterfaceBase(aPluginName)
 {
+   // SimulationClockRead only copies the simulation time under mSimTimeMutex
+   SetConcurrentRead(true);
+}
+
+Chat::SimInterface::~SimInterface()
+{
+   ShutdownConcurrentRead();
 }
 
 void Chat::SimInterface::MessageSent(const QString& aName, const QString& aChannel, const QString& aText)
@@ -21,6 +21,7 @@ class SimInterface : public warlock::SimInterfaceBase
 {
 public:
    explicit SimInterface(const QString& aPluginName);
+   ~SimInterface() override;
 
    void MessageSent(const QString& aName, const QString& aChannel, const QString& aText);
 
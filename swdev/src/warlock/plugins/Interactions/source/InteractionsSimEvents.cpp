@@ -11,6 +11,12 @@
 
 #include "InteractionsSimEvents.hpp"
 
+#include <sstream>
+#include <vector>
+
+#include <QMutex>
+
+#include "UtTime.hpp"
 #include "VaEntity.hpp"
 #include "VaUtils.hpp"
 #include "VaViewer.hpp"
@@ -19,6 +25,124 @@
 #include "WkfVtkEnvironment.hpp"
 #include "interaction/WkfAttachmentInteraction.hpp"
 
+namespace
+{
+// Recycles the memory of interaction events.
+// They are allocated on the simulation thread and released on the GUI thread.
+class EventPool
+{
+public:
+   ~EventPool()
+   {
+      for (void* ptr : mFree)
+      {
+         ::operator delete(ptr);
+      }
+   }
+
+   void* Allocate()
+   {
+      QMutexLocker locker(&mMutex);
+      if (mFree.empty())
+      {
+         return ::operator new(sizeof(WkInteractions::InteractionEvent));
+      }
+      void* ptr = mFree.back();
+      mFree.pop_back();
+      return ptr;
+   }
+
+   void Release(void* aPtr)
+   {
+      QMutexLocker locker(&mMutex);
+      if (mFree.size() < cMAX_FREE)
+      {
+         mFree.push_back(aPtr);
+      }
+      else
+      {
+         ::operator delete(aPtr);
+      }
+   }
+
+private:
+   // Bounds the memory kept after a burst of events
+   static constexpr size_t cMAX_FREE = 4096;
+
+   QMutex             mMutex;
+   std::vector<void*> mFree;
+};
+
+EventPool& GetEventPool()
+{
+   static EventPool pool;
+   return pool;
+}
+} // namespace
+
+std::string WkInteractions::Annotation::Format() const
+{
+   if (mType == cNONE)
+   {
+      return std::string();
+   }
+
+   std::ostringstream oss;
+   oss << " at T=" << UtTime(mSimTime, UtTime::FmtHMS);
+   switch (mType)
+   {
+   case cJAM:
+      oss << " with " << mSystem << "\nFreq: " << mFrequency << " Hz, BW: " << mBandwidth
+          << " Hz, Technique: " << mMode;
+      break;
+   case cSENSOR_TRACK:
+   case cDETECT:
+      oss << " with " << mSystem << " (mode: " << mMode << ")";
+      break;
+   case cLOCAL_TRACK:
+      oss << " from raw track owned by " << mTarget;
+      break;
+   case cMESSAGE:
+      oss << " using " << mSystem << " (type: " << mMode << ")";
+      break;
+   case cTASK:
+      oss << " to " << mMode << " " << mTarget;
+      if (!mResource.Empty())
+      {
+         oss << " with resource " << mResource << " (mode: " << mResourceMode << ")";
+      }
+      break;
+   case cFIRE:
+      oss << " with " << mSystem;
+      break;
+   case cKILL:
+      oss << " with weapon " << mSystem << " (effect: " << mMode << ")";
+      break;
+   case cTIME_ONLY:
+   default:
+      break;
+   }
+   return oss.str();
+}
+
+void* WkInteractions::InteractionEvent::operator new(size_t aSize)
+{
+   // A derived event may be larger, which the pool can't hold
+   return (aSize == sizeof(InteractionEvent)) ? GetEventPool().Allocate() : ::operator new(aSize);
+}
+
+void WkInteractions::InteractionEvent::operator delete(void* aPtr, size_t aSize)
+{
+   if (aSize == sizeof(InteractionEvent))
+   {
+      GetEventPool().Release(aPtr);
+   }
+   else
+   {
+      ::operator delete(aPtr);
+   }
+}
+
 bool WkInteractions::InteractionEvent::Process(vespa::VaViewer& aViewer, const wkf::InteractionPrefObject* aPrefObjectPtr)
 {
    wkf::Scenario* scenarioPtr = vaEnv.GetStandardScenario();
@@ -29,6 +153,8 @@ bool WkInteractions::InteractionEvent::Process(vespa::VaViewer& aViewer, const w
 
       if (sourceEntityPtr && targetEntityPtr)
       {
+         // Only the interactions being added display text
+         const std::string auxText = mStart ? mAnnotation.Format() : std::string();
          auto* tgtIntPtr = targetEntityPtr->FindFirstAttachmentOfType<wkf::AttachmentInteraction>();
          auto* srcIntPtr = sourceEntityPtr->FindFirstAttachmentOfType<wkf::AttachmentInteraction>();
 
@@ -55,7 +181,7 @@ bool WkInteractions::InteractionEvent::Process(vespa::VaViewer& aViewer, const w
             tgtIntPtr->SetStackingAllowed(aPrefObjectPtr->GetStackingAllowed());
             mStart ? tgtIntPtr->AddInteraction(std::make_pair(mType, wkf::AttachmentInteraction::eINCOMING),
                                                sourceEntityPtr,
-                                               mAuxText,
+                                               auxText,
                                                mId) :
                      tgtIntPtr->RemoveInteraction(std::make_pair(mType, wkf::AttachmentInteraction::eINCOMING),
                                                   sourceEntityPtr,
@@ -67,7 +193,7 @@ bool WkInteractions::InteractionEvent::Process(vespa::VaViewer& aViewer, const w
             srcIntPtr->SetStackingAllowed(aPrefObjectPtr->GetStackingAllowed());
             mStart ? srcIntPtr->AddInteraction(std::make_pair(mType, wkf::AttachmentInteraction::eOUTGOING),
                                                targetEntityPtr,
-                                               mAuxText,
+                                               auxText,
                                                mId) :
                      srcIntPtr->RemoveInteraction(std::make_pair(mType, wkf::AttachmentInteraction::eOUTGOING),
                                                   targetEntityPtr,
@@ -14,6 +14,7 @@
 #include <string>
 
 #include "WkSimInterface.hpp"
+#include "WsfStringId.hpp"
 
 namespace wkf
 {
@@ -27,6 +28,45 @@ class VaViewer;
 
 namespace WkInteractions
 {
+// The data needed to describe an interaction in the tooltip of its line. The text is only formatted when the
+// interaction is added on the GUI thread, so the simulation thread only copies these values.
+struct Annotation
+{
+   enum Type : unsigned char
+   {
+      cNONE,
+      cTIME_ONLY,
+      cJAM,
+      cSENSOR_TRACK,
+      cLOCAL_TRACK,
+      cMESSAGE,
+      cTASK,
+      cDETECT,
+      cFIRE,
+      cKILL
+   };
+
+   Annotation() = default;
+   Annotation(Type aType, double aSimTime)
+      : mType(aType)
+      , mSimTime(aSimTime)
+   {
+   }
+
+   // Returns the text to display when hovering over the interaction line
+   std::string Format() const;
+
+   Type        mType{cNONE};
+   double      mSimTime{0.0};
+   WsfStringId mSystem; // The weapon, sensor or comm used
+   WsfStringId mMode;   // The sensor mode, jamming technique, message type, task type or weapon effect
+   WsfStringId mTarget; // The task target or the owner of the raw track
+   WsfStringId mResource;
+   WsfStringId mResourceMode;
+   double      mFrequency{0.0}; // (Hz)
+   double      mBandwidth{0.0}; // (Hz)
+};
+
 class InteractionEvent : public warlock::SimEvent
 {
 public:
@@ -35,25 +75,30 @@ public:
                     bool               aStart,
                     const std::string& aType,
                     unsigned int       aId,
-                    const std::string& aAuxText = "")
+                    const Annotation&  aAnnotation = Annotation())
       : mSourcePlatformIndex(aSourcePlatformIndex)
       , mTargetPlatformIndex(aTargetPlatformIndex)
       , mStart(aStart)
       , mType(aType)
       , mId(aId)
-      , mAuxText(aAuxText)
+      , mAnnotation(aAnnotation)
    {
    }
 
+   // Interaction events are created on the simulation thread and destroyed on the GUI thread at high rates,
+   // so their memory is recycled rather than returned to the heap.
+   static void* operator new(size_t aSize);
+   static void  operator delete(void* aPtr, size_t aSize);
+
    bool Process(vespa::VaViewer& aViewer, const wkf::InteractionPrefObject* aPrefObjectPtr);
 
 protected:
    size_t       mSourcePlatformIndex;
    size_t       mTargetPlatformIndex;
-   bool         mStart;   // True if adding interaction, false if removing interaction
-   std::string  mType;    // Type of interaction (see wkf::AttachmentInteraction)
-   unsigned int mId;      // A (possibly unique) identifier for this interaction, to allow it to be removed later
-   std::string  mAuxText; // Auxiliary text to display when hovering over interaction line
+   bool         mStart;      // True if adding interaction, false if removing interaction
+   std::string  mType;       // Type of interaction (see wkf::AttachmentInteraction)
+   unsigned int mId;         // A (possibly unique) identifier for this interaction, to allow it to be removed later
+   Annotation   mAnnotation; // Formatted to the text to display when hovering over interaction line
 };
 } // namespace WkInteractions
 
@@ -11,10 +11,7 @@
 
 #include "InteractionsSimInterface.hpp"
 
-#include <sstream>
-
 #include "UtMemory.hpp"
-#include "UtTime.hpp"
 #include "WsfComm.hpp"
 #include "WsfCommNetworkManager.hpp"
 #include "WsfCommObserver.hpp"
@@ -34,10 +31,6 @@
 #include "WsfWeaponObserver.hpp"
 #include "interaction/WkfAttachmentInteraction.hpp"
 
-#define FORMAT_TIME_STRING(TIME) \
-   std::ostringstream oss;       \
-   oss << " at T=" << UtTime(TIME, UtTime::FmtHMS)
-
 WkInteractions::SimInterface::SimInterface(const QString& aPluginName)
    : warlock::SimInterfaceT<InteractionEvent>(aPluginName)
    , mTimeout(0.0)
@@ -77,14 +70,17 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
          .Connect(
             [this](double aSimTime, WsfWeapon* aWeaponPtr, double aFrequency, double aBandwidth, WsfStringId aTechnique, size_t aTargetIndex)
             {
-               FORMAT_TIME_STRING(aSimTime) << " with " << aWeaponPtr->GetName() << "\nFreq: " << aFrequency
-                                            << " Hz, BW: " << aBandwidth << " Hz, Technique: " << aTechnique;
+               Annotation annotation(Annotation::cJAM, aSimTime);
+               annotation.mSystem    = aWeaponPtr->GetNameId();
+               annotation.mMode      = aTechnique;
+               annotation.mFrequency = aFrequency;
+               annotation.mBandwidth = aBandwidth;
                AddSimEvent(ut::make_unique<InteractionEvent>(aWeaponPtr->GetPlatform()->GetIndex(),
                                                              aTargetIndex,
                                                              true,
                                                              wkf::InteractionPrefData::cJAM,
                                                              aWeaponPtr->GetUniqueId(),
-                                                             oss.str()));
+                                                             annotation));
             }));
 
    mCallbacks.Add(
@@ -105,14 +101,15 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                      .Connect(
                         [this](double aSimTime, WsfSensor* aSensorPtr, const WsfTrack* aTrackPtr)
                         {
-                           FORMAT_TIME_STRING(aSimTime)
-                              << " with " << aSensorPtr->GetName() << " (mode: " << aTrackPtr->GetSensorModeId() << ")";
+                           Annotation annotation(Annotation::cSENSOR_TRACK, aSimTime);
+                           annotation.mSystem = aSensorPtr->GetNameId();
+                           annotation.mMode   = aTrackPtr->GetSensorModeId();
                            AddSimEvent(ut::make_unique<InteractionEvent>(aSensorPtr->GetPlatform()->GetIndex(),
                                                                          aTrackPtr->GetTargetIndex(),
                                                                          true,
                                                                          wkf::InteractionPrefData::cTRACK,
                                                                          aTrackPtr->GetTrackId().GetLocalTrackNumber(),
-                                                                         oss.str()));
+                                                                         annotation));
                         }));
 
    mCallbacks.Add(WsfObserver::SensorTrackDropped(&aSimulation)
@@ -133,14 +130,14 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
          .Connect(
             [this](double aSimTime, WsfPlatform* aPlatformPtr, const WsfLocalTrack* aLocalTrackPtr, const WsfTrack* aTrackPtr)
             {
-               FORMAT_TIME_STRING(aSimTime)
-                  << " from raw track owned by " << aTrackPtr->GetTrackId().GetOwningPlatformId();
+               Annotation annotation(Annotation::cLOCAL_TRACK, aSimTime);
+               annotation.mTarget = aTrackPtr->GetTrackId().GetOwningPlatformId();
                AddSimEvent(ut::make_unique<InteractionEvent>(aPlatformPtr->GetIndex(),
                                                              aLocalTrackPtr->GetTargetIndex(),
                                                              true,
                                                              wkf::InteractionPrefData::cLOCALTRACK,
                                                              aLocalTrackPtr->GetTrackId().GetLocalTrackNumber(),
-                                                             oss.str()));
+                                                             annotation));
             }));
 
    mCallbacks.Add(WsfObserver::LocalTrackDropped(&aSimulation)
@@ -169,13 +166,18 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                WsfPlatform* rcvrPtr = aRcvrPtr->GetPlatform();
                if (rcvrPtr)
                {
-                  FORMAT_TIME_STRING(aSimTime)
-                     << " using " << aXmtrPtr->GetName() << " (type: " << aMessage.GetType() << ")";
-                  unsigned int sn   = aMessage.GetSerialNumber();
-                  size_t       xmtr = aXmtrPtr->GetPlatform()->GetIndex();
-                  size_t       rcvr = rcvrPtr->GetIndex();
-                  AddSimEvent(
-                     ut::make_unique<InteractionEvent>(xmtr, rcvr, true, wkf::InteractionPrefData::cMESSAGE, sn, oss.str()));
+                  Annotation annotation(Annotation::cMESSAGE, aSimTime);
+                  annotation.mSystem = aXmtrPtr->GetNameId();
+                  annotation.mMode   = aMessage.GetType();
+                  unsigned int sn    = aMessage.GetSerialNumber();
+                  size_t       xmtr  = aXmtrPtr->GetPlatform()->GetIndex();
+                  size_t       rcvr  = rcvrPtr->GetIndex();
+                  AddSimEvent(ut::make_unique<InteractionEvent>(xmtr,
+                                                                rcvr,
+                                                                true,
+                                                                wkf::InteractionPrefData::cMESSAGE,
+                                                                sn,
+                                                                annotation));
 
                   // Add the timeout event
                   WsfSimulation* simPtr = rcvrPtr->GetSimulation();
@@ -201,9 +203,9 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                                 aDestPtr->GetAddress().GetAddress());
 
                   size_t      rcvrIdx  = rcvrPtr->GetIndex();
-                  std::string rcvrName = aRcvrPtr->GetName();
+                  WsfStringId rcvrName = aRcvrPtr->GetNameId();
                   size_t      srcIndex;
-                  std::string srcName;
+                  WsfStringId srcName;
 
                   auto last = mMessageHopTracker.find(mid);
 
@@ -218,19 +220,25 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                      auto* origComm = aRcvrPtr->GetSimulation()->GetCommNetworkManager()->GetComm(aMessage.GetSrcAddr());
                      if (origComm != nullptr)
                      {
-                        srcName = origComm->GetName();
+                        srcName = origComm->GetNameId();
                      }
                      srcIndex = aMessage.GetOriginatorIndex();
                      // line from orig
                   }
 
 
-                  FORMAT_TIME_STRING(aSimTime) << " using " << srcName << " (type: " << aMessage.GetType() << ")";
-                  unsigned int sn   = aMessage.GetSerialNumber();
-                  size_t       xmtr = srcIndex;
-                  size_t       rcvr = rcvrPtr->GetIndex();
-                  AddSimEvent(
-                     ut::make_unique<InteractionEvent>(xmtr, rcvr, true, wkf::InteractionPrefData::cMESSAGE, sn, oss.str()));
+                  Annotation annotation(Annotation::cMESSAGE, aSimTime);
+                  annotation.mSystem = srcName;
+                  annotation.mMode   = aMessage.GetType();
+                  unsigned int sn    = aMessage.GetSerialNumber();
+                  size_t       xmtr  = srcIndex;
+                  size_t       rcvr  = rcvrPtr->GetIndex();
+                  AddSimEvent(ut::make_unique<InteractionEvent>(xmtr,
+                                                                rcvr,
+                                                                true,
+                                                                wkf::InteractionPrefData::cMESSAGE,
+                                                                sn,
+                                                                annotation));
 
                   // Add the timeout event
                   WsfSimulation* simPtr = rcvrPtr->GetSimulation();
@@ -250,19 +258,17 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                      .Connect(
                         [this](double aSimTime, const WsfTask* aTaskPtr, const WsfTrack* aTrackPtr)
                         {
-                           FORMAT_TIME_STRING(aSimTime)
-                              << " to " << aTaskPtr->GetTaskType() << " " << aTrackPtr->GetTargetName();
-                           if (!aTaskPtr->GetResourceName().Empty())
-                           {
-                              oss << " with resource " << aTaskPtr->GetResourceName()
-                                  << " (mode: " << aTaskPtr->GetResourceMode() << ")";
-                           }
+                           Annotation annotation(Annotation::cTASK, aSimTime);
+                           annotation.mMode         = aTaskPtr->GetTaskType();
+                           annotation.mTarget       = aTrackPtr->GetTargetName();
+                           annotation.mResource     = aTaskPtr->GetResourceName();
+                           annotation.mResourceMode = aTaskPtr->GetResourceMode();
                            AddSimEvent(ut::make_unique<InteractionEvent>(aTaskPtr->GetAssignerPlatformIndex(),
                                                                          aTaskPtr->GetAssigneePlatformIndex(),
                                                                          true,
                                                                          wkf::InteractionPrefData::cTASK,
                                                                          aTaskPtr->GetTaskId(),
-                                                                         oss.str()));
+                                                                         annotation));
                         }));
 
    mCallbacks.Add(WsfObserver::TaskCanceled(&aSimulation)
@@ -293,14 +299,15 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                      .Connect(
                         [this](double aSimTime, WsfSensor* aSensorPtr, size_t aTargetIndex, WsfSensorResult& aResult)
                         {
-                           FORMAT_TIME_STRING(aSimTime) << " with " << aSensorPtr->GetName()
-                                                        << " (mode: " << aSensorPtr->GetCurrentModeName() << ")";
+                           Annotation annotation(Annotation::cDETECT, aSimTime);
+                           annotation.mSystem = aSensorPtr->GetNameId();
+                           annotation.mMode   = aSensorPtr->GetCurrentModeName();
                            AddSimEvent(ut::make_unique<InteractionEvent>(aSensorPtr->GetPlatform()->GetIndex(),
                                                                          aTargetIndex,
                                                                          aResult.Detected(),
                                                                          wkf::InteractionPrefData::cDETECT,
                                                                          aSensorPtr->GetUniqueId(),
-                                                                         oss.str()));
+                                                                         annotation));
                         }));
 
    //****** Weapon Fire
@@ -311,7 +318,8 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                         {
                            if (aEngagementPtr)
                            {
-                              FORMAT_TIME_STRING(aSimTime) << " with " << aEngagementPtr->GetWeaponSystemName();
+                              Annotation annotation(Annotation::cFIRE, aSimTime);
+                              annotation.mSystem = aEngagementPtr->GetWeaponSystemName();
                               AddSimEvent(ut::make_unique<InteractionEvent>(aEngagementPtr->GetFiringPlatformIndex(),
                                                                             aTargetTrackPtr ?
                                                                                aTargetTrackPtr->GetTargetIndex() :
@@ -319,7 +327,7 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                                                                             true,
                                                                             wkf::InteractionPrefData::cFIRE,
                                                                             aEngagementPtr->GetSerialNumber(),
-                                                                            oss.str()));
+                                                                            annotation));
                            }
                         }));
 
@@ -346,13 +354,18 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
             {
                if ((aEngagementPtr) && (aTargetPtr->GetDamageFactor() == 1.0))
                {
-                  FORMAT_TIME_STRING(aSimTime) << " with weapon " << aEngagementPtr->GetWeaponSystemName()
-                                               << " (effect: " << aEngagementPtr->GetWeaponEffects()->GetType() << ")";
+                  Annotation annotation(Annotation::cKILL, aSimTime);
+                  annotation.mSystem  = aEngagementPtr->GetWeaponSystemName();
+                  annotation.mMode    = aEngagementPtr->GetWeaponEffects()->GetType();
                   unsigned int sn     = aEngagementPtr->GetSerialNumber();
                   size_t       firing = aEngagementPtr->GetFiringPlatformIndex();
                   size_t       target = aTargetPtr->GetIndex();
-                  AddSimEvent(
-                     ut::make_unique<InteractionEvent>(firing, target, true, wkf::InteractionPrefData::cKILL, sn, oss.str()));
+                  AddSimEvent(ut::make_unique<InteractionEvent>(firing,
+                                                                target,
+                                                                true,
+                                                                wkf::InteractionPrefData::cKILL,
+                                                                sn,
+                                                                annotation));
 
                   // Add the timeout event
                   WsfSimulation* simPtr = aEngagementPtr->GetSimulation();
@@ -371,13 +384,12 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                      .Connect(
                         [this](double aSimTime, const wsf::cyber::Engagement& aEngagement)
                         {
-                           FORMAT_TIME_STRING(aSimTime);
                            AddSimEvent(ut::make_unique<InteractionEvent>(aEngagement.GetAttackerIndex(),
                                                                          aEngagement.GetVictimIndex(),
                                                                          true,
                                                                          "CyberScan",
                                                                          aEngagement.GetKey(),
-                                                                         oss.str()));
+                                                                         Annotation(Annotation::cTIME_ONLY, aSimTime)));
                         }));
 
    mCallbacks.Add(WsfObserver::CyberScanFailed(&aSimulation)
@@ -444,13 +456,12 @@ void WkInteractions::SimInterface::SimulationInitializing(const WsfSimulation& a
                      .Connect(
                         [this](double aSimTime, const wsf::cyber::Engagement& aEngagement)
                         {
-                           FORMAT_TIME_STRING(aSimTime);
                            AddSimEvent(ut::make_unique<InteractionEvent>(aEngagement.GetAttackerIndex(),
                                                                          aEngagement.GetVictimIndex(),
                                                                          true,
                                                                          "CyberAttack",
                                                                          aEngagement.GetKey(),
-                                                                         oss.str()));
+                                                                         Annotation(Annotation::cTIME_ONLY, aSimTime)));
                         }));
 
    mCallbacks.Add(WsfObserver::CyberAttackFailed(&aSimulation)
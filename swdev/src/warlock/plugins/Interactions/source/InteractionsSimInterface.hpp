@@ -58,8 +58,8 @@ private:
       std::string mSrcAddr;
       std::string mDstAddr;
    };
-   // maps message serial number to previous hop data
-   std::map<MessageId, std::pair<size_t, std::string>> mMessageHopTracker;
+   // maps message serial number to previous hop data (platform index and comm name)
+   std::map<MessageId, std::pair<size_t, WsfStringId>> mMessageHopTracker;
 };
 } // namespace WkInteractions
 #endif // WKINTERACTIONSINTERFACE_HPP
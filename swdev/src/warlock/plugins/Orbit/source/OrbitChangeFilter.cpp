@@ -0,0 +1,215 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "OrbitChangeFilter.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "UtMath.hpp"
+
+namespace
+{
+const size_t cNO_SLOT = std::numeric_limits<size_t>::max();
+
+// The smallest difference between two angles, in [0, pi]
+inline double AngleDifference(double aLhs, double aRhs)
+{
+   double difference = std::abs(aLhs - aRhs);
+   difference -= UtMath::cTWO_PI * std::floor(difference / UtMath::cTWO_PI);
+   return std::min(difference, UtMath::cTWO_PI - difference);
+}
+} // namespace
+
+constexpr double WkOrbit::OrbitChangeFilter::cRELATIVE_SEMI_MAJOR_AXIS_TOLERANCE;
+constexpr double WkOrbit::OrbitChangeFilter::cECCENTRICITY_TOLERANCE;
+constexpr double WkOrbit::OrbitChangeFilter::cANGLE_TOLERANCE;
+
+void WkOrbit::OrbitChangeFilter::Shapes::Resize(size_t aSize)
+{
+   mSemiMajorAxis.resize(aSize);
+   mEccentricity.resize(aSize);
+   mInclination.resize(aSize);
+   mRAAN.resize(aSize);
+   mArgumentOfPeriapsis.resize(aSize);
+}
+
+void WkOrbit::OrbitChangeFilter::Shapes::Set(size_t aIndex, const UtOrbitalElements& aElements)
+{
+   mSemiMajorAxis[aIndex]       = aElements.GetSemiMajorAxis();
+   mEccentricity[aIndex]        = aElements.GetEccentricity();
+   mInclination[aIndex]         = aElements.GetInclination();
+   mRAAN[aIndex]                = aElements.GetRAAN();
+   mArgumentOfPeriapsis[aIndex] = aElements.GetArgumentOfPeriapsis();
+}
+
+void WkOrbit::OrbitChangeFilter::Add(size_t                       aPlatformId,
+                                     double                       aSimTime,
+                                     const UtOrbitalElements&     aElements,
+                                     const ut::optional<UtColor>& aColor)
+{
+   const size_t slot = GetSlot(aPlatformId);
+   auto         it   = mPendingIndex.find(aPlatformId);
+   if (it != mPendingIndex.end())
+   {
+      // A newer report of the same platform replaces the queued one
+      mPending[it->second]      = Update{aPlatformId, aSimTime, aElements, aColor, true};
+      mPendingSlots[it->second] = slot;
+   }
+   else
+   {
+      mPendingIndex[aPlatformId] = mPending.size();
+      mPending.push_back(Update{aPlatformId, aSimTime, aElements, aColor, true});
+      mPendingSlots.push_back(slot);
+   }
+}
+
+void WkOrbit::OrbitChangeFilter::SetDrawn(size_t aPlatformId, const UtOrbitalElements& aElements)
+{
+   const size_t slot = GetSlot(aPlatformId);
+   mDrawn.Set(slot, aElements);
+   mHasDrawn[slot] = true;
+
+   // A periodic update queued earlier is older than the elements just sent, and would redraw the old orbit
+   auto pendingIt = mPendingIndex.find(aPlatformId);
+   if (pendingIt != mPendingIndex.end())
+   {
+      mPendingSlots[pendingIt->second] = cNO_SLOT;
+      mPendingIndex.erase(pendingIt);
+   }
+}
+
+void WkOrbit::OrbitChangeFilter::Remove(size_t aPlatformId)
+{
+   auto slotIt = mSlots.find(aPlatformId);
+   if (slotIt != mSlots.end())
+   {
+      mFreeSlots.push_back(slotIt->second);
+      mHasDrawn[slotIt->second] = false;
+      mSlots.erase(slotIt);
+   }
+   auto pendingIt = mPendingIndex.find(aPlatformId);
+   if (pendingIt != mPendingIndex.end())
+   {
+      mPendingSlots[pendingIt->second] = cNO_SLOT;
+      mPendingIndex.erase(pendingIt);
+   }
+}
+
+void WkOrbit::OrbitChangeFilter::Clear()
+{
+   mDrawn.Resize(0);
+   mHasDrawn.clear();
+   mSlots.clear();
+   mFreeSlots.clear();
+   mPending.clear();
+   mPendingSlots.clear();
+   mPendingIndex.clear();
+}
+
+std::vector<WkOrbit::OrbitChangeFilter::Update> WkOrbit::OrbitChangeFilter::TakeUpdates()
+{
+   const size_t count = mPending.size();
+   mPendingShapes.Resize(count);
+   mDrawnShapes.Resize(count);
+   mChanged.assign(count, 0);
+
+   // Gather the shapes into contiguous arrays, a platform never drawn always changes
+   for (size_t i = 0; i < count; ++i)
+   {
+      const size_t slot = mPendingSlots[i];
+      if (slot == cNO_SLOT)
+      {
+         continue;
+      }
+      mPendingShapes.Set(i, mPending[i].mElements);
+      if (mHasDrawn[slot])
+      {
+         mDrawnShapes.mSemiMajorAxis[i]       = mDrawn.mSemiMajorAxis[slot];
+         mDrawnShapes.mEccentricity[i]        = mDrawn.mEccentricity[slot];
+         mDrawnShapes.mInclination[i]         = mDrawn.mInclination[slot];
+         mDrawnShapes.mRAAN[i]                = mDrawn.mRAAN[slot];
+         mDrawnShapes.mArgumentOfPeriapsis[i] = mDrawn.mArgumentOfPeriapsis[slot];
+      }
+      else
+      {
+         mDrawnShapes.Set(i, mPending[i].mElements);
+         mChanged[i] = 1;
+      }
+   }
+
+   // Compare without branches, so the loop vectorizes
+   const double* newA    = mPendingShapes.mSemiMajorAxis.data();
+   const double* newE    = mPendingShapes.mEccentricity.data();
+   const double* newI    = mPendingShapes.mInclination.data();
+   const double* newRAAN = mPendingShapes.mRAAN.data();
+   const double* newW    = mPendingShapes.mArgumentOfPeriapsis.data();
+   const double* oldA    = mDrawnShapes.mSemiMajorAxis.data();
+   const double* oldE    = mDrawnShapes.mEccentricity.data();
+   const double* oldI    = mDrawnShapes.mInclination.data();
+   const double* oldRAAN = mDrawnShapes.mRAAN.data();
+   const double* oldW    = mDrawnShapes.mArgumentOfPeriapsis.data();
+   char*         changed = mChanged.data();
+   for (size_t i = 0; i < count; ++i)
+   {
+      const double relativeA = std::abs(newA[i] - oldA[i]) / std::max(std::abs(oldA[i]), 1.0);
+      changed[i] |= static_cast<char>((relativeA > cRELATIVE_SEMI_MAJOR_AXIS_TOLERANCE) |
+                                      (std::abs(newE[i] - oldE[i]) > cECCENTRICITY_TOLERANCE) |
+                                      (AngleDifference(newI[i], oldI[i]) > cANGLE_TOLERANCE) |
+                                      (AngleDifference(newRAAN[i], oldRAAN[i]) > cANGLE_TOLERANCE) |
+                                      (AngleDifference(newW[i], oldW[i]) > cANGLE_TOLERANCE));
+   }
+
+   std::vector<Update> updates;
+   updates.reserve(mPendingIndex.size());
+   for (size_t i = 0; i < count; ++i)
+   {
+      const size_t slot = mPendingSlots[i];
+      if (slot != cNO_SLOT)
+      {
+         mPending[i].mShapeChanged = (changed[i] != 0);
+         if (mPending[i].mShapeChanged)
+         {
+            mDrawn.Set(slot, mPending[i].mElements);
+            mHasDrawn[slot] = true;
+         }
+         updates.push_back(std::move(mPending[i]));
+      }
+   }
+   mPending.clear();
+   mPendingSlots.clear();
+   mPendingIndex.clear();
+   return updates;
+}
+
+size_t WkOrbit::OrbitChangeFilter::GetSlot(size_t aPlatformId)
+{
+   auto it = mSlots.find(aPlatformId);
+   if (it != mSlots.end())
+   {
+      return it->second;
+   }
+   size_t slot = mHasDrawn.size();
+   if (!mFreeSlots.empty())
+   {
+      slot = mFreeSlots.back();
+      mFreeSlots.pop_back();
+   }
+   else
+   {
+      mHasDrawn.push_back(false);
+      mDrawn.Resize(slot + 1);
+   }
+   mHasDrawn[slot]     = false;
+   mSlots[aPlatformId] = slot;
+   return slot;
+}
@@ -0,0 +1,104 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef ORBITCHANGEFILTER_HPP
+#define ORBITCHANGEFILTER_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include "UtColor.hpp"
+#include "UtOptional.hpp"
+#include "UtOrbitalElements.hpp"
+
+namespace WkOrbit
+{
+// The WkOrbit::OrbitChangeFilter decides which periodic orbital element updates
+// change the drawn orbit. Every satellite reports its elements once per element
+// output interval, but the orbit shape (semi-major axis, eccentricity,
+// inclination, RAAN and argument of periapsis) of most satellites changes too
+// little between reports to move the drawn orbit, so regenerating its path
+// would be wasted. Every update is passed on, so that the color and the time of
+// the orbit are refreshed, but only the updates that moved the orbit by more
+// than a drawing tolerance since the last drawn elements rebuild it.
+//
+// The last drawn shapes are held as a structure of arrays, so the comparison of
+// a batch of updates is a branch-free loop over contiguous doubles that the
+// compiler vectorizes.
+class OrbitChangeFilter
+{
+public:
+   struct Update
+   {
+      size_t                mPlatformId;
+      double                mSimTime;
+      UtOrbitalElements     mElements;
+      ut::optional<UtColor> mDefinedColor;
+      bool                  mShapeChanged; // Whether the orbit must be rebuilt from mElements
+   };
+
+   // Queues a periodic update, which is passed on by TakeUpdates
+   void Add(size_t                       aPlatformId,
+            double                       aSimTime,
+            const UtOrbitalElements&     aElements,
+            const ut::optional<UtColor>& aColor);
+   // Records elements that were sent to the display by other means (maneuvers, color changes),
+   // and discards the platform's queued update, which they supersede
+   void SetDrawn(size_t aPlatformId, const UtOrbitalElements& aElements);
+   void Remove(size_t aPlatformId);
+   void Clear();
+
+   // Returns the queued updates, and records the ones that move the drawn orbit as drawn.
+   // Only the latest update of a platform is kept.
+   std::vector<Update> TakeUpdates();
+
+   size_t GetPendingCount() const { return mPending.size(); }
+
+private:
+   // Orbit shapes closer than these are drawn identically
+   static constexpr double cRELATIVE_SEMI_MAJOR_AXIS_TOLERANCE = 1.0E-4;
+   static constexpr double cECCENTRICITY_TOLERANCE             = 1.0E-5;
+   static constexpr double cANGLE_TOLERANCE                    = 1.0E-4; // radians
+
+   // Structure of arrays, one entry per orbit shape
+   struct Shapes
+   {
+      void Resize(size_t aSize);
+      void Set(size_t aIndex, const UtOrbitalElements& aElements);
+
+      std::vector<double> mSemiMajorAxis;
+      std::vector<double> mEccentricity;
+      std::vector<double> mInclination;
+      std::vector<double> mRAAN;
+      std::vector<double> mArgumentOfPeriapsis;
+   };
+
+   size_t GetSlot(size_t aPlatformId);
+
+   // The last drawn shape of each platform, by slot
+   Shapes                             mDrawn;
+   std::vector<bool>                  mHasDrawn;
+   std::unordered_map<size_t, size_t> mSlots;
+   std::vector<size_t>                mFreeSlots;
+
+   // The queued updates, and the slot of each
+   std::vector<Update>                mPending;
+   std::vector<size_t>                mPendingSlots;
+   std::unordered_map<size_t, size_t> mPendingIndex; // platform id -> index in mPending
+
+   // Scratch arrays reused by TakeUpdates
+   Shapes            mPendingShapes;
+   Shapes            mDrawnShapes;
+   std::vector<char> mChanged;
+};
+} // namespace WkOrbit
+
+#endif
@@ -30,27 +30,59 @@ void WkOrbit::UpdateOrbitAngles::Process(wkf::OrbitInterface* aInterface)
    aInterface->UpdateOrbitAngles(mSimTime);
 }
 
-void WkOrbit::OrbitalElementsUpdateEvent::Process(wkf::OrbitInterface* aInterfacePtr)
+namespace
+{
+// Refreshes the color and the time of the orbit, and rebuilds it from the elements if aShapeChanged
+void UpdateOrbit(wkf::OrbitInterface*         aInterfacePtr,
+                 size_t                       aPlatformId,
+                 double                       aSimTime,
+                 const UtOrbitalElements&     aElements,
+                 bool                         aManeuver,
+                 const ut::optional<UtColor>& aDefinedColor,
+                 bool                         aShapeChanged = true)
 {
-   wkf::AttachmentOrbit* orbitPtr = aInterfacePtr->GetAttachment(ut::safe_cast<unsigned int, size_t>(mPlatformId));
+   wkf::AttachmentOrbit* orbitPtr = aInterfacePtr->GetAttachment(ut::safe_cast<unsigned int, size_t>(aPlatformId));
    if (orbitPtr)
    {
       if (aInterfacePtr->IsScenarioColorMode())
       {
-         UtColor color(mDefinedColor.value_or(aInterfacePtr->GetTeamColor(mPlatformId)));
+         UtColor color(aDefinedColor.value_or(aInterfacePtr->GetTeamColor(aPlatformId)));
          orbitPtr->SetColor(color);
       }
 
-      orbitPtr->Add(mSimTime,
-                    mElements.GetSemiMajorAxis(),
-                    mElements.GetEccentricity(),
-                    mElements.GetRAAN(),
-                    mElements.GetInclination(),
-                    mElements.GetArgumentOfPeriapsis(),
-                    mElements.GetTrueAnomaly(),
-                    mManeuver);
-      double angle = aInterfacePtr->GetAngleForTime(mSimTime);
-      orbitPtr->UpdateTimeAngle(angle, mSimTime);
+      if (aShapeChanged)
+      {
+         orbitPtr->Add(aSimTime,
+                       aElements.GetSemiMajorAxis(),
+                       aElements.GetEccentricity(),
+                       aElements.GetRAAN(),
+                       aElements.GetInclination(),
+                       aElements.GetArgumentOfPeriapsis(),
+                       aElements.GetTrueAnomaly(),
+                       aManeuver);
+      }
+      double angle = aInterfacePtr->GetAngleForTime(aSimTime);
+      orbitPtr->UpdateTimeAngle(angle, aSimTime);
+   }
+}
+} // namespace
+
+void WkOrbit::OrbitalElementsUpdateEvent::Process(wkf::OrbitInterface* aInterfacePtr)
+{
+   UpdateOrbit(aInterfacePtr, mPlatformId, mSimTime, mElements, mManeuver, mDefinedColor);
+}
+
+void WkOrbit::OrbitalElementsBatchEvent::Process(wkf::OrbitInterface* aInterfacePtr)
+{
+   for (const auto& update : mUpdates)
+   {
+      UpdateOrbit(aInterfacePtr,
+                  update.mPlatformId,
+                  update.mSimTime,
+                  update.mElements,
+                  false,
+                  update.mDefinedColor,
+                  update.mShapeChanged);
    }
 }
 
@@ -12,6 +12,9 @@
 #ifndef ORBITSIMEVENTS_HPP
 #define ORBITSIMEVENTS_HPP
 
+#include <vector>
+
+#include "OrbitChangeFilter.hpp"
 #include "UtOrbitalElements.hpp"
 #include "WkSimInterface.hpp"
 #include "orbit/WkfOrbitInterface.hpp"
@@ -108,6 +111,24 @@ private:
    ut::optional<UtColor> mDefinedColor;
 };
 
+// The latest periodic element update of each orbit since the previous batch
+class OrbitalElementsBatchEvent : public OrbitEvent
+{
+public:
+   explicit OrbitalElementsBatchEvent(std::vector<OrbitChangeFilter::Update>&& aUpdates)
+      : OrbitEvent{false}
+      , mUpdates(std::move(aUpdates))
+   {
+   }
+
+   ~OrbitalElementsBatchEvent() override = default;
+
+   void Process(wkf::OrbitInterface* aInterfacePtr) override;
+
+private:
+   std::vector<OrbitChangeFilter::Update> mUpdates;
+};
+
 class RemoveOrbitEvent : public OrbitEvent
 {
 public:
@@ -44,6 +44,7 @@ void WkOrbit::SimInterface::PlatformDeleted(double aSimTime, const WsfPlatform&
       WsfSpaceMoverBase* moverPtr = dynamic_cast<WsfSpaceMoverBase*>(aPlatform.GetMover());
       if (moverPtr)
       {
+         mOrbitChangeFilter.Remove(aPlatform.GetIndex());
          AddSimEvent(ut::make_unique<RemoveOrbitEvent>(aPlatform.GetIndex()));
       }
    }
@@ -62,6 +63,7 @@ void WkOrbit::SimInterface::SimulationInitializing(const WsfSimulation& aSimulat
 
    mLastOrbitRedrawTime = 0.0;
    mLastMoonRedrawTime  = 0.0;
+   mOrbitChangeFilter.Clear();
 }
 
 void WkOrbit::SimInterface::SimulationStarting(const WsfSimulation& aSimulation)
@@ -77,10 +79,27 @@ void WkOrbit::SimInterface::SimulationComplete(const WsfSimulation& aSimulation)
 
 void WkOrbit::SimInterface::OnSpaceMoverUpdate(double aSimTime, WsfSpaceMoverBase* aMoverPtr)
 {
-   AddSimEvent(ut::make_unique<OrbitalElementsUpdateEvent>(aMoverPtr->GetPlatform()->GetIndex(),
+   SendElements(aSimTime, aMoverPtr, false);
+}
+
+void WkOrbit::SimInterface::OnPeriodicElementsUpdate(double aSimTime, WsfSpaceMoverBase* aMoverPtr)
+{
+   // Sent in a batch by SimulationClockRead, which only redraws the orbit if it moved enough
+   mOrbitChangeFilter.Add(aMoverPtr->GetPlatform()->GetIndex(),
+                          aSimTime,
+                          aMoverPtr->GetOrbitalState().GetOrbitalElementsTOD(),
+                          aMoverPtr->GetOrbitColor());
+}
+
+void WkOrbit::SimInterface::SendElements(double aSimTime, WsfSpaceMoverBase* aMoverPtr, bool aManeuver)
+{
+   const size_t             platformIndex = aMoverPtr->GetPlatform()->GetIndex();
+   const UtOrbitalElements& elements      = aMoverPtr->GetOrbitalState().GetOrbitalElementsTOD();
+   mOrbitChangeFilter.SetDrawn(platformIndex, elements);
+   AddSimEvent(ut::make_unique<OrbitalElementsUpdateEvent>(platformIndex,
                                                            aSimTime,
-                                                           aMoverPtr->GetOrbitalState().GetOrbitalElementsTOD(),
-                                                           false,
+                                                           elements,
+                                                           aManeuver,
                                                            aMoverPtr->GetOrbitColor()));
 }
 
@@ -99,7 +118,7 @@ WsfEvent::EventDisposition WkOrbit::SimInterface::OrbitUpdateEvent::Execute()
          WsfSpaceMoverBase* moverPtr = dynamic_cast<WsfSpaceMoverBase*>(platformPtr->GetMover());
          if (moverPtr)
          {
-            mInterface.OnSpaceMoverUpdate(eventTime, moverPtr);
+            mInterface.OnPeriodicElementsUpdate(eventTime, moverPtr);
             SetTime(eventTime + moverPtr->GetElementOutputUpdateInterval());
             retval = WsfEvent::EventDisposition::cRESCHEDULE;
          }
@@ -113,22 +132,14 @@ void WkOrbit::SimInterface::OnOrbitalManeuverCanceled(double                 aSi
                                                       WsfSpaceMoverBase*     aMoverPtr,
                                                       const WsfOrbitalEvent& aOrbitalEvent)
 {
-   AddSimEvent(ut::make_unique<OrbitalElementsUpdateEvent>(aMoverPtr->GetPlatform()->GetIndex(),
-                                                           aSimTime,
-                                                           aMoverPtr->GetOrbitalState().GetOrbitalElementsTOD(),
-                                                           true,
-                                                           aMoverPtr->GetOrbitColor()));
+   SendElements(aSimTime, aMoverPtr, true);
 }
 
 void WkOrbit::SimInterface::OnOrbitalManeuverCompleted(double                 aSimTime,
                                                        WsfSpaceMoverBase*     aMoverPtr,
                                                        const WsfOrbitalEvent& aOrbitalEvent)
 {
-   AddSimEvent(ut::make_unique<OrbitalElementsUpdateEvent>(aMoverPtr->GetPlatform()->GetIndex(),
-                                                           aSimTime,
-                                                           aMoverPtr->GetOrbitalState().GetOrbitalElementsTOD(),
-                                                           true,
-                                                           aMoverPtr->GetOrbitColor()));
+   SendElements(aSimTime, aMoverPtr, true);
 }
 
 void WkOrbit::SimInterface::SimulationClockRead(const WsfSimulation& aSimulation)
@@ -136,6 +147,14 @@ void WkOrbit::SimInterface::SimulationClockRead(const WsfSimulation& aSimulation
    constexpr double cORBIT_UPDATE_INTERVAL{1.0};
    constexpr double cMOON_UPDATE_INTERVAL{500.0};
 
+   if (mOrbitChangeFilter.GetPendingCount() > 0)
+   {
+      std::vector<OrbitChangeFilter::Update> updates = mOrbitChangeFilter.TakeUpdates();
+      if (!updates.empty())
+      {
+         AddSimEvent(ut::make_unique<OrbitalElementsBatchEvent>(std::move(updates)));
+      }
+   }
    if (aSimulation.GetSimTime() - mLastOrbitRedrawTime > cORBIT_UPDATE_INTERVAL)
    {
       mLastOrbitRedrawTime = aSimulation.GetSimTime();
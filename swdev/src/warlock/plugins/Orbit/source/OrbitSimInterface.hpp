@@ -56,13 +56,16 @@ private:
    };
 
    void OnSpaceMoverUpdate(double aSimTime, WsfSpaceMoverBase* aMoverPtr);
+   void OnPeriodicElementsUpdate(double aSimTime, WsfSpaceMoverBase* aMoverPtr);
+   void SendElements(double aSimTime, WsfSpaceMoverBase* aMoverPtr, bool aManeuver);
 
    void OnOrbitalManeuverCanceled(double aSimTime, WsfSpaceMoverBase* aMoverPtr, const WsfOrbitalEvent& aOrbitalEvent);
    void OnOrbitalManeuverCompleted(double aSimTime, WsfSpaceMoverBase* aMoverPtr, const WsfOrbitalEvent& aOrbitalEvent);
 
-   UtCallbackHolder mCallbacks;
-   double           mLastOrbitRedrawTime{0.0};
-   double           mLastMoonRedrawTime{0.0};
+   UtCallbackHolder  mCallbacks;
+   double            mLastOrbitRedrawTime{0.0};
+   double            mLastMoonRedrawTime{0.0};
+   OrbitChangeFilter mOrbitChangeFilter;
 };
 
 } // namespace WkOrbit
@@ -296,8 +296,12 @@ void WkP6DOF_Controller::HUD::Draw(double aHUD_HalfWidth,
 {
    double ppd = mPixelsPerDegree;
 
-   // Clear out the geodes drawables
+   auto buildStart = std::chrono::steady_clock::now();
+
+   // Clear out the geodes drawables. The nodes themselves are retained by mDrawableCache and reused below,
+   // so only the symbols and values that changed since the previous frame are updated.
    mHudGeode->removeDrawables(0, mHudGeode->getNumDrawables());
+   mDrawableCache.BeginFrame(1.0f * mLineWidthMult);
 
    // Set regions
    mHeadingRegion.SetExtents(-8.0 * ppd, 5.0 * ppd, 8.0 * ppd, 7.0 * ppd);
@@ -526,6 +530,9 @@ void WkP6DOF_Controller::HUD::Draw(double aHUD_HalfWidth,
       DrawUFC();
       DrawStencilBufferRegion(mUfcRegion, 0); // Restore region
    }
+
+   std::chrono::duration<double, std::micro> buildTime = std::chrono::steady_clock::now() - buildStart;
+   mDrawableCache.EndFrame(buildTime.count());
 }
 
 void WkP6DOF_Controller::HUD::SetHudColors(float aHudRedColor, float aHudGreenColor, float aHudBlueColor, float aHudAlphaColor)
@@ -538,9 +545,10 @@ void WkP6DOF_Controller::HUD::SetHudColors(float aHudRedColor, float aHudGreenCo
 
 void WkP6DOF_Controller::HUD::DrawDebugRegion(const RegionExtents& aExtents)
 {
-   double                       hudHalfWidth  = 0;
-   double                       hudHalfHeight = 0;
-   osg::ref_ptr<osg::Vec2Array> verts(new osg::Vec2Array);
+   double                        hudHalfWidth  = 0;
+   double                        hudHalfHeight = 0;
+   osg::ref_ptr<osg::Vec2Array>& verts         = mScratchVertices;
+   verts->clear();
    verts->push_back(osg::Vec2d(aExtents.X1() + hudHalfWidth, aExtents.Y1() + hudHalfHeight));
    verts->push_back(osg::Vec2d(aExtents.X2() + hudHalfWidth, aExtents.Y1() + hudHalfHeight));
    verts->push_back(osg::Vec2d(aExtents.X2() + hudHalfWidth, aExtents.Y2() + hudHalfHeight));
@@ -632,21 +640,8 @@ void WkP6DOF_Controller::HUD::DrawCenterCircle()
 
 void WkP6DOF_Controller::HUD::DrawStencilBufferRegion(const RegionExtents& aExtents, int aStencilValue)
 {
-   osg::ref_ptr<osg::StateSet> stencilStateSet(new osg::StateSet);
-   osg::ref_ptr<osg::Stencil>  stencilStateAttribute(new osg::Stencil);
-   ;
-
-   stencilStateAttribute->setFunction(osg::Stencil::Function::ALWAYS,
-                                      aStencilValue,
-                                      aStencilValue); // Always passes, 1 bit plane, 1 as mask
-   stencilStateAttribute->setOperation(osg::Stencil::KEEP, osg::Stencil::KEEP, osg::Stencil::REPLACE); // Set stencil to
-                                                                                                       // 1 where we draw
-   stencilStateSet->setAttributeAndModes(stencilStateAttribute.get(), osg::StateAttribute::ON);
-
-   // Disable drawing into the color buffer
-   osg::ref_ptr<osg::ColorMask> cMask(new osg::ColorMask);
-   cMask->setMask(false, false, false, false); // Similar to glColorMask(0, 0, 0, 0);
-   stencilStateSet->setAttributeAndModes(cMask.get(), osg::StateAttribute::ON | osg::StateAttribute::OVERRIDE);
+   // Writes aStencilValue where we draw, without drawing into the color buffer
+   osg::ref_ptr<osg::StateSet> stencilStateSet = mDrawableCache.GetStencilWriteState(aStencilValue);
 
    // Disable the depth buffer
    mHudState->setMode(GL_DEPTH_TEST, osg::StateAttribute::OFF);
@@ -657,8 +652,8 @@ void WkP6DOF_Controller::HUD::DrawStencilBufferRegion(const RegionExtents& aExte
    double x2 = aExtents.X2();
    double y2 = aExtents.Y2();
 
-   osg::ref_ptr<osg::Vec2Array> verts(new osg::Vec2Array);
-
+   osg::ref_ptr<osg::Vec2Array>& verts = mScratchVertices;
+   verts->clear();
    verts->push_back(osg::Vec2d(x1, y1));
    verts->push_back(osg::Vec2d(x2, y1));
    verts->push_back(osg::Vec2d(x2, y2));
@@ -671,21 +666,8 @@ void WkP6DOF_Controller::HUD::DrawStencilBufferRegion(const RegionExtents& aExte
 
 void WkP6DOF_Controller::HUD::DrawStencilBufferRegion(const osg::ref_ptr<osg::Vec2Array> aArray, int aStencilValue)
 {
-   osg::ref_ptr<osg::StateSet> stencilStateSet(new osg::StateSet);
-   osg::ref_ptr<osg::Stencil>  stencilStateAttribute(new osg::Stencil);
-   ;
-
-   stencilStateAttribute->setFunction(osg::Stencil::Function::ALWAYS,
-                                      aStencilValue,
-                                      aStencilValue); // Always passes, 1 bit plane, 1 as mask
-   stencilStateAttribute->setOperation(osg::Stencil::KEEP, osg::Stencil::KEEP, osg::Stencil::REPLACE); // Set stencil to
-                                                                                                       // 1 where we draw
-   stencilStateSet->setAttributeAndModes(stencilStateAttribute.get(), osg::StateAttribute::ON);
-
-   // Disable drawing into the color buffer
-   osg::ref_ptr<osg::ColorMask> cMask(new osg::ColorMask);
-   cMask->setMask(false, false, false, false); // Similar to glColorMask(0, 0, 0, 0);
-   stencilStateSet->setAttributeAndModes(cMask.get(), osg::StateAttribute::ON | osg::StateAttribute::OVERRIDE);
+   // Writes aStencilValue where we draw, without drawing into the color buffer
+   osg::ref_ptr<osg::StateSet> stencilStateSet = mDrawableCache.GetStencilWriteState(aStencilValue);
 
    // Disable the depth buffer
    mHudState->setMode(GL_DEPTH_TEST, osg::StateAttribute::OFF);
@@ -698,20 +680,8 @@ void WkP6DOF_Controller::HUD::DrawStencilBufferRegion(const osg::ref_ptr<osg::Ve
 
 osg::ref_ptr<osg::StateSet> WkP6DOF_Controller::HUD::GetStencilDrawWhereMatch()
 {
-   osg::ref_ptr<osg::StateSet> stencilStateSet(new osg::StateSet);
-   osg::ref_ptr<osg::Stencil>  stencilStateAttribute(new osg::Stencil);
-   ;
-
-   stencilStateAttribute->setFunction(osg::Stencil::Function::EQUAL, 1, 1); // Always passes, 1 bit plane, 1 as mask
-   stencilStateAttribute->setOperation(osg::Stencil::KEEP,
-                                       osg::Stencil::KEEP,
-                                       osg::Stencil::KEEP); // Set stencil to 1 where we draw
-
-   stencilStateSet->setAttributeAndModes(stencilStateAttribute.get(), osg::StateAttribute::ON);
-   osg::ref_ptr<osg::ColorMask> cMask(new osg::ColorMask);
-   cMask->setMask(true, true, true, true);
-   stencilStateSet->setAttributeAndModes(cMask.get(), osg::StateAttribute::ON | osg::StateAttribute::OVERRIDE);
-   return stencilStateSet;
+   // The state set is shared by every group drawn within the stencil region
+   return mDrawableCache.GetStencilDrawWhereMatchState();
 }
 
 void WkP6DOF_Controller::HUD::DrawHeadingRegion(double aPixelsPerDegree)
@@ -1746,7 +1716,8 @@ void WkP6DOF_Controller::HUD::DrawRightRegion()
 
 void WkP6DOF_Controller::HUD::DrawAlphaSymbol(osg::ref_ptr<osg::Group>& aGroup, double aX, double aY, double aWidth, double aHeight)
 {
-   osg::ref_ptr<osg::Vec2Array> vertArray(new osg::Vec2Array);
+   osg::ref_ptr<osg::Vec2Array>& vertArray = mScratchVertices;
+   vertArray->clear();
 
    double dx = aWidth * 0.5;
    double dy = aHeight * 0.5;
@@ -2850,41 +2821,12 @@ osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HUD::CreateHudGeometry(osg::ref_ptr
                                                                     int                                aDrawMode,
                                                                     const osg::ref_ptr<osg::Vec4Array> aColor)
 {
-   osg::ref_ptr<osg::Geometry> geom(new osg::Geometry);
-   osg::ref_ptr<osg::Geode>    retGeode(new osg::Geode);
-
-   osg::ref_ptr<osg::DrawArrays> geomArray(new osg::DrawArrays(aDrawMode, 0, aArray->size()));
-   geom->setVertexArray(aArray.get());
-   geom->addPrimitiveSet(geomArray.get());
-
-   geom->setColorArray(aColor);
-   geom->setColorBinding(osg::Geometry::BIND_OVERALL);
-
-   osg::ref_ptr<osg::StateSet>  lineState(new osg::StateSet);
-   osg::ref_ptr<osg::LineWidth> lineWidthAttr(new osg::LineWidth);
-   lineWidthAttr->setWidth(1.0 * mLineWidthMult);
-   lineState->setAttribute(lineWidthAttr.get());
-   lineState->setMode(GL_LINE_SMOOTH, osg::StateAttribute::OVERRIDE | osg::StateAttribute::ON);
-   lineState->setMode(GL_BLEND, osg::StateAttribute::ON);
-   retGeode->setStateSet(lineState.get());
-
-   retGeode->addDrawable(geom.get());
-   return retGeode;
+   // The vertices are copied into geometry retained from the previous frame
+   return mDrawableCache.GetGeometry(*aArray, aDrawMode, (*aColor)[0]);
 }
 
-osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HUD::AddTextItem(std::string                   aStr,
-                                                              float                         aXPos,
-                                                              float                         aYPos,
-                                                              int                           aFontSize,
-                                                              osg::ref_ptr<osg::Vec4Array>& aColor,
-                                                              osgText::Text::AlignmentType  aAlignment)
+osgText::Font* WkP6DOF_Controller::HUD::GetFont()
 {
-   osg::ref_ptr<osgText::Text> textItem(new osgText::Text());
-   textItem->setCharacterSize(aFontSize);
-
-   // Set alignment
-   textItem->setAlignment(aAlignment);
-
    if (mFont == nullptr)
    {
       std::string resourceDir = "";
@@ -2900,16 +2842,18 @@ osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HUD::AddTextItem(std::string
       mFont = osgText::readFontFile("DejaVuSansMono.ttf");
       wd.SetWorkingDirectory();
    }
+   return mFont;
+}
 
-   textItem->setFont(mFont);
-   textItem->setText(aStr);
-   textItem->setAxisAlignment(osgText::Text::SCREEN);
-   textItem->setPosition(osg::Vec3d(aXPos, aYPos, 0));
-   textItem->setColor((*aColor)[0]);
-
-   osg::ref_ptr<osg::Geode> geoNode(new osg::Geode);
-   geoNode->addDrawable(textItem);
-   return geoNode;
+osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HUD::AddTextItem(std::string                   aStr,
+                                                              float                         aXPos,
+                                                              float                         aYPos,
+                                                              int                           aFontSize,
+                                                              osg::ref_ptr<osg::Vec4Array>& aColor,
+                                                              osgText::Text::AlignmentType  aAlignment)
+{
+   // Text is cached by string and font size, so only new strings require a glyph layout
+   return mDrawableCache.GetText(aStr, aXPos, aYPos, aFontSize, (*aColor)[0], aAlignment, GetFont());
 }
 
 osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HUD::AddTextItem(std::string                  aStr,
@@ -2918,37 +2862,7 @@ osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HUD::AddTextItem(std::string
                                                               int                          aFontSize,
                                                               osgText::Text::AlignmentType aAlignment)
 {
-   osg::ref_ptr<osgText::Text> textItem(new osgText::Text());
-   textItem->setCharacterSize(aFontSize);
-
-   // Set alignment
-   textItem->setAlignment(aAlignment);
-
-   if (mFont == nullptr)
-   {
-      std::string resourceDir = "";
-      vespa::VaUtils::GetPathPrioritizedFilename("fonts/DejaVuSansMono.ttf", resourceDir);
-      UtPath path(resourceDir);
-      path.Up();
-
-      // Find the font in the available resource directories
-      // If an empty string is returned, OSG will find some font to use
-
-      UtPath wd = UtPath::WorkingDirectory();
-      path.SetWorkingDirectory();
-      mFont = osgText::readFontFile("DejaVuSansMono.ttf");
-      wd.SetWorkingDirectory();
-   }
-
-   textItem->setFont(mFont);
-   textItem->setText(aStr);
-   textItem->setAxisAlignment(osgText::Text::SCREEN);
-   textItem->setPosition(osg::Vec3d(aXPos, aYPos, 0));
-   textItem->setColor((*mHudColor)[0]);
-
-   osg::ref_ptr<osg::Geode> geoNode(new osg::Geode);
-   geoNode->addDrawable(textItem);
-   return geoNode;
+   return mDrawableCache.GetText(aStr, aXPos, aYPos, aFontSize, (*mHudColor)[0], aAlignment, GetFont());
 }
 
 void WkP6DOF_Controller::HUD::DrawLftMFD(P6DOF_ControllerDataContainer::eMfdMode aMfdMode, bool aActive)
@@ -4637,7 +4551,8 @@ void WkP6DOF_Controller::HUD::DrawCircle(double                        aCx,
                                          int                           aNumPts,
                                          bool                          aFilled)
 {
-   osg::ref_ptr<osg::Vec2Array> vertArray(new osg::Vec2Array);
+   osg::ref_ptr<osg::Vec2Array>& vertArray = mScratchVertices;
+   vertArray->clear();
 
    double deltaAng_rad = UtMath::cTWO_PI / static_cast<double>(aNumPts);
    for (double ang = 0; ang < UtMath::cTWO_PI; ang += deltaAng_rad)
@@ -21,6 +21,7 @@
 #include <osgText/Text>
 
 #include "P6DOF_ControllerDataContainer.hpp"
+#include "P6DOF_ControllerHudDrawableCache.hpp"
 #include "UtoRawShape.hpp"
 #include "VaOverlay.hpp"
 
@@ -70,6 +71,9 @@ public:
    // locked platform in aLockedTargetName, otherwise it returns false.
    bool LockRadarTarget(std::string& aLockedTargetName);
 
+   // Returns the node reuse counts and the time spent building the last frame
+   const HudDrawableCache::Statistics& GetBuildStatistics() const { return mDrawableCache.GetStatistics(); }
+
 protected:
    class RegionExtents
    {
@@ -245,6 +249,9 @@ private:
                    int                           aNumPts = 20,
                    bool                          aFilled = false);
 
+   // Loads the HUD font, if not already loaded
+   osgText::Font* GetFont();
+
    osgText::Font*                     mFont               = nullptr;
    osg::ref_ptr<osg::Geode>           mHudGeode           = nullptr;
    osg::ref_ptr<osg::StateSet>        mHudState           = nullptr;
@@ -252,6 +259,11 @@ private:
    osg::ref_ptr<osg::Projection>      mHudProjection      = nullptr;
    osg::ref_ptr<osg::MatrixTransform> mHudModelViewMatrix = nullptr;
 
+   // Retains the HUD nodes between frames, see Draw()
+   HudDrawableCache mDrawableCache;
+   // Reused by the helpers that build a single symbol, its contents are copied by CreateHudGeometry()
+   osg::ref_ptr<osg::Vec2Array> mScratchVertices = new osg::Vec2Array;
+
    UtoRawShape* mRawShapePtr        = nullptr;
    double       mHUD_HalfWidth      = 0.0;
    double       mHUD_HalfHeight     = 0.0;
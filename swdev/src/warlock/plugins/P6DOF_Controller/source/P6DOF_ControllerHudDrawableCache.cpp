@@ -0,0 +1,198 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "P6DOF_ControllerHudDrawableCache.hpp"
+
+#include <osg/ColorMask>
+#include <osg/LineWidth>
+#include <osg/Stencil>
+
+void WkP6DOF_Controller::HudDrawableCache::BeginFrame(float aLineWidth)
+{
+   ++mFrame;
+   mGeometryUsedCount = 0;
+
+   if (!mLineState.valid() || mLineWidth != aLineWidth)
+   {
+      mLineWidth = aLineWidth;
+      mLineState = new osg::StateSet;
+      osg::ref_ptr<osg::LineWidth> lineWidthAttr(new osg::LineWidth);
+      lineWidthAttr->setWidth(aLineWidth);
+      mLineState->setAttribute(lineWidthAttr.get());
+      mLineState->setMode(GL_LINE_SMOOTH, osg::StateAttribute::OVERRIDE | osg::StateAttribute::ON);
+      mLineState->setMode(GL_BLEND, osg::StateAttribute::ON);
+   }
+}
+
+void WkP6DOF_Controller::HudDrawableCache::EndFrame(double aBuildTime_us)
+{
+   // Values that change every frame (altitude, speed, ...) would otherwise grow the cache without bound
+   for (auto it = mTextCache.begin(); it != mTextCache.end();)
+   {
+      if (mFrame - it->second.mLastFrame > cMAX_IDLE_FRAMES)
+      {
+         it = mTextCache.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+   mStatistics.mCachedTextCount  = mTextCache.size();
+   mStatistics.mLastBuildTime_us = aBuildTime_us;
+}
+
+osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HudDrawableCache::GetGeometry(const osg::Vec2Array& aVertices,
+                                                                           int                   aDrawMode,
+                                                                           const osg::Vec4&      aColor)
+{
+   if (mGeometryUsedCount == mGeometryPool.size())
+   {
+      PooledGeometry pooled;
+      pooled.mGeode     = new osg::Geode;
+      pooled.mGeometry  = new osg::Geometry;
+      pooled.mVertices  = new osg::Vec2Array(aVertices.begin(), aVertices.end());
+      pooled.mColor     = new osg::Vec4Array;
+      pooled.mPrimitive = new osg::DrawArrays(aDrawMode, 0, aVertices.size());
+      pooled.mColor->push_back(aColor);
+
+      // The vertices are modified in place, so use buffer objects rather than display lists
+      pooled.mGeometry->setDataVariance(osg::Object::DYNAMIC);
+      pooled.mGeometry->setUseDisplayList(false);
+      pooled.mGeometry->setUseVertexBufferObjects(true);
+      pooled.mGeometry->setVertexArray(pooled.mVertices.get());
+      pooled.mGeometry->addPrimitiveSet(pooled.mPrimitive.get());
+      pooled.mGeometry->setColorArray(pooled.mColor.get());
+      pooled.mGeometry->setColorBinding(osg::Geometry::BIND_OVERALL);
+      pooled.mGeode->addDrawable(pooled.mGeometry.get());
+
+      mGeometryPool.push_back(pooled);
+      ++mStatistics.mGeometryCreated;
+   }
+   else
+   {
+      PooledGeometry& pooled = mGeometryPool[mGeometryUsedCount];
+      if (pooled.mVertices->asVector() != aVertices.asVector())
+      {
+         pooled.mVertices->assign(aVertices.begin(), aVertices.end());
+         pooled.mVertices->dirty();
+         pooled.mGeometry->dirtyBound();
+      }
+      if (pooled.mPrimitive->getMode() != static_cast<GLenum>(aDrawMode) ||
+          pooled.mPrimitive->getCount() != static_cast<GLsizei>(aVertices.size()))
+      {
+         pooled.mPrimitive->setMode(aDrawMode);
+         pooled.mPrimitive->setCount(aVertices.size());
+         pooled.mPrimitive->dirty();
+      }
+      if ((*pooled.mColor)[0] != aColor)
+      {
+         (*pooled.mColor)[0] = aColor;
+         pooled.mColor->dirty();
+      }
+      ++mStatistics.mGeometryReused;
+   }
+
+   // The state set may have been replaced by the caller during the previous frame (see GetStencilWriteState)
+   osg::ref_ptr<osg::Geode> geode = mGeometryPool[mGeometryUsedCount++].mGeode;
+   geode->setStateSet(mLineState.get());
+   return geode;
+}
+
+osg::ref_ptr<osg::Geode> WkP6DOF_Controller::HudDrawableCache::GetText(const std::string&           aStr,
+                                                                       float                        aXPos,
+                                                                       float                        aYPos,
+                                                                       int                          aFontSize,
+                                                                       const osg::Vec4&             aColor,
+                                                                       osgText::Text::AlignmentType aAlignment,
+                                                                       osgText::Font*               aFont)
+{
+   CachedText& cached = mTextCache[TextKey(aStr, aFontSize, static_cast<int>(aAlignment))];
+   if (cached.mLastFrame != mFrame)
+   {
+      cached.mLastFrame = mFrame;
+      cached.mUsedCount = 0;
+   }
+
+   if (cached.mUsedCount == cached.mGeodes.size())
+   {
+      osg::ref_ptr<osgText::Text> textItem(new osgText::Text());
+      textItem->setDataVariance(osg::Object::DYNAMIC);
+      textItem->setCharacterSize(aFontSize);
+      textItem->setAlignment(aAlignment);
+      textItem->setFont(aFont);
+      textItem->setText(aStr);
+      textItem->setAxisAlignment(osgText::Text::SCREEN);
+      textItem->setPosition(osg::Vec3(aXPos, aYPos, 0.0f));
+      textItem->setColor(aColor);
+
+      osg::ref_ptr<osg::Geode> geoNode(new osg::Geode);
+      geoNode->addDrawable(textItem.get());
+      cached.mGeodes.push_back(geoNode);
+      ++mStatistics.mTextCreated;
+   }
+   else
+   {
+      // Only the position and color can differ from the previous use, neither requires a new glyph layout
+      auto*           textItem = static_cast<osgText::Text*>(cached.mGeodes[cached.mUsedCount]->getDrawable(0));
+      const osg::Vec3 position(aXPos, aYPos, 0.0f);
+      if (textItem->getPosition() != position)
+      {
+         textItem->setPosition(position);
+      }
+      if (textItem->getColor() != aColor)
+      {
+         textItem->setColor(aColor);
+      }
+      ++mStatistics.mTextReused;
+   }
+   return cached.mGeodes[cached.mUsedCount++];
+}
+
+osg::ref_ptr<osg::StateSet> WkP6DOF_Controller::HudDrawableCache::GetStencilWriteState(int aStencilValue)
+{
+   osg::ref_ptr<osg::StateSet>& stateSet = mStencilWriteStates[(aStencilValue != 0) ? 1 : 0];
+   if (!stateSet.valid())
+   {
+      stateSet = new osg::StateSet;
+      osg::ref_ptr<osg::Stencil> stencilStateAttribute(new osg::Stencil);
+      stencilStateAttribute->setFunction(osg::Stencil::Function::ALWAYS,
+                                         aStencilValue,
+                                         aStencilValue); // Always passes, 1 bit plane, 1 as mask
+      // Set stencil to the value where we draw
+      stencilStateAttribute->setOperation(osg::Stencil::KEEP, osg::Stencil::KEEP, osg::Stencil::REPLACE);
+      stateSet->setAttributeAndModes(stencilStateAttribute.get(), osg::StateAttribute::ON);
+
+      // Disable drawing into the color buffer
+      osg::ref_ptr<osg::ColorMask> cMask(new osg::ColorMask);
+      cMask->setMask(false, false, false, false); // Similar to glColorMask(0, 0, 0, 0);
+      stateSet->setAttributeAndModes(cMask.get(), osg::StateAttribute::ON | osg::StateAttribute::OVERRIDE);
+   }
+   return stateSet;
+}
+
+osg::ref_ptr<osg::StateSet> WkP6DOF_Controller::HudDrawableCache::GetStencilDrawWhereMatchState()
+{
+   if (!mStencilDrawWhereMatchState.valid())
+   {
+      mStencilDrawWhereMatchState = new osg::StateSet;
+      osg::ref_ptr<osg::Stencil> stencilStateAttribute(new osg::Stencil);
+      stencilStateAttribute->setFunction(osg::Stencil::Function::EQUAL, 1, 1); // Passes where the stencil is 1
+      stencilStateAttribute->setOperation(osg::Stencil::KEEP, osg::Stencil::KEEP, osg::Stencil::KEEP);
+      mStencilDrawWhereMatchState->setAttributeAndModes(stencilStateAttribute.get(), osg::StateAttribute::ON);
+
+      osg::ref_ptr<osg::ColorMask> cMask(new osg::ColorMask);
+      cMask->setMask(true, true, true, true);
+      mStencilDrawWhereMatchState->setAttributeAndModes(cMask.get(),
+                                                        osg::StateAttribute::ON | osg::StateAttribute::OVERRIDE);
+   }
+   return mStencilDrawWhereMatchState;
+}
@@ -0,0 +1,120 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef P6DOF_CONTROLLERHUDDRAWABLECACHE_HPP
+#define P6DOF_CONTROLLERHUDDRAWABLECACHE_HPP
+
+#include <array>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <osg/Array>
+#include <osg/Geode>
+#include <osg/Geometry>
+#include <osg/PrimitiveSet>
+#include <osg/StateSet>
+#include <osg/ref_ptr>
+#include <osgText/Font>
+#include <osgText/Text>
+
+namespace WkP6DOF_Controller
+{
+// The WkP6DOF_Controller::HudDrawableCache retains the OSG nodes of the HUD
+// between frames. The HUD is still described every frame, but rather than
+// allocating new geometry, text and state for each symbol, the nodes of the
+// previous frame are reused:
+//  - Geometry is pooled by the order in which it is requested during a frame.
+//    Only vertices and colors that changed are copied into the pooled arrays.
+//  - Text is cached by string, font size and alignment, so the (expensive)
+//    glyph layout is only done for strings that were not recently displayed.
+//  - The stencil and line state sets are shared by every node.
+class HudDrawableCache
+{
+public:
+   struct Statistics
+   {
+      size_t mGeometryCreated{0};
+      size_t mGeometryReused{0};
+      size_t mTextCreated{0};
+      size_t mTextReused{0};
+      size_t mCachedTextCount{0};
+      double mLastBuildTime_us{0.0};
+   };
+
+   HudDrawableCache() = default;
+   // The cached nodes are owned by a single scene graph, a copy starts empty
+   HudDrawableCache(const HudDrawableCache&) {}
+   HudDrawableCache& operator=(const HudDrawableCache& aSrc) = delete;
+
+   // Starts describing a new frame. Nodes returned during the previous frame
+   // become available for reuse, so they must no longer be in the scene graph.
+   void BeginFrame(float aLineWidth);
+   // Evicts text that has not been displayed recently and records the build time
+   void EndFrame(double aBuildTime_us);
+
+   // Returns a geode drawing a copy of aVertices with the given mode and color
+   osg::ref_ptr<osg::Geode> GetGeometry(const osg::Vec2Array& aVertices, int aDrawMode, const osg::Vec4& aColor);
+
+   // Returns a geode drawing aStr at the given position
+   osg::ref_ptr<osg::Geode> GetText(const std::string&           aStr,
+                                    float                        aXPos,
+                                    float                        aYPos,
+                                    int                          aFontSize,
+                                    const osg::Vec4&             aColor,
+                                    osgText::Text::AlignmentType aAlignment,
+                                    osgText::Font*               aFont);
+
+   // Returns the state set that writes aStencilValue (0 or 1) into the stencil buffer, without drawing any color
+   osg::ref_ptr<osg::StateSet> GetStencilWriteState(int aStencilValue);
+   // Returns the state set that only draws where the stencil buffer is 1
+   osg::ref_ptr<osg::StateSet> GetStencilDrawWhereMatchState();
+
+   const Statistics& GetStatistics() const { return mStatistics; }
+
+private:
+   // Text not displayed for this many frames is evicted
+   static constexpr unsigned int cMAX_IDLE_FRAMES = 120;
+
+   struct PooledGeometry
+   {
+      osg::ref_ptr<osg::Geode>      mGeode;
+      osg::ref_ptr<osg::Geometry>   mGeometry;
+      osg::ref_ptr<osg::Vec2Array>  mVertices;
+      osg::ref_ptr<osg::Vec4Array>  mColor;
+      osg::ref_ptr<osg::DrawArrays> mPrimitive;
+   };
+
+   // String, font size and alignment
+   using TextKey = std::tuple<std::string, int, int>;
+
+   struct CachedText
+   {
+      // One instance per occurrence of the string in a frame
+      std::vector<osg::ref_ptr<osg::Geode>> mGeodes;
+      size_t                                mUsedCount{0};
+      unsigned int                          mLastFrame{0};
+   };
+
+   std::vector<PooledGeometry>                mGeometryPool;
+   size_t                                     mGeometryUsedCount{0};
+   std::map<TextKey, CachedText>              mTextCache;
+   unsigned int                               mFrame{0};
+   float                                      mLineWidth{0.0f};
+   osg::ref_ptr<osg::StateSet>                mLineState;
+   std::array<osg::ref_ptr<osg::StateSet>, 2> mStencilWriteStates;
+   osg::ref_ptr<osg::StateSet>                mStencilDrawWhereMatchState;
+   Statistics                                 mStatistics;
+};
+} // namespace WkP6DOF_Controller
+
+#endif
@@ -10,6 +10,9 @@
 // ****************************************************************************
 #include "PlatformHistoryPlugin.hpp"
 
+#include <algorithm>
+#include <limits>
+
 #include <QAction>
 #include <QMenu>
 #include <osg/Node>
@@ -44,6 +47,9 @@ const int cDEFAULT_STATE  = 0;
 const int cDETECTED_STATE = 1;
 const int cTRACKED_STATE  = 2;
 const int cATTACKED_STATE = 3;
+
+//! The length (seconds) of a trace line whose length is not set, such as the trace line of an immersive viewer
+const double cDEFAULT_TRACE_LINE_LENGTH = 30.0;
 } // namespace
 
 WKF_PLUGIN_DEFINE_SYMBOLS(WkPlatformHistory::Plugin,
@@ -60,6 +66,7 @@ WkPlatformHistory::Plugin::Plugin(const QString& aPluginName, const size_t aUniq
    mCallbacks.Add(wkf::Observer::ViewerDestroyed.Connect(&Plugin::ViewerDestroyedCB, this));
 
    mPrefObjectPtr = mPrefWidgetPtr->GetPreferenceObject();
+   mTraceStore.SetLength(std::max<double>(mPrefObjectPtr->GetTraceLineLength(), cDEFAULT_TRACE_LINE_LENGTH));
 
    connect(mPrefObjectPtr,
            &wkf::PlatformHistoryPrefObject::TraceLineColorationChanged,
@@ -201,7 +208,21 @@ void WkPlatformHistory::Plugin::GuiUpdate()
 void WkPlatformHistory::Plugin::TraceLineColorationHandler(wkf::TraceStateValue       aColoration,
                                                            const std::vector<QColor>& aColorList)
 {
-   HandleTraceLinePrefChange();
+   // The existing lines are recolored.  Their points are only copied again from the trace store if they lack the
+   // states a state coloration needs, and only once they are visible.
+   std::vector<UtColor> ucl;
+   for (auto qc : aColorList)
+   {
+      ucl.emplace_back(UtColor(qc.redF(), qc.greenF(), qc.blueF(), qc.alphaF()));
+   }
+   for (auto& iter : mTraceLineMap)
+   {
+      iter.second->SetColoration(aColoration, ucl);
+   }
+   for (auto& iter : mImmersiveTraceLines)
+   {
+      iter.second->SetColoration(aColoration, ucl);
+   }
 }
 
 /*************************************************************************************************
@@ -211,6 +232,7 @@ void WkPlatformHistory::Plugin::TraceLineColorationHandler(wkf::TraceStateValue
  **************************************************************************************************/
 void WkPlatformHistory::Plugin::TraceLineLengthHandler(double aLength)
 {
+   mTraceStore.SetLength(std::max<double>(aLength, cDEFAULT_TRACE_LINE_LENGTH));
    HandleTraceLinePrefChange();
 }
 
@@ -608,7 +630,8 @@ void WkPlatformHistory::Plugin::CreateTraceLine(wkf::Platform* aPlatform, bool a
       {
          mTraceLineMap[index]->RemoveAttachment();
       }
-      mTraceLineMap[index] = ut::make_unique<TracelineData>(*platform, vaEnv.GetStandardViewer()); // create it
+      mTraceLineMap[index] =
+         ut::make_unique<TracelineData>(*platform, vaEnv.GetStandardViewer(), mTraceStore); // create it
       mTraceLineMap[index]->SetVisible(Qt::Checked == GetPlatformOptionState(mTraceLineType, platform));
       mTraceLineMap[index]->SetTraceLineLength(mPrefObjectPtr->GetTraceLineLength());
       mTraceLineMap[index]->SetLineWidth(mPrefObjectPtr->GetTraceLineWidth());
@@ -626,7 +649,8 @@ void WkPlatformHistory::Plugin::CreateTraceLine(wkf::Platform* aPlatform, bool a
 
 void WkPlatformHistory::Plugin::SetStandardTraceLineState(unsigned int aId)
 {
-   if (mTraceLineMap.find(aId) != mTraceLineMap.end() && mPrefObjectPtr->GetTraceLineColoration() == wkf::eTRACE_STATE)
+   // The state is kept whatever the coloration, so the trace store has it if the coloration changes to the state
+   if (mTraceLineMap.find(aId) != mTraceLineMap.end())
    {
       mTraceLineMap[aId]->SetState(GetTraceLineState(aId));
    }
@@ -634,8 +658,7 @@ void WkPlatformHistory::Plugin::SetStandardTraceLineState(unsigned int aId)
 
 void WkPlatformHistory::Plugin::SetImmersiveTraceLineState(unsigned int aViewerId, unsigned int aPlatformId)
 {
-   if (mImmersiveTraceLines.find(aViewerId) != mImmersiveTraceLines.end() &&
-       mPrefObjectPtr->GetTraceLineColoration() == wkf::eTRACE_STATE)
+   if (mImmersiveTraceLines.find(aViewerId) != mImmersiveTraceLines.end())
    {
       mImmersiveTraceLines[aViewerId]->SetState(GetTraceLineState(aPlatformId));
    }
@@ -664,7 +687,7 @@ int WkPlatformHistory::Plugin::GetTraceLineState(unsigned int aId)
 
 void WkPlatformHistory::Plugin::HandleTraceLinePrefChange()
 {
-   // Overwrite all existing lines with new lines that start from the time of change
+   // Overwrite all existing lines with new lines, which copy the history of their platforms from the trace store
    for (auto& iter : mTraceLineMap)
    {
       CreateTraceLine(iter.second->GetPlatform(), iter.second->IsVisible());
@@ -755,6 +778,7 @@ void WkPlatformHistory::Plugin::EntityRemovedCB(vespa::VaEntity* aEntityPtr)
    {
       auto index = platform->GetIndex();
       mTraceLineMap.erase(index);
+      mTraceStore.Remove(index);
       mWingRibbonMap.erase(index);
       std::set<unsigned int> remset;
       for (auto& it : mImmersiveTraceLines)
@@ -805,7 +829,7 @@ void WkPlatformHistory::Plugin::AddImmersiveTraceLine(warlock::Platform& aPlatfo
    {
       mImmersiveTraceLines[viewerId]->RemoveAttachment();
    }
-   mImmersiveTraceLines[viewerId] = ut::make_unique<TracelineData>(aPlatform, aViewerPtr);
+   mImmersiveTraceLines[viewerId] = ut::make_unique<TracelineData>(aPlatform, aViewerPtr, mTraceStore);
    auto& ptr                      = mImmersiveTraceLines[viewerId];
    ptr->SetVisible(true);
    ptr->SetLineWidth(mPrefObjectPtr->GetTraceLineWidth());
@@ -874,12 +898,15 @@ void WkPlatformHistory::Plugin::RemoveImmersiveWingRibbon(vespa::VaViewer* aView
  * @param   aPlatform   The platform to attach the traceline to.
  * @date 7/14/2017
  **************************************************************************************************/
-WkPlatformHistory::Plugin::TracelineData::TracelineData(warlock::Platform& aPlatform, vespa::VaViewer* aViewerPtr)
+WkPlatformHistory::Plugin::TracelineData::TracelineData(warlock::Platform& aPlatform,
+                                                        vespa::VaViewer*   aViewerPtr,
+                                                        TraceStore&        aStore)
    : mPlatformPtr(&aPlatform)
-   , mTracelineLengthSec(30)
+   , mTracelineLengthSec(cDEFAULT_TRACE_LINE_LENGTH)
    , mLastUpdateTime(0)
    , mColoration(wkf::eTRACE_STATE)
    , mLineWidth(2)
+   , mStore(aStore)
 {
    auto* traceline = vespa::make_attachment<vespa::VaAttachmentTraceLine>(aPlatform, aViewerPtr);
    vespa::VaAttachment::LoadAttachment(*traceline);
@@ -889,6 +916,7 @@ WkPlatformHistory::Plugin::TracelineData::TracelineData(warlock::Platform& aPlat
 
 void WkPlatformHistory::Plugin::TracelineData::RemoveAttachment()
 {
+   mStore.Release(mPlatformPtr->GetIndex(), mCursor);
    mPlatformPtr->RemoveAttachment(mTraceLineUniqueId);
 }
 
@@ -965,12 +993,15 @@ void WkPlatformHistory::Plugin::TracelineData::SetLineWidth(unsigned int aWidth)
 }
 
 /*************************************************************************************************
- * @brief   Updates the traceline to create a new data point where the platform has moved to.
- *          Also erases the data points the older than the desired length of the wingribbon.
+ * @brief   Adds the point the platform has moved to to the trace store, and brings the traceline up
+ *          to date with the store.  Also erases the data points older than the desired length of
+ *          the traceline.
  * @note This will query for new data points even if the traceline attachment isn't visible. this
  *       behavior is different from wing ribbons wherein datapoints are only genereated when the
  *       attachment is visible.  This allows behavior thus allows the user to see where the
- *       platform was before the traceline was made visible.
+ *       platform was before the traceline was made visible.  The store owns the points: a visible
+ *       attachment is rebuilt from it when the store decimates or drops the points it shows, and a
+ *       hidden attachment holds no points, see TraceStore.
  * @date 7/14/2017
  **************************************************************************************************/
 void WkPlatformHistory::Plugin::TracelineData::Update()
@@ -980,21 +1011,47 @@ void WkPlatformHistory::Plugin::TracelineData::Update()
    {
       mLastUpdateTime = curTime;
 
-      vespa::VaAttachmentTraceLine* traceLine =
-         dynamic_cast<vespa::VaAttachmentTraceLine*>(mPlatformPtr->FindAttachment(mTraceLineUniqueId));
-      if (traceLine != nullptr)
-      {
-         traceLine->PruneBefore(curTime - mTracelineLengthSec);
-
-         double ecef[3];
-         mPlatformPtr->GetPosition().GetECEF(ecef);
-         traceLine->AddPointBack(curTime, ecef);
+      double ecef[3];
+      mPlatformPtr->GetPosition().GetECEF(ecef);
+      mStore.Add(mPlatformPtr->GetIndex(), curTime, ecef, mState);
+   }
 
-         if (mColoration == wkf::eTRACE_STATE)
+   vespa::VaAttachmentTraceLine* traceLine =
+      dynamic_cast<vespa::VaAttachmentTraceLine*>(mPlatformPtr->FindAttachment(mTraceLineUniqueId));
+   if (traceLine == nullptr)
+   {
+      return;
+   }
+   if (traceLine->GetStateVisibility())
+   {
+      traceLine->PruneBefore(curTime - mTracelineLengthSec);
+      mStore.Sync(
+         mPlatformPtr->GetIndex(),
+         curTime - mTracelineLengthSec,
+         mCursor,
+         [this, traceLine]()
          {
-            traceLine->AddStateBack(curTime, mState);
-         }
-      }
+            traceLine->PruneAfter(std::numeric_limits<float>::lowest());
+            mCopiedState = cNO_STATE;
+         },
+         [this, traceLine](const TraceStore::Point& aPoint)
+         {
+            double ecef[3] = {aPoint.mECEF[0], aPoint.mECEF[1], aPoint.mECEF[2]};
+            traceLine->AddPointBack(aPoint.mTime, ecef);
+            // The states are copied whatever the coloration, so a change of coloration only recolors the line
+            if (aPoint.mState != mCopiedState)
+            {
+               traceLine->AddStateBack(aPoint.mTime, aPoint.mState);
+               mCopiedState = aPoint.mState;
+            }
+         });
+   }
+   else if (mCursor.mCounted)
+   {
+      // A hidden traceline holds no points.  It is rebuilt from the store when it is shown.
+      traceLine->PruneAfter(std::numeric_limits<float>::lowest());
+      mCopiedState = cNO_STATE;
+      mStore.Release(mPlatformPtr->GetIndex(), mCursor);
    }
 }
 
@@ -1003,6 +1060,15 @@ void WkPlatformHistory::Plugin::ResetOptionStates()
    for (auto& it : mTraceLineMap)
    {
       it.second->RemoveAttachment();
+      // Keep the history of the platforms that immersive viewers still show
+      unsigned int index = it.first;
+      if (std::none_of(mImmersiveTraceLines.begin(),
+                       mImmersiveTraceLines.end(),
+                       [index](const std::pair<const unsigned int, std::unique_ptr<TracelineData>>& aLine)
+                       { return aLine.second->GetPlatform()->GetIndex() == index; }))
+      {
+         mTraceStore.Remove(index);
+      }
    }
    mTraceLineMap.clear();
    for (auto& jt : mWingRibbonMap)
@@ -1039,7 +1105,8 @@ void WkPlatformHistory::Plugin::SetPlatformOptionState(int aId, bool aSetVisible
             }
             else
             {
-               mTraceLineMap[index] = ut::make_unique<TracelineData>(*platform, vaEnv.GetStandardViewer()); // create it
+               mTraceLineMap[index] =
+                  ut::make_unique<TracelineData>(*platform, vaEnv.GetStandardViewer(), mTraceStore); // create it
                mTraceLineMap[index]->SetVisible(Qt::Checked == GetPlatformOptionState(mTraceLineType, platform));
                mTraceLineMap[index]->SetTraceLineLength(mPrefObjectPtr->GetTraceLineLength());
                mTraceLineMap[index]->SetLineWidth(mPrefObjectPtr->GetTraceLineWidth());
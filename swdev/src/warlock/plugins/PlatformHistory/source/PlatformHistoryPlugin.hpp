@@ -17,6 +17,7 @@
 #include <osg/Vec3>
 
 #include "PlatformHistorySimInterface.hpp"
+#include "PlatformHistoryTraceStore.hpp"
 #include "UtColor.hpp"
 #include "VaCallbackHolder.hpp"
 #include "WkPlatform.hpp"
@@ -112,7 +113,7 @@ private:
    class TracelineData
    {
    public:
-      TracelineData(warlock::Platform& aPlatform, vespa::VaViewer* aViewerPtr);
+      TracelineData(warlock::Platform& aPlatform, vespa::VaViewer* aViewerPtr, TraceStore& aStore);
       void RemoveAttachment();
 
       void SetVisible(bool aVisible);
@@ -127,6 +128,8 @@ private:
       warlock::Platform* GetPlatform() { return mPlatformPtr; }
 
    private:
+      static const int cNO_STATE = -1;
+
       warlock::Platform* mPlatformPtr;
       //! id of trace line attachment for fetching the attachment from the platform pointer
       unsigned int         mTraceLineUniqueId;
@@ -135,6 +138,11 @@ private:
       wkf::TraceStateValue mColoration;
       unsigned int         mLineWidth;
       int                  mState{0};
+      //! The platform's history, which the trace line attachment shows
+      TraceStore&        mStore;
+      TraceStore::Cursor mCursor;
+      //! The last state copied to the trace line attachment
+      int mCopiedState{cNO_STATE};
    };
    void AddImmersiveTraceLine(warlock::Platform& aPlatform, vespa::VaViewer* aViewerPtr);
    void RemoveImmersiveTraceLine(vespa::VaViewer* aViewerPtr);
@@ -153,6 +161,7 @@ private:
    std::map<unsigned int, std::unique_ptr<TracelineData>> mTraceLineMap;
    std::map<unsigned int, std::unique_ptr<TracelineData>> mImmersiveTraceLines;
    std::map<unsigned int, TraceLineStateData>             mTraceLineStateData;
+   TraceStore                                             mTraceStore;
 
    class WingRibbonData
    {
@@ -0,0 +1,286 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "PlatformHistoryTraceStore.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace
+{
+//! The number of points in a chunk
+const std::size_t cCHUNK_SIZE = 256;
+
+//! The distance (meters) a point may be from the trace without it before it is kept, the first time a chunk is
+//! decimated.  The distance doubles each time the chunk is decimated again.
+const double cBASE_TOLERANCE_M = 5.0;
+
+//! The number of times a chunk may be decimated
+const unsigned int cMAX_LEVEL = 8;
+
+//! Returns the distance from aPoint to the segment from aBegin to aEnd
+double DistanceToSegment(const double aPoint[3], const double aBegin[3], const double aEnd[3])
+{
+   double segment[3];
+   double offset[3];
+   double segmentLengthSquared = 0.0;
+   double projection           = 0.0;
+   for (int i = 0; i < 3; ++i)
+   {
+      segment[i] = aEnd[i] - aBegin[i];
+      offset[i]  = aPoint[i] - aBegin[i];
+      segmentLengthSquared += segment[i] * segment[i];
+      projection += segment[i] * offset[i];
+   }
+   double fraction =
+      (segmentLengthSquared > 0.0) ? std::min(1.0, std::max(0.0, projection / segmentLengthSquared)) : 0.0;
+   double distanceSquared = 0.0;
+   for (int i = 0; i < 3; ++i)
+   {
+      double difference = offset[i] - fraction * segment[i];
+      distanceSquared += difference * difference;
+   }
+   return std::sqrt(distanceSquared);
+}
+} // namespace
+
+WkPlatformHistory::TraceStore::TraceStore(std::size_t aPointBudget)
+   : mPointBudget(aPointBudget)
+{
+}
+
+void WkPlatformHistory::TraceStore::Add(unsigned int aId, double aTime, const double aECEF[3], int aState)
+{
+   Trace& trace = mTraces[aId];
+   if (!trace.mChunks.empty() && trace.mChunks.back().mPoints.back().mTime >= aTime)
+   {
+      return;
+   }
+   PruneBefore(trace, aTime - mLength_sec);
+
+   if (trace.mChunks.empty() || trace.mChunks.back().mPoints.size() >= cCHUNK_SIZE)
+   {
+      trace.mChunks.emplace_back();
+      trace.mChunks.back().mPoints.reserve(cCHUNK_SIZE);
+      trace.mChunks.back().mLevel = 0;
+   }
+   trace.mChunks.back().mPoints.push_back(Point{aTime, {aECEF[0], aECEF[1], aECEF[2]}, aState});
+   ++trace.mPointCount;
+   mPointCount += trace.GetWeight();
+
+   EnforceBudget();
+}
+
+void WkPlatformHistory::TraceStore::Remove(unsigned int aId)
+{
+   auto it = mTraces.find(aId);
+   if (it != mTraces.end())
+   {
+      mPointCount -= it->second.mPointCount * it->second.GetWeight();
+      mTraces.erase(it);
+   }
+}
+
+void WkPlatformHistory::TraceStore::Clear()
+{
+   mTraces.clear();
+   mPointCount = 0;
+}
+
+void WkPlatformHistory::TraceStore::Sync(unsigned int                             aId,
+                                         double                                   aBeginTime,
+                                         Cursor&                                  aCursor,
+                                         const std::function<void()>&             aClear,
+                                         const std::function<void(const Point&)>& aAdd)
+{
+   auto traceIt = mTraces.find(aId);
+   if (traceIt == mTraces.end())
+   {
+      return;
+   }
+   Trace& trace = traceIt->second;
+   if (!aCursor.mCounted)
+   {
+      ++trace.mCopies;
+      mPointCount += trace.mPointCount;
+      aCursor.mCounted = true;
+   }
+   if (aCursor.mRevision != trace.mRevision)
+   {
+      // The attachment holds points that the store no longer has
+      aClear();
+      aCursor.mLastTime = std::numeric_limits<double>::lowest();
+      aCursor.mRevision = trace.mRevision;
+   }
+   if (trace.mChunks.empty())
+   {
+      return;
+   }
+   const double firstTime = std::max(aBeginTime, aCursor.mLastTime);
+
+   // Only the chunks that end after the copy are visited, starting from the newest
+   auto endsAfter = [firstTime](const Chunk& aChunk) { return aChunk.mPoints.back().mTime > firstTime; };
+   auto chunkIt   = trace.mChunks.end();
+   while (chunkIt != trace.mChunks.begin() && endsAfter(*std::prev(chunkIt)))
+   {
+      --chunkIt;
+   }
+
+   auto isBefore = [](const Point& aPoint, double aTime) { return aPoint.mTime < aTime; };
+   auto isAfter  = [](double aTime, const Point& aPoint) { return aTime < aPoint.mTime; };
+   for (; chunkIt != trace.mChunks.end(); ++chunkIt)
+   {
+      const auto& points = chunkIt->mPoints;
+      auto        begin  = std::max(std::upper_bound(points.begin(), points.end(), aCursor.mLastTime, isAfter),
+                            std::lower_bound(points.begin(), points.end(), aBeginTime, isBefore));
+      for (auto it = begin; it != points.end(); ++it)
+      {
+         aAdd(*it);
+      }
+   }
+   aCursor.mLastTime = trace.mChunks.back().mPoints.back().mTime;
+}
+
+void WkPlatformHistory::TraceStore::Release(unsigned int aId, Cursor& aCursor)
+{
+   auto traceIt = mTraces.find(aId);
+   if (aCursor.mCounted && traceIt != mTraces.end())
+   {
+      --traceIt->second.mCopies;
+      mPointCount -= traceIt->second.mPointCount;
+   }
+   aCursor = Cursor();
+}
+
+// Drops the chunks that end before aTime.  The chunk that holds aTime is kept whole, so the trace line attachments
+// prune its points as their lengths require.  The attachments do not need to be rebuilt, since they prune the points
+// before their own lengths, which are not longer than the store's.
+void WkPlatformHistory::TraceStore::PruneBefore(Trace& aTrace, double aTime)
+{
+   while (!aTrace.mChunks.empty() && aTrace.mChunks.front().mPoints.back().mTime < aTime)
+   {
+      PopFront(aTrace);
+   }
+}
+
+// Brings the number of points to three quarters of the budget, so the chunks are not decimated again soon.  The
+// oldest chunks are decimated first, so a chunk is decimated more coarsely the older it is.
+void WkPlatformHistory::TraceStore::EnforceBudget()
+{
+   if (mPointCount <= mPointBudget)
+   {
+      return;
+   }
+   std::size_t target = mPointBudget - mPointBudget / 4;
+
+   // The last chunk of a trace is still being filled, so it is not decimated
+   std::vector<std::pair<Trace*, Chunk*>> candidates;
+   for (auto& trace : mTraces)
+   {
+      auto& chunks = trace.second.mChunks;
+      for (std::size_t i = 0; i + 1 < chunks.size(); ++i)
+      {
+         if (chunks[i].mLevel < cMAX_LEVEL)
+         {
+            candidates.emplace_back(&trace.second, &chunks[i]);
+         }
+      }
+   }
+   std::sort(candidates.begin(),
+             candidates.end(),
+             [](const std::pair<Trace*, Chunk*>& aLhs, const std::pair<Trace*, Chunk*>& aRhs)
+             { return aLhs.second->mPoints.back().mTime < aRhs.second->mPoints.back().mTime; });
+
+   bool decimated = true;
+   while (mPointCount > target && decimated)
+   {
+      decimated = false;
+      for (auto& candidate : candidates)
+      {
+         if (mPointCount <= target)
+         {
+            break;
+         }
+         if (candidate.second->mLevel < cMAX_LEVEL)
+         {
+            Decimate(*candidate.first, *candidate.second);
+            decimated = true;
+         }
+      }
+   }
+
+   // Drop the oldest chunks if decimation was not enough
+   while (mPointCount > target)
+   {
+      Trace* oldest = nullptr;
+      for (auto& trace : mTraces)
+      {
+         const auto& chunks = trace.second.mChunks;
+         if (chunks.size() > 1 && (oldest == nullptr ||
+                                   chunks.front().mPoints.back().mTime < oldest->mChunks.front().mPoints.back().mTime))
+         {
+            oldest = &trace.second;
+         }
+      }
+      if (oldest == nullptr)
+      {
+         break;
+      }
+      PopFront(*oldest);
+      ++oldest->mRevision;
+   }
+}
+
+// Keeps the first and last points, the points on either side of a change of state, and the points that are further
+// than the tolerance from the segment that would replace them.
+void WkPlatformHistory::TraceStore::Decimate(Trace& aTrace, Chunk& aChunk)
+{
+   auto&  points    = aChunk.mPoints;
+   double tolerance = std::ldexp(cBASE_TOLERANCE_M, static_cast<int>(aChunk.mLevel));
+   ++aChunk.mLevel;
+   if (points.size() <= 2)
+   {
+      return;
+   }
+
+   std::size_t kept = 1;
+   for (std::size_t i = 1; i + 1 < points.size(); ++i)
+   {
+      const Point& last  = points[kept - 1];
+      const Point& point = points[i];
+      const Point& next  = points[i + 1];
+      if (point.mState != last.mState || point.mState != next.mState ||
+          DistanceToSegment(point.mECEF, last.mECEF, next.mECEF) > tolerance)
+      {
+         points[kept++] = point;
+      }
+   }
+   points[kept++] = points.back();
+
+   if (kept < points.size())
+   {
+      std::size_t removed = points.size() - kept;
+      aTrace.mPointCount -= removed;
+      mPointCount -= removed * aTrace.GetWeight();
+      ++aTrace.mRevision;
+      points.resize(kept);
+      points.shrink_to_fit();
+   }
+}
+
+void WkPlatformHistory::TraceStore::PopFront(Trace& aTrace)
+{
+   std::size_t removed = aTrace.mChunks.front().mPoints.size();
+   aTrace.mPointCount -= removed;
+   mPointCount -= removed * aTrace.GetWeight();
+   aTrace.mChunks.pop_front();
+}
@@ -0,0 +1,116 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef TraceStorePlatformHistory_HPP
+#define TraceStorePlatformHistory_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace WkPlatformHistory
+{
+//! Owns the trace line history of the platforms.  The trace line attachments are only views of it.
+//! Each platform's history is kept in fixed-size chunks.  When the points exceed the point budget, which is shared by
+//! all platforms, the oldest chunks are decimated, more coarsely each time they are chosen, keeping the points that
+//! define the shape of the trace and the points where the state changes.  The oldest chunks are dropped once they
+//! cannot be decimated any further.
+//!
+//! The budget counts the points of the attachments too: each point counts once for the store and once for every
+//! attachment that shows the platform.  When the store decimates or drops a platform's points, the attachments that
+//! show it are rebuilt from the chunks by their next Sync, so they never hold more than the store.
+class TraceStore
+{
+public:
+   struct Point
+   {
+      double mTime;
+      double mECEF[3];
+      int    mState;
+   };
+
+   //! Records what an attachment holds of a platform's history, so that only the points added since are copied, and
+   //! the attachment is rebuilt when the points it holds were decimated or dropped.
+   struct Cursor
+   {
+      double       mLastTime{std::numeric_limits<double>::lowest()};
+      unsigned int mRevision{0};
+      bool         mCounted{false}; //!< Whether the budget counts the attachment
+   };
+
+   explicit TraceStore(std::size_t aPointBudget = cDEFAULT_POINT_BUDGET);
+
+   //! Sets how long (seconds) the history of a platform is kept
+   void SetLength(double aLength_sec) { mLength_sec = aLength_sec; }
+
+   //! Adds a point to the history of a platform.  Points that are not later than the last point are ignored, so
+   //! the trace lines that show the same platform may all add their points.
+   void Add(unsigned int aId, double aTime, const double aECEF[3], int aState);
+   //! Removes the history of a platform.  The attachments that showed it must have been removed.
+   void Remove(unsigned int aId);
+   void Clear();
+
+   //! Brings an attachment up to date with a platform's history.  Only the points added since the last sync are
+   //! appended, unless the points the attachment holds were decimated or dropped since, in which case the attachment
+   //! is cleared and rebuilt.  The attachment is counted against the budget from its first sync until it is released.
+   //! @param aBeginTime Points before this time are not copied.
+   //! @param aCursor    What the attachment holds.  It is updated.
+   //! @param aClear     Removes every point from the attachment.
+   //! @param aAdd       Appends a point to the attachment.
+   void Sync(unsigned int                             aId,
+             double                                   aBeginTime,
+             Cursor&                                  aCursor,
+             const std::function<void()>&             aClear,
+             const std::function<void(const Point&)>& aAdd);
+   //! Stops counting an attachment against the budget.  The caller clears or removes the attachment.
+   void Release(unsigned int aId, Cursor& aCursor);
+
+   //! Returns the number of points held by the store and the attachments
+   std::size_t GetPointCount() const { return mPointCount; }
+
+   static const std::size_t cDEFAULT_POINT_BUDGET = 2000000;
+
+private:
+   struct Chunk
+   {
+      std::vector<Point> mPoints;
+      //! The number of times the chunk has been decimated
+      unsigned int mLevel;
+   };
+   struct Trace
+   {
+      std::deque<Chunk> mChunks;
+      std::size_t       mPointCount{0};
+      //! The number of attachments counted against the budget
+      unsigned int mCopies{0};
+      //! Incremented when points are decimated or dropped, which the attachments have to be rebuilt for
+      unsigned int mRevision{1};
+
+      //! Returns how much a point of the trace counts against the budget
+      std::size_t GetWeight() const { return 1 + mCopies; }
+   };
+
+   void PruneBefore(Trace& aTrace, double aTime);
+   void EnforceBudget();
+   void Decimate(Trace& aTrace, Chunk& aChunk);
+   void PopFront(Trace& aTrace);
+
+   std::unordered_map<unsigned int, Trace> mTraces;
+   std::size_t                             mPointBudget;
+   std::size_t                             mPointCount{0};
+   double                                  mLength_sec{30.0};
+};
+} // namespace WkPlatformHistory
+
+#endif
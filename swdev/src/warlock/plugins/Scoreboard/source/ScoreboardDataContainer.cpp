@@ -0,0 +1,128 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2018 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "ScoreboardDataContainer.hpp"
+
+namespace
+{
+const char* EventTypeName(WkScoreboard::WeaponEventType aEventType)
+{
+   switch (aEventType)
+   {
+   case WkScoreboard::WeaponEventType::Fire:
+      return "Fire";
+   case WkScoreboard::WeaponEventType::Hit:
+      return "Hit";
+   case WkScoreboard::WeaponEventType::Kill:
+      return "Kill";
+   case WkScoreboard::WeaponEventType::Miss:
+      return "Miss";
+   }
+   return "";
+}
+} // namespace
+
+void WkScoreboard::DataContainer::Clear()
+{
+   mNameIds.clear();
+   mNames.clear();
+   mEvents.clear();
+   mCells.clear();
+   mCellIndices.clear();
+   ++mClearCount;
+}
+
+void WkScoreboard::DataContainer::AddScoreboardData(const WeaponEvent& aWeaponEvent)
+{
+   EventRecord record;
+   record.firingPlatformName = Intern(aWeaponEvent.firingPlatformName);
+   record.firingPlatformTeam = Intern(aWeaponEvent.firingPlatformTeam);
+   record.firingPlatformType = Intern(aWeaponEvent.firingPlatformType);
+   record.targetPlatformName = Intern(aWeaponEvent.targetPlatformName);
+   record.targetPlatformTeam = Intern(aWeaponEvent.targetPlatformTeam);
+   record.targetPlatformType = Intern(aWeaponEvent.targetPlatformType);
+   record.weaponType         = Intern(aWeaponEvent.weaponType);
+   record.weaponQuantity     = aWeaponEvent.weaponQuantity;
+   record.simTime            = aWeaponEvent.simTime;
+   record.eventType          = aWeaponEvent.eventType;
+   mEvents.push_back(record);
+
+   const std::array<NameId, cDIMENSION_COUNT> key = {{record.firingPlatformTeam,
+                                                      record.firingPlatformType,
+                                                      record.firingPlatformName,
+                                                      record.weaponType,
+                                                      record.targetPlatformTeam}};
+   auto it = mCellIndices.find(key);
+   if (it == mCellIndices.end())
+   {
+      it = mCellIndices.emplace(key, mCells.size()).first;
+      mCells.push_back(Cell{key, {0, 0, 0, 0}});
+   }
+
+   FireStats& stats = mCells[it->second].mStats;
+   switch (record.eventType)
+   {
+   case WeaponEventType::Fire:
+      stats.totalFired++;
+      break;
+   case WeaponEventType::Hit:
+      stats.totalHit++;
+      break;
+   case WeaponEventType::Kill:
+      stats.totalKill++;
+      break;
+   case WeaponEventType::Miss:
+      stats.totalMiss++;
+      break;
+   }
+}
+
+std::map<std::string, FireStats> WkScoreboard::DataContainer::Aggregate(Dimension aDimension) const
+{
+   std::map<std::string, FireStats> totals;
+   for (const auto& cell : mCells)
+   {
+      auto it = totals.emplace(mNames[cell.mKey[aDimension]], FireStats{0, 0, 0, 0}).first;
+      it->second.totalFired += cell.mStats.totalFired;
+      it->second.totalHit += cell.mStats.totalHit;
+      it->second.totalKill += cell.mStats.totalKill;
+      it->second.totalMiss += cell.mStats.totalMiss;
+   }
+   return totals;
+}
+
+void WkScoreboard::DataContainer::WriteEvents(QTextStream& aStream) const
+{
+   aStream << "Time,Event,Firing Platform,Firing Team,Firing Type,"
+              "Target Platform,Target Team,Target Type,Weapon Type,Quantity\n";
+   for (const auto& record : mEvents)
+   {
+      aStream << QString::number(record.simTime) << "," << EventTypeName(record.eventType) << ","
+              << QString::fromStdString(mNames[record.firingPlatformName]) << ","
+              << QString::fromStdString(mNames[record.firingPlatformTeam]) << ","
+              << QString::fromStdString(mNames[record.firingPlatformType]) << ","
+              << QString::fromStdString(mNames[record.targetPlatformName]) << ","
+              << QString::fromStdString(mNames[record.targetPlatformTeam]) << ","
+              << QString::fromStdString(mNames[record.targetPlatformType]) << ","
+              << QString::fromStdString(mNames[record.weaponType]) << "," << record.weaponQuantity << "\n";
+   }
+}
+
+WkScoreboard::DataContainer::NameId WkScoreboard::DataContainer::Intern(const std::string& aName)
+{
+   auto it = mNameIds.find(aName);
+   if (it == mNameIds.end())
+   {
+      it = mNameIds.emplace(aName, static_cast<NameId>(mNames.size())).first;
+      mNames.push_back(aName);
+   }
+   return it->second;
+}
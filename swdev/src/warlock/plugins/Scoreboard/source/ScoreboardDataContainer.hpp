@@ -12,15 +12,25 @@
 #ifndef SCOREBOARDDATACONTAINER_HPP
 #define SCOREBOARDDATACONTAINER_HPP
 
-#include <fstream>
-#include <sstream>
+#include <array>
+#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <QObject>
+#include <QTextStream>
 
 #include "WsfPlatform.hpp"
 
+struct FireStats
+{
+   int totalFired;
+   int totalHit;
+   int totalKill;
+   int totalMiss;
+};
+
 namespace WkScoreboard
 {
 enum class WeaponEventType
@@ -104,19 +114,75 @@ struct WeaponEvent
    WeaponEventType eventType;
 };
 
+// The recorded weapon events, and their counts pre-aggregated by the names the scoreboard can be filtered by.
+// Names are interned, so each event and each aggregate only stores ids.
 class DataContainer : public QObject
 {
 public:
+   using NameId = unsigned int;
+
+   // The names an event is aggregated by
+   enum Dimension
+   {
+      cFIRING_TEAM,
+      cFIRING_TYPE,
+      cFIRING_NAME,
+      cWEAPON_TYPE,
+      cTARGET_TEAM,
+      cDIMENSION_COUNT
+   };
+
+   struct EventRecord
+   {
+      NameId          firingPlatformName;
+      NameId          firingPlatformTeam;
+      NameId          firingPlatformType;
+      NameId          targetPlatformName;
+      NameId          targetPlatformTeam;
+      NameId          targetPlatformType;
+      NameId          weaponType;
+      int             weaponQuantity;
+      double          simTime;
+      WeaponEventType eventType;
+   };
+
+   // The counts of the events that share the same name in every dimension
+   struct Cell
+   {
+      std::array<NameId, cDIMENSION_COUNT> mKey;
+      FireStats                            mStats;
+   };
+
    DataContainer() {}
 
-   std::vector<WeaponEvent> GetScoreboardData() { return mScoreboardData; }
+   void Clear();
+
+   void AddScoreboardData(const WeaponEvent& aWeaponEvent);
 
-   void Clear() { mScoreboardData.clear(); }
+   // Incremented each time the data is cleared
+   unsigned int GetClearCount() const { return mClearCount; }
+   size_t       GetEventCount() const { return mEvents.size(); }
 
-   void AddScoreboardData(const WeaponEvent& aWeaponEvent) { mScoreboardData.push_back(aWeaponEvent); }
+   const std::vector<EventRecord>& GetEvents() const { return mEvents; }
+   const std::vector<Cell>&        GetCells() const { return mCells; }
+   const std::string&              GetName(NameId aId) const { return mNames[aId]; }
+
+   // Returns the counts summed by the names in the given dimension. The cost depends on the number of cells,
+   // not the number of events.
+   std::map<std::string, FireStats> Aggregate(Dimension aDimension) const;
+
+   // Writes every event as a line of comma separated values, preceded by a header line
+   void WriteEvents(QTextStream& aStream) const;
 
 private:
-   std::vector<WeaponEvent> mScoreboardData;
+   NameId Intern(const std::string& aName);
+
+   std::unordered_map<std::string, NameId>                mNameIds;
+   std::vector<std::string>                               mNames;
+   std::vector<EventRecord>                               mEvents;
+   std::vector<Cell>                                      mCells;
+   std::map<std::array<NameId, cDIMENSION_COUNT>, size_t> mCellIndices;
+   unsigned int                                           mClearCount{0};
 };
 } // namespace WkScoreboard
 
@@ -65,12 +65,37 @@ void WkScoreboard::Dialog::ExportData()
    }
 }
 
+void WkScoreboard::Dialog::ExportEvents()
+{
+   QString fileName = wkf::getSaveFileName(this,
+                                           "Save All Events",
+                                           "",
+                                           "CSV (Comma delimited) (*.csv);;Text Documents (*.txt);;All Files(*)");
+   if (!fileName.isEmpty())
+   {
+      QFile file(fileName);
+      if (!file.open(QIODevice::WriteOnly))
+      {
+         QMessageBox::information(this, "Unable to open file", file.errorString());
+      }
+      else
+      {
+         // Streamed from the event log, one line per event
+         QTextStream out(&file);
+         mScoreboardData.WriteEvents(out);
+      }
+   }
+}
+
 void WkScoreboard::Dialog::ShowContextMenu(const QPoint& pos)
 {
    QMenu   contextMenu;
    QAction exportData("Export Currently Displayed Data");
+   QAction exportEvents("Export All Events");
    connect(&exportData, &QAction::triggered, this, &Dialog::ExportData);
+   connect(&exportEvents, &QAction::triggered, this, &Dialog::ExportEvents);
    contextMenu.addAction(&exportData);
+   contextMenu.addAction(&exportEvents);
    contextMenu.exec(QCursor::pos());
 }
 
@@ -106,9 +131,9 @@ void WkScoreboard::Dialog::Build()
    mUserChange = false;
    mUi.mSelectionComboBox->clear();
    mUi.mSelectionComboBox->addItem(ALL);
-   for (const auto& mComboBoxOption : mComboBoxOptions)
+   for (const auto& it : mData)
    {
-      mUi.mSelectionComboBox->addItem(QString::fromStdString(mComboBoxOption));
+      mUi.mSelectionComboBox->addItem(QString::fromStdString(it.first));
    }
    // after rebuilding the combobox, highlight the user's previous selection (or All if there is none)
    mUi.mSelectionComboBox->setCurrentIndex(mUi.mSelectionComboBox->findText(mPreviousComboString));
@@ -163,108 +188,43 @@ void WkScoreboard::Dialog::Connect()
 
 void WkScoreboard::Dialog::Update()
 {
-   // add new data to the map
-   if (mPreviousVectorSize < mScoreboardData.GetScoreboardData().size())
+   // will only happen if a reset occurs and the scoreboard data is cleared...reset the defaults
+   if (mPreviousClearCount != mScoreboardData.GetClearCount())
    {
-      // filter never changes unless we change combobox
-      while (mPreviousVectorSize < mScoreboardData.GetScoreboardData().size())
-      {
-         switch (mCurrentFiringFilter)
-         {
-         case FilterOptions::Team:
-            AddToMap(mScoreboardData.GetScoreboardData()[mPreviousVectorSize].firingPlatformTeam,
-                     mScoreboardData.GetScoreboardData()[mPreviousVectorSize].eventType);
-            break;
-         case FilterOptions::PlatformType:
-            AddToMap(mScoreboardData.GetScoreboardData()[mPreviousVectorSize].firingPlatformType,
-                     mScoreboardData.GetScoreboardData()[mPreviousVectorSize].eventType);
-            break;
-         case FilterOptions::PlatformName:
-            AddToMap(mScoreboardData.GetScoreboardData()[mPreviousVectorSize].firingPlatformName,
-                     mScoreboardData.GetScoreboardData()[mPreviousVectorSize].eventType);
-            break;
-         case FilterOptions::WeaponType:
-            AddToMap(mScoreboardData.GetScoreboardData()[mPreviousVectorSize].weaponType,
-                     mScoreboardData.GetScoreboardData()[mPreviousVectorSize].eventType);
-            break;
-         }
-         mPreviousVectorSize++;
-      }
+      SetDefaultValues();
       Build();
    }
-   // will only happen if a reset occurs and mScoreboardData vector is cleared...reset the defaults
-   else if (mPreviousVectorSize > mScoreboardData.GetScoreboardData().size())
+   // new data was added, the totals are summed from the pre-aggregated data rather than from every event
+   if (mPreviousEventCount != mScoreboardData.GetEventCount())
    {
-      SetDefaultValues();
+      mData               = mScoreboardData.Aggregate(GetDimension(mCurrentFiringFilter));
+      mPreviousEventCount = mScoreboardData.GetEventCount();
       Build();
    }
 }
 
-void WkScoreboard::Dialog::AddToMap(std::string aKey, WeaponEventType aWeaponEventType)
+WkScoreboard::DataContainer::Dimension WkScoreboard::Dialog::GetDimension(FilterOptions aFilter)
 {
-   auto it = mData.find(aKey);
-   if (it == mData.end())
+   switch (aFilter)
    {
-      FireStats tmp = {0, 0, 0, 0};
-      mData.emplace(aKey, tmp);
-      it = mData.find(aKey);
-   }
-   switch (aWeaponEventType)
-   {
-   case WeaponEventType::Fire:
-      it->second.totalFired++;
-      break;
-   case WeaponEventType::Hit:
-      it->second.totalHit++;
-      break;
-   case WeaponEventType::Kill:
-      it->second.totalKill++;
-      break;
-   case WeaponEventType::Miss:
-      it->second.totalMiss++;
-      break;
+   case FilterOptions::PlatformName:
+      return DataContainer::cFIRING_NAME;
+   case FilterOptions::PlatformType:
+      return DataContainer::cFIRING_TYPE;
+   case FilterOptions::WeaponType:
+      return DataContainer::cWEAPON_TYPE;
+   case FilterOptions::Team:
+   default:
+      return DataContainer::cFIRING_TEAM;
    }
-   mComboBoxOptions.insert(aKey);
 }
 
-
 void WkScoreboard::Dialog::FiringFilterComboBoxChanged()
 {
-   mData.clear();
-   mComboBoxOptions.clear();
    mPreviousComboString = ALL; // change the filter, go back to default value of all
-
-   switch (static_cast<FilterOptions>(mUi.mFilterComboBox->currentData().toInt()))
-   {
-   case FilterOptions::Team:
-      mCurrentFiringFilter = FilterOptions::Team;
-      for (auto& i : mScoreboardData.GetScoreboardData())
-      {
-         AddToMap(i.firingPlatformTeam, i.eventType);
-      }
-      break;
-   case FilterOptions::PlatformType:
-      mCurrentFiringFilter = FilterOptions::PlatformType;
-      for (auto& i : mScoreboardData.GetScoreboardData())
-      {
-         AddToMap(i.firingPlatformType, i.eventType);
-      }
-      break;
-   case FilterOptions::WeaponType:
-      mCurrentFiringFilter = FilterOptions::WeaponType;
-      for (auto& i : mScoreboardData.GetScoreboardData())
-      {
-         AddToMap(i.weaponType, i.eventType);
-      }
-      break;
-   case FilterOptions::PlatformName:
-      mCurrentFiringFilter = FilterOptions::PlatformName;
-      for (auto& i : mScoreboardData.GetScoreboardData())
-      {
-         AddToMap(i.firingPlatformName, i.eventType);
-      }
-      break;
-   }
+   mCurrentFiringFilter = static_cast<FilterOptions>(mUi.mFilterComboBox->currentData().toInt());
+   mData                = mScoreboardData.Aggregate(GetDimension(mCurrentFiringFilter));
+   mPreviousEventCount  = mScoreboardData.GetEventCount();
    Build();
 }
 
@@ -302,11 +262,11 @@ void WkScoreboard::Dialog::HelperButtonClicked()
 void WkScoreboard::Dialog::SetDefaultValues()
 {
    mCurrentFiringFilter = FilterOptions::Team;
-   mPreviousVectorSize  = 0;
+   mPreviousEventCount  = 0;
+   mPreviousClearCount  = mScoreboardData.GetClearCount();
    mUserChange          = true;
    mPreviousComboString = ALL;
    mData.clear();
-   mComboBoxOptions.clear();
    mUi.mFilterComboBox->clear();
 
    // Add options to filter combo box
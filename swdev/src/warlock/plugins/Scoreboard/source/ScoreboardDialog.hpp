@@ -13,7 +13,6 @@
 #define SCOREBOARDDIALOG_HPP
 
 #include <map>
-#include <set>
 
 #include <QDialog>
 #include <QMenu>
@@ -22,14 +21,6 @@
 #include "ScoreboardDataContainer.hpp"
 #include "ui_ScoreboardDialog.h"
 
-struct FireStats
-{
-   int totalFired;
-   int totalHit;
-   int totalKill;
-   int totalMiss;
-};
-
 namespace WkScoreboard
 {
 enum class FilterOptions
@@ -55,25 +46,27 @@ public:
    void Update();
 
 private:
-   void AddToMap(std::string aKey, WeaponEventType aWeaponEventType);
    void Build();
    void BuildHighlightedSelection(int row, std::map<std::string, FireStats>::iterator aIt);
    void Connect();
    void ExportData();
+   void ExportEvents();
    void FiringFilterComboBoxChanged();
    void FiringFilterDetailedComboBoxChanged();
    void HelperButtonClicked();
    void SetDefaultValues();
    void ShowContextMenu(const QPoint& pos);
 
+   static DataContainer::Dimension GetDimension(FilterOptions aFilter);
+
    const QString ALL = "All";
 
    Ui::ScoreboardDialog             mUi;
    DataContainer&                   mScoreboardData;
    std::map<std::string, FireStats> mData;
    FilterOptions                    mCurrentFiringFilter;
-   size_t                           mPreviousVectorSize;
-   std::set<std::string>            mComboBoxOptions;
+   size_t                           mPreviousEventCount;
+   unsigned int                     mPreviousClearCount;
    bool                             mUserChange;
    QString                          mPreviousComboString;
 };
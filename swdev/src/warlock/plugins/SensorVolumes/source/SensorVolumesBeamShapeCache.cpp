@@ -0,0 +1,242 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "SensorVolumesBeamShapeCache.hpp"
+
+#include <cmath>
+#include <initializer_list>
+
+#include "UtMath.hpp"
+#include "sensor_volume/WkfAttachmentSensorVolume.hpp"
+
+void WkSensorVolumes::BeamShape::Apply(wkf::SensorBeam& aSensorBeam) const
+{
+   switch (mType)
+   {
+   case cRectangular:
+      aSensorBeam.RebuildRectangular(mTilt,
+                                     mMinRange,
+                                     mMaxRange,
+                                     mMinAzimuth,
+                                     mMinElevation,
+                                     mMaxAzimuth,
+                                     mMaxElevation);
+      break;
+   case cCircular:
+      aSensorBeam.RebuildCircular(mTilt, mMinRange, mMaxRange, mMaxAzimuth);
+      break;
+   case cPolygonal:
+      aSensorBeam.RebuildPolygonal(mTilt, mMinRange, mMaxRange, mPoints);
+      break;
+   case cNone:
+      break;
+   }
+}
+
+WkSensorVolumes::BeamShapeCache::BeamShapeCache(const wkf::SensorVolumesPrefObject* aPrefObject)
+   : mPrefObject(aPrefObject)
+{
+}
+
+const WkSensorVolumes::BeamShape& WkSensorVolumes::BeamShapeCache::GetShape(const Platform::Beam& aBeam)
+{
+   const wkf::SensorVolumesPrefData::DrawMode drawMode = mPrefObject->GetDrawMode();
+
+   mKey.clear();
+   mKey.push_back(drawMode);
+   mKey.push_back(aBeam.mFOV.mShape);
+   // The point count precedes the points, so that the key can not be split differently by another beam
+   mKey.push_back(static_cast<double>(aBeam.mFOV.mPoints.size()));
+   for (const auto& point : aBeam.mFOV.mPoints)
+   {
+      mKey.push_back(point.first);
+      mKey.push_back(point.second);
+   }
+   mKey.push_back(aBeam.mMinRange);
+   mKey.push_back(aBeam.mMaxRange);
+   mKey.push_back(aBeam.mTilt);
+   mKey.push_back(aBeam.mSlewMode);
+   for (const Platform::AngleLimits* limits : {&aBeam.mSlewLimits, &aBeam.mCueLimits, &aBeam.mScanLimits})
+   {
+      mKey.push_back(limits->mAzimuthLimits.first);
+      mKey.push_back(limits->mAzimuthLimits.second);
+      mKey.push_back(limits->mElevationLimits.first);
+      mKey.push_back(limits->mElevationLimits.second);
+   }
+   mKey.push_back(aBeam.mScanMode);
+   mKey.push_back(aBeam.mBeamWidth.first);
+   mKey.push_back(aBeam.mBeamWidth.second);
+
+   auto it = mShapes.find(mKey);
+   if (it == mShapes.end())
+   {
+      it = mShapes.emplace(mKey, BuildShape(aBeam, drawMode)).first;
+   }
+   return it->second;
+}
+
+const WkSensorVolumes::BeamShapeCache::DisplayData& WkSensorVolumes::BeamShapeCache::GetDisplayData(WsfStringId aModeId,
+                                                                                                     bool        aType)
+{
+   const auto key = std::make_pair(aModeId, aType);
+   auto       it  = mDisplayData.find(key);
+   if (it == mDisplayData.end())
+   {
+      DisplayData data;
+      mPrefObject->GetModeDefinition(aModeId.GetString(),
+                                     aType,
+                                     data.mShowFaces,
+                                     data.mFaceColor,
+                                     data.mShowEdges,
+                                     data.mEdgeColor,
+                                     data.mShowProjections,
+                                     data.mProjectionColor);
+      it = mDisplayData.emplace(key, data).first;
+   }
+   return it->second;
+}
+
+WkSensorVolumes::BeamShape WkSensorVolumes::BeamShapeCache::BuildShape(const Platform::Beam&                aBeam,
+                                                                       wkf::SensorVolumesPrefData::DrawMode aDrawMode)
+{
+   BeamShape shape;
+   shape.mMinRange = aBeam.mMinRange;
+   shape.mMaxRange = aBeam.mMaxRange;
+   if (std::isinf(shape.mMaxRange))
+   {
+      shape.mMaxRange = 63710000.0; // radius of the earth times 10
+   }
+
+   if (aDrawMode == wkf::SensorVolumesPrefData::cSLEW_VOLUME)
+   {
+      shape.mType         = BeamShape::cRectangular;
+      shape.mMinAzimuth   = aBeam.mSlewLimits.mAzimuthLimits.first;
+      shape.mMinElevation = aBeam.mSlewLimits.mElevationLimits.first;
+      shape.mMaxAzimuth   = aBeam.mSlewLimits.mAzimuthLimits.second;
+      shape.mMaxElevation = aBeam.mSlewLimits.mElevationLimits.second;
+   }
+   else if (aDrawMode == wkf::SensorVolumesPrefData::cCUE_VOLUME)
+   {
+      shape.mType         = BeamShape::cRectangular;
+      shape.mMinAzimuth   = aBeam.mCueLimits.mAzimuthLimits.first;
+      shape.mMinElevation = aBeam.mCueLimits.mElevationLimits.first;
+      shape.mMaxAzimuth   = aBeam.mCueLimits.mAzimuthLimits.second;
+      shape.mMaxElevation = aBeam.mCueLimits.mElevationLimits.second;
+   }
+   else if (aDrawMode == wkf::SensorVolumesPrefData::cSCAN_VOLUME)
+   {
+      shape.mType         = BeamShape::cRectangular;
+      shape.mMinAzimuth   = aBeam.mScanLimits.mAzimuthLimits.first;
+      shape.mMinElevation = aBeam.mScanLimits.mElevationLimits.first;
+      shape.mMaxAzimuth   = aBeam.mScanLimits.mAzimuthLimits.second;
+      shape.mMaxElevation = aBeam.mScanLimits.mElevationLimits.second;
+   }
+   else if (aDrawMode == wkf::SensorVolumesPrefData::cBEAM_WIDTH)
+   {
+      shape.mType = BeamShape::cRectangular;
+      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_AZ)
+      {
+         shape.mMinAzimuth = aBeam.mScanLimits.mAzimuthLimits.first;
+         shape.mMaxAzimuth = aBeam.mScanLimits.mAzimuthLimits.second;
+      }
+      else if (aBeam.mBeamWidth.first != 0.0)
+      {
+         shape.mMaxAzimuth = 0.5 * aBeam.mBeamWidth.first;
+         shape.mMinAzimuth = -shape.mMaxAzimuth;
+      }
+      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_EL)
+      {
+         shape.mMinElevation = aBeam.mScanLimits.mElevationLimits.first;
+         shape.mMaxElevation = aBeam.mScanLimits.mElevationLimits.second;
+      }
+      else if (aBeam.mBeamWidth.second)
+      {
+         shape.mMaxElevation = 0.5 * aBeam.mBeamWidth.second;
+         shape.mMinElevation = -shape.mMaxElevation;
+      }
+   }
+   else if ((aDrawMode == wkf::SensorVolumesPrefData::cFIELD_OF_VIEW) ||
+            (!aBeam.mFOV.mPoints.empty())) // we use FOV for calculated, when provided
+   {
+      const auto& points = aBeam.mFOV.mPoints;
+      shape.mTilt        = aBeam.mTilt;
+      if (aBeam.mFOV.mShape == Platform::FOV::cRectangular)
+      {
+         shape.mType         = BeamShape::cRectangular;
+         shape.mMinAzimuth   = points[0].first;
+         shape.mMinElevation = points[0].second;
+         shape.mMaxAzimuth   = points[1].first;
+         shape.mMaxElevation = points[1].second;
+      }
+      else if (aBeam.mFOV.mShape == Platform::FOV::cCircular)
+      {
+         shape.mType       = BeamShape::cCircular;
+         shape.mMaxAzimuth = points[0].first;
+      }
+      else if (aBeam.mFOV.mShape == Platform::FOV::cPolygonal)
+      {
+         shape.mType = BeamShape::cPolygonal;
+         for (const auto& point : points)
+         {
+            shape.mPoints.emplace_back(point.first, point.second);
+         }
+      }
+   }
+   else // calculated
+   {
+      // this will return shapes mostly like those prior to 2.8
+      shape.mType = BeamShape::cRectangular;
+      // if scanning, that volume will be shown instead of the beam
+      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_AZ)
+      {
+         shape.mMinAzimuth = aBeam.mScanLimits.mAzimuthLimits.first;
+         shape.mMaxAzimuth = aBeam.mScanLimits.mAzimuthLimits.second;
+      }
+      else if (aBeam.mBeamWidth.first != 0.0)
+      {
+         shape.mMaxAzimuth = 0.5 * aBeam.mBeamWidth.first;
+         shape.mMinAzimuth = -shape.mMaxAzimuth;
+      }
+      else if (aBeam.mSlewMode & WsfArticulatedPart::cSLEW_AZ)
+      {
+         shape.mMinAzimuth = aBeam.mSlewLimits.mAzimuthLimits.first;
+         shape.mMaxAzimuth = aBeam.mSlewLimits.mAzimuthLimits.second;
+         shape.mNonCueing  = true;
+      }
+      else
+      {
+         shape.mMinAzimuth = -UtMath::cPI;
+         shape.mMaxAzimuth = UtMath::cPI;
+      }
+      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_EL)
+      {
+         shape.mMinElevation = aBeam.mScanLimits.mElevationLimits.first;
+         shape.mMaxElevation = aBeam.mScanLimits.mElevationLimits.second;
+      }
+      else if (aBeam.mBeamWidth.second != 0.0)
+      {
+         shape.mMaxElevation = 0.5 * aBeam.mBeamWidth.second;
+         shape.mMinElevation = -shape.mMaxElevation;
+      }
+      else if (aBeam.mSlewMode & WsfArticulatedPart::cSLEW_EL)
+      {
+         shape.mMinElevation = aBeam.mSlewLimits.mElevationLimits.first;
+         shape.mMaxElevation = aBeam.mSlewLimits.mElevationLimits.second;
+         shape.mNonCueing    = true;
+      }
+      else
+      {
+         shape.mMinElevation = -UtMath::cPI_OVER_2;
+         shape.mMaxElevation = UtMath::cPI_OVER_2;
+      }
+   }
+   return shape;
+}
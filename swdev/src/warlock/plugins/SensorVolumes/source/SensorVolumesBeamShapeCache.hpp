@@ -0,0 +1,96 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef SENSORVOLUMESBEAMSHAPECACHE_HPP
+#define SENSORVOLUMESBEAMSHAPECACHE_HPP
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <QColor>
+
+#include "SensorVolumesPlatform.hpp"
+#include "WsfStringId.hpp"
+#include "sensor_volume/WkfSensorVolumesPrefObject.hpp"
+
+namespace WkSensorVolumes
+{
+//! The geometry of a sensor volume beam, as derived from the beam parameters and the draw mode.
+struct BeamShape
+{
+   enum Type
+   {
+      cNone, //!< The geometry is left as is
+      cRectangular,
+      cCircular,
+      cPolygonal
+   };
+
+   //! Rebuilds the geometry of aSensorBeam with this shape.
+   void Apply(wkf::SensorBeam& aSensorBeam) const;
+
+   Type   mType{cNone};
+   double mTilt{0.0};
+   float  mMinRange{0.0f};
+   float  mMaxRange{0.0f};
+   //! The angular extent of a rectangular shape, or the half angle (mMaxAzimuth) of a circular shape.
+   double                               mMinAzimuth{0.0};
+   double                               mMinElevation{0.0};
+   double                               mMaxAzimuth{0.0};
+   double                               mMaxElevation{0.0};
+   std::vector<std::pair<float, float>> mPoints; //!< The points of a polygonal shape.
+   //! True if the volume shows the slew limits, so it is only articulated by the slew.
+   bool mNonCueing{false};
+};
+
+//! Shares the beam shapes and mode display data among the platforms of the plug-in.
+//! Platforms of the same type have identical beams in each mode, so a shape is derived
+//! once per distinct beam and draw mode, and the display data once per mode, instead of
+//! once per platform. The platforms only apply their own articulation to the volumes.
+class BeamShapeCache
+{
+public:
+   struct DisplayData
+   {
+      bool   mShowFaces;
+      QColor mFaceColor;
+      bool   mShowEdges;
+      QColor mEdgeColor;
+      bool   mShowProjections;
+      QColor mProjectionColor;
+   };
+
+   explicit BeamShapeCache(const wkf::SensorVolumesPrefObject* aPrefObject);
+
+   //! Returns the shape of aBeam in the current draw mode.
+   const BeamShape& GetShape(const Platform::Beam& aBeam);
+   //! Returns the display data of mode aModeId of a sensor (or weapon if aType is true).
+   const DisplayData& GetDisplayData(WsfStringId aModeId, bool aType);
+
+   //! Called when the draw mode changes.
+   void ClearShapes() { mShapes.clear(); }
+   //! Called when the mode definitions change.
+   void ClearDisplayData() { mDisplayData.clear(); }
+
+private:
+   static BeamShape BuildShape(const Platform::Beam& aBeam, wkf::SensorVolumesPrefData::DrawMode aDrawMode);
+
+   const wkf::SensorVolumesPrefObject* mPrefObject;
+
+   //! The key holds the draw mode and the beam parameters.
+   std::map<std::vector<double>, BeamShape>            mShapes;
+   std::map<std::pair<WsfStringId, bool>, DisplayData> mDisplayData;
+   std::vector<double>                                 mKey; //!< Reused to look up shapes
+};
+} // namespace WkSensorVolumes
+
+#endif // !SENSORVOLUMESBEAMSHAPECACHE_HPP
@@ -100,7 +100,8 @@ void WkSensorVolumes::BeamData::SetData(const Platform::Beam& aBeam)
 WkSensorVolumes::Platform::Mode WkSensorVolumes::ModeData::GetData() const
 {
    Platform::Mode retval;
-   retval.mName = mMode->Get();
+   retval.mName   = mMode->Get();
+   retval.mNameId = retval.mName.toStdString();
 
    const int beamCount = mBeamList->Size();
    for (int i = 0; i < beamCount; i++)
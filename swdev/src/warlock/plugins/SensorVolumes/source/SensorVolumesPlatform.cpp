@@ -11,8 +11,11 @@
 
 #include "SensorVolumesPlatform.hpp"
 
+#include <algorithm>
+
 #include <QColor>
 
+#include "SensorVolumesBeamShapeCache.hpp"
 #include "VaEntity.hpp"
 #include "VaUtils.hpp"
 #include "WsfAntennaPattern.hpp"
@@ -75,6 +78,7 @@ WkSensorVolumes::Platform::FOV::FOV(const WsfArticulatedPart* aPart,
 
 WkSensorVolumes::Platform::Mode::Mode(WsfSensorMode& aMode)
    : mName(aMode.GetName().c_str())
+   , mNameId(aMode.GetNameId())
 {
    size_t             beamCount  = aMode.GetBeamCount();
    WsfSensor*         sensor     = aMode.GetSensor();
@@ -98,6 +102,7 @@ WkSensorVolumes::Platform::Mode::Mode(WsfSensorMode& aMode)
 
 WkSensorVolumes::Platform::Mode::Mode(WsfWeapon::WsfWeaponMode& aMode)
    : mName(aMode.GetName().c_str())
+   , mNameId(aMode.GetNameId())
 {
    size_t count = aMode.GetWeapon()->GetEM_XmtrCount();
    for (size_t i = 0; i < count; ++i)
@@ -139,10 +144,13 @@ WkSensorVolumes::Platform::Beam::Beam(const WsfArticulatedPart* aPart,
    }
 }
 
-WkSensorVolumes::Platform::Platform(const wkf::SensorVolumesPrefObject* aPrefObject, bool aType)
+WkSensorVolumes::Platform::Platform(const wkf::SensorVolumesPrefObject* aPrefObject,
+                                    BeamShapeCache&                     aShapeCache,
+                                    bool                                aType)
    : mVisible(true)
    , mVolumeVisible(false)
    , mPrefObject(aPrefObject)
+   , mShapeCache(&aShapeCache)
    , mType(aType)
 {
 }
@@ -153,8 +161,8 @@ void WkSensorVolumes::Platform::RemoveAttachments()
    {
       for (auto& jt : it.second.mModes)
       {
-         vespa::VaEntity* ent = &(jt.second->GetParent());
-         ent->RemoveAttachment(jt.second->GetUniqueId());
+         vespa::VaEntity* ent = &(jt.second.mAttachmentPtr->GetParent());
+         ent->RemoveAttachment(jt.second.mAttachmentPtr->GetUniqueId());
       }
    }
    mSensorMap.clear();
@@ -172,10 +180,10 @@ void WkSensorVolumes::Platform::SetVolumeVisibility(bool aState)
       it.second.mState = aState;
       for (auto& jt : it.second.mModes)
       {
-         int nb = jt.second->NumberBeams();
+         int nb = jt.second.mAttachmentPtr->NumberBeams();
          for (int i = 0; i < nb; i++)
          {
-            auto& beam = jt.second->GetBeam(i);
+            auto& beam = jt.second.mAttachmentPtr->GetBeam(i);
             beam.SetVisible(aState);
             beam.SetMarked(!aState);
          }
@@ -207,10 +215,10 @@ void WkSensorVolumes::Platform::MarkAll(Source aSource)
          {
             for (auto& jt : it.second.mModes)
             {
-               int numBeams = jt.second->NumberBeams();
+               int numBeams = jt.second.mAttachmentPtr->NumberBeams();
                for (int i = 0; i < numBeams; ++i)
                {
-                  jt.second->GetBeam(i).SetMarked(true);
+                  jt.second.mAttachmentPtr->GetBeam(i).SetMarked(true);
                }
             }
          }
@@ -226,10 +234,10 @@ void WkSensorVolumes::Platform::HideMarked()
       {
          for (auto jt : it.second.mModes)
          {
-            int numBeams = jt.second->NumberBeams();
+            int numBeams = jt.second.mAttachmentPtr->NumberBeams();
             for (int i = 0; i < numBeams; ++i)
             {
-               wkf::SensorBeam& beam = jt.second->GetBeam(i);
+               wkf::SensorBeam& beam = jt.second.mAttachmentPtr->GetBeam(i);
                if (beam.IsMarked())
                {
                   beam.SetVisible(false);
@@ -240,14 +248,14 @@ void WkSensorVolumes::Platform::HideMarked()
    }
 }
 
-void WkSensorVolumes::Platform::UpdateAndUnmark(const std::string& aName,
-                                                const double       aSlew[3],
-                                                const double       aCue[3],
-                                                const double       aTranslation[3],
-                                                std::vector<Mode>  aModes,
-                                                vespa::VaEntity*   aEntityPtr,
-                                                vespa::VaViewer*   aViewerPtr,
-                                                Source             aSource)
+void WkSensorVolumes::Platform::UpdateAndUnmark(const std::string&       aName,
+                                                const double             aSlew[3],
+                                                const double             aCue[3],
+                                                const double             aTranslation[3],
+                                                const std::vector<Mode>& aModes,
+                                                vespa::VaEntity*         aEntityPtr,
+                                                vespa::VaViewer*         aViewerPtr,
+                                                Source                   aSource)
 {
    if (aEntityPtr != nullptr)
    {
@@ -257,12 +265,12 @@ void WkSensorVolumes::Platform::UpdateAndUnmark(const std::string& aName,
       sensor.mSource         = aSource;
       for (const Mode& m : aModes)
       {
-         if (sensor.mModes.find(m.mName.toStdString()) == sensor.mModes.end()) // if we don't have the mode
+         if (sensor.mModes.find(m.mNameId) == sensor.mModes.end()) // if we don't have the mode
          {
             auto* attachment = vespa::make_attachment<wkf::AttachmentSensorVolume>(*aEntityPtr,
                                                                                    aViewerPtr,
                                                                                    aName + "_" + m.mName.toStdString());
-            sensor.mModes.emplace(m.mName.toStdString(), attachment);
+            sensor.mModes.emplace(m.mNameId, ModeVolume{attachment, false, false});
          }
       }
 
@@ -277,16 +285,15 @@ void WkSensorVolumes::Platform::ModesReset()
 {
    for (auto& it : mSensorMap)
    {
-      bool   showFaces;
-      bool   showEdges;
-      bool   showProjections;
-      QColor fColor;
-      QColor eColor;
-      QColor pColor;
       for (auto& jt : it.second.mModes)
       {
-         mPrefObject->GetModeDefinition(jt.second->ModeName(), mType, showFaces, fColor, showEdges, eColor, showProjections, pColor);
-         jt.second->SetDisplayData(showFaces, fColor, showEdges, eColor, showProjections, pColor);
+         const BeamShapeCache::DisplayData& data = mShapeCache->GetDisplayData(jt.first, mType);
+         jt.second.mAttachmentPtr->SetDisplayData(data.mShowFaces,
+                                                  data.mFaceColor,
+                                                  data.mShowEdges,
+                                                  data.mEdgeColor,
+                                                  data.mShowProjections,
+                                                  data.mProjectionColor);
       }
    }
 }
@@ -298,10 +305,10 @@ void WkSensorVolumes::Platform::SetSensorVisible(const std::string& aName, bool
 
    for (auto& jt : sensor.mModes)
    {
-      int nb = jt.second->NumberBeams();
+      int nb = jt.second.mAttachmentPtr->NumberBeams();
       for (int i = 0; i < nb; i++)
       {
-         auto& beam = jt.second->GetBeam(i);
+         auto& beam = jt.second.mAttachmentPtr->GetBeam(i);
          beam.SetVisible(aState);
          beam.SetMarked(!aState);
       }
@@ -393,8 +400,8 @@ void WkSensorVolumes::Platform::RemoveAttachmentsPastTimeout(Clock::duration aTi
       {
          for (auto& jt : sensor.mModes)
          {
-            vespa::VaEntity* ent = &(jt.second->GetParent());
-            ent->RemoveAttachment(jt.second->GetUniqueId());
+            vespa::VaEntity* ent = &(jt.second.mAttachmentPtr->GetParent());
+            ent->RemoveAttachment(jt.second.mAttachmentPtr->GetUniqueId());
          }
          it = mSensorMap.erase(it);
       }
@@ -405,21 +412,21 @@ void WkSensorVolumes::Platform::RemoveAttachmentsPastTimeout(Clock::duration aTi
    }
 }
 
-void WkSensorVolumes::Platform::UpdateAttachment(const std::string&           aSensor,
-                                                 const std::string&           aMode,
-                                                 const double                 aSlew[3],
-                                                 const double                 aCue[3],
-                                                 const double                 aTranslation[3],
-                                                 wkf::AttachmentSensorVolume* aAttachment,
-                                                 std::vector<Mode>&           aModes)
+void WkSensorVolumes::Platform::UpdateAttachment(const std::string&       aSensor,
+                                                 WsfStringId              aModeId,
+                                                 const double             aSlew[3],
+                                                 const double             aCue[3],
+                                                 const double             aTranslation[3],
+                                                 ModeVolume&              aVolume,
+                                                 const std::vector<Mode>& aModes)
 {
-   bool nonCueing = false;
-   auto mode      = find(aModes.begin(), aModes.end(), aMode.c_str());
+   wkf::AttachmentSensorVolume* attachment = aVolume.mAttachmentPtr;
+
+   auto mode = std::find(aModes.begin(), aModes.end(), aModeId);
    if (mode != aModes.end())
    {
-      unsigned int numBeams   = mode->mBeamList.size();
-      bool         modeChange = aAttachment->ModeName().c_str() != mode->mName;
-      bool         visible    = false;
+      unsigned int numBeams = mode->mBeamList.size();
+      bool         visible  = false;
       // If the platform is visible, then check to see if the sensor should be shown
       if (mVisible)
       {
@@ -438,204 +445,48 @@ void WkSensorVolumes::Platform::UpdateAttachment(const std::string&           aS
       }
       for (unsigned int i = 0; i < numBeams; ++i)
       {
-         if (aAttachment->NumberBeams() <= i) // if the beams don't exist, add them
+         if (attachment->NumberBeams() <= i) // if the beams don't exist, add them
          {
-            aAttachment->AddBeam();
+            attachment->AddBeam();
          }
-         wkf::SensorBeam& sensorBeam = aAttachment->GetBeam(i);
+         wkf::SensorBeam& sensorBeam = attachment->GetBeam(i);
          sensorBeam.SetVisible(visible);
          sensorBeam.SetMarked(!visible);
 
-         if (modeChange) // else if the mode is different, update
+         if (!aVolume.mBuilt) // the geometry is built once per mode, from the shape shared with other platforms
          {
-            BuildBeam(mode->mBeamList[i], sensorBeam, nonCueing);
-
-            bool   showFaces;
-            bool   showEdges;
-            bool   showProjections;
-            QColor fColor;
-            QColor eColor;
-            QColor pColor;
-            mPrefObject->GetModeDefinition(mode->mName.toStdString(),
-                                           mType,
-                                           showFaces,
-                                           fColor,
-                                           showEdges,
-                                           eColor,
-                                           showProjections,
-                                           pColor);
-            aAttachment->SetDisplayData(showFaces, fColor, showEdges, eColor, showProjections, pColor);
+            const BeamShape& shape = mShapeCache->GetShape(mode->mBeamList[i]);
+            shape.Apply(sensorBeam);
+            aVolume.mNonCueing = aVolume.mNonCueing || shape.mNonCueing;
          }
       }
-      aAttachment->SetModeName(mode->mName.toStdString());
+      if (!aVolume.mBuilt)
+      {
+         const BeamShapeCache::DisplayData& data = mShapeCache->GetDisplayData(aModeId, mType);
+         attachment->SetDisplayData(data.mShowFaces,
+                                    data.mFaceColor,
+                                    data.mShowEdges,
+                                    data.mEdgeColor,
+                                    data.mShowProjections,
+                                    data.mProjectionColor);
+         attachment->SetModeName(mode->mName.toStdString());
+         aVolume.mBuilt = true;
+      }
    }
    wkf::SensorVolumesPrefData::DrawMode drawMode = mPrefObject->GetDrawMode();
 
    if (drawMode == wkf::SensorVolumesPrefData::cSLEW_VOLUME) // these are should not be rotated by the part
    {
       const double zero[3] = {0.0, 0.0, 0.0};
-      aAttachment->Articulate(zero, zero, aTranslation); // articulate
+      attachment->Articulate(zero, zero, aTranslation); // articulate
    }
-   else if ((drawMode == wkf::SensorVolumesPrefData::cCUE_VOLUME) || nonCueing)
+   else if ((drawMode == wkf::SensorVolumesPrefData::cCUE_VOLUME) || aVolume.mNonCueing)
    {
       const double zero[3] = {0.0, 0.0, 0.0};
-      aAttachment->Articulate(aSlew, zero, aTranslation); // articulate
+      attachment->Articulate(aSlew, zero, aTranslation); // articulate
    }
    else
    {
-      aAttachment->Articulate(aSlew, aCue, aTranslation); // articulate
-   }
-}
-
-void WkSensorVolumes::Platform::BuildBeam(Beam& aBeam, wkf::SensorBeam& aSensorBeam, bool& aNonCueing)
-{
-   float minR = aBeam.mMinRange;
-   float maxR = aBeam.mMaxRange;
-   if (std::isinf(maxR))
-   {
-      maxR = 63710000.0; // radius of the earth times 10
-   }
-   wkf::SensorVolumesPrefData::DrawMode drawMode = mPrefObject->GetDrawMode();
-   if (drawMode == wkf::SensorVolumesPrefData::cSLEW_VOLUME)
-   {
-      aSensorBeam.RebuildRectangular(0.0,
-                                     minR,
-                                     maxR,
-                                     aBeam.mSlewLimits.mAzimuthLimits.first,
-                                     aBeam.mSlewLimits.mElevationLimits.first,
-                                     aBeam.mSlewLimits.mAzimuthLimits.second,
-                                     aBeam.mSlewLimits.mElevationLimits.second);
-   }
-   else if (drawMode == wkf::SensorVolumesPrefData::cCUE_VOLUME)
-   {
-      aSensorBeam.RebuildRectangular(0.0,
-                                     minR,
-                                     maxR,
-                                     aBeam.mCueLimits.mAzimuthLimits.first,
-                                     aBeam.mCueLimits.mElevationLimits.first,
-                                     aBeam.mCueLimits.mAzimuthLimits.second,
-                                     aBeam.mCueLimits.mElevationLimits.second);
-   }
-   else if (drawMode == wkf::SensorVolumesPrefData::cSCAN_VOLUME)
-   {
-      aSensorBeam.RebuildRectangular(0.0,
-                                     minR,
-                                     maxR,
-                                     aBeam.mScanLimits.mAzimuthLimits.first,
-                                     aBeam.mScanLimits.mElevationLimits.first,
-                                     aBeam.mScanLimits.mAzimuthLimits.second,
-                                     aBeam.mScanLimits.mElevationLimits.second);
-   }
-   else if (drawMode == wkf::SensorVolumesPrefData::cBEAM_WIDTH)
-   {
-      double azMax = 0.0;
-      double azMin = 0.0;
-      double elMax = 0.0;
-      double elMin = 0.0;
-      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_AZ)
-      {
-         azMin = aBeam.mScanLimits.mAzimuthLimits.first;
-         azMax = aBeam.mScanLimits.mAzimuthLimits.second;
-      }
-      else if (aBeam.mBeamWidth.first != 0.0)
-      {
-         azMax = 0.5 * aBeam.mBeamWidth.first;
-         azMin = -azMax;
-      }
-      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_EL)
-      {
-         elMin = aBeam.mScanLimits.mElevationLimits.first;
-         elMax = aBeam.mScanLimits.mElevationLimits.second;
-      }
-      else if (aBeam.mBeamWidth.second)
-      {
-         elMax = 0.5 * aBeam.mBeamWidth.second;
-         elMin = -elMax;
-      }
-      aSensorBeam.RebuildRectangular(0.0, minR, maxR, azMin, elMin, azMax, elMax);
-   }
-   else if ((drawMode == wkf::SensorVolumesPrefData::cFIELD_OF_VIEW) ||
-            (!aBeam.mFOV.mPoints.empty())) // we use FOV for calculated, when provided
-   {
-      int   shape = aBeam.mFOV.mShape;
-      float tilt  = aBeam.mTilt;
-      if (shape == FOV::cRectangular) // rectangular
-      {
-         float minAz = aBeam.mFOV.mPoints[0].first;
-         float minEl = aBeam.mFOV.mPoints[0].second;
-         float maxAz = aBeam.mFOV.mPoints[1].first;
-         float maxEl = aBeam.mFOV.mPoints[1].second;
-
-         aSensorBeam.RebuildRectangular(tilt, minR, maxR, minAz, minEl, maxAz, maxEl);
-      }
-      else if (shape == FOV::cCircular)
-      {
-         float halfAngle = aBeam.mFOV.mPoints[0].first;
-         aSensorBeam.RebuildCircular(tilt, minR, maxR, halfAngle);
-      }
-      else if (shape == FOV::cPolygonal)
-      {
-         std::vector<std::pair<float, float>> points;
-
-         int numPoints = aBeam.mFOV.mPoints.size();
-         for (int j = 0; j < numPoints; ++j)
-         {
-            points.emplace_back(aBeam.mFOV.mPoints[j].first, aBeam.mFOV.mPoints[j].second);
-         }
-         aSensorBeam.RebuildPolygonal(tilt, minR, maxR, points);
-      }
-   }
-   else // calculated
-   {
-      // this will return shapes mostly like those prior to 2.8
-      double azMax = 0.0;
-      double azMin = 0.0;
-      double elMax = 0.0;
-      double elMin = 0.0;
-      // if scanning, that volume will be shown instead of the beam
-      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_AZ)
-      {
-         azMin = aBeam.mScanLimits.mAzimuthLimits.first;
-         azMax = aBeam.mScanLimits.mAzimuthLimits.second;
-      }
-      else if (aBeam.mBeamWidth.first != 0.0)
-      {
-         azMax = 0.5 * aBeam.mBeamWidth.first;
-         azMin = -azMax;
-      }
-      else if (aBeam.mSlewMode & WsfArticulatedPart::cSLEW_AZ)
-      {
-         azMin      = aBeam.mSlewLimits.mAzimuthLimits.first;
-         azMax      = aBeam.mSlewLimits.mAzimuthLimits.second;
-         aNonCueing = true;
-      }
-      else
-      {
-         azMin = -UtMath::cPI;
-         azMax = UtMath::cPI;
-      }
-      if (aBeam.mScanMode & WsfEM_Antenna::cSCAN_EL)
-      {
-         elMin = aBeam.mScanLimits.mElevationLimits.first;
-         elMax = aBeam.mScanLimits.mElevationLimits.second;
-      }
-      else if (aBeam.mBeamWidth.second != 0.0)
-      {
-         elMax = 0.5 * aBeam.mBeamWidth.second;
-         elMin = -elMax;
-      }
-      else if (aBeam.mSlewMode & WsfArticulatedPart::cSLEW_EL)
-      {
-         elMin      = aBeam.mSlewLimits.mElevationLimits.first;
-         elMax      = aBeam.mSlewLimits.mElevationLimits.second;
-         aNonCueing = true;
-      }
-      else
-      {
-         elMin = -UtMath::cPI_OVER_2;
-         elMax = UtMath::cPI_OVER_2;
-      }
-
-      aSensorBeam.RebuildRectangular(0.0, minR, maxR, azMin, elMin, azMax, elMax);
+      attachment->Articulate(aSlew, aCue, aTranslation); // articulate
    }
 }
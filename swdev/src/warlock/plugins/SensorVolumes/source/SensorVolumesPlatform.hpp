@@ -19,6 +19,7 @@
 #include "UtOptional.hpp"
 #include "WsfEM_Antenna.hpp"
 #include "WsfEM_Rcvr.hpp"
+#include "WsfStringId.hpp"
 
 namespace vespa
 {
@@ -39,6 +40,8 @@ class WsfSensorMode;
 
 namespace WkSensorVolumes
 {
+class BeamShapeCache;
+
 using Clock = std::chrono::steady_clock;
 class Platform
 {
@@ -105,18 +108,20 @@ public:
    struct Mode
    {
       QString     mName;
+      WsfStringId mNameId; // mName interned, modes are looked up by id
       QList<Beam> mBeamList;
 
       Mode() = default;
       Mode(WsfSensorMode& aMode);
       Mode(WsfWeapon::WsfWeaponMode& aMode);
 
-      bool operator==(const Mode& aMode) { return mName == aMode.mName; }
+      bool operator==(const Mode& aMode) const { return mNameId == aMode.mNameId; }
 
-      bool operator==(const QString& aName) { return mName == aName; }
+      bool operator==(WsfStringId aNameId) const { return mNameId == aNameId; }
    };
 
-   Platform(const wkf::SensorVolumesPrefObject* aPrefObject, bool aType);
+   //! aShapeCache is shared by the platforms of the plug-in.
+   Platform(const wkf::SensorVolumesPrefObject* aPrefObject, BeamShapeCache& aShapeCache, bool aType);
    virtual ~Platform() = default;
    void RemoveAttachments();
 
@@ -130,14 +135,14 @@ public:
    //! If aSource == Source::Default, marks all.
    void MarkAll(Source aSource);
    void HideMarked();
-   void UpdateAndUnmark(const std::string& aName,
-                        const double       aSlew[3],
-                        const double       aCue[3],
-                        const double       aTranslation[3],
-                        std::vector<Mode>  aModes,
-                        vespa::VaEntity*   aEntityPtr,
-                        vespa::VaViewer*   aViewerPtr,
-                        Source             aSource);
+   void UpdateAndUnmark(const std::string&       aName,
+                        const double             aSlew[3],
+                        const double             aCue[3],
+                        const double             aTranslation[3],
+                        const std::vector<Mode>& aModes,
+                        vespa::VaEntity*         aEntityPtr,
+                        vespa::VaViewer*         aViewerPtr,
+                        Source                   aSource);
    void ModesReset();
    void SetSensorVisible(const std::string& aName, bool aState);
    void CheckSensorVisibility(bool& aAll, bool& aSome) const;
@@ -162,19 +167,25 @@ public:
    void RemoveAttachmentsPastTimeout(Clock::duration aTimeout, Clock::time_point aNow = Clock::now());
 
 private:
-   void UpdateAttachment(const std::string&           aSensor,
-                         const std::string&           aMode,
-                         const double                 aSlew[3],
-                         const double                 aCue[3],
-                         const double                 aTranslation[3],
-                         wkf::AttachmentSensorVolume* aAttachment,
-                         std::vector<Mode>&           aModes);
-   void BuildBeam(Beam& aBeam, wkf::SensorBeam& aSensorBeam, bool& aNonCueing);
+   struct ModeVolume
+   {
+      wkf::AttachmentSensorVolume* mAttachmentPtr;
+      bool                         mBuilt;     //!< True once the beams were built for the mode.
+      bool                         mNonCueing; //!< True if a beam is articulated by the slew only.
+   };
+
+   void UpdateAttachment(const std::string&       aSensor,
+                         WsfStringId              aModeId,
+                         const double             aSlew[3],
+                         const double             aCue[3],
+                         const double             aTranslation[3],
+                         ModeVolume&              aVolume,
+                         const std::vector<Mode>& aModes);
 
    struct SensorInfo
    {
       //! Map from mode to attachment.
-      std::map<std::string, wkf::AttachmentSensorVolume*> mModes;
+      std::map<WsfStringId, ModeVolume> mModes;
       Clock::time_point                                   mLastUpdateTime = Clock::now();
       Clock::time_point                                   mLastPacketTime = Clock::now();
       ut::optional<bool>                                  mState;
@@ -185,6 +196,7 @@ private:
    bool                                mVisible;
    bool                                mVolumeVisible;
    const wkf::SensorVolumesPrefObject* mPrefObject;
+   BeamShapeCache*                     mShapeCache;
    bool                                mType;
 };
 } // namespace WkSensorVolumes
@@ -42,6 +42,7 @@ static const WkSensorVolumes::Clock::duration cSENSOR_TIMEOUT          = std::ch
 WkSensorVolumes::Plugin::Plugin(const QString& aPluginName, const size_t aUniqueId)
    : warlock::PluginT<SimInterface>(aPluginName, aUniqueId)
    , mPrefWidgetPtr(new wkf::SensorVolumesPrefWidget(wkf::SensorVolumesPrefWidget::cLINEEDIT))
+   , mBeamShapeCache(mPrefWidgetPtr->GetPreferenceObject())
    , mIndividualIndex(0)
 {
    SetOptionHistoryManager(new wkf::SensorVolumesOptionHistoryManager(aPluginName, this));
@@ -236,7 +237,8 @@ void WkSensorVolumes::Plugin::SetPlatformOptionState(int aOptionId, bool aState,
       if (jt == mSensorVolumeMap.end())
       {
          // Create a new entry in the SensorVolumeMap
-         auto retPair = mSensorVolumeMap.emplace(mp, ut::make_unique<Platform>(mPrefObjectPtr, isWeaponType));
+         auto retPair =
+            mSensorVolumeMap.emplace(mp, ut::make_unique<Platform>(mPrefObjectPtr, mBeamShapeCache, isWeaponType));
          jt           = retPair.first;
          // Default the PlatformVisibility to be the same as the WKF environment
          jt->second->SetPlatformVisibility(wkfEnv.IsPlatformVisible(aPlatformPtr));
@@ -313,6 +315,7 @@ void WkSensorVolumes::Plugin::AddMode(WsfSensorMode& aSensorMode)
 
 void WkSensorVolumes::Plugin::ModesReset()
 {
+   mBeamShapeCache.ClearDisplayData();
    // notify the volumes
    for (auto& it : mSensorVolumeMap)
    {
@@ -322,6 +325,7 @@ void WkSensorVolumes::Plugin::ModesReset()
 
 void WkSensorVolumes::Plugin::DrawModeChanged(const wkf::SensorVolumesPrefData::DrawMode& aState)
 {
+   mBeamShapeCache.ClearShapes();
    // notify the volumes
    for (auto& jt : mSensorVolumeMap)
    {
@@ -342,7 +346,7 @@ WkSensorVolumes::Platform* WkSensorVolumes::Plugin::GetOrAddSensorVolumeEntry(un
    auto       it = mSensorVolumeMap.find(mp);
    if (it == mSensorVolumeMap.end())
    {
-      auto      ptr  = ut::make_unique<Platform>(mPrefObjectPtr, aWeapon);
+      auto      ptr  = ut::make_unique<Platform>(mPrefObjectPtr, mBeamShapeCache, aWeapon);
       Platform* plat = ptr.get();
       mSensorVolumeMap.emplace(mp, std::move(ptr));
       return plat;
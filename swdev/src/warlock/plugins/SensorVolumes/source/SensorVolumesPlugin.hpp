@@ -11,6 +11,7 @@
 #ifndef SENSORVOLUMESPLUGIN_HPP
 #define SENSORVOLUMESPLUGIN_HPP
 
+#include "SensorVolumesBeamShapeCache.hpp"
 #include "SensorVolumesSimInterface.hpp"
 #include "WkNetwork.hpp"
 #include "WkPlatform.hpp"
@@ -89,6 +90,7 @@ private:
    const wkf::SensorVolumesPrefObject* mPrefObjectPtr;
    // Use guarded pointers because objects will be owned by main window
    PluginUiPointer<wkf::SensorVolumesPrefWidget> mPrefWidgetPtr;
+   BeamShapeCache                                mBeamShapeCache; // shared by the platforms in mSensorVolumeMap
    QTreeWidgetItem*                              mTopSensorItem;
    QTreeWidgetItem*                              mTopWeaponItem;
    unsigned int                                  mIndividualIndex;
@@ -0,0 +1,296 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#include "SimProfilerDockWidget.hpp"
+
+#include <algorithm>
+
+#include <QCheckBox>
+#include <QComboBox>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QMessageBox>
+#include <QPainter>
+#include <QPushButton>
+#include <QSplitter>
+#include <QTableWidget>
+#include <QTimer>
+#include <QVBoxLayout>
+
+#include "WkSimEnvironment.hpp"
+
+namespace
+{
+const int cREFRESH_INTERVAL_MS = 1000;
+
+// Returns the lower bound of a histogram bucket, see warlock::SimProfiler::cBUCKET_COUNT
+QString BucketLabel(size_t aBucket)
+{
+   if (aBucket == 0)
+   {
+      return "0";
+   }
+   const double us = static_cast<double>(1ULL << (aBucket - 1));
+   if (us < 1000.0)
+   {
+      return QString("%1us").arg(us);
+   }
+   return QString("%1ms").arg(us / 1000.0);
+}
+
+QString FormatMilliseconds(double aMicroseconds)
+{
+   return QString::number(aMicroseconds / 1000.0, 'f', 3);
+}
+} // namespace
+
+WkSimProfiler::HistogramWidget::HistogramWidget(QWidget* aParent)
+   : QWidget(aParent)
+{
+   setMinimumHeight(120);
+}
+
+void WkSimProfiler::HistogramWidget::SetStatistics(const QString&                          aTitle,
+                                                   const warlock::SimProfiler::Statistics& aStatistics)
+{
+   mTitle      = aTitle;
+   mStatistics = aStatistics;
+   update();
+}
+
+void WkSimProfiler::HistogramWidget::paintEvent(QPaintEvent* aEvent)
+{
+   QPainter painter(this);
+   painter.fillRect(rect(), palette().base());
+
+   const QFontMetrics metrics(font());
+   const int          margin     = 4;
+   const int          textHeight = metrics.height();
+   const QRect        plotRect(margin, textHeight + margin, width() - 2 * margin, height() - 2 * (textHeight + margin));
+
+   painter.setPen(palette().text().color());
+   painter.drawText(QRect(margin, 0, width() - 2 * margin, textHeight), Qt::AlignLeft, mTitle);
+   if (mStatistics.mSampleCount == 0 || plotRect.height() <= 0)
+   {
+      return;
+   }
+
+   const auto&  histogram = mStatistics.mHistogram;
+   const double maxCount  = *std::max_element(histogram.begin(), histogram.end());
+   const double barWidth  = static_cast<double>(plotRect.width()) / histogram.size();
+   for (size_t i = 0; i < histogram.size(); ++i)
+   {
+      const int    left      = plotRect.left() + static_cast<int>(i * barWidth);
+      const double barHeight = (histogram[i] / maxCount) * plotRect.height();
+      painter.fillRect(QRectF(left + 1, plotRect.bottom() - barHeight, barWidth - 2, barHeight),
+                       palette().highlight());
+      // Label every other bucket so the labels don't overlap
+      if (i % 2 == 0)
+      {
+         painter.drawText(QRect(left, plotRect.bottom() + margin, static_cast<int>(2 * barWidth), textHeight),
+                          Qt::AlignLeft,
+                          BucketLabel(i));
+      }
+   }
+}
+
+WkSimProfiler::DockWidget::DockWidget(QWidget* aParent, Qt::WindowFlags aFlags)
+   : QDockWidget(aParent, aFlags)
+   , mEnabledCheckBox(new QCheckBox("Enabled", this))
+   , mCategoryComboBox(new QComboBox(this))
+   , mTracePushButton(new QPushButton(this))
+   , mExportPushButton(new QPushButton("Export Trace...", this))
+   , mTable(new QTableWidget(this))
+   , mHistogram(new HistogramWidget(this))
+   , mTimer(new QTimer(this))
+{
+   setWindowTitle("Sim Profiler");
+   setObjectName("SimProfilerDockWidget");
+
+   warlock::SimProfiler& profiler = simEnv.GetSimProfiler();
+   mEnabledCheckBox->setChecked(profiler.IsEnabled());
+   mTracePushButton->setText(profiler.IsTracing() ? "Stop Trace" : "Start Trace");
+   for (int i = 0; i < warlock::SimProfiler::cCATEGORY_COUNT; ++i)
+   {
+      const auto category = static_cast<warlock::SimProfiler::Category>(i);
+      mCategoryComboBox->addItem(warlock::SimProfiler::GetCategoryName(category), i);
+   }
+   mCategoryComboBox->setCurrentIndex(warlock::SimProfiler::cSIM_CLOCK_READ);
+   auto* resetPushButton = new QPushButton("Reset", this);
+
+   mTable->setColumnCount(cCOLUMN_COUNT);
+   mTable->setHorizontalHeaderLabels(
+      {"Name", "Samples", "Mean (ms)", "95% (ms)", "Max (ms)", "Queued/s", "Coalesced/s", "Processed/s"});
+   mTable->verticalHeader()->hide();
+   mTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+   mTable->setSelectionMode(QAbstractItemView::SingleSelection);
+   mTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+   mTable->horizontalHeader()->setSectionResizeMode(cNAME, QHeaderView::Stretch);
+
+   auto* controlsLayout = new QHBoxLayout;
+   controlsLayout->addWidget(mEnabledCheckBox);
+   controlsLayout->addWidget(mCategoryComboBox);
+   controlsLayout->addStretch();
+   controlsLayout->addWidget(resetPushButton);
+   controlsLayout->addWidget(mTracePushButton);
+   controlsLayout->addWidget(mExportPushButton);
+
+   auto* splitter = new QSplitter(Qt::Vertical, this);
+   splitter->addWidget(mTable);
+   splitter->addWidget(mHistogram);
+
+   auto* contents = new QWidget(this);
+   auto* layout   = new QVBoxLayout(contents);
+   layout->addLayout(controlsLayout);
+   layout->addWidget(splitter);
+   setWidget(contents);
+
+   connect(mEnabledCheckBox,
+           &QCheckBox::toggled,
+           this,
+           [this](bool aChecked)
+           {
+              warlock::SimProfiler& profiler = simEnv.GetSimProfiler();
+              if (!aChecked && profiler.IsTracing())
+              {
+                 profiler.StopTrace();
+                 mTracePushButton->setText("Start Trace");
+              }
+              profiler.SetEnabled(aChecked);
+           });
+   connect(mCategoryComboBox, QOverload<int>::of(&QComboBox::currentIndexChanged), this, &DockWidget::Refresh);
+   connect(resetPushButton,
+           &QPushButton::clicked,
+           this,
+           [this]()
+           {
+              simEnv.GetSimProfiler().Reset();
+              mPreviousCounts.clear();
+              Refresh();
+           });
+   connect(mTracePushButton, &QPushButton::clicked, this, &DockWidget::TraceClicked);
+   connect(mExportPushButton, &QPushButton::clicked, this, &DockWidget::ExportClicked);
+   connect(mTable, &QTableWidget::itemSelectionChanged, this, &DockWidget::UpdateHistogram);
+   connect(mTimer, &QTimer::timeout, this, &DockWidget::Refresh);
+}
+
+void WkSimProfiler::DockWidget::showEvent(QShowEvent* aEvent)
+{
+   QDockWidget::showEvent(aEvent);
+   mElapsedTimer.invalidate();
+   Refresh();
+   mTimer->start(cREFRESH_INTERVAL_MS);
+}
+
+void WkSimProfiler::DockWidget::hideEvent(QHideEvent* aEvent)
+{
+   QDockWidget::hideEvent(aEvent);
+   mTimer->stop();
+}
+
+void WkSimProfiler::DockWidget::Refresh()
+{
+   mStatistics = simEnv.GetSimProfiler().GetStatistics();
+
+   double elapsedSec = 0.0;
+   if (mElapsedTimer.isValid())
+   {
+      elapsedSec = mElapsedTimer.restart() / 1000.0;
+   }
+   else
+   {
+      mElapsedTimer.start();
+   }
+   // Events counted since the previous refresh, per second
+   auto rate = [elapsedSec](unsigned long long aCount, unsigned long long aPreviousCount)
+   {
+      if (elapsedSec > 0.0 && aCount >= aPreviousCount)
+      {
+         return QString::number((aCount - aPreviousCount) / elapsedSec, 'f', 1);
+      }
+      return QString();
+   };
+   auto setCell = [this](int aRow, int aColumn, const QString& aText)
+   {
+      QTableWidgetItem* item = mTable->item(aRow, aColumn);
+      if (!item)
+      {
+         item = new QTableWidgetItem;
+         item->setTextAlignment(((aColumn == cNAME) ? Qt::AlignLeft : Qt::AlignRight) | Qt::AlignVCenter);
+         mTable->setItem(aRow, aColumn, item);
+      }
+      item->setText(aText);
+   };
+
+   const auto category = static_cast<warlock::SimProfiler::Category>(mCategoryComboBox->currentData().toInt());
+   mTable->setRowCount(static_cast<int>(mStatistics.size()));
+   for (size_t i = 0; i < mStatistics.size(); ++i)
+   {
+      const auto& interfaceStats = mStatistics[i];
+      const auto& stats          = interfaceStats.mCategories[category];
+      const int   row            = static_cast<int>(i);
+      setCell(row, cNAME, interfaceStats.mName);
+      setCell(row, cSAMPLES, QString::number(stats.mSampleCount));
+      setCell(row, cMEAN, FormatMilliseconds(stats.mMeanUs));
+      setCell(row, cP95, FormatMilliseconds(stats.mP95Us));
+      setCell(row, cMAX, FormatMilliseconds(stats.mMaxUs));
+
+      EventCounts& previous = mPreviousCounts[interfaceStats.mName];
+      setCell(row, cQUEUED, rate(interfaceStats.mEventsQueued, previous.mQueued));
+      setCell(row, cCOALESCED, rate(interfaceStats.mEventsCoalesced, previous.mCoalesced));
+      setCell(row, cPROCESSED, rate(interfaceStats.mEventsProcessed, previous.mProcessed));
+      previous.mQueued    = interfaceStats.mEventsQueued;
+      previous.mCoalesced = interfaceStats.mEventsCoalesced;
+      previous.mProcessed = interfaceStats.mEventsProcessed;
+   }
+   UpdateHistogram();
+}
+
+void WkSimProfiler::DockWidget::UpdateHistogram()
+{
+   const auto category = static_cast<warlock::SimProfiler::Category>(mCategoryComboBox->currentData().toInt());
+   const int  row      = mTable->currentRow();
+   if (row >= 0 && row < static_cast<int>(mStatistics.size()))
+   {
+      const auto& interfaceStats = mStatistics[row];
+      mHistogram->SetStatistics(interfaceStats.mName + " - " + warlock::SimProfiler::GetCategoryName(category),
+                                interfaceStats.mCategories[category]);
+   }
+   else
+   {
+      mHistogram->SetStatistics("Select a row to show its histogram", warlock::SimProfiler::Statistics());
+   }
+}
+
+void WkSimProfiler::DockWidget::TraceClicked()
+{
+   warlock::SimProfiler& profiler = simEnv.GetSimProfiler();
+   if (profiler.IsTracing())
+   {
+      profiler.StopTrace();
+      mTracePushButton->setText("Start Trace");
+   }
+   else
+   {
+      profiler.StartTrace();
+      mEnabledCheckBox->setChecked(true);
+      mTracePushButton->setText("Stop Trace");
+   }
+}
+
+void WkSimProfiler::DockWidget::ExportClicked()
+{
+   const QString fileName = QFileDialog::getSaveFileName(this, "Export Trace", "", "Trace Files (*.json)");
+   if (!fileName.isEmpty() && !simEnv.GetSimProfiler().WriteTrace(fileName))
+   {
+      QMessageBox::warning(this, "Export Failed", "Could not write the trace to " + fileName + ".");
+   }
+}
@@ -0,0 +1,98 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#ifndef WKSIMPROFILERDOCKWIDGET_HPP
+#define WKSIMPROFILERDOCKWIDGET_HPP
+
+#include <map>
+#include <vector>
+
+#include <QDockWidget>
+#include <QElapsedTimer>
+
+#include "WkSimProfiler.hpp"
+
+class QCheckBox;
+class QComboBox;
+class QPushButton;
+class QTableWidget;
+class QTimer;
+
+namespace WkSimProfiler
+{
+// Draws the histogram of the durations of one category of one SimInterface
+class HistogramWidget : public QWidget
+{
+public:
+   explicit HistogramWidget(QWidget* aParent = nullptr);
+
+   void SetStatistics(const QString& aTitle, const warlock::SimProfiler::Statistics& aStatistics);
+
+protected:
+   void paintEvent(QPaintEvent* aEvent) override;
+
+private:
+   QString                          mTitle;
+   warlock::SimProfiler::Statistics mStatistics;
+};
+
+// Shows the statistics of warlock::SimProfiler, refreshed once per second while visible
+class DockWidget : public QDockWidget
+{
+   Q_OBJECT
+
+public:
+   DockWidget(QWidget* aParent = nullptr, Qt::WindowFlags aFlags = Qt::WindowFlags());
+   ~DockWidget() override = default;
+
+private:
+   enum Column
+   {
+      cNAME,
+      cSAMPLES,
+      cMEAN,
+      cP95,
+      cMAX,
+      cQUEUED,
+      cCOALESCED,
+      cPROCESSED,
+      cCOLUMN_COUNT
+   };
+
+   void showEvent(QShowEvent* aEvent) override;
+   void hideEvent(QHideEvent* aEvent) override;
+
+   void Refresh();
+   void UpdateHistogram();
+   void TraceClicked();
+   void ExportClicked();
+
+   struct EventCounts
+   {
+      unsigned long long mQueued{0};
+      unsigned long long mCoalesced{0};
+      unsigned long long mProcessed{0};
+   };
+
+   QCheckBox*       mEnabledCheckBox;
+   QComboBox*       mCategoryComboBox;
+   QPushButton*     mTracePushButton;
+   QPushButton*     mExportPushButton;
+   QTableWidget*    mTable;
+   HistogramWidget* mHistogram;
+   QTimer*          mTimer;
+
+   std::vector<warlock::SimProfiler::InterfaceStatistics> mStatistics;
+   // The event counts at the previous refresh, used to compute the rates
+   std::map<QString, EventCounts> mPreviousCounts;
+   QElapsedTimer                  mElapsedTimer;
+};
+} // namespace WkSimProfiler
+#endif
@@ -0,0 +1,51 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#include "SimProfilerPlugin.hpp"
+
+#include "WkfAction.hpp"
+#include "WkfDebugPrefObject.hpp"
+#include "WkfEnvironment.hpp"
+#include "WkfMainWindow.hpp"
+
+WKF_PLUGIN_DEFINE_SYMBOLS(WkSimProfiler::Plugin,
+                          "Sim Profiler",
+                          "Measures the time each plugin spends on the simulation and GUI threads.",
+                          "warlock")
+
+WkSimProfiler::Plugin::Plugin(const QString& aPluginName, const size_t aUniqueId)
+   : wkf::Plugin(aPluginName, aUniqueId)
+{
+   auto* wkfMainWindowPtr = wkfEnv.GetMainWindow();
+   // Use QMainWindow::addDockWidget so the dock widget is added to the Developer menu rather than the View menu.
+   QMainWindow* qMainWindowPtr = wkfMainWindowPtr;
+   mDockWidgetPtr              = new DockWidget(qMainWindowPtr);
+   qMainWindowPtr->addDockWidget(Qt::RightDockWidgetArea, mDockWidgetPtr);
+   mDockWidgetPtr->hide();
+
+   QMenu* devMenuPtr = wkfMainWindowPtr->GetMenuByName("Developer");
+   if (devMenuPtr)
+   {
+      wkf::Action* dlgActionPtr = new wkf::Action("Sim Profiler...", wkfMainWindowPtr);
+      connect(dlgActionPtr, &QAction::triggered, mDockWidgetPtr, &QDockWidget::show);
+      devMenuPtr->addAction(dlgActionPtr);
+   }
+
+   // If the user disables the developer menu, hide this dock widget
+   connect(wkfEnv.GetPreferenceObject<wkf::DebugPrefObject>(),
+           &wkf::DebugPrefObject::DeveloperMenuVisibilityChanged,
+           [this](bool aState)
+           {
+              if (!aState)
+              {
+                 mDockWidgetPtr->setVisible(false);
+              }
+           });
+}
@@ -0,0 +1,31 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#ifndef WKSIMPROFILERPLUGIN_HPP
+#define WKSIMPROFILERPLUGIN_HPP
+
+#include "SimProfilerDockWidget.hpp"
+#include "WkfPlugin.hpp"
+
+namespace WkSimProfiler
+{
+class Plugin : public wkf::Plugin
+{
+   Q_OBJECT
+
+public:
+   Plugin(const QString& aPluginName, const size_t aUniqueId);
+   ~Plugin() override = default;
+
+private:
+   PluginUiPointer<DockWidget> mDockWidgetPtr;
+};
+} // namespace WkSimProfiler
+#endif
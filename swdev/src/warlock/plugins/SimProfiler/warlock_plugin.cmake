@@ -0,0 +1,11 @@
+# ****************************************************************************
+# CUI
+#
+# The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+#
+# The use, dissemination or disclosure of data in this file is subject to
+# limitation or restriction. See accompanying README and LICENSE for details.
+# ****************************************************************************
+# configuration for automatic inclusion as a Warlock Plugin
+set(WARLOCK_PLUGIN_NAME SimProfiler)
+set(WARLOCK_PLUGIN_SOURCE_PATH source)
@@ -14,6 +14,7 @@
 #include <QString>
 
 #include "UtMemory.hpp"
+#include "WkSimEnvironment.hpp"
 #include "WsfLocalTrack.hpp"
 #include "WsfPlatform.hpp"
 #include "WsfSA_Assess.hpp"
@@ -25,6 +26,33 @@
 WkSA_Display::SimInterface::SimInterface(const QString& aPluginName)
 {
    // mCallbacks.Add(PerceptionUpdated.Connect(&OnPerceptionUpdated, this));
+
+   // Snapshots are only needed while the interface is enabled, see ProcessEnableFlagChanged()
+   if (IsEnabled())
+   {
+      simEnv.GetPlatformSnapshotService().Subscribe();
+   }
+}
+
+WkSA_Display::SimInterface::~SimInterface()
+{
+   if (IsEnabled())
+   {
+      simEnv.GetPlatformSnapshotService().Unsubscribe();
+   }
+}
+
+void WkSA_Display::SimInterface::ProcessEnableFlagChanged(bool aEnabled)
+{
+   if (aEnabled)
+   {
+      simEnv.GetPlatformSnapshotService().Subscribe();
+      mSeedMissilePlatforms = true;
+   }
+   else
+   {
+      simEnv.GetPlatformSnapshotService().Unsubscribe();
+   }
 }
 
 void WkSA_Display::SimInterface::WallClockRead(const WsfSimulation& aSimulation)
@@ -41,42 +69,46 @@ void WkSA_Display::SimInterface::WallClockRead(const WsfSimulation& aSimulation)
       mMutex.unlock();
    }
 
+   if (mSeedMissilePlatforms.exchange(false))
+   {
+      SeedMissilePlatforms(aSimulation);
+   }
+
    // Get the current time.
    const double simTime = aSimulation.GetSimTime();
 
    // Gather truth data of every platform that is valid(not deleted/removed).
+   // The state is read from the shared platform snapshot rather than from each WsfPlatform.
    std::vector<wkf::SA_Display::EntityTruth> tempSA_TruthPlatforms;
-   size_t                                    platformCount = aSimulation.GetPlatformCount();
-
-   // Loop through each platform.
-   for (size_t platformEntry = 0; platformEntry < platformCount; ++platformEntry)
+   auto snapshot = simEnv.GetPlatformSnapshotService().GetSnapshot();
+   if (snapshot)
    {
-      WsfPlatform* platformPtr = aSimulation.GetPlatformEntry(platformEntry);
+      const warlock::PlatformSnapshotIdentity& identity = *snapshot->mIdentity;
 
-      // If we have a valid platform, populate using WsfPlatform* data.
-      // Ignore deleted platforms.
-      if (platformPtr != nullptr && !platformPtr->IsDeleted())
+      tempSA_TruthPlatforms.reserve(snapshot->GetPlatformCount());
+      for (size_t i = 0; i < snapshot->GetPlatformCount(); ++i)
       {
+         // Ignore deleted platforms.
+         if (snapshot->mDeleted[i])
+         {
+            continue;
+         }
+
          wkf::SA_Display::EntityTruth entity;
 
          // Fill in the general data needed to draw here.
-         double lat, lon, alt;
-         platformPtr->GetLocationLLA(lat, lon, alt);
-         entity.lat_deg = lat;
-         entity.lon_deg = lon;
+         entity.lat_deg     = snapshot->mLocationLLA[i][0];
+         entity.lon_deg     = snapshot->mLocationLLA[i][1];
+         entity.heading_deg = snapshot->mOrientationNED[i][0] * UtMath::cDEG_PER_RAD;
+         entity.altitude_ft = snapshot->mLocationLLA[i][2] * UtMath::cFT_PER_M;
+         entity.speed_kts   = snapshot->mSpeed[i] * UtMath::cMPS_PER_NMPH;
 
-         double heading_rad, dummypitch, dummyroll;
-         platformPtr->GetOrientationNED(heading_rad, dummypitch, dummyroll);
-         entity.heading_deg = heading_rad * UtMath::cDEG_PER_RAD;
-         entity.altitude_ft = platformPtr->GetAltitude() * UtMath::cFT_PER_M;
-         entity.speed_kts   = platformPtr->GetSpeed() * UtMath::cMPS_PER_NMPH;
-
-         entity.index = platformPtr->GetIndex();
-         entity.name  = platformPtr->GetName();
-         entity.type  = platformPtr->GetType();
+         entity.index = identity.mIndex[i];
+         entity.name  = identity.mName[i];
+         entity.type  = identity.mType[i];
 
          // Get the domain.
-         switch (platformPtr->GetSpatialDomain())
+         switch (identity.mSpatialDomain[i])
          {
          default:
          case WSF_SPATIAL_DOMAIN_UNKNOWN:
@@ -99,14 +131,8 @@ void WkSA_Display::SimInterface::WallClockRead(const WsfSimulation& aSimulation)
             break;
          }
 
-         // Set missile flag to false, but it may become true below
-         entity.isMissile = false;
-
-         WsfCategoryList catList = platformPtr->GetCategories();
-         if (catList.IsCategoryMember(WsfStringId("missile")))
-         {
-            entity.isMissile = true;
-         }
+         // Missile platforms are recorded when they are initialized
+         entity.isMissile = (mMissilePlatforms.count(entity.index) > 0);
 
          entity.altitudeValid = true;
          entity.speedValid    = true;
@@ -438,8 +464,25 @@ void WkSA_Display::SimInterface::WallClockRead(const WsfSimulation& aSimulation)
    }
 }
 
+void WkSA_Display::SimInterface::SeedMissilePlatforms(const WsfSimulation& aSimulation)
+{
+   for (size_t i = 0; i < aSimulation.GetPlatformCount(); ++i)
+   {
+      WsfPlatform* platformPtr = aSimulation.GetPlatformEntry(i);
+      if (platformPtr->GetCategories().IsCategoryMember(WsfStringId("missile")))
+      {
+         mMissilePlatforms.insert(platformPtr->GetIndex());
+      }
+   }
+}
+
 void WkSA_Display::SimInterface::PlatformInitialized(double aSimTime, WsfPlatform& aPlatform)
 {
+   if (aPlatform.GetCategories().IsCategoryMember(WsfStringId("missile")))
+   {
+      mMissilePlatforms.insert(aPlatform.GetIndex());
+   }
+
    const WsfSA_Processor* processor = nullptr;
 
    for (WsfComponentList::RoleIterator<WsfProcessor> iter(aPlatform); !iter.AtEnd(); ++iter)
@@ -520,6 +563,8 @@ void WkSA_Display::SimInterface::PopulateEntityPerception(wkf::SA_Display::Entit
 
 void WkSA_Display::SimInterface::SimulationInitializing(const WsfSimulation& aSimulation)
 {
+   mMissilePlatforms.clear();
+
    if (!IsEnabled())
    {
       return;
@@ -535,6 +580,8 @@ void WkSA_Display::SimInterface::SimulationInitializing(const WsfSimulation& aSi
 
 void WkSA_Display::SimInterface::PlatformDeleted(double aSimTime, const WsfPlatform& aPlatform)
 {
+   mMissilePlatforms.erase(aPlatform.GetIndex());
+
    if (!IsEnabled())
    {
       return;
@@ -12,6 +12,7 @@
 #ifndef SA_DISPLAY_SIM_INTERFACE_HPP
 #define SA_DISPLAY_SIM_INTERFACE_HPP
 
+#include <atomic>
 #include <set>
 #include <vector>
 
@@ -29,6 +30,7 @@ class SimInterface : public warlock::SimInterfaceT<SA_Event>
    Q_OBJECT
 public:
    SimInterface(const QString& aPluginName);
+   ~SimInterface() override;
 
    /**
     * Called repeatedly as time continues forward, regardless of if the simulation is running.
@@ -75,6 +77,11 @@ protected:
     */
    void SimulationInitializing(const WsfSimulation& aSimulation) override;
 
+   /** Subscribes to the platform snapshots while the interface is enabled.
+    * @param aEnabled whether the interface was enabled or disabled.
+    */
+   void ProcessEnableFlagChanged(bool aEnabled) override;
+
 private:
    /** Triggers when a platform is deleted.
     * @param aSimTime sim time when the platform was deleted.
@@ -82,14 +89,22 @@ private:
     */
    void PlatformDeleted(double aSimTime, const WsfPlatform& aPlatform) override;
 
+   /** Records the existing platforms in the missile category, which were initialized before the interface
+    * subscribed to the platform snapshots. This is done on the simulation thread, once after each subscription.
+    * @param aSimulation reference to the simulation.
+    */
+   void SeedMissilePlatforms(const WsfSimulation& aSimulation);
+
    /** Populate an EntityPerception container using the wsf equivalent.
     * @param aEntityPerception perception container to fill.
     * @param aData data to fill with.
     */
    void PopulateEntityPerception(wkf::SA_Display::EntityPerception& aEntityPerception, const WsfSA_EntityPerception& aData);
 
-   std::set<size_t> mPlatformsOfInterest; ///< Set of indices of the platforms of interest
-   std::set<size_t> mPlatformsWithSAP;    ///< Set of platforms with SituationAwarenessProcessors.
+   std::set<size_t>  mPlatformsOfInterest;        ///< Set of indices of the platforms of interest
+   std::set<size_t>  mPlatformsWithSAP;           ///< Set of platforms with SituationAwarenessProcessors.
+   std::set<size_t>  mMissilePlatforms;           ///< Set of platforms in the missile category.
+   std::atomic<bool> mSeedMissilePlatforms{true}; ///< Whether mMissilePlatforms must be seeded from the simulation.
 };
 } // namespace WkSA_Display
 #endif // SA_DISPLAY_SIM_INTERFACE_HPP
@@ -21,6 +21,14 @@
 WkTaskStatus::SimInterface::SimInterface(const QString& aPluginName)
    : warlock::SimInterfaceT<TaskEvent>(aPluginName)
 {
+   // WallClockRead only reads the platform of interest through a const pointer and locks mMutex
+   SetConcurrentRead(true);
+}
+
+// ============================================================================
+WkTaskStatus::SimInterface::~SimInterface()
+{
+   ShutdownConcurrentRead();
 }
 
 // ============================================================================
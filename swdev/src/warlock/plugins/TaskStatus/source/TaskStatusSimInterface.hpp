@@ -24,6 +24,7 @@ class SimInterface : public warlock::SimInterfaceT<TaskEvent>
 
 public:
    explicit SimInterface(const QString& aPluginName);
+   ~SimInterface() override;
 
    void SetPlatformOfInterest(const std::string& aPlatformName);
 
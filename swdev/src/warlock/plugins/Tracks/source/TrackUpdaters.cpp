@@ -17,12 +17,34 @@
 #include "WsfTrackId.hpp"
 #include "WsfTrackManager.hpp"
 
-void WkTracks::DataUpdater::ReadData(const WsfSimulation& aSimulation)
+WsfPlatform* WkTracks::DataUpdater::FindPlatform(const WsfSimulation& aSimulation)
 {
+   if (mPlatformIndex != 0)
+   {
+      WsfPlatform* platform = aSimulation.GetPlatformByIndex(mPlatformIndex);
+      // The index may refer to a different platform after the simulation is restarted
+      if (platform && platform->GetNameId() == mTrackId.GetOwningPlatformId())
+      {
+         return platform;
+      }
+      mPlatformIndex = 0;
+   }
+
    WsfPlatform* platform = aSimulation.GetPlatformByName(mPlatformId);
    if (platform)
    {
-      WsfLocalTrack* track = platform->GetTrackManager().FindTrack(WsfTrackId(mPlatformId, mLocalTrackId));
+      mPlatformIndex = platform->GetIndex();
+      mTrackId       = WsfTrackId(platform->GetNameId(), mLocalTrackId);
+   }
+   return platform;
+}
+
+void WkTracks::DataUpdater::ReadData(const WsfSimulation& aSimulation)
+{
+   WsfPlatform* platform = FindPlatform(aSimulation);
+   if (platform)
+   {
+      WsfLocalTrack* track = platform->GetTrackManager().FindTrack(mTrackId);
       if (track)
       {
          double updateTime = track->GetUpdateTime();
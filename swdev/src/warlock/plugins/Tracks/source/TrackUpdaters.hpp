@@ -15,7 +15,9 @@
 #include "WkfEnvironment.hpp"
 #include "WkfUnitsObject.hpp"
 #include "WsfLocalTrack.hpp"
+#include "WsfTrackId.hpp"
 
+class WsfPlatform;
 class WsfSimulation;
 
 namespace WkTracks
@@ -27,6 +29,7 @@ public:
       : warlock::PlotUpdater(aPlatformName, aSeriesNum)
       , mLocalTrackId(aTrackId)
       , mLastUpdate(-1.0)
+      , mPlatformIndex(0)
    {
    }
 
@@ -36,6 +39,13 @@ protected:
 
    int    mLocalTrackId;
    double mLastUpdate;
+
+private:
+   WsfPlatform* FindPlatform(const WsfSimulation& aSimulation);
+
+   // The platform and track id are resolved by name once, and then looked up by platform index on each read.
+   size_t     mPlatformIndex; // 0 if not resolved
+   WsfTrackId mTrackId;
 };
 
 class AltitudeUpdater : public DataUpdater
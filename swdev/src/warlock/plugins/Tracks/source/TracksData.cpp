@@ -13,10 +13,11 @@
 
 #include "WsfLocalTrack.hpp"
 
-void WkTracks::TrackContainer::TrackData::Populate(const WsfLocalTrack* aLocalTrackPtr)
+void WkTracks::TrackContainer::TrackData::Populate(size_t aPlatformIndex, const WsfLocalTrack* aLocalTrackPtr)
 {
-   mTrackId        = wkf::TrackId(aLocalTrackPtr->GetTrackId().GetOwningPlatformId(),
-                           aLocalTrackPtr->GetTrackId().GetLocalTrackNumber());
+   mPlatformIndex  = aPlatformIndex;
+   mPlatformName   = aLocalTrackPtr->GetTrackId().GetOwningPlatformId();
+   mTrackNumber    = aLocalTrackPtr->GetTrackId().GetLocalTrackNumber();
    mLocationValid  = aLocalTrackPtr->LocationValid();
    mVelocityValid  = aLocalTrackPtr->VelocityValid();
    mBearingValid   = aLocalTrackPtr->BearingValid();
@@ -85,19 +86,17 @@ void WkTracks::TrackContainer::TrackData::Populate(const WsfLocalTrack* aLocalTr
    // aLocalTrackPtr->GetSimulation() == nullptr on LocalTracks received over XIO (sometimes?) which makes setting mRemote difficult
 }
 
-std::map<int, WkTracks::TrackContainer::TrackData> WkTracks::TrackContainer::GetTrackData(const std::string& aPlatformName) const
+const WkTracks::TrackContainer::PlatformTrackData&
+WkTracks::TrackContainer::GetTrackData(const std::string& aPlatformName) const
 {
-   std::map<int, TrackData> retval;
+   static const PlatformTrackData cEMPTY;
 
-   auto it = mTrackList.lower_bound({aPlatformName, 0});
-
-   while (it != mTrackList.end() && it->first.GetPlatformName() == aPlatformName)
+   auto it = mPlatformIndices.find(aPlatformName);
+   if (it != mPlatformIndices.end())
    {
-      retval.emplace(it->first.GetLocalTrackId(), it->second);
-      it++;
+      return mTrackList[it->second].mTracks;
    }
-
-   return retval;
+   return cEMPTY;
 }
 
 const WkTracks::TrackContainer::TrackDataList& WkTracks::TrackContainer::GetAllTrackData() const
@@ -105,41 +104,71 @@ const WkTracks::TrackContainer::TrackDataList& WkTracks::TrackContainer::GetAllT
    return mTrackList;
 }
 
+WkTracks::TrackContainer::TrackData& WkTracks::TrackContainer::FindOrAddTrack(const TrackData& aTrackData)
+{
+   if (aTrackData.mPlatformIndex >= mTrackList.size())
+   {
+      mTrackList.resize(aTrackData.mPlatformIndex + 1);
+   }
+
+   PlatformTracks& platformTracks = mTrackList[aTrackData.mPlatformIndex];
+   if (platformTracks.mPlatformName.empty())
+   {
+      platformTracks.mPlatformName = aTrackData.mPlatformName.GetString();
+      mPlatformIndices[platformTracks.mPlatformName] = aTrackData.mPlatformIndex;
+   }
+   return platformTracks.mTracks[aTrackData.mTrackNumber];
+}
+
 void WkTracks::TrackContainer::AddTrack(const TrackData& aTrackData)
 {
    // Should we check to make sure the track does not exist?
-   mTrackList[aTrackData.mTrackId] = aTrackData;
-   emit TrackInitiated(aTrackData);
+   TrackData& track = FindOrAddTrack(aTrackData);
+   track            = aTrackData;
+   emit TrackInitiated(track);
 }
 
 void WkTracks::TrackContainer::Clear()
 {
    mTrackList.clear();
+   mPlatformIndices.clear();
 }
 
-void WkTracks::TrackContainer::DropTrack(const wkf::TrackId& aTrackId)
+void WkTracks::TrackContainer::DropTrack(size_t aPlatformIndex, int aTrackNumber)
 {
-   auto it = mTrackList.find(aTrackId);
-   if (it != mTrackList.end())
+   if (aPlatformIndex < mTrackList.size())
    {
-      emit TrackDropped(aTrackId);
-      mTrackList.erase(it);
+      PlatformTrackData& tracks = mTrackList[aPlatformIndex].mTracks;
+      auto               it     = tracks.find(aTrackNumber);
+      if (it != tracks.end())
+      {
+         emit TrackDropped(it->second.GetTrackId());
+         tracks.erase(it);
+      }
    }
 }
 
-void WkTracks::TrackContainer::DropAllPlatformTracks(const std::string& aPlatformName)
+void WkTracks::TrackContainer::DropAllPlatformTracks(size_t aPlatformIndex)
 {
-   auto it = mTrackList.lower_bound({aPlatformName, 0});
-
-   while (it != mTrackList.end() && it->first.GetPlatformName() == aPlatformName)
+   if (aPlatformIndex < mTrackList.size())
    {
-      emit TrackDropped(it->first);
-      it = mTrackList.erase(it);
+      PlatformTracks& platformTracks = mTrackList[aPlatformIndex];
+      for (const auto& track : platformTracks.mTracks)
+      {
+         emit TrackDropped(track.second.GetTrackId());
+      }
+      platformTracks.mTracks.clear();
+
+      // Platform indices are not reused, so the entry is no longer needed.
+      mPlatformIndices.erase(platformTracks.mPlatformName);
+      platformTracks.mPlatformName.clear();
    }
 }
 
 void WkTracks::TrackContainer::UpdateTrack(const TrackData& aTrackData)
 {
-   mTrackList[aTrackData.mTrackId] = aTrackData;
-   emit TrackUpdated(aTrackData);
+   // Update in place. TrackData holds no heap allocated members, so this does not allocate for an existing track.
+   TrackData& track = FindOrAddTrack(aTrackData);
+   track            = aTrackData;
+   emit TrackUpdated(track);
 }
@@ -12,16 +12,23 @@
 #ifndef TRACKSDATA_HPP
 #define TRACKSDATA_HPP
 
+#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <QObject>
 
 class WsfLocalTrack;
 
 #include "WkfTrack.hpp"
+#include "WsfStringId.hpp"
 
 namespace WkTracks
 {
+// Stores the local tracks of every platform, indexed by the platform index of the owning platform and the local track
+// number. Tracks are updated in place, and the side, type, target and icon strings are interned as WsfStringIds, so
+// updating an existing track does not allocate.
 class TrackContainer : public QObject
 {
    Q_OBJECT
@@ -29,41 +36,53 @@ class TrackContainer : public QObject
 public:
    struct TrackData
    {
-      wkf::TrackId mTrackId;
-      bool         mLocationValid  = false;
-      double       mPositionWCS[3] = {0, 0, 0};
-      bool         mVelocityValid  = false;
-      double       mVelocityWCS[3] = {0, 0, 0};
-      bool         mBearingValid   = false;
-      double       mBearing_rad    = 0.0;
-      bool         mElevationValid = false;
-      double       mElevation_rad  = 0.0;
-      bool         mRangeValid     = false;
-      double       mRange_m        = 0.0;
-      std::string  mSide;
-      double       mQuality = 0.0;
-      std::string  mType;
-      std::string  mTargetPlatform;
-      std::string  mMilStdIcon;
-      bool         mRemote = false;
+      size_t      mPlatformIndex = 0; // Platform index of the owning platform
+      WsfStringId mPlatformName;      // Name of the owning platform
+      int         mTrackNumber    = 0;
+      bool        mLocationValid  = false;
+      double      mPositionWCS[3] = {0, 0, 0};
+      bool        mVelocityValid  = false;
+      double      mVelocityWCS[3] = {0, 0, 0};
+      bool        mBearingValid   = false;
+      double      mBearing_rad    = 0.0;
+      bool        mElevationValid = false;
+      double      mElevation_rad  = 0.0;
+      bool        mRangeValid     = false;
+      double      mRange_m        = 0.0;
+      WsfStringId mSide;
+      double      mQuality = 0.0;
+      WsfStringId mType;
+      WsfStringId mTargetPlatform;
+      WsfStringId mMilStdIcon;
+      bool        mRemote = false;
 
       wkf::SpatialDomain mSpatialDomain;
       wkf::IFF_Status    mIFFStatus;
 
-      void Populate(const WsfLocalTrack* aLocalTrackPtr);
+      void         Populate(size_t aPlatformIndex, const WsfLocalTrack* aLocalTrackPtr);
+      wkf::TrackId GetTrackId() const { return wkf::TrackId(mPlatformName, mTrackNumber); }
    };
-   std::map<int, TrackData> GetTrackData(const std::string& aPlatformName) const;
 
-   // map < platform name, map < local track index, data >>
-   using TrackDataList = std::map<wkf::TrackId, TrackData>;
+   // map < local track number, data >
+   using PlatformTrackData = std::map<int, TrackData>;
 
-   const TrackDataList& GetAllTrackData() const;
+   struct PlatformTracks
+   {
+      std::string       mPlatformName;
+      PlatformTrackData mTracks;
+   };
+
+   // Indexed by platform index. Entries for platforms without tracks have an empty mPlatformName.
+   using TrackDataList = std::vector<PlatformTracks>;
+
+   const PlatformTrackData& GetTrackData(const std::string& aPlatformName) const;
+   const TrackDataList&     GetAllTrackData() const;
 
    void AddTrack(const TrackData& aTrackData);
    void Clear();
    void UpdateTrack(const TrackData& aTrackData);
-   void DropTrack(const wkf::TrackId& aTrackId);
-   void DropAllPlatformTracks(const std::string& aPlatformName);
+   void DropTrack(size_t aPlatformIndex, int aTrackNumber);
+   void DropAllPlatformTracks(size_t aPlatformIndex);
 
 signals:
    void TrackInitiated(const TrackData& aTrackData);
@@ -71,7 +90,10 @@ signals:
    void TrackUpdated(const TrackData& aTrackData);
 
 private:
-   TrackDataList mTrackList;
+   TrackData& FindOrAddTrack(const TrackData& aTrackData);
+
+   TrackDataList                           mTrackList;
+   std::unordered_map<std::string, size_t> mPlatformIndices; // map < platform name, platform index >
 };
 } // namespace WkTracks
 #endif
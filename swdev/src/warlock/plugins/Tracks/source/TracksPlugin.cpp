@@ -187,7 +187,7 @@ void WkTracks::Plugin::TrackUpdatedHandler(const TrackContainer::TrackData& aTra
    wkf::Scenario* scenario = vaEnv.GetStandardScenario();
    if (scenario)
    {
-      wkf::Track* track = scenario->FindTrack(aTrackData.mTrackId);
+      wkf::Track* track = scenario->FindTrack(aTrackData.GetTrackId());
       if (track)
       {
          SetTrackState(track, aTrackData);
@@ -204,7 +204,7 @@ void WkTracks::Plugin::TrackUpdatedHandler(const TrackContainer::TrackData& aTra
 
 void WkTracks::Plugin::UpdatePlatformData()
 {
-   auto trackData = mTrackData.GetTrackData(mPlatformOfInterest);
+   const auto& trackData = mTrackData.GetTrackData(mPlatformOfInterest);
 
    // First remove any tracks that may have been dropped since last update
    std::set<int> indicesToRemove;
@@ -275,7 +275,7 @@ QList<QTreeWidgetItem*> WkTracks::Plugin::GetPlatformData(const std::string& aPl
    mTrackChildItems.clear();
 
    // Get data for the new platform, and populate the tree widget
-   auto trackData = mTrackData.GetTrackData(mPlatformOfInterest);
+   const auto& trackData = mTrackData.GetTrackData(mPlatformOfInterest);
    for (auto& data : trackData)
    {
       int trackId = data.first;
@@ -389,14 +389,14 @@ void WkTracks::Plugin::CreateTrackIfVisible(const TrackContainer::TrackData& aTr
    wkf::Scenario* scenario = vaEnv.GetStandardScenario();
    if (scenario)
    {
-      const auto* trackPrefs = wkfEnv.GetPreferenceObject<wkf::TrackVisibilityPrefObject>();
-      auto        trackVis   = trackPrefs->GetTrackVisibility();
+      const auto*        trackPrefs   = wkfEnv.GetPreferenceObject<wkf::TrackVisibilityPrefObject>();
+      auto               trackVis     = trackPrefs->GetTrackVisibility();
+      const std::string& platformName = aTrackData.mPlatformName.GetString();
 
       if (trackVis == wkf::tracks::Visibility::cLOCAL_ONLY)
       {
-         wkf::Platform* platform =
-            dynamic_cast<wkf::Platform*>(scenario->FindEntity(aTrackData.mTrackId.GetPlatformName()));
-         if (wkfEnv.IsPlatformSelected(aTrackData.mTrackId.GetPlatformName()) && // If the platform is selected
+         wkf::Platform* platform = dynamic_cast<wkf::Platform*>(scenario->FindEntity(platformName));
+         if (wkfEnv.IsPlatformSelected(platformName) && // If the platform is selected
              platform &&                         // and the platform exists (This is done second for optimization)
              wkfEnv.IsPlatformVisible(platform)) // and the platform is visible
          {
@@ -405,8 +405,7 @@ void WkTracks::Plugin::CreateTrackIfVisible(const TrackContainer::TrackData& aTr
       }
       else if (trackVis == wkf::tracks::Visibility::cSELECTED_TEAM)
       {
-         wkf::Platform* platform =
-            dynamic_cast<wkf::Platform*>(scenario->FindEntity(aTrackData.mTrackId.GetPlatformName()));
+         wkf::Platform* platform = dynamic_cast<wkf::Platform*>(scenario->FindEntity(platformName));
          if (platform &&                           // If platform exists
              wkfEnv.IsPlatformVisible(platform) && // and the platform owning the tracks is visible
              platform->GetSide() ==
@@ -417,8 +416,7 @@ void WkTracks::Plugin::CreateTrackIfVisible(const TrackContainer::TrackData& aTr
       }
       else if (trackVis == wkf::tracks::Visibility::cALL_VISIBLE_TEAMS)
       {
-         wkf::Platform* platform =
-            dynamic_cast<wkf::Platform*>(scenario->FindEntity(aTrackData.mTrackId.GetPlatformName()));
+         wkf::Platform* platform = dynamic_cast<wkf::Platform*>(scenario->FindEntity(platformName));
          if (platform &&                         // If platform exists
              wkfEnv.IsPlatformVisible(platform)) // and the platform owning the tracks is visible
          {
@@ -436,8 +434,7 @@ void WkTracks::Plugin::CreateTracksIfVisible(const TrackContainer& aTrackData)
       auto* trackPrefs = wkfEnv.GetPreferenceObject<wkf::TrackVisibilityPrefObject>();
       auto  trackVis   = trackPrefs->GetTrackVisibility();
 
-      // create filtered list of tracks based on preferences.
-      TrackContainer::TrackDataList filteredTracks;
+      // Filter the tracks based on preferences. The owning platform is checked once for all of its tracks.
       if (trackVis == wkf::tracks::Visibility::cLOCAL_ONLY)
       {
          for (const auto& p : wkfEnv.GetSelectedPlatforms())
@@ -448,46 +445,37 @@ void WkTracks::Plugin::CreateTracksIfVisible(const TrackContainer& aTrackData)
             if (platform &&                         // If platform exists
                 wkfEnv.IsPlatformVisible(platform)) // and the platform owning the tracks is visible
             {
-               auto platformTracks = aTrackData.GetTrackData(name);
-
-               for (auto& track : platformTracks)
+               for (const auto& track : aTrackData.GetTrackData(name))
                {
-                  filteredTracks[track.second.mTrackId] = std::move(track.second);
+                  CreateTrack(scenario, track.second);
                }
             }
          }
       }
-      else if (trackVis == wkf::tracks::Visibility::cSELECTED_TEAM)
+      else if (trackVis == wkf::tracks::Visibility::cSELECTED_TEAM ||
+               trackVis == wkf::tracks::Visibility::cALL_VISIBLE_TEAMS)
       {
+         const bool  checkTeam    = (trackVis == wkf::tracks::Visibility::cSELECTED_TEAM);
          std::string selectedTeam = trackPrefs->GetSelectedTeamForTracks().toStdString();
-         for (const auto& data : aTrackData.GetAllTrackData())
+         for (const auto& platformTracks : aTrackData.GetAllTrackData())
          {
-            wkf::Platform* platform = dynamic_cast<wkf::Platform*>(scenario->FindEntity(data.first.GetPlatformName()));
-            if (platform &&                            // If platform exists
-                platform->GetSide() == selectedTeam && // and the platform on the selected team
-                wkfEnv.IsPlatformVisible(platform))    // and the platform owning the tracks is visible
+            if (platformTracks.mTracks.empty())
             {
-               filteredTracks[data.first] = data.second;
+               continue;
             }
-         }
-      }
-      else if (trackVis == wkf::tracks::Visibility::cALL_VISIBLE_TEAMS)
-      {
-         for (const auto& data : aTrackData.GetAllTrackData())
-         {
-            wkf::Platform* platform = dynamic_cast<wkf::Platform*>(scenario->FindEntity(data.first.GetPlatformName()));
-            if (platform &&                         // If platform exists
+
+            wkf::Platform* platform = dynamic_cast<wkf::Platform*>(scenario->FindEntity(platformTracks.mPlatformName));
+            if (platform &&                                            // If platform exists
+                (!checkTeam || platform->GetSide() == selectedTeam) && // and the platform on the selected team
                 wkfEnv.IsPlatformVisible(platform)) // and the platform owning the tracks is visible
             {
-               filteredTracks[data.first] = data.second;
+               for (const auto& track : platformTracks.mTracks)
+               {
+                  CreateTrack(scenario, track.second);
+               }
             }
          }
       }
-
-      for (const auto& track : filteredTracks)
-      {
-         CreateTrack(scenario, track.second);
-      }
    }
 }
 
@@ -499,9 +487,10 @@ void WkTracks::Plugin::CreateTrack(wkf::Scenario* aScenario, const TrackContaine
    // and the user doesn't want to show remote tracks
    if (!(aTrackData.mRemote && !showRemote))
    {
-      if (!aScenario->FindTrack(aTrackData.mTrackId))
+      wkf::TrackId trackId = aTrackData.GetTrackId();
+      if (!aScenario->FindTrack(trackId))
       {
-         wkf::Track* track = new wkf::Track(aTrackData.mTrackId);
+         wkf::Track* track = new wkf::Track(trackId);
          SetTrackState(track, aTrackData);
          aScenario->AddTrack(track);
          wkf::Observer::TrackAdded(track);
@@ -584,11 +573,11 @@ void WkTracks::Plugin::SetTrackState(wkf::Track* aTrack, const TrackContainer::T
    aTrack->SetVelocityValid(aData.mVelocityValid);
    aTrack->SetPositionOrientation(aData.mPositionWCS, psi, theta, phi);
    aTrack->SetVelocityWCS(aData.mVelocityWCS);
-   aTrack->SetSide(aData.mSide);
-   aTrack->SetTrackType(aData.mType);
-   aTrack->SetTargetPlatform(aData.mTargetPlatform);
+   aTrack->SetSide(aData.mSide.GetString());
+   aTrack->SetTrackType(aData.mType.GetString());
+   aTrack->SetTargetPlatform(aData.mTargetPlatform.GetString());
    aTrack->SetSpatialDomain(aData.mSpatialDomain);
-   aTrack->SetIcon(aData.mMilStdIcon);
+   aTrack->SetIcon(aData.mMilStdIcon.GetString());
 
    const bool showLabel = wkfEnv.GetPreferenceObject<wkf::TrackVisibilityPrefObject>()->GetShowLabel();
    const bool showColor = wkfEnv.GetPreferenceObject<wkf::TrackVisibilityPrefObject>()->GetShowColor();
@@ -603,7 +592,7 @@ void WkTracks::Plugin::CreateTrackWidgets(int aTrackId, QTreeWidgetItem* aParent
    mTrackChildItems.emplace(aTrackId, TrackItems(mTrackParentItems[aTrackId], aTrackId));
 }
 
-void WkTracks::Plugin::PopulateTrackWidgets(int aTrackId, TrackContainer::TrackData aTrackData)
+void WkTracks::Plugin::PopulateTrackWidgets(int aTrackId, const TrackContainer::TrackData& aTrackData)
 {
    UtEntity entity;
    entity.SetLocationWCS(aTrackData.mPositionWCS);
@@ -650,13 +639,13 @@ void WkTracks::Plugin::PopulateTrackWidgets(int aTrackId, TrackContainer::TrackD
    mTrackChildItems.at(aTrackId).mElevation->SetHidden(!aTrackData.mElevationValid);
    mTrackChildItems.at(aTrackId).mElevation->SetValue(aTrackData.mElevation_rad);
 
-   QString side = QString::fromStdString(aTrackData.mSide);
+   QString side = QString::fromStdString(aTrackData.mSide.GetString());
    if (side.isEmpty())
    {
       side = "Unknown";
    }
    mTrackChildItems.at(aTrackId).mSide->setText(1, side);
-   QString type = QString::fromStdString(aTrackData.mType);
+   QString type = QString::fromStdString(aTrackData.mType.GetString());
    if (type.isEmpty())
    {
       type = "Unknown";
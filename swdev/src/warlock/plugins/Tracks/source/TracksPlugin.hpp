@@ -72,7 +72,7 @@ private:
    static void SetTrackState(wkf::Track* aTrack, const TrackContainer::TrackData& aData);
 
    void CreateTrackWidgets(int aTrackId, QTreeWidgetItem* aParentItem);
-   void PopulateTrackWidgets(int aTrackId, TrackContainer::TrackData aTrackData);
+   void PopulateTrackWidgets(int aTrackId, const TrackContainer::TrackData& aTrackData);
 
    static void UpdateTrackLabel(wkf::Track* aTrack, bool aVisible, bool aShowColor);
 
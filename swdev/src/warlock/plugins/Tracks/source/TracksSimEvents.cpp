@@ -13,7 +13,7 @@
 
 void WkTracks::TrackDropEvent::Process(TrackContainer& aTrackContainer)
 {
-   aTrackContainer.DropTrack(mTrackId);
+   aTrackContainer.DropTrack(mPlatformIndex, mTrackNumber);
 }
 
 void WkTracks::TrackInitiatedEvent::Process(TrackContainer& aTrackContainer)
@@ -28,7 +28,7 @@ void WkTracks::TrackUpdatedEvent::Process(TrackContainer& aTrackContainer)
 
 void WkTracks::PlatformDeletedEvent::Process(TrackContainer& aTrackContainer)
 {
-   aTrackContainer.DropAllPlatformTracks(mName);
+   aTrackContainer.DropAllPlatformTracks(mPlatformIndex);
 }
 
 void WkTracks::SimulationCompleteEvent::Process(TrackContainer& aTrackContainer)
@@ -12,8 +12,6 @@
 #ifndef TRACKSSIMEVENTS_HPP
 #define TRACKSSIMEVENTS_HPP
 
-#include <string>
-
 #include "TracksData.hpp"
 #include "WkSimInterface.hpp"
 #include "WsfTrackId.hpp"
@@ -37,15 +35,17 @@ public:
 class TrackDropEvent : public TrackEvent
 {
 public:
-   TrackDropEvent(const wkf::TrackId& aTrackId)
-      : mTrackId(aTrackId)
+   TrackDropEvent(size_t aPlatformIndex, int aTrackNumber)
+      : mPlatformIndex(aPlatformIndex)
+      , mTrackNumber(aTrackNumber)
    {
    }
 
    void Process(TrackContainer& aTrackContainer) override;
 
 private:
-   wkf::TrackId mTrackId;
+   size_t mPlatformIndex;
+   int    mTrackNumber;
 };
 
 class TrackInitiatedEvent : public TrackEvent
@@ -75,15 +75,15 @@ private:
 class PlatformDeletedEvent : public TrackEvent
 {
 public:
-   PlatformDeletedEvent(const std::string& aPlatformName)
-      : mName(aPlatformName)
+   PlatformDeletedEvent(size_t aPlatformIndex)
+      : mPlatformIndex(aPlatformIndex)
    {
    }
 
    void Process(TrackContainer& aTrackContainer) override;
 
 private:
-   std::string mName;
+   size_t mPlatformIndex;
 };
 } // namespace WkTracks
 #endif
\ No newline at end of file
@@ -115,18 +115,20 @@ void WkTracks::SimInterface::PlatformAdded(double aSimTime, WsfPlatform& aPlatfo
    using namespace std::placeholders;
 
    const bool        remote   = aPlatform.IsExternallyControlled();
-   UtCallbackHolder& cbHolder = mCallbacksMap[aPlatform.GetIndex()];
+   const size_t      index    = aPlatform.GetIndex();
+   UtCallbackHolder& cbHolder = mCallbacksMap[index];
 
    // Track Dropped
-   cbHolder += aPlatform.GetTrackManager().LocalTrackDropped.Connect(&SimInterface::LocalTrackDroppedCB, this);
+   cbHolder += aPlatform.GetTrackManager().LocalTrackDropped.Connect(
+      std::bind(&SimInterface::LocalTrackDroppedCB, this, _1, _2, index));
 
    // Track Initiated
    cbHolder += aPlatform.GetTrackManager().LocalTrackInitiated.Connect(
-      std::bind(&SimInterface::LocalTrackInitiatedCB, this, _1, _2, _3, remote));
+      std::bind(&SimInterface::LocalTrackInitiatedCB, this, _1, _2, _3, index, remote));
 
    // Track Updated
    cbHolder += aPlatform.GetTrackManager().LocalTrackUpdated.Connect(
-      std::bind(&SimInterface::LocalTrackUpdatedCB, this, _1, _2, _3, remote));
+      std::bind(&SimInterface::LocalTrackUpdatedCB, this, _1, _2, _3, index, remote));
 
    // When a platform is added, we may need its tracks
    // if the track visibility is ALL_VISIBLE_TEAMS or SELECTED_TEAM
@@ -150,7 +152,7 @@ void WkTracks::SimInterface::PlatformAdded(double aSimTime, WsfPlatform& aPlatfo
 void WkTracks::SimInterface::PlatformDeleted(double aSimTime, const WsfPlatform& aPlatform)
 {
    mCallbacksMap.erase(aPlatform.GetIndex());
-   AddSimEvent(ut::make_unique<PlatformDeletedEvent>(aPlatform.GetName()));
+   AddSimEvent(ut::make_unique<PlatformDeletedEvent>(aPlatform.GetIndex()));
 }
 
 void WkTracks::SimInterface::SimulationStarting(const WsfSimulation& aSimulation)
@@ -170,25 +172,27 @@ void WkTracks::SimInterface::SimulationComplete(const WsfSimulation& aSimulation
    AddSimEvent(ut::make_unique<SimulationCompleteEvent>());
 }
 
-void WkTracks::SimInterface::LocalTrackDroppedCB(double aSimTime, const WsfLocalTrack* aLocalTrackPtr)
+void WkTracks::SimInterface::LocalTrackDroppedCB(double               aSimTime,
+                                                 const WsfLocalTrack* aLocalTrackPtr,
+                                                 size_t               aPlatformIndex)
 {
-   AddSimEvent(ut::make_unique<TrackDropEvent>(wkf::TrackId(aLocalTrackPtr->GetTrackId().GetOwningPlatformId(),
-                                                            aLocalTrackPtr->GetTrackId().GetLocalTrackNumber())));
+   AddSimEvent(ut::make_unique<TrackDropEvent>(aPlatformIndex, aLocalTrackPtr->GetTrackId().GetLocalTrackNumber()));
 }
 
 void WkTracks::SimInterface::LocalTrackInitiatedCB(double               aSimTime,
                                                    const WsfLocalTrack* aLocalTrackPtr,
                                                    const WsfTrack*      aRawTrackPtr,
+                                                   size_t               aPlatformIndex,
                                                    bool                 aRemote)
 {
    TrackContainer::TrackData data;
-   data.Populate(aLocalTrackPtr);
+   data.Populate(aPlatformIndex, aLocalTrackPtr);
    if (mSimulation)
    {
       auto* platform = mSimulation->GetPlatformByIndex(aLocalTrackPtr->GetTargetIndex());
       if (platform)
       {
-         data.mMilStdIcon = platform->GetIcon();
+         data.mMilStdIcon = platform->GetIconId();
       }
    }
    data.mRemote = aRemote;
@@ -198,16 +202,17 @@ void WkTracks::SimInterface::LocalTrackInitiatedCB(double               aSimTime
 void WkTracks::SimInterface::LocalTrackUpdatedCB(double               aSimTime,
                                                  const WsfLocalTrack* aLocalTrackPtr,
                                                  const WsfTrack*      aRawTrackPtr,
+                                                 size_t               aPlatformIndex,
                                                  bool                 aRemote)
 {
    TrackContainer::TrackData data;
-   data.Populate(aLocalTrackPtr);
+   data.Populate(aPlatformIndex, aLocalTrackPtr);
    if (mSimulation)
    {
       auto* platform = mSimulation->GetPlatformByIndex(aLocalTrackPtr->GetTargetIndex());
       if (platform)
       {
-         data.mMilStdIcon = platform->GetIcon();
+         data.mMilStdIcon = platform->GetIconId();
       }
    }
    data.mRemote = aRemote;
@@ -76,11 +76,20 @@ private:
    void SimulationComplete(const WsfSimulation& aSimulation) override;
    void SimulationStarting(const WsfSimulation& aSimulation) override;
 
-   void LocalTrackDroppedCB(double aSimTime, const WsfLocalTrack* aLocalTrackPtr);
-
-   void LocalTrackInitiatedCB(double aSimTime, const WsfLocalTrack* aLocalTrackPtr, const WsfTrack* aRawTrackPtr, bool aRemote);
-
-   void LocalTrackUpdatedCB(double aSimTime, const WsfLocalTrack* aLocalTrackPtr, const WsfTrack* aRawTrackPtr, bool aRemote);
+   // The platform index of the platform owning the track manager is bound when the callbacks are connected
+   void LocalTrackDroppedCB(double aSimTime, const WsfLocalTrack* aLocalTrackPtr, size_t aPlatformIndex);
+
+   void LocalTrackInitiatedCB(double               aSimTime,
+                              const WsfLocalTrack* aLocalTrackPtr,
+                              const WsfTrack*      aRawTrackPtr,
+                              size_t               aPlatformIndex,
+                              bool                 aRemote);
+
+   void LocalTrackUpdatedCB(double               aSimTime,
+                            const WsfLocalTrack* aLocalTrackPtr,
+                            const WsfTrack*      aRawTrackPtr,
+                            size_t               aPlatformIndex,
+                            bool                 aRemote);
 
    // allows for deletion of callbacks when platform is deleted (size_t key represents platform index)
    std::unordered_map<size_t, UtCallbackHolder> mCallbacksMap;
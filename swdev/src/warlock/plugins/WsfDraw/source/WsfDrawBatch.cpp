@@ -0,0 +1,274 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WsfDrawBatch.hpp"
+
+#include "WkfEnvironment.hpp"
+#include "WkfPlatform.hpp"
+#include "WkfScenario.hpp"
+#include "WkfVtkEnvironment.hpp"
+
+namespace
+{
+bool MakeVertex(wkf::Scenario*                         aScenarioPtr,
+                const WsfDraw::VertexObject&           aVertex,
+                wkf::OverlayWsfDrawBase::VertexObject& aOverlayVertex)
+{
+   bool success                       = true;
+   aOverlayVertex.mPosition           = aVertex.mPosition;
+   aOverlayVertex.mReferenceEntityPtr = nullptr;
+
+   switch (aVertex.mVertexType)
+   {
+   case WsfDraw::cUNSET_VERTEX:
+   case WsfDraw::cABSOLUTE_WCS:
+      break;
+
+   // if it's a relative vertex, we need the position of the platform associated with the VertexObject
+   case WsfDraw::cRELATIVE_ZERO:
+   case WsfDraw::cRELATIVE_ECS:
+   case WsfDraw::cRELATIVE_NED:
+   {
+      if (aScenarioPtr)
+      {
+         aOverlayVertex.mReferenceEntityPtr = aScenarioPtr->FindPlatformByIndex(aVertex.mPlatformIndex);
+         if (aOverlayVertex.mReferenceEntityPtr == nullptr)
+         {
+            success = false;
+         }
+      }
+      break;
+   }
+   case WsfDraw::cABSOLUTE_SCREEN:
+   {
+      if (aScenarioPtr)
+      {
+         aOverlayVertex.mReferenceEntityPtr = aScenarioPtr->FindPlatformByIndex(aVertex.mPlatformIndex);
+         if ((aOverlayVertex.mReferenceEntityPtr == nullptr) && (aVertex.mPlatformIndex != 0))
+         {
+            success = false;
+         }
+      }
+      break;
+   }
+   }
+
+   switch (aVertex.mVertexType)
+   {
+   case WsfDraw::cUNSET_VERTEX:
+   {
+      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cUNSET_VERTEX;
+      break;
+   }
+
+   case WsfDraw::cABSOLUTE_WCS:
+   {
+      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cABSOLUTE_WCS;
+      break;
+   }
+
+   case WsfDraw::cRELATIVE_ZERO:
+   {
+      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cRELATIVE_ZERO;
+      break;
+   }
+
+   case WsfDraw::cRELATIVE_ECS:
+   {
+      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cRELATIVE_ECS;
+      break;
+   }
+
+   case WsfDraw::cRELATIVE_NED:
+   {
+      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cRELATIVE_NED;
+      break;
+   }
+
+   case WsfDraw::cABSOLUTE_SCREEN:
+   {
+      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cABSOLUTE_SCREEN;
+      break;
+   }
+
+   default:
+      break;
+   }
+   return success;
+}
+} // namespace
+
+void WkWsfDraw::DrawBatch::Append(double aSimTime, const std::vector<WsfDraw::DrawEvent>& aEvents)
+{
+   const size_t size = mEvents.size() + aEvents.size();
+   mStartTime.reserve(size);
+   mEndTime.reserve(size);
+   mColor.reserve(size);
+   mFirstVertex.reserve(size);
+   mValid.reserve(size);
+   mEvents.reserve(size);
+
+   for (const auto& e : aEvents)
+   {
+      AppendColumns(aSimTime, e);
+   }
+   mEvents.insert(mEvents.end(), aEvents.begin(), aEvents.end());
+}
+
+void WkWsfDraw::DrawBatch::Append(double aStartTime, WsfDraw::DrawEvent&& aEvent)
+{
+   AppendColumns(aStartTime, aEvent);
+   mEvents.emplace_back(std::move(aEvent));
+}
+
+void WkWsfDraw::DrawBatch::AppendColumns(double aStartTime, const WsfDraw::DrawEvent& aEvent)
+{
+   UtColor color = aEvent.mColor;
+   float   red, green, blue, alpha;
+   color.Get(red, green, blue, alpha);
+
+   mStartTime.push_back(aStartTime);
+   mEndTime.push_back(aStartTime + aEvent.mDuration);
+   mColor.push_back(Color{{static_cast<unsigned char>(red * 255),
+                           static_cast<unsigned char>(green * 255),
+                           static_cast<unsigned char>(blue * 255),
+                           static_cast<unsigned char>(alpha * 255)}});
+   mFirstVertex.push_back(mVertices.size());
+   mValid.push_back(0);
+   mVertices.resize(mVertices.size() + GetVertexCount(aEvent.mDrawType));
+}
+
+void WkWsfDraw::DrawBatch::Resolve()
+{
+   wkf::Scenario* scenarioPtr = vaEnv.GetStandardScenario();
+
+   mInvalidCount = 0;
+   for (size_t i = 0; i < mEvents.size(); ++i)
+   {
+      const WsfDraw::DrawEvent& e           = mEvents[i];
+      const size_t              vertexCount = GetVertexCount(e.mDrawType);
+      bool                      valid       = true;
+      for (size_t v = 0; v < vertexCount; ++v)
+      {
+         valid = valid && MakeVertex(scenarioPtr, e.mVerts[v], mVertices[mFirstVertex[i] + v]);
+      }
+      mValid[i] = valid ? 1 : 0;
+      mInvalidCount += valid ? 0 : 1;
+   }
+}
+
+void WkWsfDraw::DrawBatch::AddTo(wkf::OverlayWsfDraw& aOverlay) const
+{
+   for (size_t i = 0; i < mEvents.size(); ++i)
+   {
+      if (mValid[i] == 0)
+      {
+         continue;
+      }
+
+      const WsfDraw::DrawEvent&                    e     = mEvents[i];
+      const double                                 start = mStartTime[i];
+      const float                                  end   = static_cast<float>(mEndTime[i]);
+      const Color&                                 c     = mColor[i];
+      const wkf::OverlayWsfDrawBase::VertexObject* v     = mVertices.data() + mFirstVertex[i];
+
+      switch (e.mDrawType)
+      {
+      case WsfDraw::DrawType::cLINE:
+         aOverlay.AddLine(start, end, e.mID, v[0], v[1], e.mLineSize, e.mLineStyle, c[0], c[1], c[2], c[3]);
+         break;
+      case WsfDraw::DrawType::cPOINT:
+         aOverlay.AddPoint(start, end, e.mID, v[0], e.mPointSize, c[0], c[1], c[2], c[3]);
+         break;
+      case WsfDraw::DrawType::cICON:
+         aOverlay.AddIcon(start, end, e.mID, v[0], e.mHeading, e.mIcon, c[0], c[1], c[2], c[3]);
+         break;
+      case WsfDraw::DrawType::cELLIPSE:
+         aOverlay.AddEllipse(start,
+                             end,
+                             e.mID,
+                             v[0],
+                             e.mHeading,
+                             e.mAxisA,
+                             e.mAxisB,
+                             e.mLineSize,
+                             e.mLineStyle,
+                             e.mEllipseMode,
+                             c[0],
+                             c[1],
+                             c[2],
+                             c[3]);
+         break;
+      case WsfDraw::DrawType::cERASE:
+         aOverlay.Erase(start, e.mID);
+         break;
+      case WsfDraw::DrawType::cELLIPSOID:
+         aOverlay.AddEllipsoid(start,
+                               end,
+                               e.mID,
+                               v[0],
+                               e.mHeading,
+                               e.mPitch,
+                               e.mRoll,
+                               e.mAxisA,
+                               e.mAxisB,
+                               e.mAxisC,
+                               e.mLineSize,
+                               e.mLineStyle,
+                               e.mEllipseMode,
+                               c[0],
+                               c[1],
+                               c[2],
+                               c[3]);
+         break;
+      case WsfDraw::DrawType::cQUADRILATERAL:
+         aOverlay.AddQuadrilateral(start, end, e.mID, v[0], v[1], v[2], v[3], c[0], c[1], c[2], c[3]);
+         break;
+      case WsfDraw::DrawType::cTEXT:
+         aOverlay.AddText(start, end, e.mID, v[0], e.mTextSize, e.mText, c[0], c[1], c[2], c[3]);
+         break;
+      case WsfDraw::DrawType::cTIMER:
+         aOverlay.AddTimer(start, end, e.mID, v[0], e.mPointSize, c[0], c[1], c[2], c[3]);
+         break;
+      case WsfDraw::DrawType::cNONE:
+         break;
+      }
+   }
+}
+
+void WkWsfDraw::DrawBatch::Clear()
+{
+   // The columns keep their capacity for the next update
+   mStartTime.clear();
+   mEndTime.clear();
+   mColor.clear();
+   mFirstVertex.clear();
+   mValid.clear();
+   mEvents.clear();
+   mVertices.clear();
+   mInvalidCount = 0;
+}
+
+size_t WkWsfDraw::DrawBatch::GetVertexCount(WsfDraw::DrawType aDrawType)
+{
+   switch (aDrawType)
+   {
+   case WsfDraw::DrawType::cLINE:
+      return 2;
+   case WsfDraw::DrawType::cQUADRILATERAL:
+      return 4;
+   case WsfDraw::DrawType::cERASE:
+   case WsfDraw::DrawType::cNONE:
+      return 0;
+   default:
+      return 1;
+   }
+}
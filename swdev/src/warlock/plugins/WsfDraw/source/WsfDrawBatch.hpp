@@ -0,0 +1,71 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WSFDRAWBATCH_HPP
+#define WSFDRAWBATCH_HPP
+
+#include <array>
+#include <vector>
+
+#include "WsfDraw.hpp"
+#include "wsf_draw/WkfOverlayWsfDraw.hpp"
+
+namespace WkWsfDraw
+{
+// Collects the draw events of one layer until they are added to the overlays.
+// Scripts drawing track histories or engagement lines send many small sets of
+// events per update; appending them here lets the start and end times, colors
+// and vertices be prepared once per GUI update in contiguous columns, instead of
+// once per event and viewer, before the elements are added to each viewer's overlay.
+class DrawBatch
+{
+public:
+   void Append(double aSimTime, const std::vector<WsfDraw::DrawEvent>& aEvents);
+   void Append(double aStartTime, WsfDraw::DrawEvent&& aEvent);
+
+   // Resolves the vertices of the appended events against the platforms of the standard scenario.
+   // Must be called before AddTo, and again if events were appended since.
+   void Resolve();
+   // Adds the elements with resolved vertices to the overlay
+   void AddTo(wkf::OverlayWsfDraw& aOverlay) const;
+
+   void Clear();
+
+   bool   IsEmpty() const { return mEvents.empty(); }
+   size_t GetSize() const { return mEvents.size(); }
+   // Returns true if the vertices of at least one element were resolved.  AddTo skips the other elements.
+   bool HasValidElements() const { return mInvalidCount < mEvents.size(); }
+
+   double              GetStartTime(size_t aIndex) const { return mStartTime[aIndex]; }
+   double              GetEndTime(size_t aIndex) const { return mEndTime[aIndex]; }
+   WsfDraw::DrawEvent& GetEvent(size_t aIndex) { return mEvents[aIndex]; }
+
+private:
+   using Color = std::array<unsigned char, 4>;
+
+   static size_t GetVertexCount(WsfDraw::DrawType aDrawType);
+
+   void AppendColumns(double aStartTime, const WsfDraw::DrawEvent& aEvent);
+
+   // One entry per element
+   std::vector<double>             mStartTime;
+   std::vector<double>             mEndTime;
+   std::vector<Color>              mColor;
+   std::vector<size_t>             mFirstVertex; // index of the element's first vertex in mVertices
+   std::vector<char>               mValid;
+   std::vector<WsfDraw::DrawEvent> mEvents; // the remaining attributes of each element
+
+   std::vector<wkf::OverlayWsfDrawBase::VertexObject> mVertices;
+   size_t                                             mInvalidCount{0};
+};
+} // namespace WkWsfDraw
+
+#endif // !WSFDRAWBATCH_HPP
@@ -11,6 +11,8 @@
 
 #include "WsfDrawObject.hpp"
 
+#include <algorithm>
+
 #include "VaCamera.hpp"
 #include "VaCameraMotionTethered.hpp"
 #include "VaObserver.hpp"
@@ -98,13 +100,30 @@ void WkWsfDraw::WsfDrawObject::ViewerInitializedHandler(vespa::VaViewer* aViewer
    if (IsImmersive(aViewer))
    {
       mViewerLayerMaps.emplace(aViewer, LayerMap());
+
+      // Replay the unfinished events in the order they were drawn
+      std::vector<const EventInfo*> events;
       for (const auto& eventIt : mPastEvents)
       {
-         DrawEventHandler(eventIt.second.mStartTime,
-                          eventIt.second.mLayerName,
-                          {eventIt.second.mEvent},
-                          aViewer,
-                          mViewerLayerMaps[aViewer]);
+         if (eventIt.mActive)
+         {
+            events.push_back(&eventIt);
+         }
+      }
+      std::sort(events.begin(),
+                events.end(),
+                [](const EventInfo* aLhs, const EventInfo* aRhs) { return aLhs->mSequence < aRhs->mSequence; });
+
+      std::map<QString, DrawBatch> batches;
+      for (const EventInfo* eventPtr : events)
+      {
+         WsfDraw::DrawEvent event = eventPtr->mEvent;
+         batches[eventPtr->mLayerName].Append(eventPtr->mStartTime, std::move(event));
+      }
+      for (auto& batchIt : batches)
+      {
+         batchIt.second.Resolve();
+         DrawBatchHandler(batchIt.first, batchIt.second, aViewer, mViewerLayerMaps[aViewer]);
       }
    }
 }
@@ -127,310 +146,113 @@ void WkWsfDraw::WsfDrawObject::ProcessDrawEvents(double
 {
    if (vaEnv.GetStandardScenario() != nullptr)
    {
-      for (const auto& eventIt : aEvents)
-      {
-         mPastEvents.emplace(aSimTime + eventIt.mDuration, EventInfo(aSimTime, aLayer, eventIt));
-      }
-      // Get the smallest endTime that is greater than or equal to the currentTime, and remove everything below this time
-      auto mapIt = mPastEvents.lower_bound(aSimTime);
-      if (mapIt != mPastEvents.begin())
-      {
-         mPastEvents.erase(mPastEvents.begin(), mapIt);
-      }
-
-      for (auto& viewerIt : mViewerLayerMaps)
-      {
-         DrawEventHandler(aSimTime, aLayer, aEvents, viewerIt.first, viewerIt.second);
-      }
+      mPendingBatches[!aLayer.isEmpty() ? aLayer : "WSF_DRAW"].Append(aSimTime, aEvents);
+      mLastSimTime = aSimTime;
    }
 }
 
-void WkWsfDraw::WsfDrawObject::DrawEventHandler(double                                 aSimTime,
-                                                const QString&                         aLayer,
-                                                const std::vector<WsfDraw::DrawEvent>& aEvents,
-                                                vespa::VaViewer*                       aViewer,
-                                                LayerMap&                              aLayerMap)
+void WkWsfDraw::WsfDrawObject::FlushDrawEvents()
 {
-   bool    newLayer = false;
-   QString layer(!aLayer.isEmpty() ? aLayer : "WSF_DRAW");
-
-   if (aLayerMap.find(layer) == aLayerMap.end())
+   for (auto& batchIt : mPendingBatches)
    {
-      wkf::OverlayWsfDraw* overlay = new wkf::OverlayWsfDraw(layer.toStdString());
-      aLayerMap[layer]             = overlay;
-      if (aViewer)
+      DrawBatch& batch = batchIt.second;
+      if (!batch.IsEmpty())
       {
-         newLayer = true;
-
-         if (aViewer == vaEnv.GetStandardViewer())
+         // The vertices are resolved once, and shared by the overlays of every viewer
+         batch.Resolve();
+         for (auto& viewerIt : mViewerLayerMaps)
          {
-            connect(overlay,
-                    &wkf::OverlayWsfDraw::ElementAdded,
-                    [this, layer](int aIndex) { ElementAddedCB(layer, aIndex); });
-            connect(overlay,
-                    &wkf::OverlayWsfDraw::ElementActivated,
-                    [this, layer](int aIndex, bool aState) { ElementActivatedCB(layer, aIndex, aState); });
+            DrawBatchHandler(batchIt.first, batch, viewerIt.first, viewerIt.second);
          }
+         AddPastEvents(batchIt.first, batch);
+         batch.Clear();
       }
    }
+   ExpirePastEvents(mLastSimTime);
+}
 
-   wkf::OverlayWsfDraw* draw = aLayerMap[layer];
-
-   bool validVertex = true;
-   for (auto& e : aEvents)
+void WkWsfDraw::WsfDrawObject::AddPastEvents(const QString& aLayer, DrawBatch& aBatch)
+{
+   for (size_t i = 0; i < aBatch.GetSize(); ++i)
    {
-      UtColor color = e.mColor;
-      float   red, green, blue, alpha;
-      color.Get(red, green, blue, alpha);
-
-      float endTime = aSimTime + e.mDuration;
-
-      switch (e.mDrawType)
-      {
-      case WsfDraw::DrawType::cLINE:
-      {
-         wkf::OverlayWsfDrawBase::VertexObject v1, v2;
-         if (MakeVertex(e.mVerts[0], v1) && MakeVertex(e.mVerts[1], v2))
-         {
-            draw->AddLine(aSimTime,
-                          endTime,
-                          e.mID,
-                          v1,
-                          v2,
-                          e.mLineSize,
-                          e.mLineStyle,
-                          static_cast<unsigned char>(red * 255),
-                          static_cast<unsigned char>(green * 255),
-                          static_cast<unsigned char>(blue * 255),
-                          static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
-      }
-
-      case WsfDraw::DrawType::cPOINT:
+      // Events that already finished can never be drawn on a new viewer
+      if (aBatch.GetEndTime(i) < mLastSimTime)
       {
-         wkf::OverlayWsfDrawBase::VertexObject v1;
-         if (MakeVertex(e.mVerts[0], v1))
-         {
-            draw->AddPoint(aSimTime,
-                           endTime,
-                           e.mID,
-                           v1,
-                           e.mPointSize,
-                           static_cast<unsigned char>(red * 255),
-                           static_cast<unsigned char>(green * 255),
-                           static_cast<unsigned char>(blue * 255),
-                           static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
+         continue;
       }
 
-      case WsfDraw::DrawType::cICON:
+      EventInfo info(mPastEventSequence++, aBatch.GetStartTime(i), aLayer, std::move(aBatch.GetEvent(i)));
+      size_t    slot = mPastEvents.size();
+      if (!mFreePastEvents.empty())
       {
-         wkf::OverlayWsfDrawBase::VertexObject v1;
-         if (MakeVertex(e.mVerts[0], v1))
-         {
-            draw->AddIcon(aSimTime,
-                          endTime,
-                          e.mID,
-                          v1,
-                          e.mHeading,
-                          e.mIcon,
-                          static_cast<unsigned char>(red * 255),
-                          static_cast<unsigned char>(green * 255),
-                          static_cast<unsigned char>(blue * 255),
-                          static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
+         slot = mFreePastEvents.back();
+         mFreePastEvents.pop_back();
+         mPastEvents[slot] = std::move(info);
       }
-
-      case WsfDraw::DrawType::cELLIPSE:
+      else
       {
-         wkf::OverlayWsfDrawBase::VertexObject v1;
-         if (MakeVertex(e.mVerts[0], v1))
-         {
-            draw->AddEllipse(aSimTime,
-                             endTime,
-                             e.mID,
-                             v1,
-                             e.mHeading,
-                             e.mAxisA,
-                             e.mAxisB,
-                             e.mLineSize,
-                             e.mLineStyle,
-                             e.mEllipseMode,
-                             static_cast<unsigned char>(red * 255),
-                             static_cast<unsigned char>(green * 255),
-                             static_cast<unsigned char>(blue * 255),
-                             static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
+         mPastEvents.push_back(std::move(info));
       }
+      mPastEventExpiry.emplace(aBatch.GetEndTime(i), slot);
+   }
+}
 
-      case WsfDraw::DrawType::cERASE:
-      {
-         draw->Erase(aSimTime, e.mID);
-         break;
-      }
+void WkWsfDraw::WsfDrawObject::ExpirePastEvents(double aSimTime)
+{
+   // Only the events that finished are visited, earliest end time first
+   while (!mPastEventExpiry.empty() && mPastEventExpiry.top().first < aSimTime)
+   {
+      const size_t slot = mPastEventExpiry.top().second;
+      mPastEventExpiry.pop();
+      mPastEvents[slot].mActive = false;
+      mPastEvents[slot].mEvent  = WsfDraw::DrawEvent();
+      mFreePastEvents.push_back(slot);
+   }
+}
 
-      case WsfDraw::DrawType::cELLIPSOID:
-      {
-         wkf::OverlayWsfDrawBase::VertexObject v1;
-         if (MakeVertex(e.mVerts[0], v1))
-         {
-            draw->AddEllipsoid(aSimTime,
-                               endTime,
-                               e.mID,
-                               v1,
-                               e.mHeading,
-                               e.mPitch,
-                               e.mRoll,
-                               e.mAxisA,
-                               e.mAxisB,
-                               e.mAxisC,
-                               e.mLineSize,
-                               e.mLineStyle,
-                               e.mEllipseMode,
-                               static_cast<unsigned char>(red * 255),
-                               static_cast<unsigned char>(green * 255),
-                               static_cast<unsigned char>(blue * 255),
-                               static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
-      }
+void WkWsfDraw::WsfDrawObject::DrawBatchHandler(const QString&   aLayer,
+                                                const DrawBatch& aBatch,
+                                                vespa::VaViewer* aViewer,
+                                                LayerMap&        aLayerMap)
+{
+   auto layerIt = aLayerMap.find(aLayer);
+   if (layerIt != aLayerMap.end())
+   {
+      aBatch.AddTo(*layerIt->second);
+      return;
+   }
 
-      case WsfDraw::DrawType::cQUADRILATERAL:
-      {
-         wkf::OverlayWsfDrawBase::VertexObject v1;
-         wkf::OverlayWsfDrawBase::VertexObject v2;
-         wkf::OverlayWsfDrawBase::VertexObject v3;
-         wkf::OverlayWsfDrawBase::VertexObject v4;
+   // A layer is not created by events that only reference platforms that do not exist.  The batch holds every event
+   // of the layer for this update, so an invalid element must not drop the valid ones, which AddTo adds.
+   if (!aBatch.HasValidElements())
+   {
+      return;
+   }
 
-         if (MakeVertex(e.mVerts[0], v1) && MakeVertex(e.mVerts[1], v2) && MakeVertex(e.mVerts[2], v3) &&
-             MakeVertex(e.mVerts[3], v4))
-         {
-            draw->AddQuadrilateral(aSimTime,
-                                   endTime,
-                                   e.mID,
-                                   v1,
-                                   v2,
-                                   v3,
-                                   v4,
-                                   static_cast<unsigned char>(red * 255),
-                                   static_cast<unsigned char>(green * 255),
-                                   static_cast<unsigned char>(blue * 255),
-                                   static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
-      }
+   wkf::OverlayWsfDraw* overlay = new wkf::OverlayWsfDraw(aLayer.toStdString());
+   aLayerMap[aLayer]            = overlay;
+   if (aViewer == vaEnv.GetStandardViewer())
+   {
+      connect(overlay,
+              &wkf::OverlayWsfDraw::ElementAdded,
+              [this, aLayer](int aIndex) { ElementAddedCB(aLayer, aIndex); });
+      connect(overlay,
+              &wkf::OverlayWsfDraw::ElementActivated,
+              [this, aLayer](int aIndex, bool aState) { ElementActivatedCB(aLayer, aIndex, aState); });
+   }
 
-      case WsfDraw::DrawType::cTEXT:
-      {
-         wkf::OverlayWsfDrawBase::VertexObject v1;
-         if (MakeVertex(e.mVerts[0], v1))
-         {
-            draw->AddText(aSimTime,
-                          endTime,
-                          e.mID,
-                          v1,
-                          e.mTextSize,
-                          e.mText,
-                          static_cast<unsigned char>(red * 255),
-                          static_cast<unsigned char>(green * 255),
-                          static_cast<unsigned char>(blue * 255),
-                          static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
-      }
+   aBatch.AddTo(*overlay);
 
-      case WsfDraw::DrawType::cTIMER:
-      {
-         wkf::OverlayWsfDrawBase::VertexObject v1;
-         if (MakeVertex(e.mVerts[0], v1))
-         {
-            draw->AddTimer(aSimTime,
-                           endTime,
-                           e.mID,
-                           v1,
-                           e.mPointSize,
-                           static_cast<unsigned char>(red * 255),
-                           static_cast<unsigned char>(green * 255),
-                           static_cast<unsigned char>(blue * 255),
-                           static_cast<unsigned char>(alpha * 255));
-         }
-         else if (newLayer)
-         {
-            delete aLayerMap[layer];
-            aLayerMap.erase(layer);
-            validVertex = false;
-         }
-         break;
-      }
-      case WsfDraw::DrawType::cNONE:
-         break;
-      }
-   }
-   if (aViewer)
+   aViewer->AddOverlay(overlay);
+   if (aViewer == vaEnv.GetStandardViewer())
    {
-      if (validVertex && newLayer)
-      {
-         aViewer->AddOverlay(aLayerMap[layer]);
-         if (aViewer == vaEnv.GetStandardViewer())
-         {
-            emit LayerAdded(layer);
-         }
-         else
-         {
-            aLayerMap[layer]->SetVisible(false);
-         }
-      }
+      emit LayerAdded(aLayer);
    }
-   if (newLayer)
+   else
    {
-      HandleNewLayer(layer);
+      overlay->SetVisible(false);
    }
+   HandleNewLayer(aLayer);
 }
 
 void WkWsfDraw::WsfDrawObject::Clear()
@@ -446,7 +268,11 @@ void WkWsfDraw::WsfDrawObject::Clear()
       viewerIt.second.clear();
    }
    // mViewerLayerMap isn't cleared, since views can remain visible on restart
+   mPendingBatches.clear();
    mPastEvents.clear();
+   mFreePastEvents.clear();
+   mPastEventExpiry = decltype(mPastEventExpiry)();
+   mLastSimTime     = 0.0;
 }
 
 QList<QString> WkWsfDraw::WsfDrawObject::GetLayerStrings(vespa::VaViewer* aViewer) const
@@ -476,90 +302,3 @@ bool WkWsfDraw::WsfDrawObject::GetLayerVisibility(vespa::VaViewer* aViewer, cons
    }
    return false;
 }
-
-bool WkWsfDraw::WsfDrawObject::MakeVertex(const WsfDraw::VertexObject&           aVertex,
-                                          wkf::OverlayWsfDrawBase::VertexObject& aOverlayVertex)
-{
-   bool success             = true;
-   aOverlayVertex.mPosition = aVertex.mPosition;
-
-   switch (aVertex.mVertexType)
-   {
-   case WsfDraw::cUNSET_VERTEX:
-   case WsfDraw::cABSOLUTE_WCS:
-      break;
-
-   // if it's a relative vertex, we need the position of the platform associated with the VertexObject
-   case WsfDraw::cRELATIVE_ZERO:
-   case WsfDraw::cRELATIVE_ECS:
-   case WsfDraw::cRELATIVE_NED:
-   {
-      auto* scenarioPtr = vaEnv.GetStandardScenario();
-      if (scenarioPtr)
-      {
-         aOverlayVertex.mReferenceEntityPtr = scenarioPtr->FindPlatformByIndex(aVertex.mPlatformIndex);
-         if (aOverlayVertex.mReferenceEntityPtr == nullptr)
-         {
-            success = false;
-         }
-      }
-      break;
-   }
-   case WsfDraw::cABSOLUTE_SCREEN:
-   {
-      auto* scenarioPtr = vaEnv.GetStandardScenario();
-      if (scenarioPtr)
-      {
-         aOverlayVertex.mReferenceEntityPtr = scenarioPtr->FindPlatformByIndex(aVertex.mPlatformIndex);
-         if ((aOverlayVertex.mReferenceEntityPtr == nullptr) && (aVertex.mPlatformIndex != 0))
-         {
-            success = false;
-         }
-      }
-      break;
-   }
-   }
-
-   switch (aVertex.mVertexType)
-   {
-   case WsfDraw::cUNSET_VERTEX:
-   {
-      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cUNSET_VERTEX;
-      break;
-   }
-
-   case WsfDraw::cABSOLUTE_WCS:
-   {
-      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cABSOLUTE_WCS;
-      break;
-   }
-
-   case WsfDraw::cRELATIVE_ZERO:
-   {
-      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cRELATIVE_ZERO;
-      break;
-   }
-
-   case WsfDraw::cRELATIVE_ECS:
-   {
-      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cRELATIVE_ECS;
-      break;
-   }
-
-   case WsfDraw::cRELATIVE_NED:
-   {
-      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cRELATIVE_NED;
-      break;
-   }
-
-   case WsfDraw::cABSOLUTE_SCREEN:
-   {
-      aOverlayVertex.mVertexType = wkf::OverlayWsfDrawBase::cABSOLUTE_SCREEN;
-      break;
-   }
-
-   default:
-      break;
-   }
-   return success;
-}
@@ -12,14 +12,19 @@
 #ifndef WSFDRAWOBJECT_HPP
 #define WSFDRAWOBJECT_HPP
 
+#include <functional>
 #include <map>
+#include <queue>
 #include <set>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <QObject>
 
 #include "WkfObserver.hpp"
 #include "WsfDraw.hpp"
+#include "WsfDrawBatch.hpp"
 #include "wsf_draw/WkfOverlayWsfDraw.hpp"
 #include "wsf_draw/WkfWsfDrawItemModel.hpp"
 
@@ -34,12 +39,10 @@ public:
 
    void ShowViewerLayer(vespa::VaViewer* aViewer, const QString& aName, bool aState);
 
+   // Queues the events on their layer, they are drawn by FlushDrawEvents
    void ProcessDrawEvents(double aSimTime, const QString& aLayer, const std::vector<WsfDraw::DrawEvent>& aEvents);
-   void DrawEventHandler(double                                 aSimTime,
-                         const QString&                         aLayer,
-                         const std::vector<WsfDraw::DrawEvent>& aEvents,
-                         vespa::VaViewer*                       aViewer,
-                         LayerMap&                              aLayerMap);
+   // Draws the queued events of each layer on every viewer, once per GUI update
+   void FlushDrawEvents();
 
    void           Clear();
    QList<QString> GetLayerStrings(vespa::VaViewer* aViewer) const;
@@ -50,7 +53,10 @@ signals:
    void ResetLayers();
 
 private:
-   bool MakeVertex(const WsfDraw::VertexObject& aVertex, wkf::OverlayWsfDrawBase::VertexObject& aVert);
+   void DrawBatchHandler(const QString& aLayer, const DrawBatch& aBatch, vespa::VaViewer* aViewer, LayerMap& aLayerMap);
+
+   void AddPastEvents(const QString& aLayer, DrawBatch& aBatch);
+   void ExpirePastEvents(double aSimTime);
 
    void EntityDeletedHandler(vespa::VaEntity* aEntity);
    void ViewerDestroyedHandler(vespa::VaViewer* aViewer);
@@ -60,20 +66,35 @@ private:
    // Handles draws outside of the standard viewer
    std::unordered_map<vespa::VaViewer*, LayerMap> mViewerLayerMaps;
 
+   // The events drawn since the last flush, by layer
+   std::map<QString, DrawBatch> mPendingBatches;
+   double                       mLastSimTime{0.0};
+
    // Stores events whose duration has not finished (for future draws on viewers that aren't created on startup)
    struct EventInfo
    {
-      EventInfo(double aStartTime, const QString& aLayerName, const WsfDraw::DrawEvent& aEvent)
-         : mStartTime(aStartTime)
+      EventInfo(size_t aSequence, double aStartTime, const QString& aLayerName, WsfDraw::DrawEvent&& aEvent)
+         : mActive(true)
+         , mSequence(aSequence)
+         , mStartTime(aStartTime)
          , mLayerName(aLayerName)
-         , mEvent(aEvent)
+         , mEvent(std::move(aEvent))
       {
       }
+      bool               mActive;   // false once the event finished and its slot is free
+      size_t             mSequence; // the order the events were drawn in
       double             mStartTime;
       QString            mLayerName;
       WsfDraw::DrawEvent mEvent;
    };
-   std::multimap<double, EventInfo> mPastEvents;
+   // Slots of unfinished events, the slots of finished events are reused
+   std::vector<EventInfo> mPastEvents;
+   std::vector<size_t>    mFreePastEvents;
+   size_t                 mPastEventSequence{0};
+
+   // The end time and slot of each unfinished event, earliest end time first
+   using Expiry = std::pair<double, size_t>;
+   std::priority_queue<Expiry, std::vector<Expiry>, std::greater<Expiry>> mPastEventExpiry;
 
    vespa::VaCallbackHolder mCallbacks;
 };
@@ -81,4 +81,5 @@ void WkWsfDraw::Plugin::BuildViewerContextMenu(QMenu* aMenu, vespa::VaViewer* aV
 void WkWsfDraw::Plugin::GuiUpdate()
 {
    mInterfacePtr->ProcessEvents(*mDrawObjectPtr);
+   mDrawObjectPtr->FlushDrawEvents();
 }
@@ -16,6 +16,8 @@
 #include "WkCoreSimCommands.hpp"
 #include "WkCoreSimEvents.hpp"
 #include "WkPermissions.hpp"
+#include "WkPlatformSnapshot.hpp"
+#include "WkSimEnvironment.hpp"
 #include "WkXIO_DataContainer.hpp"
 #include "WsfClockSource.hpp"
 #include "WsfComm.hpp"
@@ -255,22 +257,42 @@ void warlock::CoreSimInterface::WallClockRead(const WsfSimulation& aSimulation)
 
    WsfDisInterface* disInterface = WsfDisInterface::Find(aSimulation);
 
-   for (size_t i = 0; i < aSimulation.GetPlatformCount(); ++i)
+   // A snapshot is only captured at the start of this clock tick while a plugin subscribes to them. The platforms
+   // were then already updated to the current time, so their kinematic state is copied from it. Otherwise the
+   // platforms are read directly.
+   auto         snapshot = simEnv.GetPlatformSnapshotService().GetSnapshot();
+   const size_t count    = snapshot ? snapshot->GetPlatformCount() : aSimulation.GetPlatformCount();
+   for (size_t i = 0; i < count; ++i)
    {
-      // platformPtr should always be valid, no need to check
-      WsfPlatform* platformPtr = aSimulation.GetPlatformEntry(i);
-
-      // Call Update so that the data is updated to the current time
-      platformPtr->Update(aSimulation.GetSimTime());
+      WsfPlatform* platformPtr =
+         snapshot ? aSimulation.GetPlatformByIndex(snapshot->mIdentity->mIndex[i]) : aSimulation.GetPlatformEntry(i);
+      if (platformPtr == nullptr)
+      {
+         continue;
+      }
 
       // Create the proxy entry
       PlatformProxy& proxy = platforms[platformPtr->GetIndex()];
 
-      proxy.mUpdateTime = aSimulation.GetSimTime();
-      platformPtr->GetLocationWCS(proxy.mLocationWCS);
-      platformPtr->GetVelocityWCS(proxy.mVelocityWCS);
-      platformPtr->GetAccelerationWCS(proxy.mAccelerationWCS);
-      platformPtr->GetOrientationWCS(proxy.mOrientationWCS[0], proxy.mOrientationWCS[1], proxy.mOrientationWCS[2]);
+      if (snapshot)
+      {
+         proxy.mUpdateTime = snapshot->mSimTime;
+         snapshot->mLocationWCS[i].Get(proxy.mLocationWCS);
+         snapshot->mVelocityWCS[i].Get(proxy.mVelocityWCS);
+         snapshot->mAccelerationWCS[i].Get(proxy.mAccelerationWCS);
+         snapshot->mOrientationWCS[i].Get(proxy.mOrientationWCS);
+      }
+      else
+      {
+         // Call Update so that the data is updated to the current time
+         platformPtr->Update(aSimulation.GetSimTime());
+
+         proxy.mUpdateTime = aSimulation.GetSimTime();
+         platformPtr->GetLocationWCS(proxy.mLocationWCS);
+         platformPtr->GetVelocityWCS(proxy.mVelocityWCS);
+         platformPtr->GetAccelerationWCS(proxy.mAccelerationWCS);
+         platformPtr->GetOrientationWCS(proxy.mOrientationWCS[0], proxy.mOrientationWCS[1], proxy.mOrientationWCS[2]);
+      }
 
       unsigned int vpCount = platformPtr->GetComponentCount<WsfVisualPart>();
       for (unsigned int vi = 0; vi < vpCount; ++vi)
@@ -0,0 +1,206 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#include "WkPlatformSnapshot.hpp"
+
+#include <algorithm>
+
+#include "WsfPlatform.hpp"
+#include "WsfPlatformPart.hpp"
+#include "WsfSimulation.hpp"
+
+size_t warlock::PlatformSnapshot::Find(size_t aPlatformIndex) const
+{
+   if (mIdentity)
+   {
+      const auto& indices = mIdentity->mIndex;
+      if (mIdentity->mSorted)
+      {
+         auto it = std::lower_bound(indices.begin(), indices.end(), aPlatformIndex);
+         if (it != indices.end() && *it == aPlatformIndex)
+         {
+            return static_cast<size_t>(it - indices.begin());
+         }
+      }
+      else
+      {
+         auto it = std::find(indices.begin(), indices.end(), aPlatformIndex);
+         if (it != indices.end())
+         {
+            return static_cast<size_t>(it - indices.begin());
+         }
+      }
+   }
+   return cNOT_FOUND;
+}
+
+std::shared_ptr<const warlock::PlatformSnapshot> warlock::PlatformSnapshotService::GetSnapshot() const
+{
+   QMutexLocker locker(&mMutex);
+   return mSnapshot;
+}
+
+void warlock::PlatformSnapshotService::Clear()
+{
+   mIdentityValid = false;
+   ++mStateChangeCount;
+   mIdentity.reset();
+   QMutexLocker locker(&mMutex);
+   mSnapshot.reset();
+}
+
+std::shared_ptr<const warlock::PlatformSnapshotIdentity>
+warlock::PlatformSnapshotService::BuildIdentity(WsfSimulation& aSimulation) const
+{
+   auto         identity = std::make_shared<PlatformSnapshotIdentity>();
+   const size_t count    = aSimulation.GetPlatformCount();
+   identity->mIndex.reserve(count);
+   identity->mName.reserve(count);
+   identity->mType.reserve(count);
+   identity->mSide.reserve(count);
+   identity->mSpatialDomain.reserve(count);
+   identity->mComponentOffset.reserve(count + 1);
+   identity->mComponentOffset.push_back(0);
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      WsfPlatform* platformPtr = aSimulation.GetPlatformEntry(i);
+      if (!identity->mIndex.empty() && platformPtr->GetIndex() < identity->mIndex.back())
+      {
+         identity->mSorted = false;
+      }
+      identity->mIndex.push_back(platformPtr->GetIndex());
+      identity->mName.emplace_back(platformPtr->GetName());
+      identity->mType.emplace_back(platformPtr->GetType());
+      identity->mSide.emplace_back(platformPtr->GetSide());
+      identity->mSpatialDomain.push_back(static_cast<int>(platformPtr->GetSpatialDomain()));
+
+      unsigned int partCount = platformPtr->GetComponentCount<WsfPlatformPart>();
+      for (unsigned int j = 0; j < partCount; ++j)
+      {
+         WsfPlatformPart* partPtr = platformPtr->GetComponentEntry<WsfPlatformPart>(j);
+         identity->mComponentName.emplace_back(partPtr->GetName());
+         identity->mComponentType.emplace_back(partPtr->GetType());
+         identity->mComponentUniqueId.push_back(partPtr->GetUniqueId());
+      }
+      identity->mComponentOffset.push_back(identity->mComponentName.size());
+   }
+   return identity;
+}
+
+void warlock::PlatformSnapshotService::Capture(WsfSimulation& aSimulation)
+{
+   const double simTime  = aSimulation.GetSimTime();
+   const size_t count    = aSimulation.GetPlatformCount();
+   auto         previous = GetSnapshot();
+
+   // The identity is rebuilt when platforms were added or deleted, or a platform's components changed.
+   bool identityValid = mIdentityValid && mIdentity && mIdentity->mIndex.size() == count;
+   for (size_t i = 0; identityValid && i < count; ++i)
+   {
+      WsfPlatform* platformPtr = aSimulation.GetPlatformEntry(i);
+      size_t       partCount   = mIdentity->mComponentOffset[i + 1] - mIdentity->mComponentOffset[i];
+      identityValid            = (platformPtr->GetIndex() == mIdentity->mIndex[i]) &&
+                      (platformPtr->GetComponentCount<WsfPlatformPart>() == partCount);
+   }
+   if (!identityValid)
+   {
+      mIdentity      = BuildIdentity(aSimulation);
+      mIdentityValid = true;
+   }
+   else if (previous && previous->mSimTime == simTime && mCapturedStateChangeCount == mStateChangeCount)
+   {
+      // Nothing has changed since the last capture (e.g. both clocks fired at the same simulation time while paused).
+      return;
+   }
+   mCapturedStateChangeCount = mStateChangeCount;
+
+   auto snapshot         = std::make_shared<PlatformSnapshot>();
+   snapshot->mSimTime    = simTime;
+   snapshot->mGeneration = ++mGeneration;
+   snapshot->mIdentity   = mIdentity;
+   snapshot->mLocationWCS.resize(count);
+   snapshot->mLocationLLA.resize(count);
+   snapshot->mVelocityWCS.resize(count);
+   snapshot->mAccelerationWCS.resize(count);
+   snapshot->mOrientationWCS.resize(count);
+   snapshot->mOrientationNED.resize(count);
+   snapshot->mSpeed.resize(count);
+   snapshot->mDamageFactor.resize(count);
+   snapshot->mDeleted.resize(count);
+   snapshot->mChangeGeneration.resize(count, snapshot->mGeneration);
+   snapshot->mComponentOn.resize(mIdentity->mComponentName.size());
+   snapshot->mComponentOperational.resize(mIdentity->mComponentName.size());
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      WsfPlatform* platformPtr = aSimulation.GetPlatformEntry(i);
+
+      // Call Update so that the data is updated to the current time
+      platformPtr->Update(simTime);
+
+      platformPtr->GetLocationWCS(snapshot->mLocationWCS[i].GetData());
+      platformPtr->GetLocationLLA(snapshot->mLocationLLA[i][0],
+                                  snapshot->mLocationLLA[i][1],
+                                  snapshot->mLocationLLA[i][2]);
+      platformPtr->GetVelocityWCS(snapshot->mVelocityWCS[i].GetData());
+      platformPtr->GetAccelerationWCS(snapshot->mAccelerationWCS[i].GetData());
+      platformPtr->GetOrientationWCS(snapshot->mOrientationWCS[i][0],
+                                     snapshot->mOrientationWCS[i][1],
+                                     snapshot->mOrientationWCS[i][2]);
+      platformPtr->GetOrientationNED(snapshot->mOrientationNED[i][0],
+                                     snapshot->mOrientationNED[i][1],
+                                     snapshot->mOrientationNED[i][2]);
+      snapshot->mSpeed[i]        = platformPtr->GetSpeed();
+      snapshot->mDamageFactor[i] = platformPtr->GetDamageFactor();
+      snapshot->mDeleted[i]      = platformPtr->IsDeleted() ? 1 : 0;
+
+      const size_t first = mIdentity->mComponentOffset[i];
+      const size_t last  = mIdentity->mComponentOffset[i + 1];
+      for (size_t j = first; j < last; ++j)
+      {
+         auto             partIndex         = static_cast<unsigned int>(j - first);
+         WsfPlatformPart* partPtr           = platformPtr->GetComponentEntry<WsfPlatformPart>(partIndex);
+         snapshot->mComponentOn[j]          = partPtr->IsTurnedOn() ? 1 : 0;
+         snapshot->mComponentOperational[j] = partPtr->IsOperational() ? 1 : 0;
+      }
+
+      // Carry the change generation forward if nothing other than the kinematic state changed.
+      if (previous)
+      {
+         size_t prev = (previous->mIdentity == mIdentity) ? i : previous->Find(mIdentity->mIndex[i]);
+         if (prev != PlatformSnapshot::cNOT_FOUND)
+         {
+            const auto&  prevIdentity = *previous->mIdentity;
+            const size_t prevFirst    = prevIdentity.mComponentOffset[prev];
+            const size_t prevLast     = prevIdentity.mComponentOffset[prev + 1];
+            bool         unchanged    = (prevLast - prevFirst == last - first) &&
+                               (previous->mDamageFactor[prev] == snapshot->mDamageFactor[i]) &&
+                               (previous->mDeleted[prev] == snapshot->mDeleted[i]) &&
+                               std::equal(snapshot->mComponentOn.begin() + first,
+                                          snapshot->mComponentOn.begin() + last,
+                                          previous->mComponentOn.begin() + prevFirst) &&
+                               std::equal(snapshot->mComponentOperational.begin() + first,
+                                          snapshot->mComponentOperational.begin() + last,
+                                          previous->mComponentOperational.begin() + prevFirst) &&
+                               std::equal(mIdentity->mComponentUniqueId.begin() + first,
+                                          mIdentity->mComponentUniqueId.begin() + last,
+                                          prevIdentity.mComponentUniqueId.begin() + prevFirst);
+            if (unchanged)
+            {
+               snapshot->mChangeGeneration[i] = previous->mChangeGeneration[prev];
+            }
+         }
+      }
+   }
+
+   QMutexLocker locker(&mMutex);
+   mSnapshot = std::move(snapshot);
+}
@@ -0,0 +1,133 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#ifndef WKPLATFORMSNAPSHOT_HPP
+#define WKPLATFORMSNAPSHOT_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QMutex>
+
+#include "UtVec3.hpp"
+class WsfSimulation;
+#include "warlock_core_export.h"
+
+namespace warlock
+{
+// Information about the platforms in a PlatformSnapshot that only changes when platforms or their components are
+// added or removed. It is shared by consecutive snapshots until such a change occurs.
+// Entries are parallel to the per-platform arrays in PlatformSnapshot.
+struct WARLOCK_CORE_EXPORT PlatformSnapshotIdentity
+{
+   std::vector<size_t>      mIndex;
+   std::vector<std::string> mName;
+   std::vector<std::string> mType;
+   std::vector<std::string> mSide;
+   std::vector<int>         mSpatialDomain; // WsfSpatialDomain
+
+   // Components of all platforms. The components of platform i are [mComponentOffset[i], mComponentOffset[i + 1]).
+   std::vector<size_t>       mComponentOffset;
+   std::vector<std::string>  mComponentName;
+   std::vector<std::string>  mComponentType;
+   std::vector<unsigned int> mComponentUniqueId;
+
+   // True if mIndex is in ascending order, which allows binary search in PlatformSnapshot::Find().
+   bool mSorted{true};
+};
+
+// A structure-of-arrays copy of the state of every platform in the simulation at one point in time.
+// Snapshots are immutable once published and may be read from any thread.
+class WARLOCK_CORE_EXPORT PlatformSnapshot
+{
+public:
+   static constexpr size_t cNOT_FOUND = static_cast<size_t>(-1);
+
+   // Returns the position of the platform with the given index in the per-platform arrays, or cNOT_FOUND.
+   size_t Find(size_t aPlatformIndex) const;
+
+   size_t GetPlatformCount() const { return mIdentity ? mIdentity->mIndex.size() : 0; }
+
+   double       mSimTime{0.0};
+   unsigned int mGeneration{0}; // Incremented each time a snapshot is captured
+
+   std::shared_ptr<const PlatformSnapshotIdentity> mIdentity;
+
+   // Per-platform state
+   std::vector<UtVec3d> mLocationWCS;
+   std::vector<UtVec3d> mLocationLLA; // latitude (deg), longitude (deg), altitude (m)
+   std::vector<UtVec3d> mVelocityWCS;
+   std::vector<UtVec3d> mAccelerationWCS;
+   std::vector<UtVec3d> mOrientationWCS; // psi, theta, phi (rad)
+   std::vector<UtVec3d> mOrientationNED; // heading, pitch, roll (rad)
+   std::vector<double>  mSpeed;
+   std::vector<double>  mDamageFactor;
+   std::vector<char>    mDeleted;
+   // The generation in which anything other than the kinematic state of the platform last changed
+   // (added, deleted, component added/removed, component turned on/off or made (non-)operational, damage).
+   std::vector<unsigned int> mChangeGeneration;
+
+   // Per-component state, parallel to the component arrays in mIdentity
+   std::vector<char> mComponentOn;
+   std::vector<char> mComponentOperational;
+};
+
+// Captures one PlatformSnapshot per clock tick on the simulation thread, regardless of how many consumers there are.
+// Capturing only occurs while at least one consumer is subscribed.
+// Owned by warlock::SimEnvironment, use simEnv.GetPlatformSnapshotService() to access it.
+class WARLOCK_CORE_EXPORT PlatformSnapshotService
+{
+public:
+   PlatformSnapshotService() = default;
+
+   // May be called from any thread.
+   // Subscribe when a consumer begins using snapshots and Unsubscribe when it stops.
+   void Subscribe() { ++mSubscriberCount; }
+   void Unsubscribe() { --mSubscriberCount; }
+   bool HasSubscribers() const { return mSubscriberCount > 0; }
+
+   // May be called from any thread. Returns the snapshot captured in the current clock tick, which is null if there
+   // were no subscribers at the start of the tick.
+   std::shared_ptr<const PlatformSnapshot> GetSnapshot() const;
+
+   // The following should be called from the SIM thread only!
+   void Capture(WsfSimulation& aSimulation);
+   // Notifies the service that the set of platforms has changed, so the identity needs to be rebuilt.
+   void InvalidateIdentity()
+   {
+      mIdentityValid = false;
+      ++mStateChangeCount;
+   }
+   // Notifies the service that the simulation state may have changed without the simulation time advancing
+   // (e.g. a command was processed while paused), so the next capture may not be skipped.
+   void NotifyStateChanged() { ++mStateChangeCount; }
+   void Clear();
+
+private:
+   std::shared_ptr<const PlatformSnapshotIdentity> BuildIdentity(WsfSimulation& aSimulation) const;
+
+   std::atomic<int> mSubscriberCount{0};
+
+   // These should only be accessed on the SIM thread.
+   bool                                            mIdentityValid{false};
+   std::shared_ptr<const PlatformSnapshotIdentity> mIdentity;
+   unsigned int                                    mGeneration{0};
+   unsigned int                                    mStateChangeCount{0};
+   unsigned int                                    mCapturedStateChangeCount{0};
+
+   // Guards mSnapshot, which is read from the GUI thread.
+   mutable QMutex                          mMutex;
+   std::shared_ptr<const PlatformSnapshot> mSnapshot;
+};
+} // namespace warlock
+
+#endif
@@ -61,7 +61,13 @@ void RunManager::HandleScenarioLoadFinished()
          wkfEnv.GetMainWindow()->setWindowTitle(QString("[ %1 ]").arg(GetScenarioDisplayName(list, true)));
       }
 
-      AssignScenarioToSimThread(mLoadThread->GetScenario());
+      std::shared_ptr<WsfScenario> scenarioPtr = mLoadThread->GetScenario();
+      if (mLoadThread->GetSignature().IsValid())
+      {
+         mLoadedScenarioPtr = scenarioPtr;
+         mLoadedSignature   = mLoadThread->GetSignature();
+      }
+      AssignScenarioToSimThread(std::move(scenarioPtr));
    }
    else
    {
@@ -123,7 +129,7 @@ QString RunManager::GetMostRecentDirectory() const
 
 void RunManager::ReloadScenario()
 {
-   LoadScenario(mOptions);
+   LoadScenarioP(mOptions, true);
 }
 
 void RunManager::LoadScenario(const QStringList& aFileList)
@@ -137,6 +143,11 @@ void RunManager::LoadScenario(const QStringList& aFileList)
 }
 
 void RunManager::LoadScenario(const WsfStandardApplication::Options& aOptions)
+{
+   LoadScenarioP(aOptions, false);
+}
+
+void RunManager::LoadScenarioP(const WsfStandardApplication::Options& aOptions, bool aWarmReload)
 {
    if (mLoadThread)
    {
@@ -162,7 +173,8 @@ void RunManager::LoadScenario(const WsfStandardApplication::Options& aOptions)
    }
 
    // Store the options to execute scenarios later.
-   mOptions = aOptions;
+   mOptions    = aOptions;
+   mWarmReload = aWarmReload;
 
    if (IsSimulationActive())
    {
@@ -261,18 +273,29 @@ void RunManager::StartLoading()
          input += "end_dis_interface\n";
       }
 
+      // Run the scenario that is already loaded again, if none of its input changed since it was read.
+      // Otherwise release it before reading the new one, so that both are not held at once.
+      if (mWarmReload && simPrefData.warmReload && mLoadedScenarioPtr &&
+          mLoadedSignature.IsUpToDate(mOptions.mInputFiles, input))
+      {
+         AssignScenarioToSimThread(mLoadedScenarioPtr);
+         return;
+      }
+      mLoadedScenarioPtr.reset();
+      mLoadedSignature = ScenarioInputSignature();
+
       // Display the Progress Bar for loading a scenario
       mProgressDialog->setLabelText(QString("Loading Scenario...\n%1").arg(GetScenarioDisplayName(files, false)));
       mProgressDialog->show();
 
       // Load the scenario on a different thread and connect to finished() signal
-      mLoadThread = new LoadThread(this, mApp, mOptions, input);
+      mLoadThread = new LoadThread(this, mApp, mOptions, input, simPrefData.warmReload);
       connect(mLoadThread, &QThread::finished, this, &RunManager::HandleScenarioLoadFinished);
       mLoadThread->start();
    }
 }
 
-void RunManager::CreateSimThread(std::unique_ptr<WsfScenario> aScenarioPtr)
+void RunManager::CreateSimThread(std::shared_ptr<WsfScenario> aScenarioPtr)
 {
    mSimThread = new SimThread(this, mApp, std::move(aScenarioPtr), mOptions);
    simEnv.moveToThread(mSimThread); // Move warlock::SimEnvironment (simEnv) to thread the simulation is executing on
@@ -308,6 +331,7 @@ void RunManager::Shutdown()
       // wait forever for the simulation thread to finish
       mSimThread->wait();
    }
+   mLoadedScenarioPtr.reset();
 
    if (mInstancePtr)
    {
@@ -403,7 +427,7 @@ void RunManager::SetMostRecentScenario(const QStringList& aFileList)
    }
 }
 
-void RunManager::AssignScenarioToSimThread(std::unique_ptr<WsfScenario> aScenarioPtr)
+void RunManager::AssignScenarioToSimThread(std::shared_ptr<WsfScenario> aScenarioPtr)
 {
    // If the sim thread has not been created yet, make it
    if (mSimThread == nullptr)
@@ -468,16 +492,24 @@ QStringList RunManager::StandardizeFilePaths(const QStringList& aFileList, bool*
 RunManager::LoadThread::LoadThread(QObject*                               aParent,
                                    WsfStandardApplication&                aApplication,
                                    const WsfStandardApplication::Options& aOptions,
-                                   const std::string&                     aAdditionalInput)
+                                   const std::string&                     aAdditionalInput,
+                                   bool                                   aComputeSignature)
    : QThread(aParent)
    , mApplication(aApplication)
    , mOptions(aOptions)
    , mAdditionalInput(aAdditionalInput)
+   , mComputeSignature(aComputeSignature)
 {
 }
 
 void RunManager::LoadThread::run()
 {
+   // Capture the input before it is read, a file changed while reading then invalidates the scenario for warm reloads
+   if (mComputeSignature)
+   {
+      mSignature = ScenarioInputSignature(mOptions.mInputFiles, mAdditionalInput);
+   }
+
    // Create a scenario
    mScenarioPtr = ut::make_unique<WsfScenario>(mApplication);
    try
@@ -508,6 +540,7 @@ void RunManager::LoadThread::run()
    catch (UtException& e)
    {
       mScenarioPtr.reset(); // Clean up scenario
+      mSignature = ScenarioInputSignature();
       std::cout << e.what() << std::endl;
 
       mErrorStr += Qt::convertFromPlainText(e.what(), Qt::WhiteSpaceNormal);
@@ -532,7 +565,7 @@ void RunManager::LoadThread::run()
 
 RunManager::SimThread::SimThread(QObject*                               aParent,
                                  WsfStandardApplication&                aApplication,
-                                 std::unique_ptr<WsfScenario>           aScenarioPtr,
+                                 std::shared_ptr<WsfScenario>           aScenarioPtr,
                                  const WsfStandardApplication::Options& aOptions)
    : QThread(aParent)
    , mApplication(aApplication)
@@ -551,7 +584,7 @@ RunManager::SimThread::SimThread(QObject*                               aParent,
            });
 }
 
-void RunManager::SimThread::SetCurrentScenario(std::unique_ptr<WsfScenario> aScenarioPtr)
+void RunManager::SimThread::SetCurrentScenario(std::shared_ptr<WsfScenario> aScenarioPtr)
 {
    TerminateSimulation();
 
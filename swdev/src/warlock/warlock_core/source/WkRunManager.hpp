@@ -20,6 +20,7 @@
 #include <QString>
 #include <QThread>
 
+#include "WkScenarioInputSignature.hpp"
 #include "WsfScenario.hpp"
 #include "WsfSimulation.hpp"
 #include "WsfStandardApplication.hpp"
@@ -41,6 +42,7 @@ public:
    void                                   ClearRecentScenarios();
    QString                                GetMostRecentDirectory() const;
 
+   // Loads the current scenario again. With the warmReload preference, an unchanged scenario is not read again.
    void ReloadScenario();
    void LoadScenario(const QStringList& aFileList);
    // This function will take control of aOptions and delete it
@@ -62,14 +64,15 @@ protected:
 
    void HandleScenarioLoadFinished();
 
+   void LoadScenarioP(const WsfStandardApplication::Options& aOptions, bool aWarmReload);
    void StartLoading();
-   void CreateSimThread(std::unique_ptr<WsfScenario> aScenarioPtr);
+   void CreateSimThread(std::shared_ptr<WsfScenario> aScenarioPtr);
 
    void ReadSettings();
    void WriteHistory();
    void SetMostRecentScenario(const QStringList& aFileList);
 
-   void AssignScenarioToSimThread(std::unique_ptr<WsfScenario> aScenarioPtr);
+   void AssignScenarioToSimThread(std::shared_ptr<WsfScenario> aScenarioPtr);
 
    static QStringList StandardizeFilePaths(const QStringList& aFileList, bool* aFilesExist = nullptr);
 
@@ -79,7 +82,8 @@ protected:
       LoadThread(QObject*                               aParent,
                  WsfStandardApplication&                aApplication,
                  const WsfStandardApplication::Options& aOptions,
-                 const std::string&                     aAdditionalInput);
+                 const std::string&                     aAdditionalInput,
+                 bool                                   aComputeSignature);
 
       ~LoadThread() override = default;
 
@@ -88,7 +92,8 @@ protected:
       {
          return std::move(mScenarioPtr);
       } // Using mScenarioPtr after calling this is undefined behavior
-      const QString& GetError() const { return mErrorStr; }
+      const QString&                GetError() const { return mErrorStr; }
+      const ScenarioInputSignature& GetSignature() const { return mSignature; }
 
    private:
       void run() override;
@@ -96,6 +101,8 @@ protected:
       WsfStandardApplication&                mApplication;
       const WsfStandardApplication::Options& mOptions;
       const std::string                      mAdditionalInput;
+      const bool                             mComputeSignature;
+      ScenarioInputSignature                 mSignature;
 
       std::unique_ptr<WsfScenario> mScenarioPtr{nullptr};
       bool                         mSuccessful{false};
@@ -108,12 +115,12 @@ protected:
    public:
       SimThread(QObject*                               aParent,
                 WsfStandardApplication&                aApplication,
-                std::unique_ptr<WsfScenario>           aScenarioPtr,
+                std::shared_ptr<WsfScenario>           aScenarioPtr,
                 const WsfStandardApplication::Options& aOptions);
 
       ~SimThread() override = default;
 
-      void SetCurrentScenario(std::unique_ptr<WsfScenario> aScenarioPtr);
+      void SetCurrentScenario(std::shared_ptr<WsfScenario> aScenarioPtr);
       void SetSimulationExternallyStarted(bool aExternallyStarted) { mExternallyStarted = aExternallyStarted; }
       void TerminateSimulation();
 
@@ -122,7 +129,7 @@ protected:
 
       WsfStandardApplication&         mApplication;
       std::unique_ptr<WsfSimulation>  mSimulationPtr{nullptr};
-      std::unique_ptr<WsfScenario>    mPendingScenarioPtr;
+      std::shared_ptr<WsfScenario>    mPendingScenarioPtr;
       WsfStandardApplication::Options mOptions;
       bool                            mExternallyStarted{false};
    };
@@ -133,11 +140,16 @@ protected:
    static RunManager* mInstancePtr;
 
    bool                            mPendingLoading{false};
+   bool                            mWarmReload{false};
    WsfStandardApplication&         mApp;
    LoadThread*                     mLoadThread{nullptr};
    SimThread*                      mSimThread{nullptr};
    WsfStandardApplication::Options mOptions;
 
+   // The last scenario read, kept for warm reloads, and the input it was read from
+   std::shared_ptr<WsfScenario> mLoadedScenarioPtr;
+   ScenarioInputSignature       mLoadedSignature;
+
    QProgressDialog* mProgressDialog{nullptr};
 };
 } // namespace warlock
@@ -0,0 +1,194 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "WkScenarioInputSignature.hpp"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+namespace
+{
+QByteArray HashContents(const QByteArray& aContents)
+{
+   return QCryptographicHash::hash(aContents, QCryptographicHash::Md5);
+}
+
+bool IsSpace(char aChar)
+{
+   return aChar == ' ' || aChar == '\t' || aChar == '\r' || aChar == '\n';
+}
+
+// Returns the next word of WSF input starting at aPos, skipping white space and comments.
+// Returns an empty array at the end of the input.
+QByteArray NextWord(const QByteArray& aContents, int& aPos)
+{
+   const int size = aContents.size();
+   while (aPos < size)
+   {
+      const char c = aContents[aPos];
+      if (IsSpace(c))
+      {
+         ++aPos;
+      }
+      else if (c == '#' || (c == '/' && aPos + 1 < size && aContents[aPos + 1] == '/'))
+      {
+         aPos = aContents.indexOf('\n', aPos);
+         aPos = (aPos < 0) ? size : aPos;
+      }
+      else if (c == '/' && aPos + 1 < size && aContents[aPos + 1] == '*')
+      {
+         aPos = aContents.indexOf("*/", aPos + 2);
+         aPos = (aPos < 0) ? size : aPos + 2;
+      }
+      else if (c == '"')
+      {
+         int end = aContents.indexOf('"', aPos + 1);
+         end     = (end < 0) ? size : end;
+         QByteArray word{aContents.mid(aPos + 1, end - aPos - 1)};
+         aPos = end + 1;
+         return word;
+      }
+      else
+      {
+         const int start = aPos;
+         while (aPos < size && !IsSpace(aContents[aPos]))
+         {
+            ++aPos;
+         }
+         return aContents.mid(start, aPos - start);
+      }
+   }
+   return QByteArray{};
+}
+} // namespace
+
+warlock::ScenarioInputSignature::ScenarioInputSignature(const std::vector<std::string>& aInputFiles,
+                                                        const std::string&              aAdditionalInput)
+   : mInputFiles(aInputFiles)
+   , mAdditionalInput(aAdditionalInput)
+   , mValid(true)
+{
+   for (const auto& file : aInputFiles)
+   {
+      AddFile(QFileInfo(QString::fromStdString(file)).absoluteFilePath());
+   }
+}
+
+bool warlock::ScenarioInputSignature::IsUpToDate(const std::vector<std::string>& aInputFiles,
+                                                 const std::string&              aAdditionalInput) const
+{
+   if (!mValid || aInputFiles != mInputFiles || aAdditionalInput != mAdditionalInput)
+   {
+      return false;
+   }
+
+   for (const File& file : mFiles)
+   {
+      QFileInfo info(file.mPath);
+      if (!info.isFile() || info.size() != file.mSize)
+      {
+         return false;
+      }
+      // A file saved without changes only has a new modification time
+      if (info.lastModified().toMSecsSinceEpoch() != file.mModified)
+      {
+         QFile f(file.mPath);
+         if (!f.open(QIODevice::ReadOnly) || HashContents(f.readAll()) != file.mHash)
+         {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+void warlock::ScenarioInputSignature::AddFile(const QString& aPath)
+{
+   for (const File& file : mFiles)
+   {
+      if (file.mPath == aPath)
+      {
+         return;
+      }
+   }
+
+   QFile f(aPath);
+   if (!f.open(QIODevice::ReadOnly))
+   {
+      mValid = false;
+      return;
+   }
+   QFileInfo        info(f);
+   const QByteArray contents = f.readAll();
+   mFiles.push_back(File{aPath, info.size(), info.lastModified().toMSecsSinceEpoch(), HashContents(contents)});
+   ScanIncludes(aPath, contents);
+}
+
+void warlock::ScenarioInputSignature::ScanIncludes(const QString& aPath, const QByteArray& aContents)
+{
+   const QDir directory = QFileInfo(aPath).absoluteDir();
+
+   int        pos = 0;
+   QByteArray word{NextWord(aContents, pos)};
+   while (mValid && !word.isEmpty())
+   {
+      const bool isInclude  = (word == "include" || word == "include_once");
+      const bool isFilePath = (word == "file_path");
+      word                  = NextWord(aContents, pos);
+      if ((isInclude || isFilePath) && !word.isEmpty())
+      {
+         const QString name = QString::fromLocal8Bit(word);
+         if (name.contains("$("))
+         {
+            // Path variables are only known to the scenario
+            mValid = false;
+         }
+         else if (isFilePath)
+         {
+            mFilePaths << QDir::current().absoluteFilePath(name) << directory.absoluteFilePath(name);
+         }
+         else
+         {
+            // Every existing candidate location is part of the signature, so the result does not depend on which
+            // one the scenario reader picked
+            QStringList candidates;
+            if (QFileInfo(name).isAbsolute())
+            {
+               candidates << name;
+            }
+            else
+            {
+               candidates << directory.absoluteFilePath(name) << QDir::current().absoluteFilePath(name);
+               for (const QString& path : mFilePaths)
+               {
+                  candidates << QDir(path).absoluteFilePath(name);
+               }
+            }
+
+            bool found = false;
+            for (const QString& candidate : candidates)
+            {
+               QFileInfo info(candidate);
+               if (info.isFile())
+               {
+                  found = true;
+                  AddFile(info.absoluteFilePath());
+               }
+            }
+            mValid = mValid && found;
+         }
+         word = NextWord(aContents, pos);
+      }
+   }
+}
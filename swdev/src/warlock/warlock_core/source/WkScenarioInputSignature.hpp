@@ -0,0 +1,62 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef WKSCENARIOINPUTSIGNATURE_HPP
+#define WKSCENARIOINPUTSIGNATURE_HPP
+
+#include "warlock_core_export.h"
+
+#include <string>
+#include <vector>
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+namespace warlock
+{
+// Identifies the input a scenario was loaded from: the input files, every file they include and the additional
+// input given to the scenario. A scenario whose signature is still up to date would be read identically again.
+// Included files are found by scanning for include and include_once commands. If an included file can not be
+// located (e.g. its name uses a path variable), the signature is invalid and never up to date.
+// Only WSF input files are covered, data files read by the scenario (e.g. terrain or tables) are not.
+class WARLOCK_CORE_EXPORT ScenarioInputSignature
+{
+public:
+   ScenarioInputSignature() = default;
+   ScenarioInputSignature(const std::vector<std::string>& aInputFiles, const std::string& aAdditionalInput);
+
+   bool IsValid() const { return mValid; }
+
+   // Returns true if the scenario would be read from the same input, and none of the files changed
+   bool IsUpToDate(const std::vector<std::string>& aInputFiles, const std::string& aAdditionalInput) const;
+
+private:
+   struct File
+   {
+      QString    mPath;
+      qint64     mSize;
+      qint64     mModified; // msecs since epoch
+      QByteArray mHash;
+   };
+
+   void AddFile(const QString& aPath);
+   void ScanIncludes(const QString& aPath, const QByteArray& aContents);
+
+   std::vector<std::string> mInputFiles;
+   std::string              mAdditionalInput;
+   std::vector<File>        mFiles;
+   QStringList              mFilePaths; // The directories given by file_path commands
+   bool                     mValid{false};
+};
+} // namespace warlock
+
+#endif
@@ -10,7 +10,14 @@
 // ****************************************************************************
 #include "WkSimEnvironment.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
+
+#include <QRunnable>
+#include <QSemaphore>
+#include <QThread>
+#include <QThreadPool>
 
 #include "UtMemory.hpp"
 #include "WkNetwork.hpp"
@@ -29,6 +36,27 @@ namespace
 {
 std::thread::id mainSimEnvironmentThreadId = std::this_thread::get_id();
 
+// Executes part of the concurrent read phase on a worker thread, then signals completion
+class ConcurrentReadTask : public QRunnable
+{
+public:
+   ConcurrentReadTask(const std::function<void()>& aWork, QSemaphore& aDone)
+      : mWork(aWork)
+      , mDone(aDone)
+   {
+   }
+
+   void run() override
+   {
+      mWork();
+      mDone.release();
+   }
+
+private:
+   std::function<void()> mWork;
+   QSemaphore&           mDone;
+};
+
 void AssertCurrentSimThread(bool aIsMainThread)
 {
    bool isMainThread = (mainSimEnvironmentThreadId == std::this_thread::get_id());
@@ -164,17 +192,25 @@ void warlock::SimEnvironment::InitializeCallbacks()
 {
    if (mSimulationPtr != nullptr)
    {
-      mCallbacks.Add(
-         WsfObserver::PlatformAdded(mSimulationPtr)
-            .Connect([this](double aSimTime, WsfPlatform* aPlatform) { emit PlatformAdded(aSimTime, *aPlatform); }));
+      mCallbacks.Add(WsfObserver::PlatformAdded(mSimulationPtr)
+                        .Connect(
+                           [this](double aSimTime, WsfPlatform* aPlatform)
+                           {
+                              mPlatformSnapshotService.InvalidateIdentity();
+                              emit PlatformAdded(aSimTime, *aPlatform);
+                           }));
 
       mCallbacks.Add(WsfObserver::PlatformInitialized(mSimulationPtr)
                         .Connect([this](double aSimTime, WsfPlatform* aPlatform)
                                  { emit PlatformInitialized(aSimTime, *aPlatform); }));
 
-      mCallbacks.Add(
-         WsfObserver::PlatformDeleted(mSimulationPtr)
-            .Connect([this](double aSimTime, WsfPlatform* aPlatform) { emit PlatformDeleted(aSimTime, *aPlatform); }));
+      mCallbacks.Add(WsfObserver::PlatformDeleted(mSimulationPtr)
+                        .Connect(
+                           [this](double aSimTime, WsfPlatform* aPlatform)
+                           {
+                              mPlatformSnapshotService.InvalidateIdentity();
+                              emit PlatformDeleted(aSimTime, *aPlatform);
+                           }));
 
       mCallbacks.Add(WsfObserver::PlatformBroken(mSimulationPtr)
                         .Connect([this](double aSimTime, WsfPlatform* aPlatform)
@@ -204,6 +240,7 @@ void warlock::SimEnvironment::InitializeCallbacks()
                         .Connect(
                            [this]
                            {
+                              mPlatformSnapshotService.Clear();
                               emit SimulationInitializing(*mSimulationPtr);
                               emit SimulationInitializing();
                            }));
@@ -224,20 +261,93 @@ void warlock::SimEnvironment::GuiUpdate()
    mCoreSimInterfacePtr->ProcessEvents();
 }
 
+void warlock::SimEnvironment::AddConcurrentReader(SimInterfaceBase* aInterfacePtr)
+{
+   QMutexLocker locker(&mConcurrentReadMutex);
+   if (std::find(mConcurrentReaders.begin(), mConcurrentReaders.end(), aInterfacePtr) == mConcurrentReaders.end())
+   {
+      mConcurrentReaders.push_back(aInterfacePtr);
+   }
+}
+
+void warlock::SimEnvironment::RemoveConcurrentReader(SimInterfaceBase* aInterfacePtr)
+{
+   QMutexLocker locker(&mConcurrentReadMutex);
+   mConcurrentReaders.erase(std::remove(mConcurrentReaders.begin(), mConcurrentReaders.end(), aInterfacePtr),
+                            mConcurrentReaders.end());
+}
+
+void warlock::SimEnvironment::ExecuteConcurrentReads(bool aSimClock, const WsfSimulation& aSimulation)
+{
+   QMutexLocker locker(&mConcurrentReadMutex);
+   const size_t readerCount = mConcurrentReaders.size();
+   if (readerCount == 0)
+   {
+      return;
+   }
+   if (!mConcurrentReadEnabled || readerCount == 1)
+   {
+      for (auto* readerPtr : mConcurrentReaders)
+      {
+         readerPtr->ConcurrentRead(aSimClock, aSimulation);
+      }
+      return;
+   }
+
+   if (!mReadThreadPoolPtr)
+   {
+      mReadThreadPoolPtr = ut::make_unique<QThreadPool>();
+      // The simulation thread executes handlers as well
+      mReadThreadPoolPtr->setMaxThreadCount(std::max(1, QThread::idealThreadCount() - 1));
+   }
+
+   // Each thread takes the next handler until none are left, so one slow handler doesn't hold up the others
+   std::atomic<size_t> next{0};
+   auto                work = [this, &next, readerCount, aSimClock, &aSimulation]()
+   {
+      for (size_t i = next++; i < readerCount; i = next++)
+      {
+         mConcurrentReaders[i]->ConcurrentRead(aSimClock, aSimulation);
+      }
+   };
+
+   QSemaphore done;
+   const int  taskCount = std::min(mReadThreadPoolPtr->maxThreadCount(), static_cast<int>(readerCount) - 1);
+   for (int i = 0; i < taskCount; ++i)
+   {
+      mReadThreadPoolPtr->start(new ConcurrentReadTask(work, done));
+   }
+   work();
+   done.acquire(taskCount);
+}
+
 WsfEvent::EventDisposition warlock::SimEnvironment::ClockEvent::Execute()
 {
    if (SimEnvironment::Exists())
    {
+      SimProfiler::ScopedSample sample(simEnv.mSimProfiler.GetTickEntry(mSimClock), SimProfiler::cTICK);
+
       double rescheduleTime = GetTime();
+      if (simEnv.mPlatformSnapshotService.HasSubscribers())
+      {
+         simEnv.mPlatformSnapshotService.Capture(*GetSimulation());
+      }
+      else
+      {
+         // A snapshot of an earlier tick must not be mistaken for the current state
+         simEnv.mPlatformSnapshotService.Clear();
+      }
       if (mSimClock)
       {
          emit simEnv.SimulationClockRead(*GetSimulation());
+         simEnv.ExecuteConcurrentReads(true, *GetSimulation());
          emit simEnv.SimulationClockWrite(*GetSimulation());
          rescheduleTime += simEnv.GetSimClockInterval();
       }
       else
       {
          emit simEnv.WallClockRead(*GetSimulation());
+         simEnv.ExecuteConcurrentReads(false, *GetSimulation());
          emit simEnv.WallClockWrite(*GetSimulation());
          rescheduleTime += simEnv.GetWallClockInterval();
       }
@@ -12,18 +12,23 @@
 #ifndef WSFWKSIMENVIRONMENT_HPP
 #define WSFWKSIMENVIRONMENT_HPP
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
 #include <QObject>
 
 #include "UtCallbackHolder.hpp"
 #include "WsfEvent.hpp"
+class QThreadPool;
 class WsfPlatform;
 class WsfSimulation;
 #include "warlock_core_export.h"
 
 #include "WkCoreSimInterface.hpp"
+#include "WkPlatformSnapshot.hpp"
 #include "WkScriptSimInterface.hpp"
+#include "WkSimProfiler.hpp"
 #include "WkXIO_DataContainer.hpp"
 
 #if defined(simEnv)
@@ -60,6 +65,13 @@ public:
    double GetSimClockInterval() const;
    double GetWallClockInterval() const;
 
+   // While enabled, the read handlers of the SimInterfaces that declared them free of side effects
+   // (see SimInterfaceBase::SetConcurrentRead) are executed concurrently on a pool of worker threads during each clock
+   // event, after the other read handlers and before the write handlers. While disabled they are executed serially.
+   // Thread safe.
+   void SetConcurrentReadEnabled(bool aEnabled) { mConcurrentReadEnabled = aEnabled; }
+   bool IsConcurrentReadEnabled() const { return mConcurrentReadEnabled; }
+
    //*******************************************************
    // Note: The following functions are NOT Thread Safe and should only be called by the thread for which they
    // are intended to be called by.  If called from the wrong thread a message will appear warning the user
@@ -71,6 +83,14 @@ public:
    // This should be called from the SIM thread only!
    const XIO_DataContainer& GetXIO_Info() const;
 
+   // The per-tick platform state snapshot shared by all SimInterfaces and plugins.
+   // Subscribe() and GetSnapshot() may be called from either thread. While subscribed, a snapshot is captured once
+   // per clock event, before SimulationClockRead and WallClockRead are emitted.
+   PlatformSnapshotService& GetPlatformSnapshotService() { return mPlatformSnapshotService; }
+
+   // Measures the cost of each SimInterface on the simulation and GUI threads. May be used from either thread.
+   SimProfiler& GetSimProfiler() { return mSimProfiler; }
+
    // This is a common SimInterface that can be used by anyone who needs access to scripts on the simulation
    // This should be called from the GUI thread only!
    std::shared_ptr<ScriptSimInterface> GetScriptSimInterface() const;
@@ -126,6 +146,13 @@ private:
 
    void GuiUpdate();
 
+   // Called by SimInterfaceBase from the GUI thread
+   void AddConcurrentReader(SimInterfaceBase* aInterfacePtr);
+   void RemoveConcurrentReader(SimInterfaceBase* aInterfacePtr);
+
+   // This should be called from the SIM thread only!
+   void ExecuteConcurrentReads(bool aSimClock, const WsfSimulation& aSimulation);
+
    static SimEnvironment* mInstancePtr;
 
    WsfSimulation*    mSimulationPtr{nullptr};
@@ -134,11 +161,22 @@ private:
    double            mWallClockInterval{1. / 30.}; // in sec, 30 Hz default
    XIO_DataContainer mXIO_DataContainer{};
 
+   PlatformSnapshotService mPlatformSnapshotService;
+   SimProfiler             mSimProfiler;
+
    std::unique_ptr<CoreSimInterface>         mCoreSimInterfacePtr{nullptr};
    mutable std::weak_ptr<ScriptSimInterface> mScriptSimInterfacePtr{};
 
    // QMutex is used to maintain thread safe communication between Sim and Gui threads.
    mutable QMutex mMutex;
+
+   // Held for the whole concurrent read phase, so RemoveConcurrentReader waits for the handlers that are executing to
+   // return.  This only protects a SimInterface that removes itself before its derived class is destroyed, see
+   // SimInterfaceBase::ShutdownConcurrentRead.
+   QMutex                         mConcurrentReadMutex;
+   std::vector<SimInterfaceBase*> mConcurrentReaders;
+   std::atomic<bool>              mConcurrentReadEnabled{false};
+   std::unique_ptr<QThreadPool>   mReadThreadPoolPtr;
 };
 } // namespace warlock
 #endif // WKENVIRONMENT_HPP
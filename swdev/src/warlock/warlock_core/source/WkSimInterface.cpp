@@ -12,6 +12,7 @@
 
 #include "WkSimEnvironment.hpp"
 #include "WkfExceptionMessage.hpp"
+#include "WkfQueueableMessageObject.hpp"
 
 warlock::SimEvent::~SimEvent() = default;
 
@@ -19,6 +20,8 @@ warlock::SimInterfaceBase::SimInterfaceBase(const QString& aName)
    : QObject(nullptr)
    , mName(aName)
    , mEnabled(true)
+   , mConcurrentRead(false)
+   , mProfilerEntryPtr(simEnv.GetSimProfiler().GetEntry(aName))
 {
    // Use a Direct connection to invoke the slot immediately, in the simulation thread
    connect(&simEnv,
@@ -54,7 +57,15 @@ warlock::SimInterfaceBase::SimInterfaceBase(const QString& aName)
    UpdatePeriodicConnections();
 }
 
-warlock::SimInterfaceBase::~SimInterfaceBase() = default;
+warlock::SimInterfaceBase::~SimInterfaceBase()
+{
+   // The derived class must have called ShutdownConcurrentRead, this only prevents a dangling pointer
+   Q_ASSERT(!mConcurrentRead);
+   if (SimEnvironment::Exists())
+   {
+      simEnv.RemoveConcurrentReader(this);
+   }
+}
 
 void warlock::SimInterfaceBase::SetEnabled(bool aEnabled)
 {
@@ -66,27 +77,102 @@ void warlock::SimInterfaceBase::SetEnabled(bool aEnabled)
    }
 }
 
+void warlock::SimInterfaceBase::SetConcurrentRead(bool aConcurrentRead)
+{
+   if (mConcurrentRead != aConcurrentRead)
+   {
+      mConcurrentRead = aConcurrentRead;
+      UpdatePeriodicConnections();
+   }
+}
+
+void warlock::SimInterfaceBase::ShutdownConcurrentRead()
+{
+   mConcurrentRead = false;
+   if (SimEnvironment::Exists())
+   {
+      // Waits for the concurrent read phase in progress, if any, to finish
+      simEnv.RemoveConcurrentReader(this);
+   }
+}
+
 void warlock::SimInterfaceBase::AddSimCommand(std::unique_ptr<SimCommand> aCommand)
 {
    auto& queue = aCommand->UseWallClock() ? mSimCommandsWallClock : mSimCommandsSimClock;
    queue.Push(std::move(aCommand));
 }
 
+void warlock::SimInterfaceBase::RecordQueuedEvent(bool aCoalesced)
+{
+   if (mProfilerEntryPtr->IsProfilerEnabled())
+   {
+      mProfilerEntryPtr->AddQueuedEvent(aCoalesced);
+   }
+}
+
+void warlock::SimInterfaceBase::ConcurrentRead(bool aSimClock, const WsfSimulation& aSimulation)
+{
+   // Exceptions may not propagate out of a worker thread, so they are reported here
+   try
+   {
+      if (aSimClock)
+      {
+         ProfiledSimulationClockRead(aSimulation);
+      }
+      else
+      {
+         ProfiledWallClockRead(aSimulation);
+      }
+   }
+   catch (std::exception& e)
+   {
+      wkf::QueueableMessageObject::DisplayQueuedMessage(
+         QMessageBox::Critical,
+         "Exception",
+         QString("An exception was thrown by %1.\n%2").arg(mName, QString::fromStdString(e.what())));
+   }
+   catch (...)
+   {
+      wkf::QueueableMessageObject::DisplayQueuedMessage(QMessageBox::Critical,
+                                                        "Exception",
+                                                        QString("An unknown exception was thrown by %1.").arg(mName));
+   }
+}
+
+void warlock::SimInterfaceBase::ProfiledWallClockRead(const WsfSimulation& aSimulation)
+{
+   SimProfiler::ScopedSample sample(mProfilerEntryPtr, SimProfiler::cWALL_CLOCK_READ);
+   WallClockRead(aSimulation);
+}
+
+void warlock::SimInterfaceBase::ProfiledSimulationClockRead(const WsfSimulation& aSimulation)
+{
+   SimProfiler::ScopedSample sample(mProfilerEntryPtr, SimProfiler::cSIM_CLOCK_READ);
+   SimulationClockRead(aSimulation);
+}
+
 void warlock::SimInterfaceBase::WallClockCommands(WsfSimulation& aSimulation)
 {
+   SimProfiler::ScopedSample sample(mProfilerEntryPtr, SimProfiler::cWALL_CLOCK_COMMANDS);
    ProcessCommands(aSimulation, mSimCommandsWallClock);
 }
 
 void warlock::SimInterfaceBase::SimulationClockCommands(WsfSimulation& aSimulation)
 {
+   SimProfiler::ScopedSample sample(mProfilerEntryPtr, SimProfiler::cSIM_CLOCK_COMMANDS);
    ProcessCommands(aSimulation, mSimCommandsSimClock);
 }
 
 void warlock::SimInterfaceBase::ProcessCommands(WsfSimulation& aSimulation, SimCommandQueue& aCommands)
 {
-   while (!aCommands.Empty())
+   if (!aCommands.Empty())
    {
-      aCommands.Pop()->Process(aSimulation);
+      // Commands may change the simulation while it is paused, which the platform snapshot would otherwise miss
+      simEnv.GetPlatformSnapshotService().NotifyStateChanged();
+      while (!aCommands.Empty())
+      {
+         aCommands.Pop()->Process(aSimulation);
+      }
    }
 }
 
@@ -96,23 +182,32 @@ void warlock::SimInterfaceBase::UpdatePeriodicConnections()
    {
       disconnect(mConnections.takeFirst());
    }
+   simEnv.RemoveConcurrentReader(this);
 
-   if (mEnabled)
+   if (mEnabled && mConcurrentRead)
+   {
+      simEnv.AddConcurrentReader(this);
+   }
+   else if (mEnabled)
    {
       mConnections << connect(&simEnv,
                               &SimEnvironment::WallClockRead,
                               this,
-                              WKF_EXCEPTION_HANDLER_QUEUED(SimInterfaceBase, WallClockRead, mName),
+                              WKF_EXCEPTION_HANDLER_QUEUED(SimInterfaceBase, ProfiledWallClockRead, mName),
                               Qt::DirectConnection);
       mConnections << connect(&simEnv,
-                              &SimEnvironment::WallClockWrite,
+                              &SimEnvironment::SimulationClockRead,
                               this,
-                              WKF_EXCEPTION_HANDLER_QUEUED(SimInterfaceBase, WallClockCommands, mName),
+                              WKF_EXCEPTION_HANDLER_QUEUED(SimInterfaceBase, ProfiledSimulationClockRead, mName),
                               Qt::DirectConnection);
+   }
+
+   if (mEnabled)
+   {
       mConnections << connect(&simEnv,
-                              &SimEnvironment::SimulationClockRead,
+                              &SimEnvironment::WallClockWrite,
                               this,
-                              WKF_EXCEPTION_HANDLER_QUEUED(SimInterfaceBase, SimulationClockRead, mName),
+                              WKF_EXCEPTION_HANDLER_QUEUED(SimInterfaceBase, WallClockCommands, mName),
                               Qt::DirectConnection);
       mConnections << connect(&simEnv,
                               &SimEnvironment::SimulationClockWrite,
@@ -21,6 +21,7 @@
 #include <QVector>
 
 #include "UtConcurrentQueue.hpp"
+#include "WkSimProfiler.hpp"
 class WsfPlatform;
 class WsfSimulation;
 #include "warlock_core_export.h"
@@ -74,6 +75,8 @@ private:
 
 class WARLOCK_CORE_EXPORT SimInterfaceBase : public QObject
 {
+   friend class SimEnvironment;
+
 public:
    explicit SimInterfaceBase(const QString& aName = "");
 
@@ -117,9 +120,11 @@ protected:
 
    // This slot is triggered on a wall clock event at a rate defined in warlock::SimEnvironment. They should be used
    // for simulation management or non-simulated events only.
+   // May be executed on a worker thread, see SetConcurrentRead().
    virtual void WallClockRead(const WsfSimulation& aSimulation) {}
 
    // This slot is triggered on a simulation clock event at a rate defined in warlock::SimEnvironment.
+   // May be executed on a worker thread, see SetConcurrentRead().
    virtual void SimulationClockRead(const WsfSimulation& aSimulation) {}
 
    // This slot is triggered when the simulation completes.
@@ -132,7 +137,30 @@ protected:
    // QMutex is used to maintain thread safe communication between Sim and Gui threads.
    mutable QMutex mMutex;
 
+   // Declares that WallClockRead and SimulationClockRead are free of side effects, so they may be executed on a worker
+   // thread concurrently with the read handlers of other SimInterfaces, while the simulation thread waits at the
+   // clock event. Such handlers may only read the simulation through const methods (note that many of the state
+   // methods of UtEntity are not const, the shared PlatformSnapshot may be used instead) and may only modify the data
+   // of this SimInterface, e.g. by calling AddSimEvent.
+   // The handlers are executed concurrently only while concurrent reads are enabled in the SimEnvironment.
+   // A SimInterface that declares this must call ShutdownConcurrentRead from its destructor.
+   // Call from the GUI thread only.
+   void SetConcurrentRead(bool aConcurrentRead);
+   bool IsConcurrentRead() const { return mConcurrentRead; }
+   // Stops the concurrent execution of the read handlers, and waits for a read handler that is executing on a worker
+   // thread to return.  The destructor of SimInterfaceBase runs after the derived class was destroyed, which is too
+   // late to wait for the handlers, so this must be called from the destructor of the derived class.
+   void ShutdownConcurrentRead();
+
+   // The profiler entry of this SimInterface, see warlock::SimProfiler
+   SimProfiler::Entry* GetProfilerEntry() const { return mProfilerEntryPtr; }
+   void                RecordQueuedEvent(bool aCoalesced);
+
 private:
+   // Executes the read handler of the given clock on behalf of the SimEnvironment's concurrent read phase
+   void ConcurrentRead(bool aSimClock, const WsfSimulation& aSimulation);
+   void ProfiledWallClockRead(const WsfSimulation& aSimulation);
+   void ProfiledSimulationClockRead(const WsfSimulation& aSimulation);
    void WallClockCommands(WsfSimulation& aSimulation);
    void SimulationClockCommands(WsfSimulation& aSimulation);
 
@@ -140,7 +168,9 @@ private:
 
    QString                          mName;
    std::atomic<bool>                mEnabled;
+   bool                             mConcurrentRead;
    QVector<QMetaObject::Connection> mConnections;
+   SimProfiler::Entry*              mProfilerEntryPtr;
 
    using SimCommandQueue = UtConcurrentQueue<std::unique_ptr<SimCommand>>;
 
@@ -181,13 +211,22 @@ public:
    template<typename... Args>
    void ProcessEvents(Args&&... args)
    {
+      SimProfiler::ScopedSample sample(GetProfilerEntry(), SimProfiler::cPROCESS_EVENTS);
+      size_t                    eventCount = 0;
       while (!mSimEvents.Empty())
       {
          mSimEvents.Pop()->Process(std::forward<Args>(args)...);
+         ++eventCount;
       }
+      sample.SetEventCount(eventCount);
    }
 
-   void AddSimEvent(std::unique_ptr<EVENT_TYPE> aEvent) { mSimEvents.Push(std::move(aEvent)); }
+   void AddSimEvent(std::unique_ptr<EVENT_TYPE> aEvent)
+   {
+      SimEventQueueContainer<EventPtr>::LastPushCoalesced() = false;
+      mSimEvents.Push(std::move(aEvent));
+      RecordQueuedEvent(SimEventQueueContainer<EventPtr>::LastPushCoalesced());
+   }
 
 private:
    // Underlying container class template used for UtConcurrentQueue. Maintains a single occurrence of recurring event types.
@@ -201,6 +240,14 @@ private:
       using const_reference = typename std::list<T>::const_reference;
       using value_type      = typename std::list<T>::value_type;
 
+      // Set by push_back() when a recurring event replaces a queued event of the same type.
+      // Only meaningful on the thread that pushed, immediately after pushing.
+      static bool& LastPushCoalesced()
+      {
+         static thread_local bool coalesced = false;
+         return coalesced;
+      }
+
       bool      empty() const { return mStorage.empty(); }
       size_type size() const { return mStorage.size(); }
       void      pop_front() { mStorage.pop_front(); }
@@ -218,6 +265,7 @@ private:
                // If element is found in lookup, erase it from the storage and erase entry in lookup
                mLookup.erase(it);
                mStorage.erase(temp);
+               LastPushCoalesced() = true;
             }
 
             mLookup.insert(last); // Insert new element into lookup
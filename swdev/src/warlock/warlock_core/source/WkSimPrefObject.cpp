@@ -25,6 +25,8 @@ warlock::SimPrefData warlock::SimPrefObject::ReadSettings(QSettings& aSettings)
    SimPrefData pData;
    pData.startPaused          = aSettings.value("startPaused", mDefaultPrefs.startPaused).toBool();
    pData.platformsDraggable   = aSettings.value("platformsDraggable", mDefaultPrefs.platformsDraggable).toBool();
+   pData.concurrentRead       = aSettings.value("concurrentRead", mDefaultPrefs.concurrentRead).toBool();
+   pData.warmReload           = aSettings.value("warmReload", mDefaultPrefs.warmReload).toBool();
    pData.enableDIS            = aSettings.value("enableDis", mDefaultPrefs.enableDIS).toBool();
    pData.multicastIp          = aSettings.value("multicastIp", mDefaultPrefs.multicastIp).toString();
    pData.netId                = aSettings.value("netId", mDefaultPrefs.netId).toString();
@@ -42,6 +44,8 @@ void warlock::SimPrefObject::SaveSettingsP(QSettings& aSettings) const
 {
    aSettings.setValue("startPaused", mCurrentPrefs.startPaused);
    aSettings.setValue("platformsDraggable", mCurrentPrefs.platformsDraggable);
+   aSettings.setValue("concurrentRead", mCurrentPrefs.concurrentRead);
+   aSettings.setValue("warmReload", mCurrentPrefs.warmReload);
    aSettings.setValue("enableDis", mCurrentPrefs.enableDIS);
    aSettings.setValue("multicastIp", mCurrentPrefs.multicastIp);
    aSettings.setValue("netId", mCurrentPrefs.netId);
@@ -60,4 +64,5 @@ void warlock::SimPrefObject::Apply()
 
    simEnv.SetSimClockInterval(1.0 / mCurrentPrefs.clockRate);
    simEnv.SetWallClockInterval(1.0 / mCurrentPrefs.clockRate);
+   simEnv.SetConcurrentReadEnabled(mCurrentPrefs.concurrentRead);
 }
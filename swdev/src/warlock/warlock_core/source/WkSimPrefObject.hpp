@@ -22,6 +22,8 @@ struct SimPrefData
 {
    bool    startPaused{false};
    bool    platformsDraggable{false};
+   bool    concurrentRead{false};
+   bool    warmReload{false};
    bool    enableDIS{false};
    QString multicastIp{"228.0.0.0"};
    QString netId{"255.255.255"};
@@ -52,6 +52,8 @@ void warlock::SimPrefWidget::WritePreferenceData(SimPrefData& aPrefData)
 
    aPrefData.startPaused          = mUi.startPausedCheckBox->isChecked();
    aPrefData.platformsDraggable   = mUi.draggablePlatformsCheckBox->isChecked();
+   aPrefData.concurrentRead       = mUi.concurrentReadCheckBox->isChecked();
+   aPrefData.warmReload           = mUi.warmReloadCheckBox->isChecked();
    aPrefData.enableDIS            = enableDIS;
    aPrefData.multicastIp          = mUi.ipAddressLineEdit->text();
    aPrefData.netId                = mUi.netIdLineEdit->text();
@@ -107,6 +109,8 @@ void warlock::SimPrefWidget::ReadPreferenceData(const SimPrefData& aPrefData)
 {
    mUi.startPausedCheckBox->setChecked(aPrefData.startPaused);
    mUi.draggablePlatformsCheckBox->setChecked(aPrefData.platformsDraggable);
+   mUi.concurrentReadCheckBox->setChecked(aPrefData.concurrentRead);
+   mUi.warmReloadCheckBox->setChecked(aPrefData.warmReload);
    mUi.disGroupBox->setChecked(aPrefData.enableDIS);
    mUi.ipAddressLineEdit->setText(aPrefData.multicastIp);
    mUi.netIdLineEdit->setText(aPrefData.netId);
@@ -0,0 +1,330 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#include "WkSimProfiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QFile>
+#include <QTextStream>
+
+#include "UtMemory.hpp"
+
+constexpr size_t warlock::SimProfiler::cBUCKET_COUNT;
+constexpr size_t warlock::SimProfiler::cWINDOW_SIZE;
+constexpr size_t warlock::SimProfiler::cMAX_TRACE_EVENTS;
+
+namespace
+{
+QString EscapeJson(const QString& aText)
+{
+   QString escaped;
+   for (const QChar& c : aText)
+   {
+      if (c == '"' || c == '\\')
+      {
+         escaped += '\\';
+         escaped += c;
+      }
+      else if (c.unicode() < 0x20)
+      {
+         escaped += QString("\\u%1").arg(c.unicode(), 4, 16, QChar('0'));
+      }
+      else
+      {
+         escaped += c;
+      }
+   }
+   return escaped;
+}
+} // namespace
+
+warlock::SimProfiler::Entry::Entry(SimProfiler& aProfiler, const QString& aName, bool aIsTick)
+   : mProfiler(aProfiler)
+   , mName(aName)
+   , mIsTick(aIsTick)
+{
+}
+
+void warlock::SimProfiler::Entry::AddSample(Category          aCategory,
+                                            Clock::time_point aStart,
+                                            Clock::time_point aEnd,
+                                            size_t            aEventCount)
+{
+   const double durationUs = std::chrono::duration<double, std::micro>(aEnd - aStart).count();
+   const bool   tracing    = mProfiler.IsTracing();
+   TraceEvent   traceEvent{this, aCategory, 0, 0, aEventCount, 0, 0, 0};
+
+   if (aCategory == cPROCESS_EVENTS)
+   {
+      mEventsProcessed += aEventCount;
+   }
+
+   {
+      QMutexLocker locker(&mMutex);
+      Window&      window             = mWindows[aCategory];
+      window.mSamplesUs[window.mNext] = static_cast<float>(durationUs);
+      window.mNext                    = (window.mNext + 1) % cWINDOW_SIZE;
+      window.mCount                   = std::min(window.mCount + 1, cWINDOW_SIZE);
+
+      if (tracing && aCategory == cPROCESS_EVENTS)
+      {
+         const unsigned long long queued    = mEventsQueued;
+         const unsigned long long coalesced = mEventsCoalesced;
+         traceEvent.mQueued                 = queued - mTracedQueued;
+         traceEvent.mCoalesced              = coalesced - mTracedCoalesced;
+         mTracedQueued                      = queued;
+         mTracedCoalesced                   = coalesced;
+      }
+   }
+
+   if (tracing)
+   {
+      traceEvent.mDurationUs = std::chrono::duration_cast<std::chrono::microseconds>(aEnd - aStart).count();
+      mProfiler.AddTraceEvent(traceEvent, aStart);
+   }
+}
+
+void warlock::SimProfiler::Entry::AddQueuedEvent(bool aCoalesced)
+{
+   ++mEventsQueued;
+   if (aCoalesced)
+   {
+      ++mEventsCoalesced;
+   }
+}
+
+void warlock::SimProfiler::Entry::GetStatistics(InterfaceStatistics& aStatistics) const
+{
+   aStatistics.mName            = mName;
+   aStatistics.mIsTick          = mIsTick;
+   aStatistics.mEventsQueued    = mEventsQueued;
+   aStatistics.mEventsCoalesced = mEventsCoalesced;
+   aStatistics.mEventsProcessed = mEventsProcessed;
+
+   std::vector<float> samples;
+   QMutexLocker       locker(&mMutex);
+   for (size_t i = 0; i < cCATEGORY_COUNT; ++i)
+   {
+      const Window& window = mWindows[i];
+      Statistics&   stats  = aStatistics.mCategories[i];
+      stats                = Statistics();
+      stats.mSampleCount   = window.mCount;
+      if (window.mCount == 0)
+      {
+         continue;
+      }
+
+      samples.assign(window.mSamplesUs.begin(), window.mSamplesUs.begin() + window.mCount);
+      double total = 0.0;
+      for (float sample : samples)
+      {
+         total += sample;
+         stats.mMaxUs = std::max(stats.mMaxUs, static_cast<double>(sample));
+         ++stats.mHistogram[GetBucket(sample)];
+      }
+      stats.mMeanUs = total / samples.size();
+
+      const size_t p95Index = static_cast<size_t>(std::ceil(0.95 * samples.size())) - 1;
+      std::nth_element(samples.begin(), samples.begin() + p95Index, samples.end());
+      stats.mP95Us = samples[p95Index];
+   }
+}
+
+void warlock::SimProfiler::Entry::Reset()
+{
+   QMutexLocker locker(&mMutex);
+   mWindows         = std::array<Window, cCATEGORY_COUNT>();
+   mEventsQueued    = 0;
+   mEventsCoalesced = 0;
+   mEventsProcessed = 0;
+   mTracedQueued    = 0;
+   mTracedCoalesced = 0;
+}
+
+unsigned int warlock::SimProfiler::Entry::GetBucket(double aDurationUs)
+{
+   if (aDurationUs < 1.0)
+   {
+      return 0;
+   }
+   const unsigned int bucket = 1 + static_cast<unsigned int>(std::log2(aDurationUs));
+   return std::min(bucket, static_cast<unsigned int>(cBUCKET_COUNT - 1));
+}
+
+warlock::SimProfiler::SimProfiler()
+   : mTraceStart(Clock::now())
+{
+   mEntries.emplace_back(ut::make_unique<Entry>(*this, "Simulation Clock", true));
+   mSimClockEntryPtr = mEntries.back().get();
+   mEntries.emplace_back(ut::make_unique<Entry>(*this, "Wall Clock", true));
+   mWallClockEntryPtr = mEntries.back().get();
+}
+
+warlock::SimProfiler::~SimProfiler() = default;
+
+QString warlock::SimProfiler::GetCategoryName(Category aCategory)
+{
+   switch (aCategory)
+   {
+   case cTICK:
+      return "Tick";
+   case cSIM_CLOCK_READ:
+      return "SimulationClockRead";
+   case cSIM_CLOCK_COMMANDS:
+      return "SimulationClockCommands";
+   case cWALL_CLOCK_READ:
+      return "WallClockRead";
+   case cWALL_CLOCK_COMMANDS:
+      return "WallClockCommands";
+   case cPROCESS_EVENTS:
+      return "ProcessEvents";
+   default:
+      return "";
+   }
+}
+
+warlock::SimProfiler::Entry* warlock::SimProfiler::GetEntry(const QString& aName)
+{
+   const QString name = aName.isEmpty() ? QString("(unnamed)") : aName;
+
+   QMutexLocker locker(&mMutex);
+   for (auto& entry : mEntries)
+   {
+      if (!entry->mIsTick && entry->GetName() == name)
+      {
+         return entry.get();
+      }
+   }
+   mEntries.emplace_back(ut::make_unique<Entry>(*this, name, false));
+   return mEntries.back().get();
+}
+
+std::vector<warlock::SimProfiler::InterfaceStatistics> warlock::SimProfiler::GetStatistics() const
+{
+   QMutexLocker                     locker(&mMutex);
+   std::vector<InterfaceStatistics> statistics(mEntries.size());
+   for (size_t i = 0; i < mEntries.size(); ++i)
+   {
+      mEntries[i]->GetStatistics(statistics[i]);
+   }
+   return statistics;
+}
+
+void warlock::SimProfiler::Reset()
+{
+   QMutexLocker locker(&mMutex);
+   for (auto& entry : mEntries)
+   {
+      entry->Reset();
+   }
+   mTraceEvents.clear();
+   mTraceThreads.clear();
+   mTraceTruncated = false;
+   mTraceStart     = Clock::now();
+}
+
+void warlock::SimProfiler::StartTrace()
+{
+   QMutexLocker locker(&mMutex);
+   for (auto& entry : mEntries)
+   {
+      QMutexLocker entryLocker(&entry->mMutex);
+      entry->mTracedQueued    = entry->mEventsQueued;
+      entry->mTracedCoalesced = entry->mEventsCoalesced;
+   }
+   mTraceEvents.clear();
+   mTraceThreads.clear();
+   mTraceTruncated = false;
+   mTraceStart     = Clock::now();
+   mTracing        = true;
+   mEnabled        = true;
+}
+
+void warlock::SimProfiler::StopTrace()
+{
+   mTracing = false;
+}
+
+bool warlock::SimProfiler::WriteTrace(const QString& aFileName) const
+{
+   QFile file(aFileName);
+   if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+   {
+      return false;
+   }
+
+   QMutexLocker locker(&mMutex);
+
+   // The threads are named after what they record: the simulation thread records the ticks, the GUI thread processes
+   // the events, and the other threads are concurrent readers
+   std::vector<QString> threadNames(mTraceThreads.size());
+   for (const TraceEvent& event : mTraceEvents)
+   {
+      if (event.mCategory == cTICK)
+      {
+         threadNames[event.mThread] = "Simulation";
+      }
+      else if (event.mCategory == cPROCESS_EVENTS)
+      {
+         threadNames[event.mThread] = "GUI";
+      }
+   }
+
+   QTextStream stream(&file);
+   stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+   for (size_t i = 0; i < threadNames.size(); ++i)
+   {
+      const QString name = threadNames[i].isEmpty() ? QString("Reader %1").arg(i + 1) : threadNames[i];
+      stream << (i > 0 ? ",\n" : "\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i + 1
+             << ",\"args\":{\"name\":\"" << name << "\"}}";
+   }
+   for (size_t i = 0; i < mTraceEvents.size(); ++i)
+   {
+      const TraceEvent& event = mTraceEvents[i];
+      stream << ((i > 0 || !threadNames.empty()) ? ",\n" : "\n") << "{\"name\":\""
+             << EscapeJson(event.mEntryPtr->GetName()) << "\",\"cat\":\"" << GetCategoryName(event.mCategory)
+             << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.mThread + 1 << ",\"ts\":" << event.mStartUs
+             << ",\"dur\":" << event.mDurationUs;
+      if (event.mCategory == cPROCESS_EVENTS)
+      {
+         stream << ",\"args\":{\"processed\":" << event.mEventCount << ",\"queued\":" << event.mQueued
+                << ",\"coalesced\":" << event.mCoalesced << "}";
+      }
+      stream << "}";
+   }
+   stream << "\n],\"otherData\":{\"truncated\":" << (mTraceTruncated ? "true" : "false") << "}}\n";
+   stream.flush();
+   return stream.status() == QTextStream::Ok;
+}
+
+void warlock::SimProfiler::AddTraceEvent(const TraceEvent& aEvent, Clock::time_point aStart)
+{
+   QMutexLocker locker(&mMutex);
+   if (mTraceEvents.size() < cMAX_TRACE_EVENTS)
+   {
+      // Events are recorded on the thread that was measured
+      const std::thread::id threadId = std::this_thread::get_id();
+      auto                  threadIt = std::find(mTraceThreads.begin(), mTraceThreads.end(), threadId);
+      if (threadIt == mTraceThreads.end())
+      {
+         threadIt = mTraceThreads.insert(mTraceThreads.end(), threadId);
+      }
+      mTraceEvents.push_back(aEvent);
+      mTraceEvents.back().mStartUs =
+         std::chrono::duration_cast<std::chrono::microseconds>(aStart - mTraceStart).count();
+      mTraceEvents.back().mThread = static_cast<size_t>(threadIt - mTraceThreads.begin());
+   }
+   else
+   {
+      mTraceTruncated = true;
+   }
+}
@@ -0,0 +1,206 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2016 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+#ifndef WKSIMPROFILER_HPP
+#define WKSIMPROFILER_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <QMutex>
+#include <QString>
+
+#include "warlock_core_export.h"
+
+namespace warlock
+{
+// Measures the time each SimInterface spends in its clock handlers on the simulation thread and processing its events
+// on the GUI thread, and counts the events it queues. Measurements are only taken while the profiler is enabled.
+// The measurements can also be recorded as a trace, which is written in the Chrome trace event format
+// (viewable with chrome://tracing or Perfetto).
+// All methods are thread safe.
+// Owned by warlock::SimEnvironment, use simEnv.GetSimProfiler() to access it.
+class WARLOCK_CORE_EXPORT SimProfiler
+{
+public:
+   using Clock = std::chrono::steady_clock;
+
+   enum Category
+   {
+      cTICK,                // The complete clock event, only recorded by the tick entries
+      cSIM_CLOCK_READ,      // SimInterfaceBase::SimulationClockRead
+      cSIM_CLOCK_COMMANDS,  // SimCommands processed on the simulation clock
+      cWALL_CLOCK_READ,     // SimInterfaceBase::WallClockRead
+      cWALL_CLOCK_COMMANDS, // SimCommands processed on the wall clock
+      cPROCESS_EVENTS,      // SimInterfaceT::ProcessEvents, on the GUI thread
+      cCATEGORY_COUNT
+   };
+
+   // Durations are counted in power-of-two buckets of microseconds: [0, 1), [1, 2), [2, 4), ...
+   // The last bucket also counts every longer duration.
+   static constexpr size_t cBUCKET_COUNT = 18;
+   // The number of most recent samples of each category the statistics are computed from
+   static constexpr size_t cWINDOW_SIZE = 256;
+   // Recording stops once a trace holds this many events
+   static constexpr size_t cMAX_TRACE_EVENTS = 2000000;
+
+   struct Statistics
+   {
+      size_t                                  mSampleCount{0};
+      double                                  mMeanUs{0.0};
+      double                                  mP95Us{0.0};
+      double                                  mMaxUs{0.0};
+      std::array<unsigned int, cBUCKET_COUNT> mHistogram{};
+   };
+
+   struct InterfaceStatistics
+   {
+      QString                                 mName;
+      bool                                    mIsTick{false};
+      std::array<Statistics, cCATEGORY_COUNT> mCategories;
+      unsigned long long                      mEventsQueued{0};
+      unsigned long long                      mEventsCoalesced{0};
+      unsigned long long                      mEventsProcessed{0};
+   };
+
+   // The measurements of one SimInterface. There is one entry per name, which lives as long as the profiler.
+   class WARLOCK_CORE_EXPORT Entry
+   {
+   public:
+      Entry(SimProfiler& aProfiler, const QString& aName, bool aIsTick);
+
+      const QString& GetName() const { return mName; }
+      bool           IsProfilerEnabled() const { return mProfiler.IsEnabled(); }
+
+      void AddSample(Category aCategory, Clock::time_point aStart, Clock::time_point aEnd, size_t aEventCount = 0);
+      void AddQueuedEvent(bool aCoalesced);
+
+   private:
+      friend class SimProfiler;
+
+      struct Window
+      {
+         std::array<float, cWINDOW_SIZE> mSamplesUs{};
+         size_t                           mNext{0};
+         size_t                           mCount{0};
+      };
+
+      void                GetStatistics(InterfaceStatistics& aStatistics) const;
+      void                Reset();
+      static unsigned int GetBucket(double aDurationUs);
+
+      SimProfiler&  mProfiler;
+      const QString mName;
+      const bool    mIsTick;
+
+      // Guards mWindows and the counts reported in the trace.
+      mutable QMutex                      mMutex;
+      std::array<Window, cCATEGORY_COUNT> mWindows;
+      unsigned long long                  mTracedQueued{0};
+      unsigned long long                  mTracedCoalesced{0};
+
+      std::atomic<unsigned long long> mEventsQueued{0};
+      std::atomic<unsigned long long> mEventsCoalesced{0};
+      std::atomic<unsigned long long> mEventsProcessed{0};
+   };
+
+   // Records the time between construction and destruction, if the profiler was enabled at construction.
+   class ScopedSample
+   {
+   public:
+      ScopedSample(Entry* aEntryPtr, Category aCategory)
+         : mEntryPtr((aEntryPtr && aEntryPtr->IsProfilerEnabled()) ? aEntryPtr : nullptr)
+         , mCategory(aCategory)
+      {
+         if (mEntryPtr)
+         {
+            mStart = Clock::now();
+         }
+      }
+      ~ScopedSample()
+      {
+         if (mEntryPtr)
+         {
+            mEntryPtr->AddSample(mCategory, mStart, Clock::now(), mEventCount);
+         }
+      }
+      ScopedSample(const ScopedSample&) = delete;
+      ScopedSample& operator=(const ScopedSample&) = delete;
+
+      void SetEventCount(size_t aEventCount) { mEventCount = aEventCount; }
+
+   private:
+      Entry*            mEntryPtr;
+      Category          mCategory;
+      Clock::time_point mStart;
+      size_t            mEventCount{0};
+   };
+
+   SimProfiler();
+   ~SimProfiler();
+
+   static QString GetCategoryName(Category aCategory);
+
+   void SetEnabled(bool aEnabled) { mEnabled = aEnabled; }
+   bool IsEnabled() const { return mEnabled; }
+
+   // Returns the entry for the given name, creating it if necessary
+   Entry* GetEntry(const QString& aName);
+   // Returns the entry that measures the complete simulation or wall clock event
+   Entry* GetTickEntry(bool aSimClock) const { return aSimClock ? mSimClockEntryPtr : mWallClockEntryPtr; }
+
+   // Returns the statistics of every entry, tick entries first
+   std::vector<InterfaceStatistics> GetStatistics() const;
+   // Discards all measurements and any recorded trace
+   void Reset();
+
+   // Starting a trace also enables the profiler.
+   void StartTrace();
+   void StopTrace();
+   bool IsTracing() const { return mTracing; }
+   // Returns false if the trace could not be written
+   bool WriteTrace(const QString& aFileName) const;
+
+private:
+   struct TraceEvent
+   {
+      const Entry* mEntryPtr;
+      Category     mCategory;
+      long long    mStartUs;
+      long long    mDurationUs;
+      size_t       mEventCount;
+      size_t       mThread; // The index of the recording thread in mTraceThreads
+      // The number of events queued and coalesced since the previous trace event of this entry, for cPROCESS_EVENTS
+      unsigned long long mQueued;
+      unsigned long long mCoalesced;
+   };
+
+   void AddTraceEvent(const TraceEvent& aEvent, Clock::time_point aStart);
+
+   std::atomic<bool> mEnabled{false};
+   std::atomic<bool> mTracing{false};
+
+   // Guards mEntries, mTraceEvents, mTraceThreads and mTraceTruncated
+   mutable QMutex                      mMutex;
+   std::vector<std::unique_ptr<Entry>> mEntries;
+   Entry*                              mSimClockEntryPtr;
+   Entry*                              mWallClockEntryPtr;
+   Clock::time_point                   mTraceStart;
+   std::vector<TraceEvent>             mTraceEvents;
+   std::vector<std::thread::id>        mTraceThreads; // The threads that recorded trace events, in order of appearance
+   bool                                mTraceTruncated{false};
+};
+} // namespace warlock
+
+#endif
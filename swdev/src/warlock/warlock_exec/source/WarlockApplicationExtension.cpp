@@ -164,6 +164,19 @@ int WarlockApplicationExtension::ProcessCommandLine(WsfStandardApplication::Opti
    {
       mStartMinimized = true;
    }
+   else if (0 == strcmp(aArgv[0], "-profile_trace"))
+   {
+      if (aArgc > 1)
+      {
+         mProfileTraceFile = aArgv[1];
+         return 2; // We processed two arguments from the command line
+      }
+      else
+      {
+         QMessageBox::warning(nullptr, "Invalid Argument", "-profile_trace requires a filename to be provided.");
+         ut::log::error() << "-profile_trace requires a filename to be provided.";
+      }
+   }
    else
    {
       return 0;
@@ -181,7 +194,9 @@ void WarlockApplicationExtension::PrintCommandLineArguments() const
                 "\n                             prevents the user from editing permissions"
                 "\n-console                     Enables the console window"
                 "\n-ups                         Uses the previous scenario, if no scenario was specified"
-                "\n-minimized                   The application will start minimized";
+                "\n-minimized                   The application will start minimized"
+                "\n-profile_trace <filename>    Records the time spent by each plugin on the simulation and GUI"
+                "\n                             threads, and writes it to the specified file on exit";
 }
 
 void WarlockApplicationExtension::ProcessDisplayConsoleWindow() const
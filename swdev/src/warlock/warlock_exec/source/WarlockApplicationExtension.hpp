@@ -32,12 +32,14 @@ public:
    bool               GetImportConfigFile() const { return mImportConfigFile; }
    bool               GetLoadPreviousScenario() const { return mLoadPreviousScenario; }
    bool               GetStartMinimized() const { return mStartMinimized; }
+   const std::string& GetProfileTraceFile() const { return mProfileTraceFile; }
 
    void ScenarioCreated(WsfScenario& aScenario) override;
 
 private:
    std::string mConfigFile;
    std::string mPermissionFile;
+   std::string mProfileTraceFile;
    bool        mImportConfigFile;
    bool        mShowConsole;
    bool        mLoadPreviousScenario;
@@ -144,6 +144,10 @@ int wkExecute(WsfStandardApplication& aApp)
    warlock::AppEnvironment::Create();
    // Create the Warlock Simulation Environment (simEnv)
    warlock::SimEnvironment::Create();
+   if (!warlockExtPtr->GetProfileTraceFile().empty())
+   {
+      simEnv.GetSimProfiler().StartTrace();
+   }
    // Create the Warlock Run Manager
    warlock::RunManager::Create(aApp);
 
@@ -260,6 +264,15 @@ int wkExecute(WsfStandardApplication& aApp)
    }
 
    warlock::RunManager::GetInstance().Shutdown();
+   if (!warlockExtPtr->GetProfileTraceFile().empty())
+   {
+      simEnv.GetSimProfiler().StopTrace();
+      if (!simEnv.GetSimProfiler().WriteTrace(QString::fromStdString(warlockExtPtr->GetProfileTraceFile())))
+      {
+         auto out = ut::log::error() << "Could not write the profile trace.";
+         out.AddNote() << "File: " << warlockExtPtr->GetProfileTraceFile();
+      }
+   }
    simEnv.Shutdown();
    wkEnv.Shutdown();
    wkfEnv.Shutdown();
@@ -11,6 +11,7 @@
 
 #include "AutoComplete.hpp"
 
+#include "AutoCompleteService.hpp"
 #include "ParseResults.hpp"
 #include "Project.hpp"
 #include "Signals.hpp"
@@ -58,6 +59,19 @@ wizard::AutoComplete::AutoComplete()
    , mCurrentTypeRef(nullptr)
    , mExpandTypeCommand(true)
    , mCurrentQuery()
+   , mCachePtr(nullptr)
+   , mCancelPtr(nullptr)
+{
+}
+
+wizard::AutoComplete::AutoComplete(AutoCompleteCache* aCachePtr, const std::atomic<bool>* aCancelPtr)
+   : mExpanded(false)
+   , mParseResultsPtr(nullptr)
+   , mCurrentTypeRef(nullptr)
+   , mExpandTypeCommand(true)
+   , mCurrentQuery()
+   , mCachePtr(aCachePtr)
+   , mCancelPtr(aCancelPtr)
 {
 }
 void wizard::AutoComplete::GetSyntax(ParseResults&      aParseData,
@@ -106,7 +120,7 @@ void wizard::AutoComplete::GetSyntax(ParseResults&      aParseData,
    do
    {
       Entry* nodeEntry = new Entry;
-      ExpandRule(0, rootReader, mCurrentTypeRef, *nodeEntry, true);
+      ExpandRuleCached(0, rootReader, mCurrentTypeRef, *nodeEntry, true);
 
       WsfParseNode* nextBlockPtr = nullptr;
       if (rootReader->Type() == WsfParseRule::cRECURRENCE)
@@ -224,7 +238,7 @@ void wizard::AutoComplete::GetSuggestions(ParseResults&      aParseData,
    do
    {
       Entry* nodeEntry = new Entry;
-      ExpandRule(0, rootReader, mCurrentTypeRef, *nodeEntry, true);
+      ExpandRuleCached(0, rootReader, mCurrentTypeRef, *nodeEntry, true);
 
       WsfParseNode* nextBlockPtr = nullptr;
       if (rootReader && rootReader->Type() == WsfParseRule::cRECURRENCE)
@@ -262,8 +276,14 @@ void wizard::AutoComplete::GetSuggestions(ParseResults&      aParseData,
       {
          break;
       }
-   } while (mExpanded);
+   } while (mExpanded && !IsCancelled());
 
+   if (entryPtr && IsCancelled())
+   {
+      // The results are no longer wanted
+      delete entryPtr;
+      entryPtr = nullptr;
+   }
    if (entryPtr)
    {
       CollectSuggestions(entryPtr, mCurrentQuery.mQueryWordIndex, aResults.mSuggestionList, aResults.mLastToken);
@@ -913,12 +933,103 @@ bool wizard::AutoComplete::ExpandRule(int                 aQueryWordIndex,
    return expanded || (aEntry.mEntryType != Entry::cUNEXPANDED);
 }
 
+// Same as ExpandRule(), but reuses the expansion from the cache if there is one.
+// The expansion of a rule depends only on the rule and the state of the entry, not on the query, so it may be reused
+// until the project is re-parsed.  Entries which already have children or a reference type are expanded normally.
+bool wizard::AutoComplete::ExpandRuleCached(int                 aQueryWordIndex,
+                                            WsfParseRule*       aReaderPtr,
+                                            const WsfParseType* aCurrentTypePtr,
+                                            Entry&              aEntry,
+                                            bool                aExpandBlock)
+{
+   if (mCachePtr == nullptr || aReaderPtr == nullptr || !aEntry.mChildren.empty() || !aEntry.mRefType.empty())
+   {
+      return ExpandRule(aQueryWordIndex, aReaderPtr, aCurrentTypePtr, aEntry, aExpandBlock);
+   }
+
+   AutoCompleteCache::ExpansionKey key;
+   key.mRulePtr          = aReaderPtr;
+   key.mCurrentTypePtr   = aCurrentTypePtr;
+   key.mParentCommandPtr = aEntry.mParentCommandPtr;
+   key.mCommandWordIndex = aEntry.mCommandWordIndex;
+   key.mEntryType        = aEntry.mEntryType;
+   key.mFlags            = aEntry.mFlags;
+   key.mExpandBlock      = aExpandBlock;
+
+   auto iter = mCachePtr->mExpansions.find(key);
+   if (iter == mCachePtr->mExpansions.end())
+   {
+      AutoCompleteCache::Expansion expansion;
+      expansion.mEntryPtr.reset(new Entry(aEntry));
+      expansion.mExpanded =
+         ExpandRule(aQueryWordIndex, aReaderPtr, aCurrentTypePtr, *expansion.mEntryPtr, aExpandBlock);
+      iter = mCachePtr->mExpansions.emplace(key, std::move(expansion)).first;
+   }
+
+   // The copy constructor doesn't copy children, so the assignment transfers ownership of the copied children
+   Entry* copyPtr = CopyEntryTree(*iter->second.mEntryPtr);
+   aEntry         = *copyPtr;
+   copyPtr->mChildren.clear();
+   delete copyPtr;
+   return iter->second.mExpanded;
+}
+
+// Returns a copy of aEntry including copies of all of its children.
+wizard::AutoComplete::Entry* wizard::AutoComplete::CopyEntryTree(const Entry& aEntry)
+{
+   Entry* copyPtr = new Entry(aEntry);
+   for (auto&& childPtr : aEntry.mChildren)
+   {
+      copyPtr->mChildren.push_back(CopyEntryTree(*childPtr));
+   }
+   return copyPtr;
+}
+
+// Find the names of the types which may be used for a reference to aKind.
+void wizard::AutoComplete::FindTypeNames(const WsfParseTypePath& aKind, std::vector<std::string>& aNames)
+{
+   if (mCachePtr)
+   {
+      mCachePtr->FindDefinitionsOfType(aKind, aNames);
+      mCachePtr->GetBaseTypes(aKind, aNames);
+   }
+   else
+   {
+      std::vector<WsfParseNode*> defs;
+      mParseResultsPtr->FindDefinitionsOfType(aKind, defs);
+      for (auto&& def : defs)
+      {
+         aNames.push_back(def->mValue.Text());
+      }
+      mParseResultsPtr->GetBaseTypes(aKind, aNames);
+   }
+}
+
+// Find the names which may be used for a reference to the named node type aNameType.
+void wizard::AutoComplete::FindNames(const std::string& aNameType, std::vector<std::string>& aNames)
+{
+   if (mCachePtr)
+   {
+      mCachePtr->FindNames(aNameType, aNames);
+   }
+   else
+   {
+      mParseResultsPtr->FindNames(aNameType, aNames);
+      // plug-ins may also have suggestions here
+      wizSignals->RequestNameSuggestions(aNameType, aNames);
+   }
+}
+
 // Walks tree of entries, expanding any entries if possible.
 // ExpandTree does a limited amount of work, usually only expanding one level.
 // This allows Prune() to reduce the number of entries that are expanded.
 // mExpanded is set to true if an entry was expanded.
 int wizard::AutoComplete::ExpandTree(Entry& aEntry, const WsfParseType* aCurrentTypePtr, int aWordIndex, int aMaxWordIndex)
 {
+   if (IsCancelled())
+   {
+      return -1;
+   }
    if (aEntry.mComplete)
    {
       if (aEntry.mWordCount < 0)
@@ -950,7 +1061,7 @@ int wizard::AutoComplete::ExpandTree(Entry& aEntry, const WsfParseType* aCurrent
       }
       else
       {
-         mExpanded = ExpandRule(aWordIndex, aEntry.mReaderPtr, aCurrentTypePtr, newEntry) || mExpanded;
+         mExpanded = ExpandRuleCached(aWordIndex, aEntry.mReaderPtr, aCurrentTypePtr, newEntry) || mExpanded;
       }
       std::swap(aEntry, newEntry);
       return aWordIndex + aEntry.GetWordCount();
@@ -1075,17 +1186,9 @@ void wizard::AutoComplete::ExpandRefType(Entry& aEntry, const WsfParseType* aCur
       }
       else
       {
-         std::vector<WsfParseNode*> defs;
-         mParseResultsPtr->FindDefinitionsOfType(newEntry.mRefType, defs);
-         for (auto&& def : defs)
-         {
-            Entry* typeEntry = new Entry;
-            typeEntry->Set(def->mValue.Text());
-            newEntry.mChildren.push_back(typeEntry);
-         }
-         std::vector<std::string> baseTypes;
-         mParseResultsPtr->GetBaseTypes(newEntry.mRefType, baseTypes);
-         for (auto&& type : baseTypes)
+         std::vector<std::string> typeNames;
+         FindTypeNames(newEntry.mRefType, typeNames);
+         for (auto&& type : typeNames)
          {
             Entry* typeEntry = new Entry;
             typeEntry->Set(type);
@@ -1098,9 +1201,7 @@ void wizard::AutoComplete::ExpandRefType(Entry& aEntry, const WsfParseType* aCur
       std::vector<std::string> nameList;
       if (aEntry.mRefType.size() == 1)
       {
-         mParseResultsPtr->FindNames(aEntry.mRefType[0], nameList);
-         // plug-ins may also have suggestions here
-         wizSignals->RequestNameSuggestions(aEntry.mRefType[0], nameList);
+         FindNames(aEntry.mRefType[0], nameList);
          for (auto&& name : nameList)
          {
             Entry* typeEntry = new Entry;
@@ -11,6 +11,7 @@
 
 #ifndef AUTOCOMPLETE_HPP
 #define AUTOCOMPLETE_HPP
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -22,6 +23,7 @@ class WsfParseSequence;
 
 namespace wizard
 {
+class AutoCompleteCache;
 class ParseResults;
 class TextSource;
 
@@ -47,6 +49,8 @@ class TextSource;
 //!    processor myproc WSF_|     ('processor myproc' matches the first rule, leaving us to autocomplete only on WSF_)
 //!    <br> end_time 1 m|              ('end_time 1 m' matches a rule, leaving no way to autocomplete for 'minutes')
 //!
+//!  When given an AutoCompleteCache, rule expansions and name lookups are reused between queries on the same parse
+//!  results.  When given a cancel flag, the query stops early once the flag is set (see AutoCompleteService).
 //!
 class AutoComplete
 {
@@ -61,6 +65,7 @@ public:
       bool                     mPartialToken;
    };
    AutoComplete();
+   AutoComplete(AutoCompleteCache* aCachePtr, const std::atomic<bool>* aCancelPtr);
    void GetSuggestions(ParseResults&      aParseData,
                        TextSource&        aSource,
                        WsfParseNode*      aNodePtr,
@@ -86,6 +91,8 @@ public:
                   SyntaxResults&     aResults);
 
 protected:
+   friend class AutoCompleteCache;
+
    enum Operation
    {
       cAUTOCOMPLETE,
@@ -162,6 +169,17 @@ protected:
                    const WsfParseType* aCurrentTypePtr,
                    Entry&              aEntry,
                    bool                aExpandBlock = false);
+   bool ExpandRuleCached(int                 aWordIndex,
+                         WsfParseRule*       aReaderPtr,
+                         const WsfParseType* aCurrentTypePtr,
+                         Entry&              aEntry,
+                         bool                aExpandBlock = false);
+
+   static Entry* CopyEntryTree(const Entry& aEntry);
+   void          FindTypeNames(const WsfParseTypePath& aKind, std::vector<std::string>& aNames);
+   void          FindNames(const std::string& aNameType, std::vector<std::string>& aNames);
+   bool          IsCancelled() const { return mCancelPtr && mCancelPtr->load(std::memory_order_relaxed); }
+
    void ExpandRefType(Entry& aEntry, const WsfParseType* aCurrentTypePtr, int aWordIndex);
    void Prune(int aQueryWordIndex, Entry*& aEntry);
    void CollectSuggestions(Entry* aRootEntry, size_t aWordIndex, std::vector<std::string>& aSuggestions, bool& aLastToken);
@@ -178,6 +196,9 @@ protected:
    bool                mExpandTypeCommand;
 
    Query mCurrentQuery;
+
+   AutoCompleteCache*       mCachePtr;
+   const std::atomic<bool>* mCancelPtr;
 };
 } // namespace wizard
 
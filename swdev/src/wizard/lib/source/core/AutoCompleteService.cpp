@@ -0,0 +1,296 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "AutoCompleteService.hpp"
+
+#include <algorithm>
+#include <tuple>
+
+#include <QtConcurrent>
+
+#include "ParseResults.hpp"
+#include "ParseUtil.hpp"
+#include "Signals.hpp"
+#include "UtMemory.hpp"
+#include "WsfParseNode.hpp"
+
+bool wizard::AutoCompleteCache::ExpansionKey::operator<(const ExpansionKey& aRhs) const
+{
+   return std::tie(mRulePtr, mCurrentTypePtr, mParentCommandPtr, mCommandWordIndex, mEntryType, mFlags, mExpandBlock) <
+          std::tie(aRhs.mRulePtr,
+                   aRhs.mCurrentTypePtr,
+                   aRhs.mParentCommandPtr,
+                   aRhs.mCommandWordIndex,
+                   aRhs.mEntryType,
+                   aRhs.mFlags,
+                   aRhs.mExpandBlock);
+}
+
+wizard::AutoCompleteCache::AutoCompleteCache(ParseResults& aParseResults)
+   : mParseResults(aParseResults)
+   , mIndexBuilt(false)
+{
+}
+
+wizard::AutoCompleteCache::~AutoCompleteCache() = default;
+
+// Walk the parse tree once, collecting the named nodes and type definitions.
+void wizard::AutoCompleteCache::BuildIndex()
+{
+   const int     cTYPENAME_FLAGS = WsfParseNode::cTYPE_NAME_NODE | WsfParseNode::cLAZY_TYPENAME_NODE;
+   WsfParseNode* nodePtr         = mParseResults.parseTree();
+   while (nodePtr)
+   {
+      if (mCancelPtr && mCancelPtr->load(std::memory_order_relaxed))
+      {
+         // The request's results are dropped, so the partial index is discarded and built again by the next request
+         mNames.clear();
+         mDefinitions.clear();
+         return;
+      }
+      if ((nodePtr->mFlags & WsfParseNode::cNAMED_NODE) && nodePtr->mValue.Valid())
+      {
+         mNames[nodePtr->mType].push_back(nodePtr->mValue.Text());
+      }
+      if (nodePtr->GetFlags() & cTYPENAME_FLAGS)
+      {
+         WsfParseTypePath typeKey;
+         bool             isNested;
+         if (wizard::ParseUtil::FindReferenceType(nodePtr, typeKey, isNested) && !isNested && !typeKey.empty())
+         {
+            Definition def;
+            def.mName = nodePtr->mValue.Text();
+            def.mPath = typeKey;
+            mDefinitions[typeKey[0].Get()].push_back(def);
+         }
+      }
+      nodePtr = nodePtr->Next();
+   }
+   for (auto& names : mNames)
+   {
+      std::sort(names.second.begin(), names.second.end());
+      names.second.erase(std::unique(names.second.begin(), names.second.end()), names.second.end());
+   }
+   mIndexBuilt = true;
+}
+
+void wizard::AutoCompleteCache::FindDefinitionsOfType(const WsfParseTypePath& aPath, std::vector<std::string>& aNames)
+{
+   if (!mIndexBuilt)
+   {
+      BuildIndex();
+   }
+   if (aPath.empty())
+   {
+      for (auto&& defs : mDefinitions)
+      {
+         for (auto&& def : defs.second)
+         {
+            aNames.push_back(def.mName);
+         }
+      }
+      return;
+   }
+   auto iter = mDefinitions.find(aPath[0].Get());
+   if (iter != mDefinitions.end())
+   {
+      for (auto&& def : iter->second)
+      {
+         if (def.mPath.size() >= aPath.size() && std::equal(aPath.begin() + 1, aPath.end(), def.mPath.begin() + 1))
+         {
+            aNames.push_back(def.mName);
+         }
+      }
+   }
+}
+
+void wizard::AutoCompleteCache::GetBaseTypes(const WsfParseTypePath& aKind, std::vector<std::string>& aBaseTypeNames)
+{
+   if (aKind.empty())
+   {
+      return;
+   }
+   std::string kindStr = WsfParseTypePathString(aKind);
+   auto        iter    = mBaseTypes.find(kindStr);
+   if (iter != mBaseTypes.end())
+   {
+      aBaseTypeNames.insert(aBaseTypeNames.end(), iter->second.begin(), iter->second.end());
+   }
+   else
+   {
+      mPendingBaseTypes[kindStr] = aKind;
+   }
+}
+
+void wizard::AutoCompleteCache::FindNames(const std::string& aNameType, std::vector<std::string>& aNameList)
+{
+   if (!mIndexBuilt)
+   {
+      BuildIndex();
+   }
+   auto iter = mNames.find(aNameType);
+   if (iter != mNames.end())
+   {
+      aNameList.insert(aNameList.end(), iter->second.begin(), iter->second.end());
+   }
+   auto suggestedIter = mSuggestedNames.find(aNameType);
+   if (suggestedIter != mSuggestedNames.end())
+   {
+      aNameList.insert(aNameList.end(), suggestedIter->second.begin(), suggestedIter->second.end());
+   }
+   else if (std::find(mPendingNameTypes.begin(), mPendingNameTypes.end(), aNameType) == mPendingNameTypes.end())
+   {
+      mPendingNameTypes.push_back(aNameType);
+   }
+}
+
+void wizard::AutoCompleteCache::ResolvePendingLookups()
+{
+   // Base types come from the proxy, which is only safe to read on the GUI thread
+   for (auto&& pending : mPendingBaseTypes)
+   {
+      mParseResults.GetBaseTypes(pending.second, mBaseTypes[pending.first]);
+   }
+   mPendingBaseTypes.clear();
+   // plug-ins may also have suggestions here
+   for (auto&& nameType : mPendingNameTypes)
+   {
+      wizSignals->RequestNameSuggestions(nameType, mSuggestedNames[nameType]);
+   }
+   mPendingNameTypes.clear();
+}
+
+wizard::AutoCompleteService::AutoCompleteService()
+   : QObject()
+   , mRequest()
+   , mStartPending(false)
+{
+}
+
+wizard::AutoCompleteService::~AutoCompleteService()
+{
+   // The tasks use the cache, so they must stop before it is deleted
+   Invalidate();
+}
+
+void wizard::AutoCompleteService::RequestSuggestions(const Request& aRequest, const ResultsCallback& aCallback)
+{
+   Cancel();
+   mRequest  = aRequest;
+   mCallback = aCallback;
+   if (mCancelledWatcherPtr)
+   {
+      // The cancelled task may still be using the cache
+      mStartPending = true;
+   }
+   else
+   {
+      Start();
+   }
+}
+
+void wizard::AutoCompleteService::Start()
+{
+   if (!mCachePtr || &mCachePtr->GetParseResults() != mRequest.mParseResultsPtr)
+   {
+      mCachePtr = ut::make_unique<AutoCompleteCache>(*mRequest.mParseResultsPtr);
+   }
+   if (mCachePtr->HasPendingLookups())
+   {
+      mCachePtr->ResolvePendingLookups();
+   }
+
+   // Each request gets its own flag, so a cancelled task can never observe the flag of a later request
+   mCancelPtr = std::make_shared<std::atomic<bool>>(false);
+   mCachePtr->SetCancelFlag(mCancelPtr);
+
+   AutoCompleteCache*                 cachePtr  = mCachePtr.get();
+   std::shared_ptr<std::atomic<bool>> cancelPtr = mCancelPtr;
+   Request                            request   = mRequest;
+
+   mWatcherPtr = ut::make_unique<Watcher>();
+   connect(mWatcherPtr.get(), &Watcher::finished, this, &AutoCompleteService::RequestFinished);
+   mWatcherPtr->setFuture(QtConcurrent::run(
+      [cachePtr, cancelPtr, request]()
+      {
+         AutoComplete::Results results;
+         AutoComplete          autoCompleter(cachePtr, cancelPtr.get());
+         autoCompleter.GetSuggestions(*request.mParseResultsPtr,
+                                      *request.mSourcePtr,
+                                      request.mBlockNodePtr,
+                                      request.mText,
+                                      request.mInsertPosition,
+                                      results);
+         return results;
+      }));
+}
+
+void wizard::AutoCompleteService::Cancel()
+{
+   if (mWatcherPtr)
+   {
+      // The task stops at its next check of the flag.  It uses the cache, so the cache is not modified or deleted,
+      // and no other request is started, until the task finished.
+      *mCancelPtr = true;
+      mWatcherPtr->disconnect(this);
+      mCancelledWatcherPtr = std::move(mWatcherPtr);
+      connect(mCancelledWatcherPtr.get(), &Watcher::finished, this, &AutoCompleteService::CancelledRequestFinished);
+   }
+   mStartPending = false;
+   mCallback     = nullptr;
+}
+
+void wizard::AutoCompleteService::Invalidate()
+{
+   Cancel();
+   if (mCancelledWatcherPtr)
+   {
+      // The parse results are deleted after this, so the cancelled task must not be reading them anymore
+      mCancelledWatcherPtr->disconnect(this);
+      mCancelledWatcherPtr->waitForFinished();
+      mCancelledWatcherPtr.release()->deleteLater();
+   }
+   mCachePtr.reset();
+}
+
+void wizard::AutoCompleteService::CancelledRequestFinished()
+{
+   // The results of the cancelled task are stale, so they are dropped.
+   // This is called from the watcher's signal, so the watcher can't be deleted immediately
+   mCancelledWatcherPtr.release()->deleteLater();
+   if (mStartPending)
+   {
+      mStartPending = false;
+      Start();
+   }
+}
+
+void wizard::AutoCompleteService::RequestFinished()
+{
+   AutoComplete::Results results = mWatcherPtr->result();
+   // This is called from the watcher's signal, so the watcher can't be deleted immediately
+   mWatcherPtr.release()->deleteLater();
+
+   if (mCachePtr->HasPendingLookups())
+   {
+      // Some lookups could only be completed on the GUI thread.  Run the request again with the lookups completed.
+      // The rule expansions and name index are cached, so the second pass is quick.
+      Start();
+      return;
+   }
+
+   ResultsCallback callback = mCallback;
+   mCallback                = nullptr;
+   if (callback)
+   {
+      callback(results);
+   }
+}
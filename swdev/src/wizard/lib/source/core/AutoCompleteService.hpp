@@ -0,0 +1,163 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef AUTOCOMPLETESERVICE_HPP
+#define AUTOCOMPLETESERVICE_HPP
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QFutureWatcher>
+#include <QObject>
+
+#include "AutoComplete.hpp"
+#include "ViExport.hpp"
+#include "WsfParseType.hpp"
+
+namespace wizard
+{
+class ParseResults;
+class TextSource;
+
+//! Data used by AutoComplete which only changes when the project is re-parsed.
+//! An AutoCompleteCache belongs to a single ParseResults and must be discarded when the parse results are invalidated.
+//!
+//! The cache holds:
+//!  * the expansion of each grammar rule, keyed by the rule and the state of the entry being expanded,
+//!  * the names of each kind of named node, sorted, built by a single walk of the parse tree,
+//!  * the non-nested type definitions, grouped by the first element of their type path,
+//!  * base types and plug-in name suggestions, which may only be looked up on the GUI thread.
+//!
+//! The cache is not thread-safe.  AutoCompleteService guarantees that only one thread uses it at a time.
+class AutoCompleteCache
+{
+public:
+   explicit AutoCompleteCache(ParseResults& aParseResults);
+   ~AutoCompleteCache();
+
+   ParseResults& GetParseResults() const { return mParseResults; }
+
+   //! Append the names of the non-nested definitions of the type aPath
+   //! Equivalent to ParseResults::FindDefinitionsOfType()
+   void FindDefinitionsOfType(const WsfParseTypePath& aPath, std::vector<std::string>& aNames);
+   //! Append the names of the base types of aKind
+   //! Equivalent to ParseResults::GetBaseTypes(), but nothing is appended until ResolvePendingLookups() has been called
+   void GetBaseTypes(const WsfParseTypePath& aKind, std::vector<std::string>& aBaseTypeNames);
+   //! Append the names of the nodes of type aNameType, followed by any names suggested by plug-ins
+   //! Plug-in suggestions are not appended until ResolvePendingLookups() has been called
+   void FindNames(const std::string& aNameType, std::vector<std::string>& aNameList);
+
+   //! Set the cancel flag of the request using the cache.  Building the name index stops early once it is set.
+   void SetCancelFlag(const std::shared_ptr<const std::atomic<bool>>& aCancelPtr) { mCancelPtr = aCancelPtr; }
+
+   //! Returns 'true' if a lookup was requested that may only be completed on the GUI thread
+   bool HasPendingLookups() const { return !mPendingBaseTypes.empty() || !mPendingNameTypes.empty(); }
+   //! Complete the pending lookups.  Must be called from the GUI thread while no AutoComplete is using the cache.
+   void ResolvePendingLookups();
+
+private:
+   friend class AutoComplete;
+
+   struct ExpansionKey
+   {
+      bool operator<(const ExpansionKey& aRhs) const;
+
+      WsfParseRule*       mRulePtr;
+      const WsfParseType* mCurrentTypePtr;
+      WsfParseSequence*   mParentCommandPtr;
+      size_t              mCommandWordIndex;
+      int                 mEntryType;
+      int                 mFlags;
+      bool                mExpandBlock;
+   };
+   struct Expansion
+   {
+      std::unique_ptr<AutoComplete::Entry> mEntryPtr;
+      bool                                 mExpanded;
+   };
+   struct Definition
+   {
+      WsfParseTypePath mPath;
+      std::string      mName;
+   };
+
+   void BuildIndex();
+
+   ParseResults&                            mParseResults;
+   std::shared_ptr<const std::atomic<bool>> mCancelPtr;
+
+   std::map<ExpansionKey, Expansion> mExpansions;
+
+   bool                                            mIndexBuilt;
+   std::map<std::string, std::vector<std::string>> mNames;
+   std::map<std::string, std::vector<Definition>>  mDefinitions;
+   std::map<std::string, std::vector<std::string>> mBaseTypes;
+   std::map<std::string, std::vector<std::string>> mSuggestedNames;
+   std::map<std::string, WsfParseTypePath>         mPendingBaseTypes;
+   std::vector<std::string>                        mPendingNameTypes;
+};
+
+//! Computes auto-complete suggestions on a worker thread.
+//! Only one request is active at a time; a new request cancels the previous one.  The results are delivered to the
+//! request's callback on the GUI thread.  Owned by the Project, use Project::GetAutoCompleteService() to access it.
+//!
+//! Cancelling does not wait for the worker thread.  The cancelled task stops at its next check of the cancel flag and
+//! its results are dropped.  As the cache is not thread-safe, a new request starts once the cancelled task finished.
+class VI_EXPORT AutoCompleteService : public QObject
+{
+   Q_OBJECT
+
+public:
+   struct Request
+   {
+      ParseResults* mParseResultsPtr;
+      TextSource*   mSourcePtr;
+      WsfParseNode* mBlockNodePtr;
+      std::string   mText;
+      size_t        mInsertPosition;
+   };
+   using ResultsCallback = std::function<void(const AutoComplete::Results&)>;
+
+   AutoCompleteService();
+   ~AutoCompleteService() override;
+
+   //! Start computing suggestions for aRequest, cancelling any request in progress.
+   //! aRequest.mParseResultsPtr must remain valid until the callback is invoked, Cancel() is called,
+   //! or the results are invalidated with Invalidate().
+   void RequestSuggestions(const Request& aRequest, const ResultsCallback& aCallback);
+   //! Cancel the request in progress, if any.  The callback will not be invoked.
+   void Cancel();
+   //! Cancel the request in progress and discard the cached data.  Called when the parse results are invalidated.
+   //! This waits for a cancelled task, which may still be reading the parse results.
+   void Invalidate();
+
+private:
+   void Start();
+   void RequestFinished();
+   void CancelledRequestFinished();
+
+   using Watcher = QFutureWatcher<AutoComplete::Results>;
+
+   std::unique_ptr<AutoCompleteCache> mCachePtr;
+   std::unique_ptr<Watcher>           mWatcherPtr;
+   std::unique_ptr<Watcher>           mCancelledWatcherPtr; //!< The cancelled task, until it finishes
+   std::shared_ptr<std::atomic<bool>> mCancelPtr;
+   Request                            mRequest;
+   ResultsCallback                    mCallback;
+   bool                               mStartPending; //!< Whether mRequest waits for the cancelled task to finish
+};
+} // namespace wizard
+
+#endif
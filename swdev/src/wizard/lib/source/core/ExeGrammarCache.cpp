@@ -0,0 +1,272 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "ExeGrammarCache.hpp"
+
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QStringList>
+
+#include "UtPath.hpp"
+#include "Util.hpp"
+
+namespace
+{
+const quint32 cFILE_MAGIC   = 0x41474331; // "AGC1"
+const quint32 cFILE_VERSION = 1;
+
+using Hash = wizard::Util::ContentHash;
+
+struct ExeStamp
+{
+   QString mPath;
+   qint64  mSize{-1};
+   qint64  mModified{0};
+   Hash    mPluginsHash{0};
+};
+
+Hash ComputeHash(const QByteArray& aData)
+{
+   return wizard::Util::ComputeContentHash(aData.constData(), static_cast<size_t>(aData.size()));
+}
+
+// The directories searched for plug-ins by WsfStandardApplication, relative to the executable,
+// and the directories listed in the WSF_PLUGIN_PATH environment variable
+QStringList GetPluginDirectories(const QFileInfo& aExeInfo)
+{
+   const QDir  exeDir = aExeInfo.absoluteDir();
+   QStringList dirs;
+   dirs << exeDir.filePath("wsf_plugins") << exeDir.filePath("../wsf_plugins")
+        << exeDir.filePath("../mission_plugins");
+   const QString envPath = QString::fromLocal8Bit(qgetenv("WSF_PLUGIN_PATH"));
+   if (!envPath.isEmpty())
+   {
+      dirs << envPath.split(QDir::listSeparator(), QString::SkipEmptyParts);
+   }
+   return dirs;
+}
+
+// Hashes the name, size and modification time of every file in the plug-in directories.
+// Adding, removing or rebuilding a plug-in can change the grammar without changing the executable.
+Hash ComputePluginsHash(const QFileInfo& aExeInfo)
+{
+   QByteArray fingerprint;
+   for (const QString& dir : GetPluginDirectories(aExeInfo))
+   {
+      QStringList entries;
+      QDirIterator it(dir, QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+      while (it.hasNext())
+      {
+         it.next();
+         const QFileInfo& info = it.fileInfo();
+         entries << QString("%1|%2|%3")
+                       .arg(info.absoluteFilePath())
+                       .arg(info.size())
+                       .arg(info.lastModified().toMSecsSinceEpoch());
+      }
+      // The iteration order is not defined by QDirIterator
+      entries.sort();
+      fingerprint += QDir::cleanPath(QDir(dir).absolutePath()).toUtf8();
+      fingerprint += '\n';
+      fingerprint += entries.join('\n').toUtf8();
+      fingerprint += '\n';
+   }
+   return ComputeHash(fingerprint);
+}
+
+bool ComputeContentHash(const QString& aPath, Hash& aHash)
+{
+   QFile file(aPath);
+   if (!file.open(QIODevice::ReadOnly))
+   {
+      return false;
+   }
+   const qint64 size = file.size();
+   if (size == 0)
+   {
+      aHash = wizard::Util::ComputeContentHash(nullptr, 0);
+      return true;
+   }
+   const uchar* dataPtr = file.map(0, size);
+   if (dataPtr == nullptr)
+   {
+      return false;
+   }
+   aHash = wizard::Util::ComputeContentHash(reinterpret_cast<const char*>(dataPtr), static_cast<size_t>(size));
+   file.unmap(const_cast<uchar*>(dataPtr));
+   return true;
+}
+
+bool GetStamp(const UtPath& aExePath, ExeStamp& aStamp)
+{
+   const QFileInfo info(QString::fromStdString(aExePath.GetSystemPath()));
+   if (!info.exists())
+   {
+      return false;
+   }
+   aStamp.mPath        = info.absoluteFilePath();
+   aStamp.mSize        = info.size();
+   aStamp.mModified    = info.lastModified().toMSecsSinceEpoch();
+   aStamp.mPluginsHash = ComputePluginsHash(info);
+   return true;
+}
+
+// One file per executable, named after the hash of its absolute path
+QString GetCacheFilePath(const ExeStamp& aStamp, bool aCreateDirectory)
+{
+   const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/exe_grammar";
+   if (aCreateDirectory && !QDir().mkpath(cacheDir))
+   {
+      return QString();
+   }
+   const QByteArray pathUtf8 = aStamp.mPath.toUtf8();
+   return cacheDir + '/' + QString::number(static_cast<qulonglong>(ComputeHash(pathUtf8)), 16) + ".cache";
+}
+
+QByteArray ToByteArray(const std::string& aText)
+{
+   return QByteArray(aText.data(), static_cast<int>(aText.size()));
+}
+
+std::string ToStdString(const QByteArray& aData)
+{
+   return std::string(aData.constData(), static_cast<size_t>(aData.size()));
+}
+
+// Grammars compiled during this session, by the hash and size of their text
+std::mutex                                                            sDefinitionsMutex;
+std::map<std::pair<Hash, size_t>, std::weak_ptr<WsfParseDefinitions>> sDefinitions;
+
+std::pair<Hash, size_t> GetDefinitionsKey(const std::string& aGrammarText)
+{
+   return std::make_pair(wizard::Util::ComputeContentHash(aGrammarText.data(), aGrammarText.size()),
+                         aGrammarText.size());
+}
+} // namespace
+
+bool wizard::ExeGrammarCache::Load(const UtPath& aExePath, Output& aOutput)
+{
+   ExeStamp current;
+   if (!GetStamp(aExePath, current))
+   {
+      return false;
+   }
+   QFile file(GetCacheFilePath(current, false));
+   if (!file.open(QIODevice::ReadOnly))
+   {
+      return false;
+   }
+
+   QDataStream stream(&file);
+   quint32     magic   = 0;
+   quint32     version = 0;
+   ExeStamp    stored;
+   quint64     pluginsHash = 0;
+   quint64     contentHash = 0;
+   QByteArray  exeVersion;
+   QByteArray  application;
+   QByteArray  grammarText;
+   stream >> magic >> version;
+   if (magic != cFILE_MAGIC || version != cFILE_VERSION)
+   {
+      return false;
+   }
+   stream >> stored.mPath >> stored.mSize >> stored.mModified >> pluginsHash >> contentHash;
+   stream >> exeVersion >> application >> grammarText;
+   if (stream.status() != QDataStream::Ok || grammarText.isEmpty())
+   {
+      return false;
+   }
+
+   if (stored.mPath != current.mPath || stored.mSize != current.mSize || pluginsHash != current.mPluginsHash)
+   {
+      return false;
+   }
+   if (stored.mModified != current.mModified)
+   {
+      // Only read the (large) executable when the time stamp alone can't tell
+      Hash currentContentHash = 0;
+      if (!ComputeContentHash(current.mPath, currentContentHash) || currentContentHash != contentHash)
+      {
+         return false;
+      }
+   }
+
+   aOutput.mVersion     = ToStdString(exeVersion);
+   aOutput.mApplication = ToStdString(application);
+   aOutput.mGrammarText = ToStdString(grammarText);
+   return true;
+}
+
+void wizard::ExeGrammarCache::Store(const UtPath& aExePath, const Output& aOutput)
+{
+   ExeStamp stamp;
+   Hash     contentHash = 0;
+   if (aOutput.mGrammarText.empty() || !GetStamp(aExePath, stamp) || !ComputeContentHash(stamp.mPath, contentHash))
+   {
+      return;
+   }
+   const QString fileName = GetCacheFilePath(stamp, true);
+   if (fileName.isEmpty())
+   {
+      return;
+   }
+
+   // Write to a temporary file and rename, so a concurrent Load never sees a partial entry
+   QSaveFile file(fileName);
+   if (file.open(QIODevice::WriteOnly))
+   {
+      QDataStream stream(&file);
+      stream << cFILE_MAGIC << cFILE_VERSION;
+      stream << stamp.mPath << stamp.mSize << stamp.mModified << static_cast<quint64>(stamp.mPluginsHash)
+             << static_cast<quint64>(contentHash);
+      stream << ToByteArray(aOutput.mVersion) << ToByteArray(aOutput.mApplication)
+             << ToByteArray(aOutput.mGrammarText);
+      if (stream.status() == QDataStream::Ok)
+      {
+         file.commit();
+      }
+   }
+}
+
+std::shared_ptr<WsfParseDefinitions> wizard::ExeGrammarCache::FindDefinitions(const std::string& aGrammarText)
+{
+   std::lock_guard<std::mutex> lock(sDefinitionsMutex);
+   auto                        it = sDefinitions.find(GetDefinitionsKey(aGrammarText));
+   if (it != sDefinitions.end())
+   {
+      auto definitionsPtr = it->second.lock();
+      if (!definitionsPtr)
+      {
+         sDefinitions.erase(it);
+      }
+      return definitionsPtr;
+   }
+   return std::shared_ptr<WsfParseDefinitions>();
+}
+
+void wizard::ExeGrammarCache::AddDefinitions(const std::string&                          aGrammarText,
+                                             const std::shared_ptr<WsfParseDefinitions>& aDefinitions)
+{
+   std::lock_guard<std::mutex> lock(sDefinitionsMutex);
+   sDefinitions[GetDefinitionsKey(aGrammarText)] = aDefinitions;
+}
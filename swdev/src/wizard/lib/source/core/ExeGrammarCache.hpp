@@ -0,0 +1,55 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef EXEGRAMMARCACHE_HPP
+#define EXEGRAMMARCACHE_HPP
+
+#include <memory>
+#include <string>
+
+#include "ViExport.hpp"
+
+class UtPath;
+class WsfParseDefinitions;
+
+namespace wizard
+{
+//! Remembers what a mission executable reports about itself with the --ide-output option.
+//! Running the executable takes seconds (it loads every plug-in), so the output is stored in the user's cache
+//! directory and reused while neither the executable nor its plug-in directories change.
+//! An entry is valid when the size and modification time of the executable match the stored values; when only the
+//! modification time differs (e.g. the executable was re-installed) the content hash is compared instead.
+//! Compiled grammars are shared in memory by every executable reporting the same grammar text.
+class VI_EXPORT ExeGrammarCache
+{
+public:
+   struct Output
+   {
+      std::string mVersion;
+      std::string mApplication;
+      std::string mGrammarText;
+   };
+
+   //! Returns 'true' and fills aOutput if the cache holds the current output of aExePath
+   static bool Load(const UtPath& aExePath, Output& aOutput);
+   //! Stores the output of aExePath, replacing any previous entry
+   static void Store(const UtPath& aExePath, const Output& aOutput);
+
+   //! Returns the definitions compiled from aGrammarText during this session, or an empty pointer
+   static std::shared_ptr<WsfParseDefinitions> FindDefinitions(const std::string& aGrammarText);
+   //! Shares definitions compiled (without error) from aGrammarText.
+   //! The cache does not keep the definitions alive, they are released with the last executable using them.
+   static void AddDefinitions(const std::string&                          aGrammarText,
+                              const std::shared_ptr<WsfParseDefinitions>& aDefinitions);
+};
+} // namespace wizard
+
+#endif
@@ -0,0 +1,454 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "OutputBuffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+// Lines are checked for cancellation of a re-filter this often
+const size_t cREFILTER_CHECK_INTERVAL = 4096;
+} // namespace
+
+constexpr size_t wizard::OutputBuffer::cDEFAULT_CAPACITY;
+constexpr size_t wizard::OutputBuffer::cCHUNK_SIZE;
+
+wizard::OutputBuffer::OutputBuffer(size_t aCapacity)
+   : mCapacity(std::max(aCapacity, cCHUNK_SIZE))
+{
+   mIndexerThread = std::thread(&OutputBuffer::IndexerLoop, this);
+}
+
+wizard::OutputBuffer::~OutputBuffer()
+{
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mStopping = true;
+   }
+   mWakeCondition.notify_one();
+   mIndexerThread.join();
+}
+
+void wizard::OutputBuffer::Append(const char* aDataPtr, size_t aSize)
+{
+   if (aSize == 0)
+   {
+      return;
+   }
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      while (aSize > 0)
+      {
+         const uint64_t used = mWriteOffset - mFirstChunkOffset;
+         if (used == mChunks.size() * cCHUNK_SIZE)
+         {
+            mChunks.push_back(std::make_shared<Chunk>());
+         }
+         // The indexer may be reading the front of the last chunk, it never reads past mWriteOffset
+         const size_t position = static_cast<size_t>(used % cCHUNK_SIZE);
+         const size_t count    = std::min(aSize, cCHUNK_SIZE - position);
+         std::memcpy(mChunks.back()->mData + position, aDataPtr, count);
+         aDataPtr += count;
+         aSize -= count;
+         mWriteOffset += count;
+      }
+      DropOldChunks();
+   }
+   mWakeCondition.notify_one();
+}
+
+void wizard::OutputBuffer::Finish()
+{
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mFinished = true;
+   }
+   mWakeCondition.notify_one();
+}
+
+void wizard::OutputBuffer::SetFilter(const QString& aFilter, bool aCaseSensitive)
+{
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      mRequestedPattern       = aFilter;
+      mRequestedCaseSensitive = aCaseSensitive;
+      ++mRequestedFilterId;
+   }
+   mWakeCondition.notify_one();
+}
+
+size_t wizard::OutputBuffer::GetRowCount() const
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   return mFilterActive ? mFilteredLineNumbers.size() : mLines.size();
+}
+
+QString wizard::OutputBuffer::GetRowText(size_t aRow, Severity* aSeverityPtr) const
+{
+   QByteArray text;
+   Severity   severity = cNORMAL;
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      const Line*                 linePtr = GetRowLine(aRow);
+      if (linePtr != nullptr)
+      {
+         text     = CopyBytes(mChunks, mFirstChunkOffset, linePtr->mOffset, linePtr->mLength);
+         severity = linePtr->mSeverity;
+      }
+   }
+   if (aSeverityPtr != nullptr)
+   {
+      *aSeverityPtr = severity;
+   }
+   return QString::fromUtf8(text);
+}
+
+QString wizard::OutputBuffer::GetRowsText(size_t aFirstRow, size_t aCount) const
+{
+   QByteArray text;
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      for (size_t row = aFirstRow; row < aFirstRow + aCount; ++row)
+      {
+         const Line* linePtr = GetRowLine(row);
+         if (linePtr == nullptr)
+         {
+            break;
+         }
+         if (row != aFirstRow)
+         {
+            text += '\n';
+         }
+         text += CopyBytes(mChunks, mFirstChunkOffset, linePtr->mOffset, linePtr->mLength);
+      }
+   }
+   return QString::fromUtf8(text);
+}
+
+bool wizard::OutputBuffer::FindProblem(size_t aFromRow, bool aForward, size_t& aProblemRow) const
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   const size_t                rowCount = mFilterActive ? mFilteredLineNumbers.size() : mLines.size();
+   if (aForward)
+   {
+      for (size_t row = aFromRow; row < rowCount; ++row)
+      {
+         if (GetRowLine(row)->mSeverity != cNORMAL)
+         {
+            aProblemRow = row;
+            return true;
+         }
+      }
+   }
+   else
+   {
+      for (size_t row = std::min(aFromRow, rowCount); row > 0; --row)
+      {
+         if (GetRowLine(row - 1)->mSeverity != cNORMAL)
+         {
+            aProblemRow = row - 1;
+            return true;
+         }
+      }
+   }
+   return false;
+}
+
+size_t wizard::OutputBuffer::GetErrorCount() const
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   return mErrorCount;
+}
+
+size_t wizard::OutputBuffer::GetWarningCount() const
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   return mWarningCount;
+}
+
+bool wizard::OutputBuffer::IsIndexing() const
+{
+   std::lock_guard<std::mutex> lock(mMutex);
+   return (mIndexedOffset < mWriteOffset) || (mFilterId != mRequestedFilterId);
+}
+
+void wizard::OutputBuffer::IndexerLoop()
+{
+   while (true)
+   {
+      ChunkList chunks;
+      uint64_t  chunksOffset = 0;
+      uint64_t  end          = 0;
+      bool      finished     = false;
+      bool      refilter     = false;
+      {
+         std::unique_lock<std::mutex> lock(mMutex);
+         mWakeCondition.wait(lock,
+                             [this]()
+                             {
+                                return mStopping || (mIndexedOffset < mWriteOffset) ||
+                                       (mFilterId != mRequestedFilterId) ||
+                                       (mFinished && mLineStartOffset < mWriteOffset);
+                             });
+         if (mStopping)
+         {
+            return;
+         }
+         refilter = (mFilterId != mRequestedFilterId);
+         if (!refilter)
+         {
+            // Holding the chunks keeps them alive if Append drops them while they are being indexed
+            chunks.assign(mChunks.begin(), mChunks.end());
+            chunksOffset = mFirstChunkOffset;
+            end          = mWriteOffset;
+            finished     = mFinished;
+         }
+      }
+
+      if (refilter)
+      {
+         Refilter();
+      }
+      else
+      {
+         IndexLines(chunks, chunksOffset, end, finished);
+      }
+   }
+}
+
+void wizard::OutputBuffer::IndexLines(const ChunkList& aChunks, uint64_t aChunksOffset, uint64_t aEnd, bool aFinished)
+{
+   struct NewLine
+   {
+      Line mLine;
+      bool mMatches;
+   };
+   std::vector<NewLine> newLines;
+
+   // The start of the current line may have been dropped, the rest of it is then skipped
+   uint64_t offset    = std::max(mIndexedOffset, aChunksOffset);
+   uint64_t lineStart = std::max(mLineStartOffset, aChunksOffset);
+   bool     partial   = (mLineStartOffset < aChunksOffset);
+   auto     addLine   = [&](uint64_t aLineEnd)
+   {
+      if (partial)
+      {
+         partial = false;
+         return;
+      }
+      NewLine newLine;
+      newLine.mLine.mOffset = lineStart;
+      newLine.mLine.mLength = static_cast<uint32_t>(aLineEnd - lineStart);
+      QByteArray text       = CopyBytes(aChunks, aChunksOffset, newLine.mLine.mOffset, newLine.mLine.mLength);
+      if (text.endsWith('\r'))
+      {
+         text.chop(1);
+         --newLine.mLine.mLength;
+      }
+      newLine.mLine.mSeverity = GetSeverity(text);
+      newLine.mMatches        = mFilter.pattern().isEmpty() || QString::fromUtf8(text).contains(mFilter);
+      newLines.push_back(newLine);
+   };
+
+   while (offset < aEnd)
+   {
+      const size_t chunkIndex = static_cast<size_t>((offset - aChunksOffset) / cCHUNK_SIZE);
+      const size_t begin      = static_cast<size_t>((offset - aChunksOffset) % cCHUNK_SIZE);
+      const size_t stop       = static_cast<size_t>(std::min<uint64_t>(cCHUNK_SIZE, begin + (aEnd - offset)));
+      const char*  dataPtr    = aChunks[chunkIndex]->mData;
+      const void*  newLinePtr = std::memchr(dataPtr + begin, '\n', stop - begin);
+      if (newLinePtr != nullptr)
+      {
+         const uint64_t newLineOffset = offset + (static_cast<const char*>(newLinePtr) - (dataPtr + begin));
+         addLine(newLineOffset);
+         offset    = newLineOffset + 1;
+         lineStart = offset;
+      }
+      else
+      {
+         offset += stop - begin;
+      }
+      // Break up output without new lines, so a row never holds more than a few chunks
+      if (offset - lineStart >= cCHUNK_SIZE)
+      {
+         addLine(offset);
+         lineStart = offset;
+      }
+   }
+   if (aFinished && lineStart < aEnd)
+   {
+      addLine(aEnd);
+      lineStart = aEnd;
+   }
+
+   std::lock_guard<std::mutex> lock(mMutex);
+   mIndexedOffset   = offset;
+   mLineStartOffset = lineStart;
+   for (const auto& newLine : newLines)
+   {
+      if (newLine.mLine.mSeverity == cERROR)
+      {
+         ++mErrorCount;
+      }
+      else if (newLine.mLine.mSeverity == cWARNING)
+      {
+         ++mWarningCount;
+      }
+      // Skip lines dropped by Append while they were being indexed
+      if (newLine.mLine.mOffset >= mFirstChunkOffset)
+      {
+         if (mFilterActive && newLine.mMatches)
+         {
+            mFilteredLineNumbers.push_back(mFirstLineNumber + mLines.size());
+         }
+         mLines.push_back(newLine.mLine);
+      }
+   }
+   ++mRevision;
+}
+
+void wizard::OutputBuffer::Refilter()
+{
+   QRegularExpression filter;
+   uint64_t           filterId = 0;
+   std::deque<Line>   lines;
+   uint64_t           firstLineNumber = 0;
+   ChunkList          chunks;
+   uint64_t           chunksOffset = 0;
+   {
+      std::lock_guard<std::mutex> lock(mMutex);
+      filter.setPattern(mRequestedPattern);
+      if (!mRequestedCaseSensitive)
+      {
+         filter.setPatternOptions(QRegularExpression::CaseInsensitiveOption);
+      }
+      filterId        = mRequestedFilterId;
+      lines           = mLines;
+      firstLineNumber = mFirstLineNumber;
+      chunks.assign(mChunks.begin(), mChunks.end());
+      chunksOffset = mFirstChunkOffset;
+   }
+
+   // Lines are only added by this thread, so 'lines' stays complete while matching
+   std::deque<uint64_t> filteredLineNumbers;
+   if (!filter.pattern().isEmpty())
+   {
+      filter.optimize();
+      for (size_t i = 0; i < lines.size(); ++i)
+      {
+         if (i % cREFILTER_CHECK_INTERVAL == 0)
+         {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mStopping || mRequestedFilterId != filterId)
+            {
+               return;
+            }
+         }
+         const QByteArray text = CopyBytes(chunks, chunksOffset, lines[i].mOffset, lines[i].mLength);
+         if (QString::fromUtf8(text).contains(filter))
+         {
+            filteredLineNumbers.push_back(firstLineNumber + i);
+         }
+      }
+   }
+
+   mFilter = filter;
+   std::lock_guard<std::mutex> lock(mMutex);
+   while (!filteredLineNumbers.empty() && filteredLineNumbers.front() < mFirstLineNumber)
+   {
+      filteredLineNumbers.pop_front();
+   }
+   mFilteredLineNumbers.swap(filteredLineNumbers);
+   mFilterActive = !filter.pattern().isEmpty();
+   mFilterId     = filterId;
+   ++mRevision;
+}
+
+void wizard::OutputBuffer::DropOldChunks()
+{
+   bool dropped = false;
+   while (mChunks.size() > 1 && (mChunks.size() - 1) * cCHUNK_SIZE >= mCapacity)
+   {
+      mChunks.pop_front();
+      mFirstChunkOffset += cCHUNK_SIZE;
+      dropped = true;
+   }
+   if (dropped)
+   {
+      while (!mLines.empty() && mLines.front().mOffset < mFirstChunkOffset)
+      {
+         mLines.pop_front();
+         ++mFirstLineNumber;
+      }
+      while (!mFilteredLineNumbers.empty() && mFilteredLineNumbers.front() < mFirstLineNumber)
+      {
+         mFilteredLineNumbers.pop_front();
+      }
+      ++mRevision;
+   }
+}
+
+const wizard::OutputBuffer::Line* wizard::OutputBuffer::GetRowLine(size_t aRow) const
+{
+   if (!mFilterActive)
+   {
+      return (aRow < mLines.size()) ? &mLines[aRow] : nullptr;
+   }
+   if (aRow < mFilteredLineNumbers.size())
+   {
+      const uint64_t index = mFilteredLineNumbers[aRow] - mFirstLineNumber;
+      if (index < mLines.size())
+      {
+         return &mLines[static_cast<size_t>(index)];
+      }
+   }
+   return nullptr;
+}
+
+template<class CHUNKS>
+QByteArray wizard::OutputBuffer::CopyBytes(const CHUNKS& aChunks,
+                                           uint64_t      aChunksOffset,
+                                           uint64_t      aOffset,
+                                           uint32_t      aLength)
+{
+   QByteArray bytes;
+   bytes.reserve(static_cast<int>(aLength));
+   uint64_t offset = aOffset;
+   uint64_t end    = aOffset + aLength;
+   while (offset < end)
+   {
+      const size_t chunkIndex = static_cast<size_t>((offset - aChunksOffset) / cCHUNK_SIZE);
+      const size_t position   = static_cast<size_t>((offset - aChunksOffset) % cCHUNK_SIZE);
+      const size_t count      = static_cast<size_t>(std::min<uint64_t>(cCHUNK_SIZE - position, end - offset));
+      bytes.append(aChunks[chunkIndex]->mData + position, static_cast<int>(count));
+      offset += count;
+   }
+   return bytes;
+}
+
+wizard::OutputBuffer::Severity wizard::OutputBuffer::GetSeverity(const QByteArray& aLine)
+{
+   // WSF reports problems as "***** ERROR: ..." or "***** WARNING: ..."
+   if (aLine.startsWith("***** "))
+   {
+      if (aLine.startsWith("***** ERROR") || aLine.startsWith("***** FATAL"))
+      {
+         return cERROR;
+      }
+      if (aLine.startsWith("***** WARNING"))
+      {
+         return cWARNING;
+      }
+   }
+   return cNORMAL;
+}
@@ -0,0 +1,146 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef OUTPUTBUFFER_HPP
+#define OUTPUTBUFFER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <QByteArray>
+#include <QRegularExpression>
+#include <QString>
+
+#include "ViExport.hpp"
+
+namespace wizard
+{
+//! Holds the console output of an execution.
+//! The raw bytes are appended to a ring of fixed-size chunks, the oldest chunks are dropped once the capacity is
+//! exceeded. A background thread splits the bytes into lines, classifies error and warning lines and applies the
+//! filter, so appending never does more than a copy. Text is only decoded for the lines a view asks for.
+//!
+//! Rows are the lines visible through the filter (every line when there is no filter). Rows shift when old lines
+//! are dropped, use GetRevision() to detect any change.
+class VI_EXPORT OutputBuffer
+{
+public:
+   enum Severity : uint8_t
+   {
+      cNORMAL,
+      cWARNING,
+      cERROR
+   };
+
+   static constexpr size_t cDEFAULT_CAPACITY = 64 * 1024 * 1024;
+
+   explicit OutputBuffer(size_t aCapacity = cDEFAULT_CAPACITY);
+   OutputBuffer(const OutputBuffer&) = delete;
+   OutputBuffer& operator=(const OutputBuffer&) = delete;
+   ~OutputBuffer();
+
+   //! Appends raw output. The text is not decoded here.
+   void Append(const char* aDataPtr, size_t aSize);
+   void Append(const QByteArray& aData) { Append(aData.constData(), static_cast<size_t>(aData.size())); }
+   //! Indicates no more output will be appended, an unterminated last line becomes a row
+   void Finish();
+
+   //! Shows only the lines matching aFilter, or every line if aFilter is empty.
+   //! The lines already in the buffer are filtered in the background.
+   void SetFilter(const QString& aFilter, bool aCaseSensitive);
+
+   //! Incremented whenever rows are added, dropped or re-filtered
+   uint64_t GetRevision() const { return mRevision; }
+   size_t   GetRowCount() const;
+   //! Returns the decoded text of a row, and optionally its severity
+   QString GetRowText(size_t aRow, Severity* aSeverityPtr = nullptr) const;
+   //! Returns the text of the rows [aFirstRow, aFirstRow + aCount), separated by new lines
+   QString GetRowsText(size_t aFirstRow, size_t aCount) const;
+   //! Finds the first error or warning row at or after aFromRow, or the last one before aFromRow when searching
+   //! backward. Returns 'false' if there is none.
+   bool FindProblem(size_t aFromRow, bool aForward, size_t& aProblemRow) const;
+
+   //! Counts of the lines indexed since the output started, including dropped lines
+   size_t GetErrorCount() const;
+   size_t GetWarningCount() const;
+   //! Returns 'true' while the background thread has output left to index
+   bool IsIndexing() const;
+
+private:
+   static constexpr size_t cCHUNK_SIZE = 64 * 1024;
+
+   struct Chunk
+   {
+      char mData[cCHUNK_SIZE];
+   };
+   using ChunkList = std::vector<std::shared_ptr<Chunk>>;
+
+   struct Line
+   {
+      uint64_t mOffset;
+      uint32_t mLength;
+      Severity mSeverity;
+   };
+
+   void IndexerLoop();
+   //! Splits the bytes [mIndexedOffset, aEnd) into lines and adds them
+   void IndexLines(const ChunkList& aChunks, uint64_t aChunksOffset, uint64_t aEnd, bool aFinished);
+   //! Applies the requested filter to every retained line
+   void Refilter();
+   void DropOldChunks();
+   const Line* GetRowLine(size_t aRow) const;
+
+   //! Copies the bytes [aOffset, aOffset + aLength) out of aChunks, which start at aChunksOffset
+   template<class CHUNKS>
+   static QByteArray CopyBytes(const CHUNKS& aChunks, uint64_t aChunksOffset, uint64_t aOffset, uint32_t aLength);
+   static Severity   GetSeverity(const QByteArray& aLine);
+
+   const size_t mCapacity;
+
+   mutable std::mutex      mMutex;
+   std::condition_variable mWakeCondition;
+   bool                    mStopping{false};
+   bool                    mFinished{false};
+
+   // Written by Append and SetFilter, guarded by mMutex
+   std::deque<std::shared_ptr<Chunk>> mChunks;
+   uint64_t                           mFirstChunkOffset{0}; //!< Absolute offset of mChunks.front()
+   uint64_t                           mWriteOffset{0};      //!< Absolute offset of the next appended byte
+   QString                            mRequestedPattern;
+   bool                               mRequestedCaseSensitive{false};
+   uint64_t                           mRequestedFilterId{0};
+
+   // Written by the indexer, guarded by mMutex
+   std::deque<Line>     mLines;
+   uint64_t             mFirstLineNumber{0}; //!< Absolute number of mLines.front()
+   std::deque<uint64_t> mFilteredLineNumbers;
+   bool                 mFilterActive{false};
+   uint64_t             mFilterId{0};
+   size_t               mErrorCount{0};
+   size_t               mWarningCount{0};
+   uint64_t             mIndexedOffset{0};
+   uint64_t             mLineStartOffset{0};
+
+   // Only used by the indexer thread
+   QRegularExpression mFilter; //!< The filter applied to mFilteredLineNumbers
+
+   std::atomic<uint64_t> mRevision{0};
+   std::thread           mIndexerThread;
+};
+} // namespace wizard
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "ActionManager.hpp"
 #include "AttributeSet.hpp"
+#include "AutoCompleteService.hpp"
 #include "BackupPrefObject.hpp"
 #include "ChangeHistory.hpp"
 #include "Editor.hpp"
@@ -100,6 +101,8 @@ wizard::Project::Project(wizard::ProjectWorkspace* aWorkspacePtr)
 
    mParseWorker = new ParseWorker(this);
 
+   mAutoCompleteServicePtr = ut::make_unique<AutoCompleteService>();
+
    mUtCallbacks += WsfExe::ExeUpdated.Connect(&Project::ExeUpdated, this);
 
    RegisterComponents(this);
@@ -129,6 +132,9 @@ wizard::Project::~Project()
 
    wizSignals->ProxyInvalidate();
 
+   // Auto-complete may be running on the parse results
+   mAutoCompleteServicePtr->Invalidate();
+
    // RemoveAllAbstractItems(true);
    delete mParseResultsPrivatePtr;
    delete mParseResultsTinyPtr;
@@ -1089,6 +1095,7 @@ wizard::ParseResults* wizard::Project::TakeParseResults()
 {
    if (mParseResultsPtr != nullptr)
    {
+      mAutoCompleteServicePtr->Invalidate();
       emit wizSignals->ParseResultsInvalidate(this);
       mParseResultsTinyPtr->TakeResults(*mParseResultsPtr);
       mParseResultsPtr       = nullptr;
@@ -1198,6 +1205,8 @@ void proxyBeforeModifiedCallback(WsfPProxy*                     aProxyPtr,
 
 void wizard::Project::ProxyReady(std::unique_ptr<WsfPProxy> aProxy, std::unique_ptr<ProxyHash> aProxyHashPtr)
 {
+   // Cached auto-complete base types come from the proxy
+   mAutoCompleteServicePtr->Invalidate();
    Undo::Instance()->ClearProxyChanges();
 
    aProxy->SetProxyModifiedCallback(&proxyModifiedCallback);
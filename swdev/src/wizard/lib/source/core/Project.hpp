@@ -45,6 +45,7 @@ class WsfPProxyPath;
 namespace wizard
 {
 class AttributeSet;
+class AutoCompleteService;
 class CacheSourceProvider;
 class Editor;
 class ParseResults;
@@ -157,6 +158,7 @@ public:
    void                   ProxyReady(std::unique_ptr<WsfPProxy> aProxy, std::unique_ptr<ProxyHash> aProxyHashPtr);
    void                   ExportProjectAction();
    ParseWorker*           GetParseWorker() { return mParseWorker; }
+   AutoCompleteService&   GetAutoCompleteService() { return *mAutoCompleteServicePtr; }
    void                   InitParseResults();
    ParseCompleteCallback* ExecuteWhenParseComplete(ParseCompleteCallback* aCallbackPtr);
    const UtPath&          WorkingDirectory() const;
@@ -324,6 +326,8 @@ private:
 
    std::unique_ptr<TerrainMonitor> mTerrainMonitor{nullptr};
 
+   std::unique_ptr<AutoCompleteService> mAutoCompleteServicePtr;
+
    bool       mEpochListenerSetup{false};
    UtCalendar mEpoch;
 
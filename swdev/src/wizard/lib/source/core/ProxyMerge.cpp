@@ -12,6 +12,7 @@
 #include "ProxyMerge.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 #include "WsfPProxyBasicValue.hpp"
 #include "WsfPProxyList.hpp"
@@ -19,7 +20,18 @@
 #include "WsfPProxyStructValue.hpp"
 #include "WsfPProxyType.hpp"
 
-WsfPProxyHash wizard::ProxyHash::RecurseHash(ProxyHashNode*      aParentPtr,
+namespace
+{
+size_t DigestKey(const UtSHA_Digest& aDigest)
+{
+   static_assert(sizeof(UtSHA_Digest) >= sizeof(size_t), "The digest is shorter than its key");
+   size_t key;
+   std::memcpy(&key, &aDigest, sizeof(key));
+   return key;
+}
+} // namespace
+
+WsfPProxyHash wizard::ProxyHash::RecurseHash(Entries*            aParentEntriesPtr,
                                              const WsfPProxyKey& aValueAddr,
                                              WsfPProxyValue      aRootValue,
                                              bool                aIsParentStruct)
@@ -28,72 +40,73 @@ WsfPProxyHash wizard::ProxyHash::RecurseHash(ProxyHashNode*      aParentPtr,
    {
       return WsfPProxyHash();
    }
+
+   ProxyHashNode  node;
+   ProxyHashNode* valueNode = nullptr;
    switch (aRootValue.GetType()->mTypeKind)
    {
    case WsfProxy::cSTRUCT:
    {
-      UtSHA          structHash;
-      ProxyHashNode* valueNode;
-      if (aParentPtr)
-      {
-         valueNode = aParentPtr->Add(aValueAddr);
-      }
-      else
-      {
-         valueNode = &mRoot;
-      }
       WsfPProxyStructValue inst(aRootValue);
-      if (inst.IsUnset())
-      {
-         return WsfPProxyHash();
-      }
-      else
+      if (!inst.IsUnset())
       {
+         UtSHA        structHash;
          size_t       members = inst.GetMemberCount();
          WsfPProxyKey memberPath;
          for (size_t i = 0; i < members; ++i)
          {
             memberPath.SetIndex(i);
             WsfPProxyValue member     = inst.GetAtIndex(i);
-            WsfPProxyHash  hashResult = RecurseHash(valueNode, memberPath, member, true);
+            WsfPProxyHash  hashResult = RecurseHash(&node.mEntries, memberPath, member, true);
             hashResult.AddData(structHash);
          }
-         structHash.FinalDigest(valueNode->mDigest);
-         return valueNode->mDigest;
+         structHash.FinalDigest(node.mDigest);
       }
+      if (aParentEntriesPtr == nullptr)
+      {
+         mRoot     = std::move(node);
+         valueNode = &mRoot;
+      }
+      else
+      {
+         valueNode = Intern(std::move(node));
+         aParentEntriesPtr->push_back(ProxyHashNode::Entry{aValueAddr, valueNode});
+      }
+      if (inst.IsUnset())
+      {
+         return WsfPProxyHash();
+      }
+      return valueNode->mDigest;
    }
-   break;
    case WsfProxy::cLIST:
    {
       UtSHA          listHash;
-      ProxyHashNode* valueNode = aParentPtr->Add(aValueAddr);
       WsfPProxyKey   memberPath;
       WsfPProxyList* listPtr = aRootValue.GetList();
+      node.mEntries.reserve(listPtr->mValues.size());
       for (size_t i = 0; i < listPtr->mValues.size(); ++i)
       {
          memberPath.SetIndex(i);
-         RecurseHash(valueNode, memberPath, listPtr->Get(i), false).AddData(listHash);
+         RecurseHash(&node.mEntries, memberPath, listPtr->Get(i), false).AddData(listHash);
       }
-      listHash.FinalDigest(valueNode->mDigest);
-      return valueNode->mDigest;
+      listHash.FinalDigest(node.mDigest);
+      break;
    }
-   break;
    case WsfProxy::cOBJECT_MAP:
    {
       UtSHA               mapHash;
-      ProxyHashNode*      valueNode = aParentPtr->Add(aValueAddr);
       WsfPProxyKey        memberPath;
       WsfPProxyObjectMap* mapPtr = aRootValue.GetObjectMap();
+      node.mEntries.reserve(mapPtr->GetValues().size());
       for (auto iter = mapPtr->GetValues().begin(); iter != mapPtr->GetValues().end(); ++iter)
       {
          memberPath = iter->first;
          mapHash.AddData(iter->first.c_str(), iter->first.size());
-         RecurseHash(valueNode, memberPath, iter->second, false).AddData(mapHash);
+         RecurseHash(&node.mEntries, memberPath, iter->second, false).AddData(mapHash);
       }
-      mapHash.FinalDigest(valueNode->mDigest);
-      return valueNode->mDigest;
+      mapHash.FinalDigest(node.mDigest);
+      break;
    }
-   break;
    default:
       if (aIsParentStruct)
       {
@@ -101,16 +114,38 @@ WsfPProxyHash wizard::ProxyHash::RecurseHash(ProxyHashNode*      aParentPtr,
       }
       else
       {
-         ProxyHashNode* valueNode = aParentPtr->Add(aValueAddr);
-         UtSHA          sha;
+         UtSHA sha;
          aRootValue.Hash().AddData(sha);
-         sha.FinalDigest(valueNode->mDigest);
-         return valueNode->mDigest;
+         sha.FinalDigest(node.mDigest);
       }
+      break;
    }
-   return WsfPProxyHash();
+   valueNode = Intern(std::move(node));
+   aParentEntriesPtr->push_back(ProxyHashNode::Entry{aValueAddr, valueNode});
+   return valueNode->mDigest;
 }
 
+wizard::ProxyHashNode* wizard::ProxyHash::Intern(ProxyHashNode&& aNode)
+{
+   const size_t key   = DigestKey(aNode.mDigest);
+   auto         range = mInternedNodes.equal_range(key);
+   for (auto it = range.first; it != range.second; ++it)
+   {
+      if (it->second->IsSame(aNode))
+      {
+         return it->second;
+      }
+   }
+
+   if (aNode.mEntries.capacity() > aNode.mEntries.size())
+   {
+      aNode.mEntries.shrink_to_fit();
+   }
+   mNodes.push_back(std::move(aNode));
+   ProxyHashNode* nodePtr = &mNodes.back();
+   mInternedNodes.emplace(key, nodePtr);
+   return nodePtr;
+}
 
 wizard::ProxyHashNode* wizard::ProxyHash::Find(const WsfPProxyPath& aPath)
 {
@@ -129,6 +164,8 @@ wizard::ProxyHash::ProxyHash(WsfPProxyValue aRootValue)
    mRootValue = aRootValue;
    WsfPProxyKey nullEntry;
    RecurseHash(nullptr, nullEntry, aRootValue, false);
+   // The index is only needed to find equal nodes while hashing
+   std::unordered_multimap<size_t, ProxyHashNode*>().swap(mInternedNodes);
 }
 
 wizard::ProxyMerge::ProxyMerge(ProxyHash* aOldHash, ProxyHash* aNewHash, WsfPProxy* aOldProxy, WsfPProxy* aNewProxy)
@@ -326,21 +363,21 @@ void wizard::ProxyHashNode::Initialize()
    std::sort(mEntries.begin(), mEntries.end());
 }
 
-wizard::ProxyHashNode* wizard::ProxyHashNode::Add(const WsfPProxyKey& aAddr)
+bool wizard::ProxyHashNode::IsSame(const ProxyHashNode& aOther) const
 {
-   Entry e;
-   e.mAddr = aAddr;
-   e.mNode = new ProxyHashNode;
-   mEntries.push_back(e);
-   return e.mNode;
-}
-
-wizard::ProxyHashNode::~ProxyHashNode()
-{
-   for (auto&& it : mEntries)
+   if (mDigest != aOther.mDigest || mEntries.size() != aOther.mEntries.size())
+   {
+      return false;
+   }
+   for (size_t i = 0; i < mEntries.size(); ++i)
    {
-      delete it.mNode;
+      // Children are interned before their parents, so equal children are the same node
+      if (mEntries[i].mNode != aOther.mEntries[i].mNode || !(mEntries[i].mAddr == aOther.mEntries[i].mAddr))
+      {
+         return false;
+      }
    }
+   return true;
 }
 
 wizard::ProxyHashNode* wizard::ProxyHashNode::FindChild(const WsfPProxyKey& e)
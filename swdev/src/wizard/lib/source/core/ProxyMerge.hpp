@@ -12,7 +12,10 @@
 #ifndef PROXYMERGE_HPP
 #define PROXYMERGE_HPP
 
+#include <deque>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "UtMemoryPool.hpp"
 #include "UtSHA.hpp"
@@ -24,15 +27,15 @@ class WsfPProxy;
 
 namespace wizard
 {
+// Nodes are owned by the ProxyHash that built them. Identical subtrees of a ProxyHash are a single node,
+// so a node may be the child of several parents.
 class VI_EXPORT ProxyHashNode
 {
 public:
-   UtSHA_Digest mDigest;
-   ~ProxyHashNode();
+   UtSHA_Digest   mDigest;
    ProxyHashNode* FindChild(const WsfPProxyKey& e);
    // Initialize() Must be called prior to calling FindChild()
    void           Initialize();
-   ProxyHashNode* Add(const WsfPProxyKey& aAddr);
    struct Entry
    {
       bool operator<(const Entry& e) const { return mAddr < e.mAddr; }
@@ -43,7 +46,12 @@ public:
 
    const std::vector<Entry>& Children() { return mEntries; }
 
+   // Returns true if both nodes have the same digest and the same children
+   bool IsSame(const ProxyHashNode& aOther) const;
+
 private:
+   friend class ProxyHash;
+
    // Define a std::map with a memory pool allocator.  This provides a sorted container with contiguous memory.
    // typedef UtMemoryPoolAllocator<ProxyHashNode> NodeAllocator;
    // typedef std::map<WsfPProxyPathEntry, ProxyHashNode, std::less<WsfPProxyPathEntry>, NodeAllocator> NodeMap;
@@ -52,22 +60,41 @@ private:
    std::vector<Entry> mEntries;
 };
 
+// Hashes every struct, list and object map of a proxy, so that two proxies can be compared by ProxyMerge.
+// The nodes are hash-consed: subtrees with equal digests and equal children (e.g. the parts that platforms
+// share with their type) are stored once. The nodes are allocated from an arena, which is freed as a whole.
+// Only the hash is interned; the proxy values it hashes are not shared between parses.
 class ProxyHash
 {
 public:
    explicit ProxyHash(WsfPProxyValue aRootValue);
 
+   ProxyHash(const ProxyHash&) = delete;
+   ProxyHash& operator=(const ProxyHash&) = delete;
+
    ProxyHashNode* Find(const WsfPProxyPath& aPath);
    ProxyHashNode& Root() { return mRoot; }
    WsfPProxyValue RootValue() const { return mRootValue; }
 
+   // Returns the number of distinct nodes, excluding the root
+   size_t GetNodeCount() const { return mNodes.size(); }
+
 protected:
-   WsfPProxyHash  RecurseHash(ProxyHashNode*      aParentPtr,
-                              const WsfPProxyKey& aValueAddr,
-                              WsfPProxyValue      aRootValue,
-                              bool                aIsParentStruct);
-   ProxyHashNode  mRoot;
-   WsfPProxyValue mRootValue;
+   using Entries = std::vector<ProxyHashNode::Entry>;
+
+   // Hashes aRootValue and, unless it is a basic value of a struct, adds its node to aParentEntriesPtr.
+   // The root value is hashed into mRoot, with a null aParentEntriesPtr.
+   WsfPProxyHash RecurseHash(Entries*            aParentEntriesPtr,
+                             const WsfPProxyKey& aValueAddr,
+                             WsfPProxyValue      aRootValue,
+                             bool                aIsParentStruct);
+   // Returns the node equal to aNode, which is added to the arena if there is none yet
+   ProxyHashNode* Intern(ProxyHashNode&& aNode);
+
+   ProxyHashNode                                   mRoot;
+   WsfPProxyValue                                  mRootValue;
+   std::deque<ProxyHashNode>                       mNodes;
+   std::unordered_multimap<size_t, ProxyHashNode*> mInternedNodes; // by digest, only used while hashing
    UT_MEMORY_DEBUG_MARKER(cMDB_ProxyHash);
 };
 
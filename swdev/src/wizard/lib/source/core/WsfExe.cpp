@@ -12,6 +12,7 @@
 #include "WsfExe.hpp"
 
 // Qt
+#include <QFile>
 #include <QMessageBox>
 #include <QSettings>
 #include <QString>
@@ -21,6 +22,7 @@
 #include "UtProcess.hpp"
 
 // Application specific
+#include "ExeGrammarCache.hpp"
 #include "RunEnvManager.hpp"
 #include "Util.hpp"
 #include "WsfExeManager.hpp"
@@ -64,10 +66,21 @@ void wizard::WsfExe::Cleanup()
    mGivenScriptTypes.clear();
 }
 
-bool wizard::WsfExe::LoadFromDisk()
+bool wizard::WsfExe::LoadFromDisk(bool aUseCache)
 {
    if (Util::IsExecutable(mExePath))
    {
+      ExeGrammarCache::Output cachedOutput;
+      if (aUseCache && ExeGrammarCache::Load(mExePath, cachedOutput))
+      {
+         Cleanup();
+         mVersion     = cachedOutput.mVersion;
+         mApplication = cachedOutput.mApplication;
+         mGrammarText = cachedOutput.mGrammarText;
+         ReloadParseDefinitions();
+         return true;
+      }
+
       std::string tempFileName = Util::MakeTempFileName();
       // std::vector<std::string> args;
       // args.push_back("--ide-output");
@@ -113,8 +126,15 @@ bool wizard::WsfExe::LoadFromDisk()
                   currentBlock += '\n';
                }
             }
-            mParseDefinitions = std::shared_ptr<WsfParseDefinitions>();
-            GetParseDefinitions();
+            exeDataFile.close();
+            QFile::remove(QString::fromStdString(tempFileName));
+
+            ExeGrammarCache::Output output;
+            output.mVersion     = mVersion;
+            output.mApplication = mApplication;
+            output.mGrammarText = mGrammarText;
+            ExeGrammarCache::Store(mExePath, output);
+            ReloadParseDefinitions();
             return true;
          }
          else
@@ -141,13 +161,13 @@ bool wizard::WsfExe::IsLoaded() const
    return !mGrammarText.empty();
 }
 
-wizard::WsfExe* wizard::WsfExe::FromDisk(const UtPath& aExePath)
+wizard::WsfExe* wizard::WsfExe::FromDisk(const UtPath& aExePath, bool aUseCache)
 {
    WsfExe* exePtr = nullptr;
    if (Util::IsExecutable(aExePath))
    {
       exePtr = new WsfExe(aExePath);
-      if (!exePtr->LoadFromDisk())
+      if (!exePtr->LoadFromDisk(aUseCache))
       {
          delete exePtr;
          exePtr = nullptr;
@@ -204,11 +224,29 @@ void wizard::WsfExe::BuildProxyRegistry()
    regPtr->Setup(parseDefs->GetRootStruct(), parseDefs->mBasicTypes);
 }
 
+void wizard::WsfExe::ReloadParseDefinitions()
+{
+   // Hold on to the previous definitions until the new ones are found, an unchanged grammar is then not recompiled
+   std::shared_ptr<WsfParseDefinitions> previousDefinitions;
+   previousDefinitions.swap(mParseDefinitions);
+   GetParseDefinitions();
+}
+
 std::shared_ptr<WsfParseDefinitions> wizard::WsfExe::GetParseDefinitions()
 {
    // Check to see if pointer is empty
    if (!mParseDefinitions)
    {
+      // Executables reporting the same grammar (copies, or this executable before a refresh) share the definitions
+      mParseDefinitions = ExeGrammarCache::FindDefinitions(mGrammarText);
+      if (mParseDefinitions)
+      {
+         mGrammarVersion = GrammarVersion(mParseDefinitions->GetVersionString());
+         BuildProxyRegistry();
+         BeginBuildDoc();
+         return mParseDefinitions;
+      }
+
       // Create a new parse definition object
       mParseDefinitions = std::make_shared<WsfParseDefinitions>();
 
@@ -268,6 +306,10 @@ std::shared_ptr<WsfParseDefinitions> wizard::WsfExe::GetParseDefinitions()
       {
          mParseDefinitions = wizExeMgr.GetDefaultParseDefinitions();
       }
+      else
+      {
+         ExeGrammarCache::AddDefinitions(mGrammarText, mParseDefinitions);
+      }
 
       BuildProxyRegistry();
       BeginBuildDoc();
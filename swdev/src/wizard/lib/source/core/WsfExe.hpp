@@ -53,9 +53,11 @@ public:
    WsfExe& operator=(WsfExe&&) = default;
    virtual ~WsfExe();
 
-   bool                                  LoadFromDisk();
+   // Queries the executable for its version and grammar. Unless aUseCache is false, the output of a previous
+   // session is reused when neither the executable nor its plug-ins changed (see ExeGrammarCache)
+   bool                                  LoadFromDisk(bool aUseCache = true);
    bool                                  IsLoaded() const;
-   static WsfExe*                        FromDisk(const UtPath& aExePath);
+   static WsfExe*                        FromDisk(const UtPath& aExePath, bool aUseCache = true);
    const UtPath&                         GetPath() const { return mExePath; }
    const std::string&                    GetVersion() const { return mVersion; }
    const std::string&                    GetApplication() const { return mApplication; }
@@ -111,6 +113,7 @@ protected:
    void Cleanup();
    void ProcessData(const std::string& aBlockName, const std::string& aText);
    void BuildProxyRegistry();
+   void ReloadParseDefinitions();
 
    UtPath                               mExePath;
    std::string                          mVersion;
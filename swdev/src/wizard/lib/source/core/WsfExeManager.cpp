@@ -239,7 +239,7 @@ void wizard::WsfExeManager::Refresh()
    for (size_t i = 1; i < mExes.size(); ++i)
    {
       WsfExe* exePtr = mExes[i];
-      WsfExe* exe    = WsfExe::FromDisk(exePtr->GetPath());
+      WsfExe* exe    = WsfExe::FromDisk(exePtr->GetPath(), false);
       if (exe)
       {
          newExes.push_back(exe);
@@ -267,7 +267,7 @@ bool wizard::WsfExeManager::Refresh(WsfExe* aExePtr)
          WsfExeListUpdated();
          refreshed = true;
       }
-      else if (aExePtr->LoadFromDisk())
+      else if (aExePtr->LoadFromDisk(false))
       {
          WsfExeListUpdated();
          refreshed = true;
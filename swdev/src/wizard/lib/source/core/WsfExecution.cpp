@@ -13,8 +13,6 @@
 
 #include <cassert>
 
-#include <QTextBlock>
-#include <QTextCursor>
 #include <QUrl>
 #include <QUrlQuery>
 
@@ -31,20 +29,14 @@ wizard::WsfExecution::WsfExecution(QString aName, WsfExe* aExePtr, const UtPath&
 {
    setProcessChannelMode(MergedChannels);
 
-   mOutputText = QSharedPointer<QTextDocument>(new QTextDocument);
-   mDone       = false;
-   mExitStatus = NormalExit;
+   mOutputBufferPtr = std::make_shared<OutputBuffer>();
+   mDone            = false;
+   mExitStatus      = NormalExit;
 
    mWorkingDir = aWorkingDir;
    setWorkingDirectory(mWorkingDir.GetSystemPath().c_str());
    mExePtr    = aExePtr;
    mArguments = aArguments;
-   QFont font = mOutputText->defaultFont();
-   font.setFamily("Monospace");
-   font.setStyleHint(QFont::TypeWriter);
-   mOutputText->setDefaultFont(font);
-   mOutputText->setUndoRedoEnabled(false);
-   // mOutputText->setDefaultStyleSheet("white-space: pre");
 
    connect(this, &WsfExecution::readyReadStandardOutput, this, &WsfExecution::ReadyReadStandardOutput);
    connect(this, static_cast<void (WsfExecution::*)(int)>(&WsfExecution::finished), this, &WsfExecution::Finished);
@@ -98,20 +90,21 @@ void wizard::WsfExecution::Start(const std::vector<UtPath>& aStartupFiles)
 
    QString exePath = QString::fromStdString(mExePtr->GetPath().GetSystemPath());
    QString output  = QString("> " + exePath + " " + args.join(" ") + "\n");
-   emit    StandardOutputText(output);
+   mOutputBufferPtr->Append(output.toUtf8());
    start(exePath, args, QProcess::ReadOnly);
    mStarted = true;
 }
 
 void wizard::WsfExecution::ReadyReadStandardOutput()
 {
-   QString newText = readAllStandardOutput();
+   // The output is kept as bytes, it is only decoded for display
+   const QByteArray newText = readAllStandardOutput();
    if (!newText.isEmpty())
    {
-      emit StandardOutputText(newText);
+      mOutputBufferPtr->Append(newText);
       if (mOutputLog.isOpen())
       {
-         mOutputLog.write(newText.toUtf8());
+         mOutputLog.write(newText);
       }
    }
 }
@@ -122,6 +115,7 @@ void wizard::WsfExecution::Finished()
    {
       mDone = true;
       ReadyReadStandardOutput();
+      mOutputBufferPtr->Finish();
       if (mOutputLog.isOpen())
       {
          mOutputLog.close();
@@ -136,18 +130,6 @@ void wizard::WsfExecution::Finished()
    }
 }
 
-void wizard::WsfExecution::LimitOutputSize(QTextCursor* aCursorPtr)
-{
-   const int maxDocLines = 10000;
-   int       linesTooBig = aCursorPtr->document()->lineCount() - maxDocLines;
-   if (linesTooBig > 200) // seems to be expensive, only remove chunks at a time
-   {
-      aCursorPtr->movePosition(QTextCursor::Start);
-      aCursorPtr->movePosition(QTextCursor::Down, QTextCursor::KeepAnchor, linesTooBig);
-      aCursorPtr->removeSelectedText();
-   }
-}
-
 void wizard::WsfExecution::Kill()
 {
    mExitStatus = CrashExit;
@@ -156,6 +138,7 @@ void wizard::WsfExecution::Kill()
    {
       mDone = true;
       ReadyReadStandardOutput();
+      mOutputBufferPtr->Finish();
       emit Done();
       // Added disconnect statement here to prevent crash that occurs when std::out gets backlogged and the user hits
       // the Kill button.
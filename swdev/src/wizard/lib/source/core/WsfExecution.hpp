@@ -12,10 +12,12 @@
 #ifndef WSFEXECUTION_HPP
 #define WSFEXECUTION_HPP
 
+#include <memory>
+
 #include <QFile>
 #include <QProcess>
-#include <QTextDocument>
 
+#include "OutputBuffer.hpp"
 #include "UtPath.hpp"
 #include "ViExport.hpp"
 
@@ -29,8 +31,6 @@ class VI_EXPORT WsfExecution : public QProcess
    Q_OBJECT
 
 public:
-   QSharedPointer<QTextDocument> mOutputText;
-
    static WsfExecution* NewExecution(WsfExe*                    aExe,
                                      const UtPath&              aWorkingDir,
                                      const std::vector<UtPath>& aStartupFiles,
@@ -48,6 +48,8 @@ public:
    static std::string DebugSettingsString(int aPort);
    void               SetOutputLogPath(const QString& aPath);
    UtPath             GetWorkingDir() const { return mWorkingDir; }
+   //! The output of the application, which remains available after the execution is deleted
+   std::shared_ptr<OutputBuffer> GetOutputBuffer() const { return mOutputBufferPtr; }
 
    struct ConnectionParameters
    {
@@ -67,26 +69,25 @@ public:
 
 signals:
    void Done();
-   void StandardOutputText(const QString& aText);
 
 protected slots:
    void ReadyReadStandardOutput();
    void Finished();
 
 protected:
-   void LimitOutputSize(QTextCursor* aCursorPtr);
-   int  Exec();
+   int Exec();
 
-   QFile       mOutputLog;
-   UtPath      mWorkingDir;
-   WsfExe*     mExePtr;
-   QStringList mArguments;
-   QRegExp     mErrExp;
-   QRegExp     mInFileLineColExp;
-   QRegExp     mInFileEofExp;
-   bool        mDone;
-   bool        mStarted;
-   ExitStatus  mExitStatus;
+   std::shared_ptr<OutputBuffer> mOutputBufferPtr;
+   QFile                         mOutputLog;
+   UtPath                        mWorkingDir;
+   WsfExe*                       mExePtr;
+   QStringList                   mArguments;
+   QRegExp                       mErrExp;
+   QRegExp                       mInFileLineColExp;
+   QRegExp                       mInFileEofExp;
+   bool                          mDone;
+   bool                          mStarted;
+   ExitStatus                    mExitStatus;
 };
 } // namespace wizard
 
@@ -11,6 +11,7 @@
 
 #include "TextSource.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <stdio.h>
@@ -19,6 +20,7 @@
 #include <QClipboard>
 #include <QDataStream>
 #include <QDesktopServices>
+#include <QFile>
 #include <QFileDialog>
 #include <QMessageBox>
 #include <QTextDocument>
@@ -129,8 +131,9 @@ bool wizard::TextSource::CheckForFileModifications(bool aAlwaysFullyReload)
          }
          else
          {
-            // Allow loading of unmodified files without asking
-            allowLoad = true;
+            // Allow loading of unmodified files without asking.  Touching a file without changing it does not require
+            // a reload, which would also cause the project to be re-parsed.
+            allowLoad = aAlwaysFullyReload || !FileContentMatches();
          }
 
          if (allowLoad && mLoaded)
@@ -178,6 +181,20 @@ bool wizard::TextSource::CheckForFileModifications(bool aAlwaysFullyReload)
    return fileReloaded;
 }
 
+// Returns 'true' if the file on disk holds exactly the text in the document
+bool wizard::TextSource::FileContentMatches()
+{
+   QFile file(QString::fromStdString(mFilePath.GetSystemPath()));
+   if (!file.open(QIODevice::ReadOnly) || Size() == 0 || static_cast<size_t>(file.size()) != Size() - 1)
+   {
+      return false;
+   }
+   // Size() includes the null terminator
+   const QByteArray content = file.readAll();
+   return static_cast<size_t>(content.size()) == Size() - 1 &&
+          std::equal(content.constBegin(), content.constEnd(), GetPointer());
+}
+
 bool wizard::TextSource::ReadSource(bool aAlwaysFullyReload)
 {
    bool loaded(false);
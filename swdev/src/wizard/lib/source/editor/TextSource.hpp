@@ -138,6 +138,7 @@ public:
 
 private:
    void SaveAndStore();
+   bool FileContentMatches();
 
    void ApplyChangeToQt(const TextSourceChange& aChange, Editor& aEditor);
 
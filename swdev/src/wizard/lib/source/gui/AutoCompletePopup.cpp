@@ -22,6 +22,7 @@
 #include <QVBoxLayout>
 
 #include "AutoComplete.hpp"
+#include "AutoCompleteService.hpp"
 #include "BrowserWidget.hpp"
 #include "EditAssist.hpp"
 #include "EditorPrefObject.hpp"
@@ -55,6 +56,7 @@ wizard::AutoCompletePopup::AutoCompletePopup(QWidget*   aParentPtr,
    , //, Qt::WindowFlags(/*Qt::Tool |*/ Qt::FramelessWindowHint | /*Qt::CustomizeWindowHint |*/ Qt::WindowStaysOnTopHint)),
    mContextType(cNONE)
    , mNeedsUpdated(false)
+   , mSuggestionsPending(false)
    , mEditControlPtr(aEditControlPtr)
    , mCursorX(-1)
    , mCursorY(-1)
@@ -109,6 +111,11 @@ wizard::AutoCompletePopup::AutoCompletePopup(QWidget*   aParentPtr,
 
 wizard::AutoCompletePopup::~AutoCompletePopup()
 {
+   // The results are delivered to this popup, so they are no longer needed
+   if (mSuggestionsPending && Project::Instance())
+   {
+      Project::Instance()->GetAutoCompleteService().Cancel();
+   }
    delete mScriptLookupPtr;
    delete mUpdateCallbackPtr;
 }
@@ -250,74 +257,84 @@ void wizard::AutoCompletePopup::UpdateAutocompleteWSF()
       }
       mPreviousCommandPosition = con.mQueryTextRange.GetBegin();
 
-      size_t                pos = mCursorColumn + sourcePtr->GetSource()->GetLinePosition(mCursorLine);
-      AutoComplete          autoCompleter;
-      AutoComplete::Results acResults;
-      WsfParseNode*         tmpBlock;
-      tmpBlock              = con.mBlockNodePtr;
-      mReplaceRange         = con.mQueryTextRange;
-      size_t      insertPos = pos - mReplaceRange.GetBegin();
-      std::string queryText = GetLineText(mReplaceRange);
-      if (results)
-      {
-         autoCompleter.GetSuggestions(*results, *sourcePtr, tmpBlock, queryText, insertPos, acResults);
-      }
+      size_t pos    = mCursorColumn + sourcePtr->GetSource()->GetLinePosition(mCursorLine);
+      mReplaceRange = con.mQueryTextRange;
+
+      // Suggestions are computed on a worker thread so typing isn't delayed.
+      // Any request still running for the previous keystroke is cancelled.
+      AutoCompleteService::Request request;
+      request.mParseResultsPtr = results;
+      request.mSourcePtr       = sourcePtr;
+      request.mBlockNodePtr    = con.mBlockNodePtr;
+      request.mText            = GetLineText(mReplaceRange);
+      request.mInsertPosition  = pos - mReplaceRange.GetBegin();
+      mSuggestionsPending      = true;
+      projectPtr->GetAutoCompleteService().RequestSuggestions(request,
+                                                              [this](const AutoComplete::Results& aResults)
+                                                              {
+                                                                 mSuggestionsPending = false;
+                                                                 SetSuggestions(aResults);
+                                                              });
+   }
+   else
+   {
+      UpdateSize();
+      UpdateWindowPosition();
+   }
+   mNeedsUpdated = false;
+}
 
-      mInsertPosition           = acResults.mInsertPosition + mReplaceRange.GetBegin();
-      mReplaceCharacters        = acResults.mReplaceCharacters;
-      mSuggestionIsLastToken    = acResults.mLastToken;
-      mSuggestionIsPartialToken = acResults.mPartialToken;
-      mSuggestionListPtr->clear();
-      mCurrentSuggestions.clear();
-      QListWidgetItem items;
-      size_t          firstRealItem = 0;
-      mCurrentSuggestions           = acResults.mSuggestionList;
-      for (size_t i = 0; i < mCurrentSuggestions.size();)
+//! Fill the suggestion list with the results of an auto-complete request.
+void wizard::AutoCompletePopup::SetSuggestions(const AutoComplete::Results& aResults)
+{
+   mInsertPosition           = aResults.mInsertPosition + mReplaceRange.GetBegin();
+   mReplaceCharacters        = aResults.mReplaceCharacters;
+   mSuggestionIsLastToken    = aResults.mLastToken;
+   mSuggestionIsPartialToken = aResults.mPartialToken;
+   mSuggestionListPtr->clear();
+   mCurrentSuggestions.clear();
+   QListWidgetItem items;
+   size_t          firstRealItem = 0;
+   mCurrentSuggestions           = aResults.mSuggestionList;
+   for (size_t i = 0; i < mCurrentSuggestions.size();)
+   {
+      std::string suggestion = mCurrentSuggestions[i];
+      if (!suggestion.empty())
       {
-         std::string suggestion = mCurrentSuggestions[i];
-         if (!suggestion.empty())
+         bool canSelect = suggestion[0] != '<';
+         // don't select items that can't be inserted by default
+         if (!canSelect && i == firstRealItem)
          {
-            bool canSelect = suggestion[0] != '<';
-            // don't select items that can't be inserted by default
-            if (!canSelect && i == firstRealItem)
-            {
-               ++firstRealItem;
-            }
-            // a rare few WSF inputs DO have a leading '<', they will be escaped with \\  ...
-            if (suggestion[0] == '\\' && suggestion[1] == '<')
-            {
-               suggestion = suggestion.substr(1);
-            }
-            QListWidgetItem* itemPtr = new QListWidgetItem(QString::fromStdString(suggestion));
-            if (!canSelect)
-            {
-               QFont ifont = itemPtr->font();
-               ifont.setItalic(true);
-               itemPtr->setFont(ifont);
-            }
-            mSuggestionListPtr->addItem(itemPtr);
-            ++i;
+            ++firstRealItem;
          }
-         else
+         // a rare few WSF inputs DO have a leading '<', they will be escaped with \\  ...
+         if (suggestion[0] == '\\' && suggestion[1] == '<')
+         {
+            suggestion = suggestion.substr(1);
+         }
+         QListWidgetItem* itemPtr = new QListWidgetItem(QString::fromStdString(suggestion));
+         if (!canSelect)
          {
-            mCurrentSuggestions.erase(mCurrentSuggestions.begin() + i);
+            QFont ifont = itemPtr->font();
+            ifont.setItalic(true);
+            itemPtr->setFont(ifont);
          }
+         mSuggestionListPtr->addItem(itemPtr);
+         ++i;
       }
-      mSuggestionListPtr->SetCurrentRow((int)firstRealItem, 1);
-      FilterAutoCompleteList();
-
-      // If there are no suggestions then don't show then exit auto complete
-      if (mSuggestionListPtr->count() <= 1)
+      else
       {
-         mEditControlPtr->HideAutocomplete();
+         mCurrentSuggestions.erase(mCurrentSuggestions.begin() + i);
       }
    }
-   else
+   mSuggestionListPtr->SetCurrentRow((int)firstRealItem, 1);
+   FilterAutoCompleteList();
+
+   // If there are no suggestions then don't show then exit auto complete
+   if (mSuggestionListPtr->count() <= 1)
    {
-      UpdateSize();
-      UpdateWindowPosition();
+      mEditControlPtr->HideAutocomplete();
    }
-   mNeedsUpdated = false;
 }
 
 //! Intercepts key events that may be useful to the autocomplete popup.
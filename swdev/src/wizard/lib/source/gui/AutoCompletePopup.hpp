@@ -19,6 +19,7 @@
 #include <QTimer>
 #include <QWidget>
 
+#include "AutoComplete.hpp"
 #include "UtCallback.hpp"
 #include "UtCallbackHolder.hpp"
 #include "UtTextDocument.hpp"
@@ -94,6 +95,7 @@ private:
    std::string GetLineText(UtTextDocumentRange& aRange);
    bool        InsertSelection(QListWidgetItem* aItemPtr = nullptr);
    void        UpdateAutocompleteWSF();
+   void        SetSuggestions(const AutoComplete::Results& aResults);
 
    bool UpdateAutocompleteScript();
 
@@ -109,6 +111,7 @@ private:
 
    ContextType         mContextType;
    bool                mNeedsUpdated;
+   bool                mSuggestionsPending;
    size_t              mCursorLine;
    size_t              mCursorColumn;
    UtTextDocumentRange mReplaceRange;
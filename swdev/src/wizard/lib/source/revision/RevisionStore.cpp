@@ -90,6 +90,7 @@ bool wizard::RevisionStore::Open()
    RenameFallbackDb();
 
    const bool success = mRevDb.Open(mDbFile.GetSystemPath());
+   mFileStates.clear();
 
    if (success)
    {
@@ -111,6 +112,7 @@ bool wizard::RevisionStore::Open()
 //! @returns Whether or not the database was successfully opened.
 bool wizard::RevisionStore::OpenInMemory()
 {
+   mFileStates.clear();
    return mRevDb.OpenInMemory();
 }
 
@@ -119,6 +121,7 @@ bool wizard::RevisionStore::OpenInMemory()
 bool wizard::RevisionStore::Close()
 {
    const bool success = mRevDb.Close();
+   mFileStates.clear();
 
    if (success)
    {
@@ -381,6 +384,7 @@ bool wizard::RevisionStore::DeleteAllRevisions()
    if (success)
    {
       mBackupScheduled = false;
+      mFileStates.clear();
    }
 
    return success;
@@ -464,6 +468,18 @@ wizard::RevisionChange wizard::RevisionStore::AnalyzeFile(const UtTextDocument&
    UtTextDocument    oldRevision;
    int               revisionsTraversed;
 
+   FileState& state = mAnalyzedStates[relDocPath];
+   state.mHash      = Util::ComputeContentHash(aDoc.GetPointer(), aDoc.Size());
+   state.mSize      = aDoc.Size();
+
+   auto stateIter = mFileStates.find(relDocPath);
+   if ((revNo >= 1) && (stateIter != mFileStates.end()) && (stateIter->second.mRevision == revNo) &&
+       (stateIter->second.mHash == state.mHash) && (stateIter->second.mSize == state.mSize))
+   {
+      // The content is identical to the latest revision, there is no need to rebuild the file
+      return RevisionChange(RevisionChange::cNO_CHANGE, relDocPath);
+   }
+
    if ((revNo < 1) || !mRevDb.GetFileAtRevision(relDocPath, revNo, oldRevision, &revisionsTraversed))
    {
       change = RevisionChange(RevisionChange::cNEW_FILE, relDocPath, aDoc);
@@ -498,6 +514,7 @@ wizard::RevisionChangeList wizard::RevisionStore::GenerateFileChanges(const Revi
 {
    RevisionChangeList changes;
 
+   mAnalyzedStates.clear();
    for (auto&& qf : mQueuedFiles)
    {
       const UtTextDocument* doc    = qf.second;
@@ -572,9 +589,34 @@ bool wizard::RevisionStore::StoreNewRevision(const RevisionChangeList&       aCh
                                              const std::vector<std::string>& aStartupFiles)
 {
    const int newRevNo = mRevDb.StoreNewRevision(aChanges, aWorkingDir, aStartupFiles);
+   // When nothing changed, the analyzed files still match the latest revision
+   if ((newRevNo > 0) || aChanges.empty())
+   {
+      CommitFileStates(aChanges, mRevDb.LatestRevisionNo());
+   }
+   mAnalyzedStates.clear();
    return (newRevNo > 0);
 }
 
+//! Records the state of the analyzed files as their state at the latest revision.
+//! @param aChanges The list of changes that make up the revision.
+//! @param aRevNo The number of the latest revision.
+void wizard::RevisionStore::CommitFileStates(const RevisionChangeList& aChanges, int aRevNo)
+{
+   for (auto&& state : mAnalyzedStates)
+   {
+      mFileStates[state.first]           = state.second;
+      mFileStates[state.first].mRevision = aRevNo;
+   }
+   for (auto&& change : aChanges)
+   {
+      if (change.kind == RevisionChange::cREMOVED_FILE)
+      {
+         mFileStates.erase(change.filePath);
+      }
+   }
+}
+
 //! The database file name is now based on the project name. If we cannot find a
 //! database based on the project name, then we will check for a legacy/fallback
 //! database file and rename it.
@@ -20,6 +20,7 @@
 #include "RevisionDb.hpp"
 #include "UtCallbackHolder.hpp"
 #include "UtPath.hpp"
+#include "Util.hpp"
 #include "ViExport.hpp"
 
 class QStringList;
@@ -90,6 +91,17 @@ private:
    std::string    RelativeDocPath(const UtTextDocument& aDoc) const;
    RevisionChange AnalyzeFile(const UtTextDocument& aDoc);
    bool           AnalyzeAddedRemovedFiles(RevisionPathSet& aRemovedPaths);
+   void           CommitFileStates(const RevisionChangeList& aChanges, int aRevNo);
+
+   //! The content hash of a file at a revision, which allows unchanged files to be analyzed without rebuilding them
+   //! from the database
+   struct FileState
+   {
+      Util::ContentHash mHash;
+      size_t            mSize;
+      int               mRevision; //!< The revision the hash describes
+   };
+   using FileStateMap = std::map<std::string, FileState>;
 
    UtPath              mDbDir;
    UtPath              mDbFile;
@@ -99,6 +111,8 @@ private:
    UtCallbackHolder    mCallbacks;
    RevisionDb          mRevDb;
    RevisionFileMap     mQueuedFiles;
+   FileStateMap        mFileStates;
+   FileStateMap        mAnalyzedStates;
    bool                mBackupScheduled;
    QTimer*             mAutoBackupTimer;
    WsfPProxy*          mProxy;
@@ -0,0 +1,115 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include <cstring>
+#include <string>
+
+#include <QObject>
+#include <QtTest/QTest>
+
+#include "RevisionStore.hpp"
+#include "UtTextDocument.hpp"
+#include "Util.hpp"
+
+namespace
+{
+// Exposes the analysis of queued files, which is normally triggered by the project
+class ExposedRevisionStore : public wizard::RevisionStore
+{
+public:
+   using RevisionStore::GenerateFileChanges;
+   using RevisionStore::StoreNewRevision;
+};
+} // namespace
+
+class TestRevisionStore : public QObject
+{
+   Q_OBJECT
+
+private slots:
+   void initTestCase() {}    // Called before the first test function is executed.
+   void init() {}            // Called before each test function is executed.
+   void cleanup() {}         // Called after every test function.
+   void cleanupTestCase() {} // Called after the last test function is executed.
+
+   void testContentHash();
+   void testRevisionBackup();
+};
+
+// Tests that the content hash tells different content apart.
+void TestRevisionStore::testContentHash()
+{
+   const std::string text("Hello World\nI am a file\n");
+   const std::string other("Hello World\nI am another file\n");
+
+   QCOMPARE(wizard::Util::ComputeContentHash(text.c_str(), text.size()),
+            wizard::Util::ComputeContentHash(std::string(text).c_str(), text.size()));
+   QVERIFY(wizard::Util::ComputeContentHash(text.c_str(), text.size()) !=
+           wizard::Util::ComputeContentHash(other.c_str(), other.size()));
+   // A prefix of the content is different content
+   QVERIFY(wizard::Util::ComputeContentHash(text.c_str(), text.size()) !=
+           wizard::Util::ComputeContentHash(text.c_str(), text.size() - 1));
+}
+
+// Tests backing up files that did and did not change since the latest revision.
+void TestRevisionStore::testRevisionBackup()
+{
+   UtTextDocument           doc;
+   const std::string        text("Hello World\nI am a file\nThis is the last line\n");
+   const std::string        workingDir = "myDir";
+   std::vector<std::string> startupFiles(1, "myFile");
+
+   ExposedRevisionStore store;
+   QVERIFY(store.OpenInMemory());
+
+   doc.Insert(0, text.c_str(), text.size() + 1);
+   store.QueueFile(&doc);
+   wizard::RevisionChangeList changes = store.GenerateFileChanges();
+   QCOMPARE(changes.size(), size_t(1));
+   QCOMPARE(changes[0].kind, wizard::RevisionChange::cNEW_FILE);
+   QVERIFY(store.StoreNewRevision(changes, workingDir, startupFiles));
+
+   // The file is unchanged, so there is nothing to back up
+   store.QueueFile(&doc);
+   changes = store.GenerateFileChanges();
+   QVERIFY(changes.empty());
+   QVERIFY(!store.StoreNewRevision(changes, workingDir, startupFiles));
+
+   // Changed files are stored as the difference from the latest revision
+   doc.Erase(10, 8);
+   store.QueueFile(&doc);
+   changes = store.GenerateFileChanges();
+   QCOMPARE(changes.size(), size_t(1));
+   QCOMPARE(changes[0].kind, wizard::RevisionChange::cCHANGE_DELTA);
+   QVERIFY(store.StoreNewRevision(changes, workingDir, startupFiles));
+
+   store.QueueFile(&doc);
+   QVERIFY(store.GenerateFileChanges().empty());
+
+   // Restoring the original content is a change from the latest revision
+   doc.Insert(10, text.c_str() + 10, 8);
+   store.QueueFile(&doc);
+   changes = store.GenerateFileChanges();
+   QCOMPARE(changes.size(), size_t(1));
+   QCOMPARE(changes[0].kind, wizard::RevisionChange::cCHANGE_DELTA);
+   QVERIFY(store.StoreNewRevision(changes, workingDir, startupFiles));
+
+   // The stored revisions rebuild the current content
+   UtTextDocument latest;
+   QVERIFY(store.DB().GetFileAtRevision(changes[0].filePath, store.DB().LatestRevisionNo(), latest));
+   QCOMPARE(latest.Size(), doc.Size());
+   QVERIFY(std::memcmp(latest.GetPointer(), doc.GetPointer(), doc.Size()) == 0);
+
+   QVERIFY(store.Close());
+}
+
+QTEST_APPLESS_MAIN(TestRevisionStore)
+#include "moc/TestRevisionStore.moc"
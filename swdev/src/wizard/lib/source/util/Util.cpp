@@ -495,6 +495,20 @@ QRegExp wizard::Util::SimpleRegex(const QString& aText)
    return QRegExp(regexStr, Qt::CaseInsensitive);
 }
 
+wizard::Util::ContentHash wizard::Util::ComputeContentHash(const char* aDataPtr, size_t aSize)
+{
+   const ContentHash cFNV_OFFSET_BASIS = 14695981039346656037ULL;
+   const ContentHash cFNV_PRIME        = 1099511628211ULL;
+
+   ContentHash hash = cFNV_OFFSET_BASIS;
+   for (size_t i = 0; i < aSize; ++i)
+   {
+      hash ^= static_cast<unsigned char>(aDataPtr[i]);
+      hash *= cFNV_PRIME;
+   }
+   return hash;
+}
+
 QString wizard::Util::BuildFileLineColURL(const QString& aFilePath, int aLine, int aColumn, const QString& aLabel)
 {
    QString lbl = aLabel;
@@ -12,6 +12,7 @@
 #define UTIL_HPP
 
 #include <algorithm>
+#include <cstdint>
 #include <iosfwd>
 #include <set>
 #include <string>
@@ -82,6 +83,8 @@ struct UtilCStringCompare
 class VI_EXPORT Util
 {
 public:
+   using ContentHash = uint64_t;
+
    static bool        IsExecutable(const UtPath& aExePath);
    static QStringList SplitCommandLine(const QString& aCommandLine, const QMap<QString, QString>& aVariables);
 
@@ -100,6 +103,9 @@ public:
 
    static void EscapeForCSV(std::string& aText);
 
+   //! Computes the hash used to identify file content (64-bit FNV-1a)
+   static ContentHash ComputeContentHash(const char* aDataPtr, size_t aSize);
+
    static QString BuildFileLineColURL(const QString& aFilePath, int aLine, int aColumn = 0, const QString& aLabel = QString());
 
    static QString BuildHRef(const QString& aUrl, const QString& aLabel);
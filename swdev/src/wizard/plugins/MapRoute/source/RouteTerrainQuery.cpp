@@ -11,7 +11,9 @@
 
 #include "RouteTerrainQuery.hpp"
 
-#include <QTimer>
+#include <cmath>
+#include <list>
+#include <set>
 
 #include "Environment.hpp"
 #include "ProxyWatcher.hpp"
@@ -20,83 +22,210 @@
 namespace
 {
 const int cINTERVAL = 100;
+
+//! The elevations are cached per cell of one arc-second, the resolution of the finest terrain (DTED level 2)
+const double cCELLS_PER_DEGREE = 3600.0;
+//! The cells are grouped in tiles of a tenth of a degree, which are evicted as a whole
+const int cCELLS_PER_TILE = 360;
+//! The most elevations the cache holds before it evicts the least recently used tiles
+const size_t cMAX_ELEVATIONS = 100000;
+
+//! The elevations found for all routes, so routes sharing waypoints or legs do not query the terrain again.
+//! The cells of the terrain a route crosses are usually in a few tiles, so the tiles are kept in the order of their
+//! use, and the least recently used tiles are evicted when the cache is full.
+class ElevationCache
+{
+public:
+   using Cell = MapRoute::RouteTerrainQuery::Cell;
+
+   bool Find(const Cell& aCell, double& aElevation)
+   {
+      auto tileIter = mTileIndex.find(TileOf(aCell));
+      if (tileIter == mTileIndex.end())
+      {
+         return false;
+      }
+      auto elevationIter = tileIter->second->mElevations.find(aCell);
+      if (elevationIter == tileIter->second->mElevations.end())
+      {
+         return false;
+      }
+      mTiles.splice(mTiles.begin(), mTiles, tileIter->second);
+      aElevation = elevationIter->second;
+      return true;
+   }
+
+   void Insert(const Cell& aCell, double aElevation)
+   {
+      const Cell tileKey  = TileOf(aCell);
+      auto       tileIter = mTileIndex.find(tileKey);
+      if (tileIter == mTileIndex.end())
+      {
+         mTiles.push_front(Tile{tileKey, {}});
+         tileIter = mTileIndex.emplace(tileKey, mTiles.begin()).first;
+      }
+      else
+      {
+         mTiles.splice(mTiles.begin(), mTiles, tileIter->second);
+      }
+      if (mTiles.front().mElevations.emplace(aCell, aElevation).second)
+      {
+         ++mSize;
+      }
+      // The tile just used is never evicted
+      while (mSize > cMAX_ELEVATIONS && mTiles.size() > 1)
+      {
+         mSize -= mTiles.back().mElevations.size();
+         mTileIndex.erase(mTiles.back().mKey);
+         mTiles.pop_back();
+      }
+   }
+
+   void Clear()
+   {
+      mTiles.clear();
+      mTileIndex.clear();
+      mSize = 0;
+   }
+
+private:
+   struct Tile
+   {
+      Cell                   mKey;
+      std::map<Cell, double> mElevations;
+   };
+
+   static int FloorDivide(int aValue, int aDivisor)
+   {
+      return (aValue >= 0) ? (aValue / aDivisor) : -((-aValue + aDivisor - 1) / aDivisor);
+   }
+
+   static Cell TileOf(const Cell& aCell)
+   {
+      return Cell{FloorDivide(aCell.first, cCELLS_PER_TILE), FloorDivide(aCell.second, cCELLS_PER_TILE)};
+   }
+
+   std::list<Tile>                           mTiles; //!< The most recently used tile is first
+   std::map<Cell, std::list<Tile>::iterator> mTileIndex;
+   size_t                                    mSize{0};
+};
+
+ElevationCache sElevationCache;
+
+//! The terrain queries of all routes, whose requests are dropped with the cache when the terrain changes
+std::set<MapRoute::RouteTerrainQuery*> sQueries;
+} // namespace
+
+MapRoute::RouteTerrainQuery::RouteTerrainQuery()
+{
+   mPollTimer.setInterval(cINTERVAL);
+   QObject::connect(&mPollTimer, &QTimer::timeout, [this]() { PollRequests(); });
+   sQueries.insert(this);
+}
+
+MapRoute::RouteTerrainQuery::~RouteTerrainQuery()
+{
+   sQueries.erase(this);
+   DropRequests();
 }
 
 double MapRoute::RouteTerrainQuery::GetElevationData(double aLat, double aLon)
 {
-   // Make sure the clean-up method is attached to the wizard::ProxyWatcher
+   WatchTerrain();
+   double elevation = 0.0;
+   FindElevation(LatLon{aLat, aLon}, elevation);
+   return elevation;
+}
+
+void MapRoute::RouteTerrainQuery::WatchTerrain()
+{
    if (mCallbacks.Empty())
    {
       WsfPM_Root    proxyRoot(wizard::ProxyWatcher::GetActiveProxy());
       WsfPProxyNode terrainNode = proxyRoot + "terrain";
-      auto          pathStr     = terrainNode.GetPathString();
       mCallbacks.Add(
          wizard::WatchProxy(terrainNode.GetPath()).AnyUpdate.Connect(&RouteTerrainQuery::TerrainProxyModified, this));
    }
-   // Check for the elevation/ground level in the cache
-   std::pair<double, double> latLonPair{aLat, aLon};
-   auto                      cacheIter = mWaypointCache.find(latLonPair);
-   if (cacheIter != mWaypointCache.end())
-   {
-      return cacheIter->second;
-   }
+}
 
-   // Check for a current request for this lat/lon
-   size_t requestId;
-   auto   requestIter = mWaypointRequestCache.find(latLonPair);
-   if (requestIter != mWaypointRequestCache.end())
+MapRoute::RouteTerrainQuery::Cell MapRoute::RouteTerrainQuery::ToCell(const LatLon& aLatLon)
+{
+   return Cell{static_cast<int>(std::floor(aLatLon.first * cCELLS_PER_DEGREE)),
+               static_cast<int>(std::floor(aLatLon.second * cCELLS_PER_DEGREE))};
+}
+
+bool MapRoute::RouteTerrainQuery::FindElevation(const LatLon& aLatLon, double& aElevation)
+{
+   aElevation = 0.0;
+   // Check for the elevation/ground level in the cache
+   const Cell cell = ToCell(aLatLon);
+   if (sElevationCache.Find(cell, aElevation))
    {
-      requestId = requestIter->second;
+      return true;
    }
-   else
+   // Check for a current request for this cell
+   if (mRequestIds.count(cell) != 0)
    {
-      requestId                         = wkfEnv.GetResourceManager().Register();
-      mWaypointRequestCache[latLonPair] = requestId;
+      return false;
    }
 
    // Kick off the acquisition of the elevation/ground level from the wkf::ResourceManager.
-   // This will periodically poll the wkf::ResourceManager for the data.
-   // Once the wkf::ResourceManger has the data, store the data in the cache.
-   // Future requests will get the data from the cache, rather than the wkf::ResourceManager.
-   float elevationResult = 0;
-   if (!wkfEnv.GetResourceManager().QueryElevation(requestId, aLat, aLon, elevationResult))
-   {
-      wkfEnv.GetResourceManager().ElevationRequest(requestId, latLonPair);
-      QTimer::singleShot(cINTERVAL, [this, requestId]() { DelayedRouteUpdate(requestId); });
-      elevationResult = 0;
+   // The outstanding requests are polled together, and once the wkf::ResourceManager has the data, it is stored in
+   // the cache.  Future requests will get the data from the cache, rather than the wkf::ResourceManager.
+   size_t requestId       = wkfEnv.GetResourceManager().Register();
+   float  elevationResult = 0;
+   if (wkfEnv.GetResourceManager().QueryElevation(requestId, aLatLon.first, aLatLon.second, elevationResult))
+   {
+      wkfEnv.GetResourceManager().ReleaseRequests(requestId);
+      sElevationCache.Insert(cell, elevationResult);
+      aElevation = elevationResult;
+      return true;
    }
-   else
+   wkfEnv.GetResourceManager().ElevationRequest(requestId, aLatLon);
+   mRequests[requestId] = cell;
+   mRequestIds[cell]    = requestId;
+   if (!mPollTimer.isActive())
    {
-      mWaypointCache[latLonPair] = elevationResult;
+      mPollTimer.start();
    }
-
-   return elevationResult;
+   return false;
 }
 
-void MapRoute::RouteTerrainQuery::DelayedRouteUpdate(size_t aId)
+void MapRoute::RouteTerrainQuery::PollRequests()
 {
-   std::pair<float, bool> elevationResult;
-   if (wkfEnv.GetResourceManager().ElevationResult(aId, elevationResult))
+   for (auto it = mRequests.begin(); it != mRequests.end();)
    {
+      std::pair<float, bool> elevationResult;
+      if (!wkfEnv.GetResourceManager().ElevationResult(it->first, elevationResult))
+      {
+         // The request is unknown to the wkf::ResourceManager, so it will never complete
+         wkfEnv.GetResourceManager().ReleaseRequests(it->first);
+         mRequestIds.erase(it->second);
+         it = mRequests.erase(it);
+      }
       // The result is still being processed.
-      if (!elevationResult.second)
+      else if (!elevationResult.second)
       {
-         QTimer::singleShot(cINTERVAL, [this, aId]() { DelayedRouteUpdate(aId); });
+         ++it;
       }
       // The result is successfully calculated and stored off.
       else
       {
-         // Search the mWaypointRequestCache to find the request and its lat/lon.
-         // Using that lat/lon, add the found elevation/ground level to mWaypointCache.
-         for (const auto& curRequest : mWaypointRequestCache)
-         {
-            if (curRequest.second == aId)
-            {
-               std::pair<double, double> latLonPair = curRequest.first;
-               mWaypointCache[latLonPair]           = elevationResult.first;
-               break;
-            }
-         }
+         sElevationCache.Insert(it->second, elevationResult.first);
+         mBatchUpdated = true;
+         wkfEnv.GetResourceManager().ReleaseRequests(it->first);
+         mRequestIds.erase(it->second);
+         it = mRequests.erase(it);
+      }
+   }
+
+   // Update the route once for the whole batch, rather than once per point
+   if (mRequests.empty())
+   {
+      mPollTimer.stop();
+      if (mBatchUpdated)
+      {
+         mBatchUpdated = false;
          wizEnv.PlatformUpdated(mPlatformName);
       }
    }
@@ -116,7 +245,23 @@ double MapRoute::RouteTerrainQuery::GetWaypointAltitude(const WsfPM_Waypoint& aW
 
 void MapRoute::RouteTerrainQuery::TerrainProxyModified(const wizard::ProxyChange& aProxyChange)
 {
-   // The terrain block changed, so clear the caches
-   mWaypointCache.clear();
-   mWaypointRequestCache.clear();
+   // The terrain block changed, so clear the cache shared by the routes and drop the outstanding requests of every
+   // route, which would otherwise store elevations of the old terrain in the cache
+   sElevationCache.Clear();
+   for (auto* query : sQueries)
+   {
+      query->DropRequests();
+   }
+}
+
+void MapRoute::RouteTerrainQuery::DropRequests()
+{
+   for (const auto& request : mRequests)
+   {
+      wkfEnv.GetResourceManager().ReleaseRequests(request.first);
+   }
+   mRequests.clear();
+   mRequestIds.clear();
+   mBatchUpdated = false;
+   mPollTimer.stop();
 }
@@ -11,7 +11,12 @@
 #ifndef ROUTETERRAINQUERY_HPP
 #define ROUTETERRAINQUERY_HPP
 
+#include <map>
+#include <unordered_map>
+#include <utility>
+
 #include <QString>
+#include <QTimer>
 
 #include "UtCallbackHolder.hpp"
 #include "UtMemory.hpp"
@@ -27,10 +32,20 @@ namespace MapRoute
 class RouteTerrainQuery
 {
 public:
+   //! A latitude and longitude
+   using LatLon = std::pair<double, double>;
+   //! The indices of the terrain cell of a latitude and longitude, within which the elevation is cached once
+   using Cell = std::pair<int, int>;
+
+   RouteTerrainQuery();
+   ~RouteTerrainQuery();
+
    //! Queries the wkf::ResourceManager for the elevation data at the given latitude and longitude
    //! @param aLat is the given latitude
    //! @param aLon is the given longitude
-   //! @return the elevation at the given latitude and longitude
+   //! @return the elevation at the given latitude and longitude, or zero if it is not available yet
+   //! @note Elevations that are not available yet are requested as part of one batch.  The platform is updated once,
+   //!       when the whole batch is available.
    double GetElevationData(double aLat, double aLon);
 
    //! Gets the waypoint's altitude
@@ -40,7 +55,8 @@ public:
    //! @note AGL altitude = ground level + MSL altitude
    double GetWaypointAltitude(const WsfPM_Waypoint& aWaypoint);
 
-   //! This will get called when the terrain is modified via the proxy
+   //! This will get called when the terrain is modified via the proxy.  The elevations cached for all routes are
+   //! cleared, and the outstanding requests of all routes are dropped.
    //! @param aProxyChange a change recorded by the proxy
    void TerrainProxyModified(const wizard::ProxyChange& aProxyChange);
 
@@ -49,17 +65,36 @@ public:
    void SetPlatformName(const QString& aPlatformName) { mPlatformName = aPlatformName; }
 
 private:
-   //! Handler for querying the wkf::ResourceManager at periodic intervals to see if the terrain data for a route is ready
-   //! @param aDtedId is the terrain request ID of the local route's waypoint
-   void DelayedRouteUpdate(size_t aId);
+   //! Make sure the clean-up method is attached to the wizard::ProxyWatcher
+   void WatchTerrain();
+
+   //! Returns the terrain cell of the given latitude and longitude
+   static Cell ToCell(const LatLon& aLatLon);
+
+   //! Gets the elevation at the given latitude and longitude from the cache, or adds a request for it to the batch
+   //! @param aLatLon is the given latitude and longitude
+   //! @param aElevation is the elevation, or zero if it is not available yet
+   //! @return whether the elevation is available
+   bool FindElevation(const LatLon& aLatLon, double& aElevation);
+
+   //! Releases the outstanding requests of the route and stops polling them
+   void DropRequests();
+
+   //! Handler for querying the wkf::ResourceManager at periodic intervals to see if the terrain data for the batch is
+   //! ready.  The platform is updated once all requests of the batch completed.
+   void PollRequests();
 
    //! name of the platform associated with this route.  If it's a global route, the name should have '_anchor' at the end.
    QString mPlatformName{""};
 
-   //! Keep a cache of found elevations for faster retrieval on route rebuilds
-   std::map<std::pair<double, double>, double> mWaypointCache;
-   //! Keep a cache of requestIds to prevent multiple requests for the same lat/lon
-   std::map<std::pair<double, double>, size_t> mWaypointRequestCache;
+   //! The cells of the outstanding requests, by request ID
+   std::unordered_map<size_t, Cell> mRequests;
+   //! The outstanding request IDs, by cell, to prevent multiple requests for the same cell
+   std::map<Cell, size_t> mRequestIds;
+   //! Whether an elevation of the current batch arrived
+   bool mBatchUpdated{false};
+   //! Polls the outstanding requests
+   QTimer mPollTimer;
 
    UtCallbackHolder mCallbacks;
 };
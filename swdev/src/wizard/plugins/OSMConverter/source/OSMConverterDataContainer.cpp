@@ -11,9 +11,13 @@
 
 #include "OSMConverterDataContainer.hpp"
 
+#include <algorithm>
+#include <cmath>
+
+#include <QFile>
 #include <QString>
+#include <QXmlStreamReader>
 
-#include "tinyxml2.h"
 #include "ui_OSMConverterDialog.h"
 
 namespace
@@ -26,153 +30,385 @@ const std::unordered_map<int, QString> valueStrings{
    {static_cast<int>(OSMConverterDataContainer::ValueType::cSTRING), "string "},
    {static_cast<int>(OSMConverterDataContainer::ValueType::cUNITARY), "unitary "}};
 
+const QString cREAD_ERROR = "Could not read the provided file. Please the make sure that the file is valid osm/xml.";
+
+using FilterData = OSMConverterDataContainer::FilterData;
+
+// Returns the filter matching the tag (or attribute) aKey with aValue
+std::vector<FilterData>::const_iterator FindFilter(const std::vector<FilterData>& aFilters,
+                                                   const QString&                 aKey,
+                                                   const QString&                 aValue)
+{
+   return std::find_if(aFilters.begin(),
+                       aFilters.end(),
+                       [&aKey, &aValue](const FilterData& aTagData)
+                       {
+                          if (!aTagData.mValue.isEmpty() && !aValue.isEmpty())
+                          {
+                             return aTagData.mTagKey == aKey && aTagData.mValue == aValue;
+                          }
+                          return aTagData.mTagKey == aKey && aTagData.mValue.isEmpty();
+                       });
 }
 
-QString OSMConverterDataContainer::ParseFile(const QString& aFileName)
+// Formats the magnitude of a latitude or longitude the way OSM writes it, with at most 7 decimals
+QString FormatAngle(double aAngle)
 {
-   mNodeMap.clear();
-   mWayMap.clear();
-   tinyxml2::XMLDocument osmDocument;
-   if (osmDocument.LoadFile(qPrintable(aFileName)) == 0)
+   QString text = QString::number(std::abs(aAngle), 'f', 7);
+   while (text.endsWith('0'))
+   {
+      text.chop(1);
+   }
+   if (text.endsWith('.'))
+   {
+      text.chop(1);
+   }
+   return text;
+}
+
+} // namespace
+
+constexpr size_t OSMConverterDataContainer::cNO_DATA;
+
+QString OSMConverterDataContainer::ParseFile(const QString&                 aFileName,
+                                             const ReadFilter&              aReadFilter,
+                                             const std::vector<FilterData>& aNodeTagFilter,
+                                             const std::vector<FilterData>& aWayTagFilter)
+{
+   mWays.clear();
+   mNodes.clear();
+   mNodeData.clear();
+
+   QFile osmFile(aFileName);
+   if (!osmFile.open(QIODevice::ReadOnly))
+   {
+      return cREAD_ERROR;
+   }
+
+   // The file is streamed twice, first for the ways, then for only the nodes that the ways read reference.
+   // The bounding box is applied while the nodes are read.  Nothing else is held in memory.
+   QString errorMessage = ReadWays(osmFile, aReadFilter, aWayTagFilter);
+   if (errorMessage.isEmpty())
    {
-      tinyxml2::XMLElement* root = osmDocument.FirstChildElement("osm");
-      if (root)
+      IndexNodes();
+      osmFile.reset();
+      errorMessage = ReadNodes(osmFile, aReadFilter, aNodeTagFilter);
+   }
+   if (errorMessage.isEmpty())
+   {
+      ApplyBoundingBox(aReadFilter);
+   }
+   else
+   {
+      mWays.clear();
+      mNodes.clear();
+      mNodeData.clear();
+   }
+   return errorMessage;
+}
+
+QString OSMConverterDataContainer::ReadWays(QIODevice&                     aDevice,
+                                            const ReadFilter&              aReadFilter,
+                                            const std::vector<FilterData>& aWayTagFilter)
+{
+   QXmlStreamReader                reader(&aDevice);
+   std::vector<unsigned long long> wayIds; // used to find duplicates
+   std::unordered_set<QString>     keys;   // used to find duplicates within a way
+   if (reader.readNextStartElement() && reader.name() == QLatin1String("osm"))
+   {
+      while (reader.readNextStartElement())
       {
-         // Iterate through all nodes
-         for (tinyxml2::XMLElement* node = root->FirstChildElement("node"); node != nullptr;
-              node                       = node->NextSiblingElement("node"))
+         if (reader.name() != QLatin1String("way"))
+         {
+            reader.skipCurrentElement();
+            continue;
+         }
+
+         // Get the Way id attribute
+         const QXmlStreamAttributes attributes = reader.attributes();
+         const QString              wayID      = attributes.value("id").toString();
+         if (wayID.isEmpty())
+         {
+            return ("Please make sure that all ways have an \"id\" attribute.");
+         }
+         wayIds.push_back(wayID.toULongLong());
+
+         OSMWayData wayData;
+         bool       keepWay = aReadFilter.mWayTagKeys.isEmpty();
+         keys.clear();
+         for (const QXmlStreamAttribute& attribute : attributes)
+         {
+            const QString key   = attribute.name().toString();
+            const QString value = attribute.value().toString();
+            keys.insert(key);
+            if (FindFilter(aWayTagFilter, key, value) != aWayTagFilter.end())
+            {
+               wayData.mData.emplace(key, value);
+            }
+         }
+
+         while (reader.readNextStartElement())
          {
-            // Get the Node id attribute, QString already seems to perform safety checks, no need for separate cases
-            QString nodeID = QString::fromUtf8(node->Attribute("id"));
-            if (!nodeID.isEmpty())
+            const QXmlStreamAttributes childAttributes = reader.attributes();
+            if (reader.name() == QLatin1String("nd"))
             {
-               unsigned long long mapKey = nodeID.toULongLong();
-               if (mNodeMap.find(mapKey) != mNodeMap.end())
+               const QStringRef referenceID = childAttributes.value("ref");
+               if (!referenceID.isEmpty())
                {
-                  return ("Please make sure there are no duplicate node ids. The id " + QString::number(mapKey) +
-                          " may have already been used.");
+                  wayData.mNodeRefIdList.emplace_back(referenceID.toULongLong());
                }
-
-               std::unordered_map<QString, QString> mapValues;
-               // store all attributes, valid xml will always have a legal attribute name, but the value can be null or empty
-               for (const tinyxml2::XMLAttribute* attribute = node->FirstAttribute(); attribute != nullptr;
-                    attribute                               = attribute->Next())
+            }
+            else if (reader.name() == QLatin1String("tag"))
+            {
+               // tags should only contain a key and value attribute (k, v)
+               if (!childAttributes.hasAttribute("k") || !childAttributes.hasAttribute("v"))
                {
-                  mapValues.emplace(QString::fromUtf8(attribute->Name()), QString::fromUtf8(attribute->Value()));
+                  return ("Please make sure that all tags have a valid k/v (key/value) attribute pair in the way "
+                          "with id " +
+                          wayID);
                }
-
-               // store all tags that have been defined (auxiliary data): tags should only contain a key and value
-               // attribute (k, v)
-               for (tinyxml2::XMLElement* childData = node->FirstChildElement("tag"); childData != nullptr;
-                    childData                       = childData->NextSiblingElement("tag"))
+               const QString key   = childAttributes.value("k").toString();
+               const QString value = childAttributes.value("v").toString();
+               if (!keys.insert(key).second)
                {
-                  const char* keyName   = childData->Attribute("k");
-                  const char* valueName = childData->Attribute("v");
-                  if (keyName && valueName)
-                  {
-                     if (mapValues.find(QString::fromUtf8(keyName)) != mapValues.end())
-                     {
-                        return ("Please make sure there are no duplicate attributes or tag keys. The key " +
-                                QString::fromUtf8(keyName) + " may have already been used in the node with id " +
-                                QString::fromUtf8(node->FindAttribute("id")->Name()));
-                     }
-                     mapValues.emplace(QString::fromUtf8(keyName), QString::fromUtf8(valueName));
-                  }
-                  else
-                  {
-                     return ("Please make sure that all tags have a valid k/v (key/value) attribute pair in the way "
-                             "with id " +
-                             QString::fromUtf8(node->FindAttribute("id")->Name()));
-                  }
+                  return ("Please make sure there are no duplicate attributes or tag keys. The key " + key +
+                          " may have already been used in the way with id " + wayID);
+               }
+               if (key == "name" || FindFilter(aWayTagFilter, key, value) != aWayTagFilter.end())
+               {
+                  wayData.mData.emplace(key, value);
                }
-               mNodeMap.emplace(mapKey, mapValues);
+               keepWay = keepWay || aReadFilter.mWayTagKeys.contains(key);
             }
-            else
+            reader.skipCurrentElement();
+         }
+
+         if (keepWay)
+         {
+            mWays.push_back(std::move(wayData));
+         }
+      }
+   }
+   if (reader.hasError())
+   {
+      return cREAD_ERROR;
+   }
+
+   std::sort(wayIds.begin(), wayIds.end());
+   auto duplicateIt = std::adjacent_find(wayIds.begin(), wayIds.end());
+   if (duplicateIt != wayIds.end())
+   {
+      return ("Please make sure there are no duplicate way ids. The id " + QString::number(*duplicateIt) +
+              " may have already been used.");
+   }
+   return "";
+}
+
+QString OSMConverterDataContainer::ReadNodes(QIODevice&                     aDevice,
+                                             const ReadFilter&              aReadFilter,
+                                             const std::vector<FilterData>& aNodeTagFilter)
+{
+   QXmlStreamReader            reader(&aDevice);
+   std::unordered_set<QString> keys; // used to find duplicates within a node
+   if (reader.readNextStartElement() && reader.name() == QLatin1String("osm"))
+   {
+      while (reader.readNextStartElement())
+      {
+         if (reader.name() != QLatin1String("node"))
+         {
+            reader.skipCurrentElement();
+            continue;
+         }
+
+         // Get the Node id attribute
+         const QXmlStreamAttributes attributes = reader.attributes();
+         const QString              nodeID     = attributes.value("id").toString();
+         if (nodeID.isEmpty())
+         {
+            return ("Please make sure that all nodes have an \"id\" attribute.");
+         }
+
+         // Only the nodes referenced by a way that was read are kept
+         const unsigned long long id = nodeID.toULongLong();
+         auto                     nodeIt =
+            std::lower_bound(mNodes.begin(),
+                             mNodes.end(),
+                             id,
+                             [](const OSMNodeData& aNode, unsigned long long aId) { return aNode.mId < aId; });
+         if (nodeIt == mNodes.end() || nodeIt->mId != id)
+         {
+            reader.skipCurrentElement();
+            continue;
+         }
+         if (nodeIt->mFound)
+         {
+            return ("Please make sure there are no duplicate node ids. The id " + nodeID +
+                    " may have already been used.");
+         }
+         nodeIt->mFound = true;
+
+         DataList data;
+         bool     hasLatitude  = false;
+         bool     hasLongitude = false;
+         keys.clear();
+         for (const QXmlStreamAttribute& attribute : attributes)
+         {
+            const QString key   = attribute.name().toString();
+            const QString value = attribute.value().toString();
+            keys.insert(key);
+            if (key == "lat")
             {
-               return ("Please make sure that all nodes have an \"id\" attribute.");
+               nodeIt->mLatitude = value.toDouble();
+               hasLatitude       = true;
+            }
+            else if (key == "lon")
+            {
+               nodeIt->mLongitude = value.toDouble();
+               hasLongitude       = true;
+            }
+            if (FindFilter(aNodeTagFilter, key, value) != aNodeTagFilter.end())
+            {
+               data.emplace_back(key, value);
             }
          }
+         nodeIt->mHasPosition = hasLatitude && hasLongitude;
 
-         // Iterate through all ways
-         std::unordered_set<unsigned long long> nodesUsed; // used to track duplicates
-         for (tinyxml2::XMLElement* way = root->FirstChildElement("way"); way != nullptr;
-              way                       = way->NextSiblingElement("way"))
+         // Only the position is recorded for a node outside the bounding box, it is removed from its ways afterwards
+         if (aReadFilter.mUseBoundingBox && nodeIt->mHasPosition &&
+             (nodeIt->mLatitude < aReadFilter.mMinLatitude || nodeIt->mLatitude > aReadFilter.mMaxLatitude ||
+              nodeIt->mLongitude < aReadFilter.mMinLongitude || nodeIt->mLongitude > aReadFilter.mMaxLongitude))
          {
-            // Get the Way id attribute
-            QString wayID = QString::fromUtf8(way->Attribute("id"));
-            if (!wayID.isEmpty())
+            nodeIt->mOutsideBox = true;
+            reader.skipCurrentElement();
+            continue;
+         }
+
+         // store the tags that have been defined (auxiliary data): tags should only contain a key and value
+         // attribute (k, v)
+         while (reader.readNextStartElement())
+         {
+            if (reader.name() == QLatin1String("tag"))
             {
-               unsigned long long mapKey = wayID.toULongLong();
-               if (mWayMap.find(mapKey) != mWayMap.end())
+               const QXmlStreamAttributes childAttributes = reader.attributes();
+               if (!childAttributes.hasAttribute("k") || !childAttributes.hasAttribute("v"))
                {
-                  return ("Please make sure there are no duplicate way ids. The id " + QString::number(mapKey) +
-                          " may have already been used.");
+                  return ("Please make sure that all tags have a valid k/v (key/value) attribute pair in the node "
+                          "with id " +
+                          nodeID);
                }
-
-               OSMWayData wayData;
-               // Find all way attributes
-               for (const tinyxml2::XMLAttribute* attribute = way->FirstAttribute(); attribute != nullptr;
-                    attribute                               = attribute->Next())
+               const QString key   = childAttributes.value("k").toString();
+               const QString value = childAttributes.value("v").toString();
+               if (!keys.insert(key).second)
                {
-                  wayData.mData.emplace(QString::fromUtf8(attribute->Name()), QString::fromUtf8(attribute->Value()));
+                  return ("Please make sure there are no duplicate attributes or tag keys. The key " + key +
+                          " may have already been used in the node with id " + nodeID);
                }
-
-               for (tinyxml2::XMLElement* childNode = way->FirstChildElement("nd"); childNode != nullptr;
-                    childNode                       = childNode->NextSiblingElement("nd"))
+               if (FindFilter(aNodeTagFilter, key, value) != aNodeTagFilter.end())
                {
-                  QString referenceID = QString::fromUtf8(childNode->Attribute("ref"));
-                  if (!referenceID.isEmpty())
-                  {
-                     if (nodesUsed.find(referenceID.toULongLong()) == nodesUsed.end())
-                     {
-                        nodesUsed.emplace(referenceID.toULongLong());
-                     }
-                     else
-                     {
-                        mIntersections.emplace(referenceID.toULongLong());
-                     }
-                     wayData.mNodeRefIdList.emplace_back(referenceID.toULongLong());
-                  }
-               }
-
-               for (tinyxml2::XMLElement* childData = way->FirstChildElement("tag"); childData != nullptr;
-                    childData                       = childData->NextSiblingElement("tag"))
-               {
-                  const char* keyName   = childData->Attribute("k");
-                  const char* valueName = childData->Attribute("v");
-                  if (keyName && valueName)
-                  {
-                     if (wayData.mData.find(QString::fromUtf8(keyName)) != wayData.mData.end())
-                     {
-                        return ("Please make sure there are no duplicate attributes or tag keys. The key " +
-                                QString::fromUtf8(keyName) + " may have already been used in the way with id " +
-                                QString::fromUtf8(way->FindAttribute("id")->Name()));
-                     }
-                     wayData.mData.emplace(QString::fromUtf8(keyName), QString::fromUtf8(valueName));
-                  }
-                  else
-                  {
-                     return ("Please make sure that all tags have a valid k/v (key/value) attribute pair in the way "
-                             "with id " +
-                             QString::fromUtf8(way->FindAttribute("id")->Name()));
-                  }
+                  data.emplace_back(key, value);
                }
-               mWayMap.emplace(mapKey, wayData);
-            }
-            else
-            {
-               return ("Please make sure that all ways have an \"id\" attribute.");
             }
+            reader.skipCurrentElement();
+         }
+
+         if (!data.empty())
+         {
+            nodeIt->mDataIndex = mNodeData.size();
+            mNodeData.push_back(std::move(data));
          }
       }
    }
-   else
+   if (reader.hasError())
    {
-      return "Could not read the provided file. Please the make sure that the file is valid osm/xml.";
+      return cREAD_ERROR;
    }
    return "";
 }
 
+void OSMConverterDataContainer::ApplyBoundingBox(const ReadFilter& aReadFilter)
+{
+   if (!aReadFilter.mUseBoundingBox)
+   {
+      return;
+   }
+
+   // Nodes that were not found or have no position are kept, so that GetRouteNetwork reports them, but they do not
+   // keep a way on their own
+   auto outsideBox = [this](unsigned long long aId)
+   {
+      const OSMNodeData* nodePtr = FindNode(aId);
+      return nodePtr && nodePtr->mOutsideBox;
+   };
+   auto inBox = [this](unsigned long long aId)
+   {
+      const OSMNodeData* nodePtr = FindNode(aId);
+      return nodePtr && nodePtr->mHasPosition && !nodePtr->mOutsideBox;
+   };
+   for (auto& way : mWays)
+   {
+      way.mNodeRefIdList.erase(std::remove_if(way.mNodeRefIdList.begin(), way.mNodeRefIdList.end(), outsideBox),
+                               way.mNodeRefIdList.end());
+   }
+   mWays.erase(std::remove_if(mWays.begin(),
+                              mWays.end(),
+                              [&inBox](const OSMWayData& aWay)
+                              { return std::none_of(aWay.mNodeRefIdList.begin(), aWay.mNodeRefIdList.end(), inBox); }),
+               mWays.end());
+   IndexNodes();
+}
+
+void OSMConverterDataContainer::IndexNodes()
+{
+   std::vector<unsigned long long> references;
+   for (const auto& way : mWays)
+   {
+      references.insert(references.end(), way.mNodeRefIdList.begin(), way.mNodeRefIdList.end());
+   }
+   std::sort(references.begin(), references.end());
+
+   std::vector<OSMNodeData> nodes;
+   std::vector<DataList>    nodeData;
+   for (size_t i = 0; i < references.size();)
+   {
+      const unsigned long long id    = references[i];
+      size_t                   count = 0;
+      for (; i < references.size() && references[i] == id; ++i)
+      {
+         ++count;
+      }
+
+      const OSMNodeData* oldNodePtr = FindNode(id);
+      OSMNodeData        node;
+      if (oldNodePtr)
+      {
+         node = *oldNodePtr;
+      }
+      else
+      {
+         node.mId = id;
+      }
+      // A node used more than once connects routes (or closes one)
+      node.mIntersection = (count > 1);
+      if (node.mDataIndex != cNO_DATA)
+      {
+         nodeData.push_back(std::move(mNodeData[node.mDataIndex]));
+         node.mDataIndex = nodeData.size() - 1;
+      }
+      nodes.push_back(node);
+   }
+   mNodes.swap(nodes);
+   mNodeData.swap(nodeData);
+}
+
+const OSMConverterDataContainer::OSMNodeData* OSMConverterDataContainer::FindNode(unsigned long long aId) const
+{
+   auto it = std::lower_bound(mNodes.begin(),
+                              mNodes.end(),
+                              aId,
+                              [](const OSMNodeData& aNode, unsigned long long aNodeId) { return aNode.mId < aNodeId; });
+   return (it != mNodes.end() && it->mId == aId) ? &*it : nullptr;
+}
+
 QString OSMConverterDataContainer::GetRouteNetwork(const std::vector<FilterData>& aNodeTagFilter,
                                                    const std::vector<FilterData>& aWayTagFilter,
                                                    const QString&                 aNetworkName,
@@ -205,78 +441,67 @@ QString OSMConverterDataContainer::GetRouteNetwork(const std::vector<FilterData>
    }
 
    QString routeNetwork = "route_network " + aNetworkName + "\n";
-   for (auto& wayIt : mWayMap)
+   for (const auto& way : mWays)
    {
       routeNetwork += (cTAB1 + "route\n");
-      auto nameData = wayIt.second.mData.find("name");
-      if (nameData != wayIt.second.mData.end())
+      auto nameData = way.mData.find("name");
+      if (nameData != way.mData.end())
       {
          routeNetwork += (cTAB2 + "name " + nameData->second.simplified().replace(" ", "_") + "\n");
       }
 
       routeNetwork += (cTAB2 + "navigation\n");
-      for (auto& nodeListIt : wayIt.second.mNodeRefIdList)
+      for (unsigned long long nodeId : way.mNodeRefIdList)
       {
-         auto singleNodeData = mNodeMap.find(nodeListIt);
-         if (singleNodeData != mNodeMap.end())
+         const OSMNodeData* nodePtr = FindNode(nodeId);
+         if (nodePtr && nodePtr->mFound)
          {
             // Handle Node Position
-            auto latitudeIt  = singleNodeData->second.find("lat");
-            auto longitudeIt = singleNodeData->second.find("lon");
-            if (latitudeIt != singleNodeData->second.end() && longitudeIt != singleNodeData->second.end())
+            if (nodePtr->mHasPosition)
             {
-               QString latDirection  = (latitudeIt->second.toDouble() >= 0) ? "n" : "s";
-               QString longDirection = (longitudeIt->second.toDouble() >= 0) ? "e" : "w";
-               QString latitude      = latitudeIt->second + latDirection;
-               QString longitude     = longitudeIt->second + longDirection;
-               latitude.remove("-");
-               longitude.remove("-");
+               QString latDirection  = (nodePtr->mLatitude >= 0) ? "n" : "s";
+               QString longDirection = (nodePtr->mLongitude >= 0) ? "e" : "w";
+               QString latitude      = FormatAngle(nodePtr->mLatitude) + latDirection;
+               QString longitude     = FormatAngle(nodePtr->mLongitude) + longDirection;
                routeNetwork += (cTAB3 + "position " + latitude + " " + longitude + "\n");
             }
             else // ERROR: Missing position data
             {
                aErrorMessage = "Could not create route_network. There is missing position data for the node with id " +
-                               QString::number(singleNodeData->first);
+                               QString::number(nodeId);
                return "";
             }
 
             // Handle Auxiliary Node Data
             QString nodeAuxData = "";
-            for (auto& nodeData : singleNodeData->second)
+            if (nodePtr->mDataIndex != cNO_DATA)
             {
-               auto nodeFilterIt =
-                  find_if(aNodeTagFilter.begin(),
-                          aNodeTagFilter.end(),
-                          [nodeData](const FilterData& aNodeTagData)
-                          {
-                             if (!aNodeTagData.mValue.isEmpty() && !nodeData.second.isEmpty())
-                             {
-                                return aNodeTagData.mTagKey == nodeData.first && aNodeTagData.mValue == nodeData.second;
-                             }
-                             return aNodeTagData.mTagKey == nodeData.first && aNodeTagData.mValue.isEmpty();
-                          });
-               if (nodeFilterIt != aNodeTagFilter.end())
+               for (const auto& nodeData : mNodeData[nodePtr->mDataIndex])
                {
-                  auto valueTypeIt = valueStrings.find(static_cast<int>(nodeFilterIt->mValueType));
-                  if (valueTypeIt == valueStrings.end())
+                  auto nodeFilterIt = FindFilter(aNodeTagFilter, nodeData.first, nodeData.second);
+                  if (nodeFilterIt != aNodeTagFilter.end())
                   {
-                     continue;
-                  }
+                     auto valueTypeIt = valueStrings.find(static_cast<int>(nodeFilterIt->mValueType));
+                     if (valueTypeIt == valueStrings.end())
+                     {
+                        continue;
+                     }
 
-                  QString value = (valueTypeIt->first != static_cast<int>(ValueType::cSTRING)) ?
-                                     nodeData.second :
-                                     ("\"" + nodeData.second + "\"");
-                  if (valueTypeIt->first == static_cast<int>(ValueType::cBOOL))
-                  {
-                     value = "false";
-                     if (!nodeFilterIt->mValue.isEmpty() || (nodeData.second.compare("yes") == 0))
+                     QString value = (valueTypeIt->first != static_cast<int>(ValueType::cSTRING)) ?
+                                        nodeData.second :
+                                        ("\"" + nodeData.second + "\"");
+                     if (valueTypeIt->first == static_cast<int>(ValueType::cBOOL))
                      {
-                        value = "true";
+                        value = "false";
+                        if (!nodeFilterIt->mValue.isEmpty() || (nodeData.second.compare("yes") == 0))
+                        {
+                           value = "true";
+                        }
                      }
+                     nodeAuxData += ("\n" + cTAB5 + valueTypeIt->second + nodeFilterIt->mOutputName + " = " + value);
+                     aResultOutput.mNodeTagMatches[nodeFilterIt->mTagKey + (nodeFilterIt->mValue.isEmpty() ? "" : ":") +
+                                                   nodeFilterIt->mValue] += 1;
                   }
-                  nodeAuxData += ("\n" + cTAB5 + valueTypeIt->second + nodeFilterIt->mOutputName + " = " + value);
-                  aResultOutput.mNodeTagMatches[nodeFilterIt->mTagKey + (nodeFilterIt->mValue.isEmpty() ? "" : ":") +
-                                                nodeFilterIt->mValue] += 1;
                }
             }
 
@@ -287,15 +512,15 @@ QString OSMConverterDataContainer::GetRouteNetwork(const std::vector<FilterData>
             }
 
             // Deal with intersections
-            if (mIntersections.find(singleNodeData->first) != mIntersections.end())
+            if (nodePtr->mIntersection)
             {
-               routeNetwork += (cTAB4 + "node_id " + QString::number(singleNodeData->first) + "\n");
+               routeNetwork += (cTAB4 + "node_id " + QString::number(nodeId) + "\n");
             }
          }
          else // ERROR: missing node definition
          {
             aErrorMessage =
-               "Could not create route_network. Could not locate the node with id " + QString::number(nodeListIt);
+               "Could not create route_network. Could not locate the node with id " + QString::number(nodeId);
             return "";
          }
       }
@@ -303,19 +528,9 @@ QString OSMConverterDataContainer::GetRouteNetwork(const std::vector<FilterData>
 
       // Handle Auxiliary waypoint/route Data
       QString wayAuxData = "";
-      for (const auto& wayData : wayIt.second.mData)
+      for (const auto& wayData : way.mData)
       {
-         auto wayFilterIt =
-            find_if(aWayTagFilter.begin(),
-                    aWayTagFilter.end(),
-                    [wayData](const FilterData& aWayTagData)
-                    {
-                       if (!aWayTagData.mValue.isEmpty() && !wayData.second.isEmpty())
-                       {
-                          return aWayTagData.mTagKey == wayData.first && aWayTagData.mValue == wayData.second;
-                       }
-                       return aWayTagData.mTagKey == wayData.first && aWayTagData.mValue.isEmpty();
-                    });
+         auto wayFilterIt = FindFilter(aWayTagFilter, wayData.first, wayData.second);
          if (wayFilterIt != aWayTagFilter.end())
          {
             auto valueTypeIt = valueStrings.find(static_cast<int>(wayFilterIt->mValueType));
@@ -349,7 +564,7 @@ QString OSMConverterDataContainer::GetRouteNetwork(const std::vector<FilterData>
 
       routeNetwork += (cTAB1 + "end_route\n");
    }
-   aResultOutput.mRoutesCreated = mWayMap.size();
+   aResultOutput.mRoutesCreated = mWays.size();
    routeNetwork += "end_route_network\n";
 
    return routeNetwork;
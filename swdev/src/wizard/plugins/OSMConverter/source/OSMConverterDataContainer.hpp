@@ -19,7 +19,9 @@
 #include <vector>
 
 #include <QHash>
+#include <QIODevice>
 #include <QString>
+#include <QStringList>
 
 namespace std
 {
@@ -59,27 +61,66 @@ public:
       std::map<QString, size_t> mNodeTagMatches;
    };
 
+   // Applied while the file is read, so that only the data that is exported is held in memory
+   struct ReadFilter
+   {
+      QStringList mWayTagKeys; // Ways without one of these tags are skipped. All ways are read if empty.
+      bool        mUseBoundingBox{false};
+      double      mMinLatitude{-90.0};
+      double      mMaxLatitude{90.0};
+      double      mMinLongitude{-180.0};
+      double      mMaxLongitude{180.0};
+   };
+
    struct OSMWayData
    {
       std::vector<unsigned long long>      mNodeRefIdList; // Reference Id
-      std::unordered_map<QString, QString> mData;
+      std::unordered_map<QString, QString> mData;          // The name and the way attributes/tags that pass the filter
    };
 
    OSMConverterDataContainer() = default;
-   QString ParseFile(const QString& aFileName);
+   // The tag filters must be the ones later given to GetRouteNetwork, node and way data they don't match is not kept
+   QString ParseFile(const QString&                 aFileName,
+                     const ReadFilter&              aReadFilter,
+                     const std::vector<FilterData>& aNodeTagFilter,
+                     const std::vector<FilterData>& aWayTagFilter);
    QString GetRouteNetwork(const std::vector<FilterData>& aNodeTagFilter,
                            const std::vector<FilterData>& aWayTagFilter,
                            const QString&                 aNetworkName,
                            QString&                       aErrorMessage,
                            ResultOutput&                  aResultOutput);
-   size_t  GetNumberOfRoutes() const { return mWayMap.size(); }
+   size_t  GetNumberOfRoutes() const { return mWays.size(); }
 
 private:
-   // OSM Id for nodes are stored as a 64 bit integer number >= 1. The wiki doesn't say anything about way id, so assume the same.
-   std::unordered_map<unsigned long long, std::unordered_map<QString, QString>> mNodeMap; // Key: Node Id, Value: data
-                                                                                          // (lat, lon, aux, etc.)
-   std::unordered_map<unsigned long long, OSMWayData> mWayMap; // Key: Way Id,  Value: Node list and data
-   std::unordered_set<unsigned long long>             mIntersections;
+   using DataList = std::vector<std::pair<QString, QString>>;
+
+   static constexpr size_t cNO_DATA = static_cast<size_t>(-1);
+
+   // A node referenced by a way. OSM Id for nodes are stored as a 64 bit integer number >= 1.
+   struct OSMNodeData
+   {
+      unsigned long long mId{0};
+      double             mLatitude{0.0};
+      double             mLongitude{0.0};
+      bool               mFound{false};
+      bool               mHasPosition{false};
+      bool               mIntersection{false};
+      bool               mOutsideBox{false};  // The position is outside the bounding box, nothing else is kept
+      size_t             mDataIndex{cNO_DATA}; // Index of the node attributes/tags that pass the filter in mNodeData
+   };
+
+   QString ReadWays(QIODevice& aDevice, const ReadFilter& aReadFilter, const std::vector<FilterData>& aWayTagFilter);
+   QString ReadNodes(QIODevice& aDevice, const ReadFilter& aReadFilter, const std::vector<FilterData>& aNodeTagFilter);
+   // Removes the nodes outside the bounding box from the ways, and the ways left without a node inside it
+   void    ApplyBoundingBox(const ReadFilter& aReadFilter);
+   // Rebuilds mNodes from the nodes referenced by mWays, keeping the data already read
+   void    IndexNodes();
+
+   const OSMNodeData* FindNode(unsigned long long aId) const;
+
+   std::vector<OSMWayData>  mWays;     // In file order
+   std::vector<OSMNodeData> mNodes;    // Sorted by id
+   std::vector<DataList>    mNodeData; // Only for the nodes with data that passes the filter
 };
 
 #endif
@@ -143,7 +143,25 @@ void OSMConverterDialog::HandleExportButtonClicked()
 
    if (writeToFile && (importFile.right(4) == ".osm") && !exportTarget.isEmpty())
    {
-      QString parseErrorMsg = mDataContainer->ParseFile(importFile);
+      // Only the ways (and their nodes) that pass the read filter, and the tag data that is exported, are read
+      OSMConverterDataContainer::ReadFilter readFilter;
+      for (const QString& key : mUI.mWayKeyLineEdit->text().split(',', QString::SkipEmptyParts))
+      {
+         if (!key.trimmed().isEmpty())
+         {
+            readFilter.mWayTagKeys << key.trimmed();
+         }
+      }
+      readFilter.mUseBoundingBox = mUI.mBoundingBoxGroupBox->isChecked();
+      readFilter.mMinLatitude    = mUI.mMinLatitudeSpinBox->value();
+      readFilter.mMaxLatitude    = mUI.mMaxLatitudeSpinBox->value();
+      readFilter.mMinLongitude   = mUI.mMinLongitudeSpinBox->value();
+      readFilter.mMaxLongitude   = mUI.mMaxLongitudeSpinBox->value();
+
+      const std::vector<OSMConverterDataContainer::FilterData>& nodeTagFilter = mNodeTagTable->GetTableData();
+      const std::vector<OSMConverterDataContainer::FilterData>& wayTagFilter  = mWayTagTable->GetTableData();
+
+      QString parseErrorMsg = mDataContainer->ParseFile(importFile, readFilter, nodeTagFilter, wayTagFilter);
       if (parseErrorMsg.isEmpty())
       {
          QString                                 routeErrorMessage;
@@ -151,8 +169,8 @@ void OSMConverterDialog::HandleExportButtonClicked()
          QFileInfo                               importFileInfo(importFile);
          QString                                 text =
             "# File generated by Wizard OSM Converter Tool\n# Input file: " + importFileInfo.fileName() + "\n\n";
-         text += mDataContainer->GetRouteNetwork(mNodeTagTable->GetTableData(),
-                                                 mWayTagTable->GetTableData(),
+         text += mDataContainer->GetRouteNetwork(nodeTagFilter,
+                                                 wayTagFilter,
                                                  mUI.mNameLineEdit->text(),
                                                  routeErrorMessage,
                                                  results);
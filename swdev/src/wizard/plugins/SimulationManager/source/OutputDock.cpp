@@ -11,11 +11,12 @@
 
 #include "OutputDock.hpp"
 
+#include <QApplication>
 #include <QDesktopServices>
 #include <QFileDialog>
 #include <QMenu>
-#include <QTextBlock>
-#include <QTextCursor>
+#include <QRegularExpression>
+#include <QTextStream>
 #include <QUrlQuery>
 
 #include "ContextMenuActions.hpp"
@@ -28,6 +29,9 @@
 
 SimulationManager::OutputDock::OutputDock(QWidget* parent /*= 0*/, Qt::WindowFlags f /*= 0*/)
    : QDockWidget(parent, f)
+   , mExecutionPtr(nullptr)
+   , mErrorCount(0)
+   , mWarningCount(0)
    , mExecutionDoneConnection()
 {
    setObjectName("OutputDock");
@@ -35,15 +39,12 @@ SimulationManager::OutputDock::OutputDock(QWidget* parent /*= 0*/, Qt::WindowFla
    mUi.setupUi(widget());
    setWindowTitle(widget()->windowTitle());
 
-   mUi.outputText->setOpenLinks(false);
-   mUi.outputText->setUndoRedoEnabled(false);
    mUi.statusLabel->setText("");
    mUi.killBn->setEnabled(false);
    mUi.killBn->setIcon(QIcon::fromTheme("delete"));
    mUi.outputText->setFont(wizard::UiResources::GetInstance().GetFont());
-
-   mUi.outputText->setLineWrapMode(QTextEdit::NoWrap);
-   mUi.outputText->setTextInteractionFlags(mUi.outputText->textInteractionFlags() | Qt::TextSelectableByKeyboard);
+   mUi.previousProblemBn->setIcon(QIcon::fromTheme("up"));
+   mUi.nextProblemBn->setIcon(QIcon::fromTheme("down"));
    mUi.logFileBn->setEnabled(true);
    mUi.logFileBn->setIcon(QIcon::fromTheme("folder"));
 
@@ -51,7 +52,10 @@ SimulationManager::OutputDock::OutputDock(QWidget* parent /*= 0*/, Qt::WindowFla
            &wizard::ProjectWorkspace::StartingExecution,
            this,
            &OutputDock::StartingExecution);
-   connect(mUi.outputText, &OutputWidget::anchorClicked, this, &OutputDock::AnchorClicked);
+   connect(mUi.outputText, &OutputView::AnchorClicked, this, &OutputDock::AnchorClicked);
+   connect(mUi.filterEdit, &QLineEdit::textChanged, this, &OutputDock::FilterChanged);
+   connect(mUi.previousProblemBn, &QToolButton::clicked, this, [this]() { GoToProblem(false); });
+   connect(mUi.nextProblemBn, &QToolButton::clicked, this, [this]() { GoToProblem(true); });
    connect(mUi.killBn, &QToolButton::clicked, this, &OutputDock::KillClick);
    connect(mUi.logFileBn, &QPushButton::clicked, this, &OutputDock::SelectOutputLogFile);
    connect(mUi.logFilePath, &QLabel::linkActivated, this, &OutputDock::OutputLogLinkClicked);
@@ -60,9 +64,16 @@ SimulationManager::OutputDock::OutputDock(QWidget* parent /*= 0*/, Qt::WindowFla
    mUi.resultsButton->setMenu(mResultsMenuPtr);
 }
 
-void SimulationManager::OutputDock::AppendQueueToConsole()
+void SimulationManager::OutputDock::UpdateOutput()
 {
-   mUi.outputText->AppendQueueToConsole();
+   mUi.outputText->Update();
+   if (mOutputBufferPtr &&
+       (mOutputBufferPtr->GetErrorCount() != mErrorCount || mOutputBufferPtr->GetWarningCount() != mWarningCount))
+   {
+      mErrorCount   = mOutputBufferPtr->GetErrorCount();
+      mWarningCount = mOutputBufferPtr->GetWarningCount();
+      mUi.problemLabel->setText(QString("%1 errors, %2 warnings").arg(mErrorCount).arg(mWarningCount));
+   }
 }
 
 void SimulationManager::OutputDock::AnchorClicked(const QUrl& aUrl)
@@ -94,12 +105,12 @@ void SimulationManager::OutputDock::AnchorClicked(const QUrl& aUrl)
 void SimulationManager::OutputDock::StartingExecution(wizard::WsfExecution* aExecutionPtr)
 {
    mResultsMenuPtr->clear();
-   mUi.outputText->Reset();
-
-   QTextDocument* doc = aExecutionPtr->mOutputText.data();
-   doc->setMaximumBlockCount(1000);
-
-   connect(aExecutionPtr, &wizard::WsfExecution::StandardOutputText, mUi.outputText, &OutputWidget::QueueForConsole);
+   mOutputBufferPtr = aExecutionPtr->GetOutputBuffer();
+   mOutputBufferPtr->SetFilter(mUi.filterEdit->text(), false);
+   mUi.outputText->SetBuffer(mOutputBufferPtr);
+   mErrorCount   = 0;
+   mWarningCount = 0;
+   mUi.problemLabel->clear();
 
    disconnect(mExecutionDoneConnection);
    mExecutionDoneConnection = connect(aExecutionPtr, &wizard::WsfExecution::Done, this, &OutputDock::ExecutionDone);
@@ -215,3 +226,21 @@ void SimulationManager::OutputDock::SetOutputLogLabel()
       mUi.logFilePath->setText(mOutputLogPath);
    }
 }
+
+void SimulationManager::OutputDock::FilterChanged(const QString& aFilter)
+{
+   const bool valid = QRegularExpression(aFilter).isValid();
+   mUi.filterEdit->setStyleSheet(valid ? QString() : QString("color: red"));
+   if (valid && mOutputBufferPtr)
+   {
+      mOutputBufferPtr->SetFilter(aFilter, false);
+   }
+}
+
+void SimulationManager::OutputDock::GoToProblem(bool aForward)
+{
+   if (!mUi.outputText->GoToProblem(aForward))
+   {
+      QApplication::beep();
+   }
+}
@@ -12,15 +12,17 @@
 #ifndef OUTPUTDOCK_HPP
 #define OUTPUTDOCK_HPP
 
+#include <memory>
+
 #include <QDockWidget>
 
 #include "ui_OutputDock.h"
 
 class QMenu;
-class QTextDocument;
 class UtPath;
 namespace wizard
 {
+class OutputBuffer;
 class WsfExecution;
 class OutputPrefObject;
 } // namespace wizard
@@ -33,7 +35,8 @@ public:
    OutputDock(QWidget* parent = nullptr, Qt::WindowFlags f = Qt::WindowFlags());
    ~OutputDock() override = default;
 
-   void AppendQueueToConsole();
+   //! Shows the output received since the previous update
+   void UpdateOutput();
 
 private:
    void AnchorClicked(const QUrl& aUrl);
@@ -44,11 +47,16 @@ private:
    void SelectOutputLogFile();
    void OutputLogLinkClicked(const QString& aPath);
    void SetOutputLogLabel();
+   void FilterChanged(const QString& aFilter);
+   void GoToProblem(bool aForward);
 
-   QString               mOutputLogPath;
-   wizard::WsfExecution* mExecutionPtr;
-   Ui::OutputDock        mUi;
-   QMenu*                mResultsMenuPtr;
+   QString                               mOutputLogPath;
+   wizard::WsfExecution*                 mExecutionPtr;
+   std::shared_ptr<wizard::OutputBuffer> mOutputBufferPtr;
+   Ui::OutputDock                        mUi;
+   QMenu*                                mResultsMenuPtr;
+   size_t                                mErrorCount;
+   size_t                                mWarningCount;
 
    QMetaObject::Connection mExecutionDoneConnection;
 };
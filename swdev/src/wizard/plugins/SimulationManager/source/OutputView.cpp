@@ -0,0 +1,402 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "OutputView.hpp"
+
+#include <algorithm>
+#include <climits>
+
+#include <QApplication>
+#include <QClipboard>
+#include <QContextMenuEvent>
+#include <QKeyEvent>
+#include <QMenu>
+#include <QPainter>
+#include <QScrollBar>
+#include <QUrlQuery>
+
+#include "Project.hpp"
+
+namespace
+{
+const int cMARGIN = 4;
+
+QString GetFileSystemPath(const QString& aLocalPath)
+{
+   const UtPath&     cwd      = wizard::Project::Instance()->WorkingDirectory();
+   const std::string filePath = (cwd + aLocalPath.toStdString()).GetSystemPath();
+   return QString::fromStdString(filePath);
+}
+} // namespace
+
+SimulationManager::OutputView::OutputView(QWidget* aParent)
+   : QAbstractScrollArea(aParent)
+   , mFileLineColumnRegex("'([^']*)',.line (\\d+),.near column.(\\d+)")
+   , mFileEofRegex("'([^']*)'.at.end-of-file")
+{
+   viewport()->setMouseTracking(true);
+   viewport()->setCursor(Qt::IBeamCursor);
+   setFocusPolicy(Qt::StrongFocus);
+   UpdateScrollBars();
+}
+
+void SimulationManager::OutputView::SetBuffer(const std::shared_ptr<wizard::OutputBuffer>& aBufferPtr)
+{
+   mBufferPtr    = aBufferPtr;
+   mRevision     = 0;
+   mRowCount     = 0;
+   mMaxLineWidth = 0;
+   mHasSelection = false;
+   mSelecting    = false;
+   verticalScrollBar()->setValue(0);
+   horizontalScrollBar()->setValue(0);
+   UpdateScrollBars();
+   Update();
+   viewport()->update();
+}
+
+void SimulationManager::OutputView::Update()
+{
+   if (!mBufferPtr || mBufferPtr->GetRevision() == mRevision)
+   {
+      return;
+   }
+   mRevision = mBufferPtr->GetRevision();
+
+   QScrollBar* scrollBarPtr = verticalScrollBar();
+   const bool  following    = (scrollBarPtr->value() == scrollBarPtr->maximum());
+   mRowCount                = mBufferPtr->GetRowCount();
+   UpdateScrollBars();
+   if (following)
+   {
+      scrollBarPtr->setValue(scrollBarPtr->maximum());
+   }
+   viewport()->update();
+}
+
+bool SimulationManager::OutputView::GoToProblem(bool aForward)
+{
+   if (!mBufferPtr)
+   {
+      return false;
+   }
+   // Search from the selection, or from the rows in view when nothing is selected
+   size_t from = static_cast<size_t>(verticalScrollBar()->value());
+   if (mHasSelection)
+   {
+      from = aForward ? mCurrentRow + 1 : mCurrentRow;
+   }
+   else if (!aForward)
+   {
+      from += static_cast<size_t>(GetVisibleRowCount());
+   }
+   size_t row = 0;
+   if (!mBufferPtr->FindProblem(from, aForward, row))
+   {
+      return false;
+   }
+   mAnchorRow    = row;
+   mCurrentRow   = row;
+   mHasSelection = true;
+   ScrollToRow(row);
+   viewport()->update();
+   return true;
+}
+
+void SimulationManager::OutputView::Copy()
+{
+   if (mBufferPtr && mHasSelection)
+   {
+      const size_t first = std::min(mAnchorRow, mCurrentRow);
+      const size_t last  = std::max(mAnchorRow, mCurrentRow);
+      QApplication::clipboard()->setText(mBufferPtr->GetRowsText(first, last - first + 1));
+   }
+}
+
+void SimulationManager::OutputView::SelectAll()
+{
+   if (mRowCount > 0)
+   {
+      mAnchorRow    = 0;
+      mCurrentRow   = mRowCount - 1;
+      mHasSelection = true;
+      viewport()->update();
+   }
+}
+
+void SimulationManager::OutputView::paintEvent(QPaintEvent* aEvent)
+{
+   QPainter painter(viewport());
+   painter.fillRect(viewport()->rect(), palette().base());
+   mLinks.clear();
+   if (!mBufferPtr)
+   {
+      return;
+   }
+
+   const QFontMetrics metrics(font());
+   const int          lineHeight = GetLineHeight();
+   const int          left       = cMARGIN - horizontalScrollBar()->value();
+   const size_t       firstRow   = static_cast<size_t>(verticalScrollBar()->value());
+   const size_t       lastRow    = std::min(mRowCount, firstRow + GetVisibleRowCount() + 1);
+   const size_t       selectMin  = std::min(mAnchorRow, mCurrentRow);
+   const size_t       selectMax  = std::max(mAnchorRow, mCurrentRow);
+   int                maxWidth   = mMaxLineWidth;
+   for (size_t row = firstRow; row < lastRow; ++row)
+   {
+      wizard::OutputBuffer::Severity severity = wizard::OutputBuffer::cNORMAL;
+      const QString                  text     = mBufferPtr->GetRowText(row, &severity);
+      const int                      top      = static_cast<int>(row - firstRow) * lineHeight;
+
+      const bool selected = mHasSelection && row >= selectMin && row <= selectMax;
+      if (selected)
+      {
+         painter.fillRect(QRect(0, top, viewport()->width(), lineHeight), palette().highlight());
+         painter.setPen(palette().highlightedText().color());
+      }
+      else if (severity == wizard::OutputBuffer::cERROR)
+      {
+         painter.setPen(QColor(Qt::red));
+      }
+      else if (severity == wizard::OutputBuffer::cWARNING)
+      {
+         painter.setPen(QColor(255, 140, 0));
+      }
+      else
+      {
+         painter.setPen(palette().text().color());
+      }
+      painter.drawText(QPoint(left, top + metrics.ascent()), text);
+      FindLinks(text, QPoint(left, top));
+      maxWidth = std::max(maxWidth, metrics.width(text));
+   }
+
+   // Underline the error locations
+   painter.setPen(palette().link().color());
+   for (const auto& link : mLinks)
+   {
+      painter.drawLine(link.mRect.bottomLeft(), link.mRect.bottomRight());
+   }
+
+   if (maxWidth != mMaxLineWidth)
+   {
+      mMaxLineWidth = maxWidth;
+      UpdateScrollBars();
+   }
+}
+
+void SimulationManager::OutputView::resizeEvent(QResizeEvent* aEvent)
+{
+   QAbstractScrollArea::resizeEvent(aEvent);
+   UpdateScrollBars();
+}
+
+void SimulationManager::OutputView::keyPressEvent(QKeyEvent* aEvent)
+{
+   QScrollBar* scrollBarPtr = verticalScrollBar();
+   if (aEvent->matches(QKeySequence::Copy))
+   {
+      Copy();
+   }
+   else if (aEvent->matches(QKeySequence::SelectAll))
+   {
+      SelectAll();
+   }
+   else if (aEvent->key() == Qt::Key_Home)
+   {
+      scrollBarPtr->setValue(scrollBarPtr->minimum());
+   }
+   else if (aEvent->key() == Qt::Key_End)
+   {
+      scrollBarPtr->setValue(scrollBarPtr->maximum());
+   }
+   else if (aEvent->key() == Qt::Key_Up)
+   {
+      scrollBarPtr->triggerAction(QAbstractSlider::SliderSingleStepSub);
+   }
+   else if (aEvent->key() == Qt::Key_Down)
+   {
+      scrollBarPtr->triggerAction(QAbstractSlider::SliderSingleStepAdd);
+   }
+   else if (aEvent->key() == Qt::Key_PageUp)
+   {
+      scrollBarPtr->triggerAction(QAbstractSlider::SliderPageStepSub);
+   }
+   else if (aEvent->key() == Qt::Key_PageDown)
+   {
+      scrollBarPtr->triggerAction(QAbstractSlider::SliderPageStepAdd);
+   }
+   else
+   {
+      QAbstractScrollArea::keyPressEvent(aEvent);
+   }
+}
+
+void SimulationManager::OutputView::mousePressEvent(QMouseEvent* aEvent)
+{
+   if (aEvent->button() != Qt::LeftButton || mRowCount == 0)
+   {
+      QAbstractScrollArea::mousePressEvent(aEvent);
+      return;
+   }
+   const QUrl url = GetLinkAt(aEvent->pos());
+   if (!url.isEmpty())
+   {
+      emit AnchorClicked(url);
+      return;
+   }
+   const size_t row = GetRowAt(aEvent->pos());
+   if (!mHasSelection || !(aEvent->modifiers() & Qt::ShiftModifier))
+   {
+      mAnchorRow = row;
+   }
+   mCurrentRow   = row;
+   mHasSelection = true;
+   mSelecting    = true;
+   viewport()->update();
+}
+
+void SimulationManager::OutputView::mouseMoveEvent(QMouseEvent* aEvent)
+{
+   if (mSelecting)
+   {
+      // Dragging past the top or bottom scrolls the view
+      if (aEvent->pos().y() < 0)
+      {
+         verticalScrollBar()->triggerAction(QAbstractSlider::SliderSingleStepSub);
+      }
+      else if (aEvent->pos().y() > viewport()->height())
+      {
+         verticalScrollBar()->triggerAction(QAbstractSlider::SliderSingleStepAdd);
+      }
+      mCurrentRow = GetRowAt(aEvent->pos());
+      viewport()->update();
+   }
+   else
+   {
+      viewport()->setCursor(GetLinkAt(aEvent->pos()).isEmpty() ? Qt::IBeamCursor : Qt::PointingHandCursor);
+   }
+}
+
+void SimulationManager::OutputView::mouseReleaseEvent(QMouseEvent* aEvent)
+{
+   mSelecting = false;
+   QAbstractScrollArea::mouseReleaseEvent(aEvent);
+}
+
+void SimulationManager::OutputView::contextMenuEvent(QContextMenuEvent* aEvent)
+{
+   QMenu    menu(this);
+   QAction* copyActionPtr = menu.addAction("Copy", this, &OutputView::Copy, QKeySequence::Copy);
+   copyActionPtr->setEnabled(mHasSelection);
+   menu.addAction("Select All", this, &OutputView::SelectAll, QKeySequence::SelectAll);
+   menu.exec(aEvent->globalPos());
+}
+
+void SimulationManager::OutputView::changeEvent(QEvent* aEvent)
+{
+   QAbstractScrollArea::changeEvent(aEvent);
+   if (aEvent->type() == QEvent::FontChange)
+   {
+      mMaxLineWidth = 0;
+      UpdateScrollBars();
+      viewport()->update();
+   }
+}
+
+void SimulationManager::OutputView::UpdateScrollBars()
+{
+   const int visibleRows = GetVisibleRowCount();
+   const int rowCount    = static_cast<int>(std::min<size_t>(mRowCount, INT_MAX));
+   verticalScrollBar()->setRange(0, std::max(0, rowCount - visibleRows));
+   verticalScrollBar()->setPageStep(visibleRows);
+   verticalScrollBar()->setSingleStep(1);
+
+   const int width = viewport()->width();
+   horizontalScrollBar()->setRange(0, std::max(0, mMaxLineWidth + 2 * cMARGIN - width));
+   horizontalScrollBar()->setPageStep(width);
+   horizontalScrollBar()->setSingleStep(fontMetrics().averageCharWidth());
+}
+
+int SimulationManager::OutputView::GetLineHeight() const
+{
+   return std::max(1, QFontMetrics(font()).lineSpacing());
+}
+
+int SimulationManager::OutputView::GetVisibleRowCount() const
+{
+   return std::max(1, viewport()->height() / GetLineHeight());
+}
+
+size_t SimulationManager::OutputView::GetRowAt(const QPoint& aPosition) const
+{
+   const int    offset  = std::max(0, aPosition.y()) / GetLineHeight();
+   const size_t row     = static_cast<size_t>(verticalScrollBar()->value()) + static_cast<size_t>(offset);
+   const size_t lastRow = (mRowCount > 0) ? mRowCount - 1 : 0;
+   return std::min(row, lastRow);
+}
+
+void SimulationManager::OutputView::ScrollToRow(size_t aRow)
+{
+   const size_t firstRow = static_cast<size_t>(verticalScrollBar()->value());
+   const size_t visible  = static_cast<size_t>(GetVisibleRowCount());
+   if (aRow < firstRow || aRow >= firstRow + visible)
+   {
+      // Center the row
+      const size_t half = visible / 2;
+      verticalScrollBar()->setValue(static_cast<int>(std::min<size_t>((aRow > half) ? aRow - half : 0, INT_MAX)));
+   }
+}
+
+void SimulationManager::OutputView::FindLinks(const QString& aText, const QPoint& aTopLeft)
+{
+   const QFontMetrics metrics(font());
+   auto               addLink = [&](const QRegularExpressionMatch& aMatch, const QUrlQuery& aQuery)
+   {
+      QUrl url(QString("ide://wsf_error"));
+      url.setQuery(aQuery);
+      const int x     = aTopLeft.x() + metrics.width(aText.left(aMatch.capturedStart()));
+      const int width = metrics.width(aMatch.captured());
+      mLinks.push_back(Link{QRect(x, aTopLeft.y(), width, metrics.ascent() + 1), url});
+   };
+
+   auto it = mFileLineColumnRegex.globalMatch(aText);
+   while (it.hasNext())
+   {
+      const QRegularExpressionMatch match = it.next();
+      QUrlQuery                     query;
+      query.addQueryItem("file", GetFileSystemPath(match.captured(1)));
+      query.addQueryItem("line", match.captured(2));
+      query.addQueryItem("column", match.captured(3));
+      addLink(match, query);
+   }
+   it = mFileEofRegex.globalMatch(aText);
+   while (it.hasNext())
+   {
+      const QRegularExpressionMatch match = it.next();
+      QUrlQuery                     query;
+      query.addQueryItem("file", GetFileSystemPath(match.captured(1)));
+      query.addQueryItem("EOF", "Y");
+      addLink(match, query);
+   }
+}
+
+QUrl SimulationManager::OutputView::GetLinkAt(const QPoint& aPosition) const
+{
+   for (const auto& link : mLinks)
+   {
+      if (link.mRect.contains(aPosition))
+      {
+         return link.mUrl;
+      }
+   }
+   return QUrl();
+}
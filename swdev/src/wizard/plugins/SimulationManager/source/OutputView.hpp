@@ -0,0 +1,94 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef OUTPUTVIEW_HPP
+#define OUTPUTVIEW_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <QAbstractScrollArea>
+#include <QRegularExpression>
+#include <QUrl>
+
+#include "OutputBuffer.hpp"
+
+namespace SimulationManager
+{
+//! Displays a wizard::OutputBuffer.
+//! Only the rows in the viewport are decoded and drawn, so the cost of a repaint does not depend on the amount of
+//! output. Error locations reported by WSF are drawn as links, selection is by whole rows.
+class OutputView : public QAbstractScrollArea
+{
+   Q_OBJECT
+
+public:
+   explicit OutputView(QWidget* aParent = nullptr);
+   ~OutputView() override = default;
+
+   void SetBuffer(const std::shared_ptr<wizard::OutputBuffer>& aBufferPtr);
+   //! Picks up new rows from the buffer. While the view is scrolled to the bottom, it follows the output.
+   void Update();
+
+   //! Scrolls to and selects the next (or previous) error or warning, returns 'false' if there is none
+   bool GoToProblem(bool aForward);
+
+   void Copy();
+   void SelectAll();
+
+signals:
+   void AnchorClicked(const QUrl& aUrl);
+
+protected:
+   void paintEvent(QPaintEvent* aEvent) override;
+   void resizeEvent(QResizeEvent* aEvent) override;
+   void keyPressEvent(QKeyEvent* aEvent) override;
+   void mousePressEvent(QMouseEvent* aEvent) override;
+   void mouseMoveEvent(QMouseEvent* aEvent) override;
+   void mouseReleaseEvent(QMouseEvent* aEvent) override;
+   void contextMenuEvent(QContextMenuEvent* aEvent) override;
+   void changeEvent(QEvent* aEvent) override;
+
+private:
+   struct Link
+   {
+      QRect mRect;
+      QUrl  mUrl;
+   };
+
+   void   UpdateScrollBars();
+   int    GetLineHeight() const;
+   int    GetVisibleRowCount() const;
+   size_t GetRowAt(const QPoint& aPosition) const;
+   void   ScrollToRow(size_t aRow);
+   //! Appends the error locations found in aText, drawn at aTopLeft, to mLinks
+   void   FindLinks(const QString& aText, const QPoint& aTopLeft);
+   QUrl   GetLinkAt(const QPoint& aPosition) const;
+
+   std::shared_ptr<wizard::OutputBuffer> mBufferPtr;
+   uint64_t                              mRevision{0};
+   size_t                                mRowCount{0};
+   int                                   mMaxLineWidth{0};
+
+   // The selected rows are [min(mAnchorRow, mCurrentRow), max(mAnchorRow, mCurrentRow)]
+   bool   mHasSelection{false};
+   bool   mSelecting{false};
+   size_t mAnchorRow{0};
+   size_t mCurrentRow{0};
+
+   std::vector<Link>  mLinks; //!< The links drawn by the last repaint
+   QRegularExpression mFileLineColumnRegex;
+   QRegularExpression mFileEofRegex;
+};
+} // namespace SimulationManager
+
+#endif
@@ -670,5 +670,5 @@ void SimulationManager::Plugin::SetupExe(const QString& aPath)
 
 void SimulationManager::Plugin::GuiUpdate()
 {
-   mOutputPanel->AppendQueueToConsole();
+   mOutputPanel->UpdateOutput();
 }
@@ -0,0 +1,738 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "SatelliteCatalog.hpp"
+
+#include <cstring>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <QDateTime>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QSaveFile>
+
+#include "SatelliteInserterModel.hpp"
+#include "SpaceToolsUtil.hpp"
+#include "UtMemory.hpp"
+#include "UtPath.hpp"
+
+namespace // {anonymous}
+{
+const char     cMAGIC[8] = {'A', 'F', 'S', 'A', 'T', 'C', 'A', 'T'};
+const uint32_t cVERSION  = 1;
+
+//! The fixed-size header at the start of a catalog file. All offsets are byte offsets from the start of the file.
+struct Header
+{
+   char     mMagic[8];
+   uint32_t mVersion;
+   uint32_t mRowCount;
+   uint32_t mColumnCount;
+   uint32_t mFileCount;
+   uint32_t mStringCount;
+   uint32_t mBucketCount;
+   int64_t  mSourceSize;
+   int64_t  mSourceModified;
+   uint64_t mStringOffsetsPos;
+   uint64_t mStringDataPos;
+   uint64_t mColumnsPos;
+   uint64_t mNameIndexPos;
+   uint64_t mDesignatorIndexPos;
+   uint64_t mExtentsPos;
+   uint64_t mFilesPos;
+   uint64_t mTotalSize;
+};
+
+struct ExtentRecord
+{
+   uint32_t mFileIndex;
+   uint32_t mPad;
+   uint64_t mOffset;
+   uint64_t mLength;
+};
+
+struct FileRecord
+{
+   uint32_t mPathId;
+   uint32_t mIncludesId;
+   int64_t  mSize;
+   int64_t  mModified;
+};
+
+uint32_t Hash(const char* aDataPtr, size_t aLength)
+{
+   // FNV-1a
+   uint32_t hash = 2166136261u;
+   for (size_t i = 0; i < aLength; ++i)
+   {
+      hash ^= static_cast<unsigned char>(aDataPtr[i]);
+      hash *= 16777619u;
+   }
+   return hash;
+}
+
+uint32_t BucketCountFor(uint32_t aRowCount)
+{
+   uint32_t buckets = 16;
+   while (buckets < aRowCount * 2)
+   {
+      buckets <<= 1;
+   }
+   return buckets;
+}
+
+void Align(QByteArray& aBuffer)
+{
+   while (aBuffer.size() % 8 != 0)
+   {
+      aBuffer.append('\0');
+   }
+}
+
+template<typename T>
+void AppendVector(QByteArray& aBuffer, const std::vector<T>& aValues)
+{
+   if (!aValues.empty())
+   {
+      aBuffer.append(reinterpret_cast<const char*>(aValues.data()), static_cast<int>(aValues.size() * sizeof(T)));
+   }
+}
+
+//! Checks that a section of aCount elements of aElementSize bytes at aPos is aligned and lies within a file of
+//! aSize bytes
+bool IsSectionInside(uint64_t aPos, uint64_t aCount, uint64_t aElementSize, uint64_t aSize)
+{
+   return aPos % 8 == 0 && aPos <= aSize && aCount <= (aSize - aPos) / aElementSize;
+}
+
+//! Checks that every section of a catalog lies within the file, and that the ids and indices stored in the sections
+//! refer to existing entries, so that reading the catalog can not go outside of the file
+bool AreSectionsValid(const uchar* aDataPtr, uint64_t aSize)
+{
+   const Header& header = *reinterpret_cast<const Header*>(aDataPtr);
+
+   // String pool
+   if (!IsSectionInside(header.mStringOffsetsPos, uint64_t{header.mStringCount} + 1, sizeof(uint32_t), aSize))
+   {
+      return false;
+   }
+   const uint32_t* offsets = reinterpret_cast<const uint32_t*>(aDataPtr + header.mStringOffsetsPos);
+   if (!IsSectionInside(header.mStringDataPos, offsets[header.mStringCount], 1, aSize))
+   {
+      return false;
+   }
+   for (uint32_t i = 0; i < header.mStringCount; ++i)
+   {
+      if (offsets[i] > offsets[i + 1])
+      {
+         return false;
+      }
+   }
+
+   // Columns
+   const uint64_t fieldCount = uint64_t{header.mRowCount} * header.mColumnCount;
+   if (!IsSectionInside(header.mColumnsPos, fieldCount, sizeof(uint32_t), aSize))
+   {
+      return false;
+   }
+   const uint32_t* columns = reinterpret_cast<const uint32_t*>(aDataPtr + header.mColumnsPos);
+   for (uint64_t i = 0; i < fieldCount; ++i)
+   {
+      if (columns[i] >= header.mStringCount)
+      {
+         return false;
+      }
+   }
+
+   // Hash indices, which need a power of two buckets and at least one empty bucket
+   const uint32_t bucketCount = header.mBucketCount;
+   if (bucketCount == 0 || (bucketCount & (bucketCount - 1)) != 0 || bucketCount <= header.mRowCount)
+   {
+      return false;
+   }
+   for (uint64_t indexPos : {header.mNameIndexPos, header.mDesignatorIndexPos})
+   {
+      if (!IsSectionInside(indexPos, bucketCount, sizeof(uint32_t), aSize))
+      {
+         return false;
+      }
+      const uint32_t* buckets = reinterpret_cast<const uint32_t*>(aDataPtr + indexPos);
+      for (uint32_t i = 0; i < bucketCount; ++i)
+      {
+         if (buckets[i] > header.mRowCount)
+         {
+            return false;
+         }
+      }
+   }
+
+   // Extents and definition files
+   if (!IsSectionInside(header.mExtentsPos, header.mRowCount, sizeof(ExtentRecord), aSize) ||
+       !IsSectionInside(header.mFilesPos, header.mFileCount, sizeof(FileRecord), aSize))
+   {
+      return false;
+   }
+   const FileRecord* files = reinterpret_cast<const FileRecord*>(aDataPtr + header.mFilesPos);
+   for (uint32_t i = 0; i < header.mFileCount; ++i)
+   {
+      if (files[i].mPathId >= header.mStringCount || files[i].mIncludesId >= header.mStringCount || files[i].mSize < 0)
+      {
+         return false;
+      }
+   }
+   // A definition must lie within its file, as recorded when the catalog was generated, and must be short enough to
+   // be read into a QString
+   const ExtentRecord* extents = reinterpret_cast<const ExtentRecord*>(aDataPtr + header.mExtentsPos);
+   for (uint32_t i = 0; i < header.mRowCount; ++i)
+   {
+      const uint32_t fileIndex = extents[i].mFileIndex;
+      if (fileIndex == SpaceTools::SatelliteCatalog::cNOT_FOUND)
+      {
+         continue;
+      }
+      const SpaceTools::SatelliteCatalog::Extent extent{fileIndex, extents[i].mOffset, extents[i].mLength};
+      if (fileIndex >= header.mFileCount || !extent.IsInside(static_cast<uint64_t>(files[fileIndex].mSize)) ||
+          extent.mLength > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+void GetFileStamp(const QString& aPath, int64_t& aSize, int64_t& aModified)
+{
+   QFileInfo info(aPath);
+   aSize     = info.exists() ? info.size() : -1;
+   aModified = info.exists() ? info.lastModified().toMSecsSinceEpoch() : -1;
+}
+
+//! Interns UTF-8 strings into a pool. Id 0 is always the empty string.
+class StringPool
+{
+public:
+   StringPool() { Intern(QByteArray()); }
+
+   uint32_t Intern(const QByteArray& aValue)
+   {
+      auto it = mIds.find(aValue.toStdString());
+      if (it != mIds.end())
+      {
+         return it->second;
+      }
+      uint32_t id = static_cast<uint32_t>(mOffsets.size());
+      mOffsets.push_back(static_cast<uint32_t>(mData.size()));
+      mData.append(aValue);
+      mIds.emplace(aValue.toStdString(), id);
+      return id;
+   }
+
+   const std::vector<uint32_t>& GetOffsets() const { return mOffsets; }
+   const QByteArray&            GetData() const { return mData; }
+
+private:
+   std::unordered_map<std::string, uint32_t> mIds;
+   std::vector<uint32_t>                     mOffsets;
+   QByteArray                                mData;
+};
+
+//! The platform definitions and include directives found by scanning a definition file
+struct DefinitionScan
+{
+   std::map<QByteArray, std::pair<uint64_t, uint64_t>> mBlocks;
+   QByteArray                                          mIncludes;
+};
+
+//! Scans a definition file the same way SatelliteInserterHandler::FindDefinitions does, recording the byte extent
+//! of each platform definition (starting at its radar signature when one immediately precedes it) instead of
+//! the text itself.
+DefinitionScan ScanDefinitions(const QByteArray& aContents)
+{
+   DefinitionScan scan;
+   bool           inDefinition = false;
+   QByteArray     signatureName;
+   uint64_t       signatureStart = 0;
+   QByteArray     platformName;
+   uint64_t       platformStart = 0;
+
+   int pos = 0;
+   while (pos < aContents.size())
+   {
+      int end = aContents.indexOf('\n', pos);
+      end     = (end < 0) ? aContents.size() : end + 1;
+
+      QByteArray line = aContents.mid(pos, end - pos);
+      while (line.endsWith('\n') || line.endsWith('\r'))
+      {
+         line.chop(1);
+      }
+      auto tokens = line.split(' ');
+      if ((tokens[0] == "include" || tokens[0] == "include_once") && !inDefinition)
+      {
+         scan.mIncludes.append(line).append('\n');
+      }
+      else if (tokens[0] == "radar_signature" && tokens.size() >= 2)
+      {
+         inDefinition   = true;
+         signatureName  = tokens[1];
+         signatureStart = static_cast<uint64_t>(pos);
+      }
+      else if (tokens[0] == "platform" && tokens.size() >= 2)
+      {
+         inDefinition  = true;
+         platformName  = tokens[1];
+         platformStart =
+            (signatureName == platformName + "_RADAR_SIGNATURE") ? signatureStart : static_cast<uint64_t>(pos);
+      }
+      else if (tokens[0] == "end_platform")
+      {
+         inDefinition = false;
+         if (!platformName.isEmpty() && scan.mBlocks.count(platformName) == 0)
+         {
+            scan.mBlocks[platformName] = std::make_pair(platformStart, static_cast<uint64_t>(end) - platformStart);
+         }
+         platformName.clear();
+         signatureName.clear();
+      }
+      else if (tokens[0] == "end_radar_signature")
+      {
+         inDefinition = false;
+      }
+      pos = end;
+   }
+   return scan;
+}
+
+std::mutex                                                           sCatalogMutex;
+std::map<QString, std::weak_ptr<const SpaceTools::SatelliteCatalog>> sCatalogs;
+} // namespace
+
+SpaceTools::SatelliteCatalog::~SatelliteCatalog()
+{
+   if (mFilePtr && mDataPtr)
+   {
+      mFilePtr->unmap(const_cast<uchar*>(mDataPtr));
+   }
+}
+
+//! Gets the catalog for the given JSON database, generating it if it does not exist or is out of date.
+//! Catalogs are shared between all users of the same database.
+//!
+//! @param aDatabasePath The path of the JSON database
+//! @returns The catalog, or null if the database does not exist or is not a valid JSON database
+std::shared_ptr<const SpaceTools::SatelliteCatalog> SpaceTools::SatelliteCatalog::Load(const QString& aDatabasePath)
+{
+   QString databasePath = QString::fromStdString(UtPath(aDatabasePath.toStdString()).GetNormalizedPath());
+
+   std::lock_guard<std::mutex> lock(sCatalogMutex);
+   auto                        catalog = sCatalogs[databasePath].lock();
+   if (!catalog || !catalog->IsCurrent(databasePath))
+   {
+      catalog                 = Open(databasePath, GetCatalogPath(databasePath));
+      sCatalogs[databasePath] = catalog;
+   }
+   return catalog;
+}
+
+//! Gets the path of the binary catalog that accompanies the given JSON database
+QString SpaceTools::SatelliteCatalog::GetCatalogPath(const QString& aDatabasePath)
+{
+   QFileInfo info(aDatabasePath);
+   return info.path() + '/' + info.completeBaseName() + ".sicat";
+}
+
+std::shared_ptr<const SpaceTools::SatelliteCatalog> SpaceTools::SatelliteCatalog::Open(const QString& aDatabasePath,
+                                                                                       const QString& aCatalogPath)
+{
+   auto catalog           = std::make_shared<SatelliteCatalog>();
+   catalog->mDatabasePath = aDatabasePath;
+
+   // Map an existing catalog if it was generated from the current database
+   auto file = ut::make_unique<QFile>(aCatalogPath);
+   if (file->open(QIODevice::ReadOnly))
+   {
+      const uchar* dataPtr = file->map(0, file->size());
+      if (dataPtr)
+      {
+         catalog->mFilePtr = std::move(file);
+         if (catalog->Attach(dataPtr, catalog->mFilePtr->size()) && catalog->IsCurrent(aDatabasePath))
+         {
+            return catalog;
+         }
+         catalog->mFilePtr->unmap(const_cast<uchar*>(dataPtr));
+         catalog->mFilePtr.reset();
+         catalog->mDataPtr = nullptr;
+      }
+   }
+
+   // Otherwise, generate it from the JSON database
+   QJsonDocument database = Util::GetDatabase(aDatabasePath);
+   if (database.isNull())
+   {
+      return nullptr;
+   }
+   catalog->mOwnedData = Build(aDatabasePath, database);
+
+   // Save the catalog for the next load. If the database directory is not writable, the in-memory copy is used.
+   QSaveFile output(aCatalogPath);
+   if (output.open(QIODevice::WriteOnly))
+   {
+      output.write(catalog->mOwnedData);
+      output.commit();
+   }
+
+   if (!catalog->Attach(reinterpret_cast<const uchar*>(catalog->mOwnedData.constData()), catalog->mOwnedData.size()))
+   {
+      return nullptr;
+   }
+   return catalog;
+}
+
+QByteArray SpaceTools::SatelliteCatalog::Build(const QString& aDatabasePath, const QJsonDocument& aDatabase)
+{
+   const uint32_t columnCount = SatelliteInserterModel::cLAST_COLUMN;
+   auto           platforms   = aDatabase.object()["platforms"].toArray();
+   const uint32_t rowCount    = static_cast<uint32_t>(platforms.size());
+
+   // Gather the fields of every platform
+   std::vector<std::vector<QByteArray>>        rows(rowCount, std::vector<QByteArray>(columnCount));
+   std::map<QByteArray, std::vector<uint32_t>> designatorRows;
+   for (uint32_t i = 0; i < rowCount; ++i)
+   {
+      auto platform = platforms.at(static_cast<int>(i)).toObject();
+      for (uint32_t j = 0; j < columnCount; ++j)
+      {
+         if (j != SatelliteInserterModel::cDATABASE)
+         {
+            rows[i][j] = platform[SatelliteInserterModel::GetFieldKey(static_cast<int>(j))].toString().toUtf8();
+         }
+      }
+      const QByteArray& designator = rows[i][SatelliteInserterModel::cDESIGNATOR];
+      if (!designator.isEmpty())
+      {
+         designatorRows[designator].push_back(i);
+      }
+   }
+
+   // Entries that share a designator fill in each other's missing fields
+   for (const auto& designator : designatorRows)
+   {
+      const auto& matches = designator.second;
+      for (size_t k = 1; k < matches.size(); ++k)
+      {
+         for (uint32_t j = 0; j < columnCount; ++j)
+         {
+            if (rows[matches[0]][j].isEmpty())
+            {
+               rows[matches[0]][j] = rows[matches[k]][j];
+            }
+         }
+      }
+      for (size_t k = 1; k < matches.size(); ++k)
+      {
+         for (uint32_t j = 0; j < columnCount; ++j)
+         {
+            if (rows[matches[k]][j].isEmpty())
+            {
+               rows[matches[k]][j] = rows[matches[0]][j];
+            }
+         }
+      }
+   }
+
+   // Intern the fields into columns
+   StringPool            pool;
+   std::vector<uint32_t> columns(static_cast<size_t>(columnCount) * rowCount);
+   for (uint32_t i = 0; i < rowCount; ++i)
+   {
+      for (uint32_t j = 0; j < columnCount; ++j)
+      {
+         columns[static_cast<size_t>(j) * rowCount + i] = pool.Intern(rows[i][j]);
+      }
+   }
+
+   // Hash indices
+   const uint32_t bucketCount = BucketCountFor(rowCount);
+   auto           buildIndex  = [&](uint32_t aColumn)
+   {
+      std::vector<uint32_t> buckets(bucketCount, 0);
+      for (uint32_t i = 0; i < rowCount; ++i)
+      {
+         const QByteArray& key = rows[i][aColumn];
+         if (key.isEmpty())
+         {
+            continue;
+         }
+         uint32_t bucket = Hash(key.constData(), static_cast<size_t>(key.size())) & (bucketCount - 1);
+         while (buckets[bucket] != 0)
+         {
+            if (rows[buckets[bucket] - 1][aColumn] == key)
+            {
+               break; // keep the first row with this key
+            }
+            bucket = (bucket + 1) & (bucketCount - 1);
+         }
+         if (buckets[bucket] == 0)
+         {
+            buckets[bucket] = i + 1;
+         }
+      }
+      return buckets;
+   };
+   std::vector<uint32_t> nameIndex       = buildIndex(SatelliteInserterModel::cNAME);
+   std::vector<uint32_t> designatorIndex = buildIndex(SatelliteInserterModel::cDESIGNATOR);
+
+   // Scan each definition file once and record the extent of each platform's definition
+   QString                        basePath = QFileInfo(aDatabasePath).path();
+   std::map<QByteArray, uint32_t> fileIndices;
+   std::vector<FileRecord>        files;
+   std::vector<DefinitionScan>    scans;
+   std::vector<ExtentRecord>      extents(rowCount, ExtentRecord{cNOT_FOUND, 0, 0, 0});
+   for (uint32_t i = 0; i < rowCount; ++i)
+   {
+      const QByteArray& fileName = rows[i][SatelliteInserterModel::cFILE];
+      if (fileName.isEmpty())
+      {
+         continue;
+      }
+      auto it = fileIndices.find(fileName);
+      if (it == fileIndices.end())
+      {
+         QString    path = basePath + '/' + QString::fromUtf8(fileName);
+         FileRecord record{pool.Intern(fileName), 0, -1, -1};
+         QFile      definitionFile(path);
+         if (definitionFile.open(QIODevice::ReadOnly))
+         {
+            scans.push_back(ScanDefinitions(definitionFile.readAll()));
+            GetFileStamp(path, record.mSize, record.mModified);
+         }
+         else
+         {
+            scans.emplace_back();
+         }
+         record.mIncludesId = pool.Intern(scans.back().mIncludes);
+         it                 = fileIndices.emplace(fileName, static_cast<uint32_t>(files.size())).first;
+         files.push_back(record);
+      }
+      const auto& blocks = scans[it->second].mBlocks;
+      auto        block  = blocks.find(rows[i][SatelliteInserterModel::cNAME]);
+      if (block != blocks.end())
+      {
+         extents[i] = ExtentRecord{it->second, 0, block->second.first, block->second.second};
+      }
+   }
+
+   // Lay out the file
+   Header header;
+   std::memset(&header, 0, sizeof(header));
+   std::memcpy(header.mMagic, cMAGIC, sizeof(cMAGIC));
+   header.mVersion     = cVERSION;
+   header.mRowCount    = rowCount;
+   header.mColumnCount = columnCount;
+   header.mFileCount   = static_cast<uint32_t>(files.size());
+   header.mStringCount = static_cast<uint32_t>(pool.GetOffsets().size());
+   header.mBucketCount = bucketCount;
+   GetFileStamp(aDatabasePath, header.mSourceSize, header.mSourceModified);
+
+   QByteArray buffer(static_cast<int>(sizeof(Header)), '\0');
+   Align(buffer);
+   header.mStringOffsetsPos = static_cast<uint64_t>(buffer.size());
+   std::vector<uint32_t> stringOffsets = pool.GetOffsets();
+   stringOffsets.push_back(static_cast<uint32_t>(pool.GetData().size()));
+   AppendVector(buffer, stringOffsets);
+   Align(buffer);
+   header.mStringDataPos = static_cast<uint64_t>(buffer.size());
+   buffer.append(pool.GetData());
+   Align(buffer);
+   header.mColumnsPos = static_cast<uint64_t>(buffer.size());
+   AppendVector(buffer, columns);
+   Align(buffer);
+   header.mNameIndexPos = static_cast<uint64_t>(buffer.size());
+   AppendVector(buffer, nameIndex);
+   Align(buffer);
+   header.mDesignatorIndexPos = static_cast<uint64_t>(buffer.size());
+   AppendVector(buffer, designatorIndex);
+   Align(buffer);
+   header.mExtentsPos = static_cast<uint64_t>(buffer.size());
+   AppendVector(buffer, extents);
+   Align(buffer);
+   header.mFilesPos = static_cast<uint64_t>(buffer.size());
+   AppendVector(buffer, files);
+   header.mTotalSize = static_cast<uint64_t>(buffer.size());
+   std::memcpy(buffer.data(), &header, sizeof(header));
+   return buffer;
+}
+
+bool SpaceTools::SatelliteCatalog::Attach(const uchar* aDataPtr, qint64 aSize)
+{
+   if (aSize < static_cast<qint64>(sizeof(Header)))
+   {
+      return false;
+   }
+   const Header* headerPtr = reinterpret_cast<const Header*>(aDataPtr);
+   if (std::memcmp(headerPtr->mMagic, cMAGIC, sizeof(cMAGIC)) != 0 || headerPtr->mVersion != cVERSION ||
+       headerPtr->mTotalSize != static_cast<uint64_t>(aSize) ||
+       headerPtr->mColumnCount != static_cast<uint32_t>(SatelliteInserterModel::cLAST_COLUMN) ||
+       !AreSectionsValid(aDataPtr, static_cast<uint64_t>(aSize)))
+   {
+      return false;
+   }
+   mDataPtr = aDataPtr;
+   mSize    = aSize;
+   return true;
+}
+
+bool SpaceTools::SatelliteCatalog::IsCurrent(const QString& aDatabasePath) const
+{
+   int64_t size;
+   int64_t modified;
+   GetFileStamp(aDatabasePath, size, modified);
+   const Header* headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   return headerPtr->mSourceSize == size && headerPtr->mSourceModified == modified;
+}
+
+//! Gets the number of platforms in the catalog
+uint32_t SpaceTools::SatelliteCatalog::GetRowCount() const
+{
+   return reinterpret_cast<const Header*>(mDataPtr)->mRowCount;
+}
+
+//! Gets the number of fields stored per platform
+uint32_t SpaceTools::SatelliteCatalog::GetColumnCount() const
+{
+   return reinterpret_cast<const Header*>(mDataPtr)->mColumnCount;
+}
+
+//! Gets the interned id of a field. Equal ids within a catalog imply equal strings.
+//!
+//! @param aRow The platform row
+//! @param aColumn The SatelliteInserterModel::FieldColumn
+//! @returns The string id of the field
+uint32_t SpaceTools::SatelliteCatalog::GetStringId(uint32_t aRow, uint32_t aColumn) const
+{
+   const Header*   headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   const uint32_t* columns   = reinterpret_cast<const uint32_t*>(mDataPtr + headerPtr->mColumnsPos);
+   return columns[static_cast<size_t>(aColumn) * headerPtr->mRowCount + aRow];
+}
+
+const char* SpaceTools::SatelliteCatalog::GetStringData(uint32_t aStringId, uint32_t& aLength) const
+{
+   const Header*   headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   const uint32_t* offsets   = reinterpret_cast<const uint32_t*>(mDataPtr + headerPtr->mStringOffsetsPos);
+   aLength                   = offsets[aStringId + 1] - offsets[aStringId];
+   return reinterpret_cast<const char*>(mDataPtr + headerPtr->mStringDataPos + offsets[aStringId]);
+}
+
+//! Gets the string with the given id
+QString SpaceTools::SatelliteCatalog::GetString(uint32_t aStringId) const
+{
+   uint32_t    length;
+   const char* dataPtr = GetStringData(aStringId, length);
+   return QString::fromUtf8(dataPtr, static_cast<int>(length));
+}
+
+uint32_t SpaceTools::SatelliteCatalog::Find(const QByteArray& aKey, uint64_t aIndexPos, uint32_t aColumn) const
+{
+   if (aKey.isEmpty())
+   {
+      return cNOT_FOUND;
+   }
+   const Header*   headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   const uint32_t* buckets   = reinterpret_cast<const uint32_t*>(mDataPtr + aIndexPos);
+   const uint32_t  mask      = headerPtr->mBucketCount - 1;
+   for (uint32_t bucket = Hash(aKey.constData(), static_cast<size_t>(aKey.size())) & mask; buckets[bucket] != 0;
+        bucket          = (bucket + 1) & mask)
+   {
+      uint32_t    row = buckets[bucket] - 1;
+      uint32_t    length;
+      const char* dataPtr = GetStringData(GetStringId(row, aColumn), length);
+      if (length == static_cast<uint32_t>(aKey.size()) && std::memcmp(dataPtr, aKey.constData(), length) == 0)
+      {
+         return row;
+      }
+   }
+   return cNOT_FOUND;
+}
+
+//! Finds the first platform with the given name
+//!
+//! @param aName The name of the platform
+//! @returns The row of the platform or cNOT_FOUND
+uint32_t SpaceTools::SatelliteCatalog::FindByName(const QString& aName) const
+{
+   return Find(aName.toUtf8(), reinterpret_cast<const Header*>(mDataPtr)->mNameIndexPos, SatelliteInserterModel::cNAME);
+}
+
+//! Finds the first platform with the given designator
+//!
+//! @param aDesignator The designator of the platform
+//! @returns The row of the platform or cNOT_FOUND
+uint32_t SpaceTools::SatelliteCatalog::FindByDesignator(const QString& aDesignator) const
+{
+   return Find(aDesignator.toUtf8(),
+               reinterpret_cast<const Header*>(mDataPtr)->mDesignatorIndexPos,
+               SatelliteInserterModel::cDESIGNATOR);
+}
+
+//! Gets the location of a platform's definition in its definition file
+//!
+//! @param aRow The platform row
+//! @param aExtent Returns the file index and byte extent of the definition
+//! @returns True if the definition was found when the catalog was generated
+bool SpaceTools::SatelliteCatalog::GetExtent(uint32_t aRow, Extent& aExtent) const
+{
+   const Header*       headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   const ExtentRecord& record    = reinterpret_cast<const ExtentRecord*>(mDataPtr + headerPtr->mExtentsPos)[aRow];
+   aExtent.mFileIndex            = record.mFileIndex;
+   aExtent.mOffset               = record.mOffset;
+   aExtent.mLength               = record.mLength;
+   return record.mFileIndex != cNOT_FOUND;
+}
+
+//! Gets the number of definition files referenced by the catalog
+uint32_t SpaceTools::SatelliteCatalog::GetFileCount() const
+{
+   return reinterpret_cast<const Header*>(mDataPtr)->mFileCount;
+}
+
+//! Gets the path of a definition file, relative to the database
+QString SpaceTools::SatelliteCatalog::GetFilePath(uint32_t aFileIndex) const
+{
+   const Header* headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   return GetString(reinterpret_cast<const FileRecord*>(mDataPtr + headerPtr->mFilesPos)[aFileIndex].mPathId);
+}
+
+//! Gets the include directives that appear outside of platform definitions in a definition file, one per line
+QString SpaceTools::SatelliteCatalog::GetFileIncludes(uint32_t aFileIndex) const
+{
+   const Header* headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   return GetString(reinterpret_cast<const FileRecord*>(mDataPtr + headerPtr->mFilesPos)[aFileIndex].mIncludesId);
+}
+
+//! Checks that a definition file has not changed since the catalog was generated
+//!
+//! @param aFileIndex The index of the definition file
+//! @param aAbsolutePath The location of the definition file
+//! @returns True if the recorded extents may be used to read from the file
+bool SpaceTools::SatelliteCatalog::IsFileCurrent(uint32_t aFileIndex, const QString& aAbsolutePath) const
+{
+   const Header*     headerPtr = reinterpret_cast<const Header*>(mDataPtr);
+   const FileRecord& record    = reinterpret_cast<const FileRecord*>(mDataPtr + headerPtr->mFilesPos)[aFileIndex];
+   int64_t           size;
+   int64_t           modified;
+   GetFileStamp(aAbsolutePath, size, modified);
+   return record.mSize >= 0 && record.mSize == size && record.mModified == modified;
+}
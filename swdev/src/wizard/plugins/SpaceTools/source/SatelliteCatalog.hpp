@@ -0,0 +1,95 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2019 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef SATELLITECATALOG_HPP
+#define SATELLITECATALOG_HPP
+
+#include <cstdint>
+#include <memory>
+
+#include <QByteArray>
+#include <QFile>
+#include <QJsonDocument>
+#include <QString>
+
+namespace SpaceTools
+{
+//! A compact, memory-mapped binary form of a Satellite Inserter JSON database.
+//!
+//! The catalog is generated from the JSON database the first time it is loaded and is written next to it
+//! (e.g. satcat.json -> satcat.sicat). Subsequent loads map the binary file directly. It contains:
+//! - a pool of unique UTF-8 strings,
+//! - one string id column per SatelliteInserterModel::FieldColumn,
+//! - open-addressed hash indices on the name and designator columns,
+//! - the byte extent of each platform definition (including a preceding radar signature) in its definition file,
+//! - the include directives and size/modification time of each definition file.
+//!
+//! The catalog is stale (and is rebuilt) when the JSON database's size or modification time changes. Definition
+//! extents are only trusted when the definition file's size and modification time still match, see IsFileCurrent.
+class SatelliteCatalog
+{
+public:
+   static constexpr uint32_t cNOT_FOUND = 0xFFFFFFFF;
+
+   //! The byte extent of a platform definition within its definition file
+   struct Extent
+   {
+      uint32_t mFileIndex;
+      uint64_t mOffset;
+      uint64_t mLength;
+
+      //! Returns true if the extent lies within a file of aSize bytes
+      bool IsInside(uint64_t aSize) const { return mOffset <= aSize && mLength <= aSize - mOffset; }
+   };
+
+   SatelliteCatalog()                        = default;
+   SatelliteCatalog(const SatelliteCatalog&) = delete;
+   SatelliteCatalog& operator=(const SatelliteCatalog&) = delete;
+   ~SatelliteCatalog();
+
+   static std::shared_ptr<const SatelliteCatalog> Load(const QString& aDatabasePath);
+   static QString                                 GetCatalogPath(const QString& aDatabasePath);
+
+   //! Get the normalized path of the JSON database this catalog was generated from
+   const QString& GetDatabasePath() const { return mDatabasePath; }
+
+   uint32_t GetRowCount() const;
+   uint32_t GetColumnCount() const;
+   uint32_t GetStringId(uint32_t aRow, uint32_t aColumn) const;
+   QString  GetString(uint32_t aStringId) const;
+   QString  GetField(uint32_t aRow, uint32_t aColumn) const { return GetString(GetStringId(aRow, aColumn)); }
+
+   uint32_t FindByName(const QString& aName) const;
+   uint32_t FindByDesignator(const QString& aDesignator) const;
+
+   bool     GetExtent(uint32_t aRow, Extent& aExtent) const;
+   uint32_t GetFileCount() const;
+   QString  GetFilePath(uint32_t aFileIndex) const;
+   QString  GetFileIncludes(uint32_t aFileIndex) const;
+   bool     IsFileCurrent(uint32_t aFileIndex, const QString& aAbsolutePath) const;
+
+private:
+   static std::shared_ptr<const SatelliteCatalog> Open(const QString& aDatabasePath, const QString& aCatalogPath);
+   static QByteArray                              Build(const QString& aDatabasePath, const QJsonDocument& aDatabase);
+
+   bool        Attach(const uchar* aDataPtr, qint64 aSize);
+   bool        IsCurrent(const QString& aDatabasePath) const;
+   const char* GetStringData(uint32_t aStringId, uint32_t& aLength) const;
+   uint32_t    Find(const QByteArray& aKey, uint64_t aIndexPos, uint32_t aColumn) const;
+
+   QString                mDatabasePath;
+   std::unique_ptr<QFile> mFilePtr;
+   QByteArray             mOwnedData;
+   const uchar*           mDataPtr{nullptr};
+   qint64                 mSize{0};
+};
+} // namespace SpaceTools
+#endif
@@ -23,6 +23,7 @@
 #include "Project.hpp"
 #include "ProjectWorkspace.hpp"
 #include "ProxyWatcher.hpp"
+#include "SatelliteCatalog.hpp"
 #include "SatelliteInserterModel.hpp"
 #include "SpaceToolsScenario.hpp"
 #include "TextSourceCache.hpp"
@@ -60,16 +61,16 @@ void SpaceTools::SatelliteInserterHandler::SetInsertFile(const QString& aFile)
    }
 }
 
-std::map<QString, std::pair<UtPath, std::vector<QString>>>
+std::map<QString, SpaceTools::SatelliteInserterHandler::InsertGroup>
 SpaceTools::SatelliteInserterHandler::GetInsertPlatforms(const QAbstractItemModel* aModelPtr,
                                                          const QModelIndexList&    aIndexList)
 {
-   std::map<QString, std::pair<UtPath, std::vector<QString>>> filePlatName;
-   QSet<QString>                                              insertedPlatforms{};
-   QSet<QString>                                              duplicatePlatforms{};
-   QSet<QString>                                              existingPlatforms{};
-   QSet<QString>                                              existingDesignators{};
-   QSet<QString>                                              allDesignators{GetDesignators()};
+   std::map<QString, InsertGroup> filePlatName;
+   QSet<QString>                  insertedPlatforms{};
+   QSet<QString>                  duplicatePlatforms{};
+   QSet<QString>                  existingPlatforms{};
+   QSet<QString>                  existingDesignators{};
+   QSet<QString>                  allDesignators{GetDesignators()};
 
    WsfPProxy* proxyPtr = wizard::ProxyWatcher::GetActiveProxy();
    WsfPM_Root root(proxyPtr);
@@ -115,18 +116,16 @@ SpaceTools::SatelliteInserterHandler::GetInsertPlatforms(const QAbstractItemMode
       auto it = filePlatName.find(fileLoc);
       if (it != filePlatName.end())
       {
-         it->second.second.push_back(platName);
+         it->second.mPlatforms.push_back(platName);
       }
       else
       {
-         UtPath basePath{
+         QString database{
             aModelPtr->data(aModelPtr->index(row, SatelliteInserterModel::FieldColumn::cDATABASE), Qt::UserRole)
-               .toString()
-               .toStdString()};
+               .toString()};
+         UtPath basePath{database.toStdString()};
          basePath.Up();
-         std::vector<QString>                    newVec = {platName};
-         std::pair<UtPath, std::vector<QString>> pair{basePath, newVec};
-         filePlatName[fileLoc] = pair;
+         filePlatName[fileLoc] = InsertGroup{basePath, database, {platName}};
       }
       insertedPlatforms.insert(platName);
    }
@@ -172,10 +171,13 @@ void SpaceTools::SatelliteInserterHandler::InsertSatellites(const QAbstractItemM
          QString definitions;
          for (auto& inFile : platformMap) // for every file that has a platform definition
          {
-            auto insertFile   = inFile.first;
-            auto basePath     = inFile.second.first;
-            auto platformList = inFile.second.second;
-            definitions.append(FindDefinitions(insertFile, basePath, platformList, invalidFiles));
+            const auto& insertFile = inFile.first;
+            const auto& group      = inFile.second;
+            if (!FindIndexedDefinitions(insertFile, group, definitions))
+            {
+               auto platformList = group.mPlatforms;
+               definitions.append(FindDefinitions(insertFile, group.mBasePath, platformList, invalidFiles));
+            }
          } // for infile
 
          if (!definitions.isEmpty())
@@ -214,8 +216,9 @@ QString SpaceTools::SatelliteInserterHandler::FindDefinitions(const QString&
    {
       QTextStream in(&inputFile);
 
-      bool insertDefinition     = false;
-      bool inPlatformDefinition = false;
+      std::set<std::string> sources              = GetSourcePaths();
+      bool                  insertDefinition     = false;
+      bool                  inPlatformDefinition = false;
       while (!in.atEnd())
       {
          QString line     = in.readLine();
@@ -223,37 +226,7 @@ QString SpaceTools::SatelliteInserterHandler::FindDefinitions(const QString&
          // Only add include files that are not in platform definitions.
          if ((splitStr.at(0) == "include" || splitStr.at(0) == "include_once") && !inPlatformDefinition)
          {
-            QString includeString("include ");
-            if (line.contains("include_once"))
-            {
-               includeString = "include_once ";
-            }
-
-            // includePath is the path to the platform type definition
-            // line.right removes the "include " or "include_once "from the string
-            UtPath includePath(aBasePath.GetNormalizedPath() + '/' +
-                               line.right(line.size() - includeString.size()).toStdString());
-            auto   sources         = wizard::Project::Instance()->GetSourceCache().GetSources();
-            bool   alreadyIncluded = false;
-            includePath            = includePath.GetNormalizedPath();
-            // checks if the new include file is already included in the scenario. If it isn't, include it.
-            for (const auto& source : sources)
-            {
-               UtPath sourcePath(source.first);
-               if (includePath == sourcePath.GetNormalizedPath())
-               {
-                  alreadyIncluded = true;
-                  break;
-               }
-            }
-            if (alreadyIncluded)
-            {
-               continue;
-            }
-
-            QString includeLine =
-               includeString + QString::fromStdString(includePath.GetRealPath().GetNormalizedPath()) + "\n\n";
-            definitions.append(includeLine);
+            definitions.append(GetIncludeLine(line, aBasePath, sources));
          }
          else if ((splitStr.at(0) == "platform" || splitStr.at(0) == "radar_signature") && !insertDefinition)
          {
@@ -301,6 +274,124 @@ QString SpaceTools::SatelliteInserterHandler::FindDefinitions(const QString&
    return definitions;
 }
 
+//! Reads the definitions of the group's platforms using the extents recorded in the database's catalog
+//!
+//! @param aFile The definition file, relative to the database
+//! @param aGroup The platforms to insert from the file
+//! @param aDefinitions The definitions and needed include directives are appended to this
+//! @returns False if the catalog cannot be used (e.g. the definition file changed since the catalog was generated),
+//!          in which case nothing is appended and the definition file must be scanned.
+bool SpaceTools::SatelliteInserterHandler::FindIndexedDefinitions(const QString&     aFile,
+                                                                  const InsertGroup& aGroup,
+                                                                  QString&           aDefinitions)
+{
+   auto catalog = SatelliteCatalog::Load(aGroup.mDatabase);
+   if (!catalog)
+   {
+      return false;
+   }
+
+   // Resolve every platform through the name index before touching the definition file
+   std::vector<SatelliteCatalog::Extent> extents;
+   for (const auto& platform : aGroup.mPlatforms)
+   {
+      SatelliteCatalog::Extent extent;
+      uint32_t                 row = catalog->FindByName(platform);
+      if (row == SatelliteCatalog::cNOT_FOUND || !catalog->GetExtent(row, extent) ||
+          catalog->GetFilePath(extent.mFileIndex) != aFile)
+      {
+         return false;
+      }
+      extents.push_back(extent);
+   }
+   if (extents.empty())
+   {
+      return true;
+   }
+
+   QString definitionFilePath{QString::fromStdString(aGroup.mBasePath.GetNormalizedPath()) + '/' + aFile};
+   QFile   inputFile(definitionFilePath);
+   if (!catalog->IsFileCurrent(extents.front().mFileIndex, definitionFilePath) || !inputFile.open(QIODevice::ReadOnly))
+   {
+      return false;
+   }
+   const uchar* dataPtr = inputFile.map(0, inputFile.size());
+   if (!dataPtr)
+   {
+      return false;
+   }
+   // The catalog was validated against the recorded file size, which IsFileCurrent compared, but the file may have
+   // changed since
+   const uint64_t fileSize = static_cast<uint64_t>(inputFile.size());
+   for (const auto& extent : extents)
+   {
+      if (!extent.IsInside(fileSize))
+      {
+         inputFile.unmap(const_cast<uchar*>(dataPtr));
+         return false;
+      }
+   }
+
+   std::set<std::string> sources = GetSourcePaths();
+   for (const auto& line : catalog->GetFileIncludes(extents.front().mFileIndex).split('\n', QString::SkipEmptyParts))
+   {
+      aDefinitions.append(GetIncludeLine(line, aGroup.mBasePath, sources));
+   }
+   for (const auto& extent : extents)
+   {
+      QString definition = QString::fromUtf8(reinterpret_cast<const char*>(dataPtr + extent.mOffset),
+                                             static_cast<int>(extent.mLength));
+      definition.remove('\r');
+      if (!definition.endsWith('\n'))
+      {
+         definition.append('\n');
+      }
+      aDefinitions.append(definition + '\n');
+   }
+   inputFile.unmap(const_cast<uchar*>(dataPtr));
+   return true;
+}
+
+//! Gets the include directive to insert for an include directive found in a definition file
+//!
+//! @param aLine The include or include_once directive
+//! @param aBasePath The directory that the include is relative to
+//! @param aSources The files that are already part of the scenario
+//! @returns The include directive with its path resolved, or an empty string if the file is already included
+QString SpaceTools::SatelliteInserterHandler::GetIncludeLine(const QString&               aLine,
+                                                             const UtPath&                aBasePath,
+                                                             const std::set<std::string>& aSources)
+{
+   QString includeString("include ");
+   if (aLine.contains("include_once"))
+   {
+      includeString = "include_once ";
+   }
+
+   // includePath is the path to the platform type definition
+   // aLine.right removes the "include " or "include_once "from the string
+   UtPath includePath(aBasePath.GetNormalizedPath() + '/' +
+                      aLine.right(aLine.size() - includeString.size()).toStdString());
+   includePath = includePath.GetNormalizedPath();
+   // checks if the new include file is already included in the scenario. If it isn't, include it.
+   if (aSources.count(includePath.GetNormalizedPath()) > 0)
+   {
+      return QString();
+   }
+   return includeString + QString::fromStdString(includePath.GetRealPath().GetNormalizedPath()) + "\n\n";
+}
+
+//! Gets the normalized paths of the files that are part of the scenario
+std::set<std::string> SpaceTools::SatelliteInserterHandler::GetSourcePaths()
+{
+   std::set<std::string> paths;
+   for (const auto& source : wizard::Project::Instance()->GetSourceCache().GetSources())
+   {
+      paths.insert(UtPath(source.first).GetNormalizedPath());
+   }
+   return paths;
+}
+
 const QSet<QString> SpaceTools::SatelliteInserterHandler::GetDesignators()
 {
    QSet<QString> allDesignator{};
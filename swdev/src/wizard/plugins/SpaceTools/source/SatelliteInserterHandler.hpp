@@ -13,6 +13,8 @@
 #define SATELLITEINSERTERHANDLER_HPP
 
 #include <map>
+#include <set>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -36,12 +38,23 @@ public:
    void           InsertSatellites(const QAbstractItemModel* aModelPtr, const QModelIndexList& aIndexList);
 
 private:
-   static std::map<QString, std::pair<UtPath, std::vector<QString>>> GetInsertPlatforms(const QAbstractItemModel* aModelPtr,
-                                                                                        const QModelIndexList& aIndexList);
-   static QString                                                    FindDefinitions(const QString&        aFile,
-                                                                                     const UtPath&         aBasePath,
-                                                                                     std::vector<QString>& aPlatforms,
-                                                                                     QSet<QString>&        aInvalidFilesList);
+   //! The platforms to insert from one definition file
+   struct InsertGroup
+   {
+      UtPath               mBasePath;
+      QString              mDatabase;
+      std::vector<QString> mPlatforms;
+   };
+
+   static std::map<QString, InsertGroup> GetInsertPlatforms(const QAbstractItemModel* aModelPtr,
+                                                            const QModelIndexList&    aIndexList);
+   static bool    FindIndexedDefinitions(const QString& aFile, const InsertGroup& aGroup, QString& aDefinitions);
+   static QString FindDefinitions(const QString&        aFile,
+                                  const UtPath&         aBasePath,
+                                  std::vector<QString>& aPlatforms,
+                                  QSet<QString>&        aInvalidFilesList);
+   static QString GetIncludeLine(const QString& aLine, const UtPath& aBasePath, const std::set<std::string>& aSources);
+   static std::set<std::string> GetSourcePaths();
 
    static const QSet<QString> GetDesignators();
 
@@ -11,92 +11,34 @@
 
 #include "SatelliteInserterModel.hpp"
 
-#include <map>
+#include <algorithm>
 
-#include <QJsonArray>
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QSet>
-
-#include "UtCast.hpp"
 #include "UtPath.hpp"
 
-SpaceTools::SatelliteInserterModel::SatelliteInserterModel(const std::map<QString, QJsonDocument>& aDatabases)
+SpaceTools::SatelliteInserterModel::SatelliteInserterModel(
+   const std::map<QString, std::shared_ptr<const SatelliteCatalog>>& aDatabases)
 {
-   mData.clear();
-   std::multimap<QString, int> insertedPlatforms;
-   QSet<QString>               insertedDesignators;
    for (const auto& database : aDatabases)
    {
-      auto obj = database.second.object();
-      auto arr = obj["platforms"].toArray();
-      for (int i = 0; i < arr.size(); ++i)
+      if (database.second)
       {
-         std::map<int, QString> platform;
-         auto                   plat = arr.at(i).toObject();
-
-         for (int j = 0; j < cLAST_COLUMN; ++j)
-         {
-            auto header  = headerData(j, Qt::Orientation::Horizontal, Qt::DisplayRole).toString();
-            header       = header.toLower().replace(' ', '_');
-            QString data = plat[header].toString();
-            if (j == cDATABASE)
-            {
-               data = database.first;
-            }
-            else if (j == cDESIGNATOR && !data.isEmpty())
-            {
-               insertedPlatforms.insert(std::pair<QString, int>(data, i));
-               insertedDesignators.insert(data);
-            }
-            platform[j] = data;
-         }
-         mData.push_back(platform);
+         mDatabases.push_back(Database{database.first, database.second, mRowCount});
+         mRowCount += static_cast<int>(database.second->GetRowCount());
       }
    }
-   SetExistingData(insertedPlatforms, insertedDesignators);
 }
 
-void SpaceTools::SatelliteInserterModel::SetExistingData(const std::multimap<QString, int>& aInsertedPlatforms,
-                                                         const QSet<QString>&               aInsertedDesignators)
+//! Finds the database that holds the given row
+//!
+//! @param aRow The model row
+//! @returns The database containing the row
+const SpaceTools::SatelliteInserterModel::Database* SpaceTools::SatelliteInserterModel::FindDatabase(int aRow) const
 {
-   for (const auto& designator : aInsertedDesignators)
-   {
-      if (aInsertedPlatforms.count(designator) > 1)
-      {
-         auto  range     = aInsertedPlatforms.equal_range(designator);
-         auto& firstRow  = range.first;
-         int   row1      = firstRow->second;
-         auto  secondRow = ++firstRow;
-
-         // First run through sets the first row with all information
-
-         for (auto& nextIt = secondRow; nextIt != range.second; ++nextIt)
-         {
-            int row2 = nextIt->second;
-            for (int j = 0; j < cLAST_COLUMN; ++j)
-            {
-               if (mData[row1].at(j).isEmpty() && !mData[row2].at(j).isEmpty())
-               {
-                  mData[row1].at(j) = mData[row2].at(j);
-               }
-            }
-         }
-
-         // Second run through fills in missing data for rows
-         for (auto& nextIt = secondRow; nextIt != range.second; ++nextIt)
-         {
-            for (int j = 0; j < cLAST_COLUMN; ++j)
-            {
-               int row2 = nextIt->second;
-               if (mData[row2].at(j).isEmpty() && !mData[row1].at(j).isEmpty())
-               {
-                  mData[row2].at(j) = mData[row1].at(j);
-               }
-            }
-         }
-      }
-   }
+   auto it = std::upper_bound(mDatabases.begin(),
+                              mDatabases.end(),
+                              aRow,
+                              [](int aValue, const Database& aDatabase) { return aValue < aDatabase.mFirstRow; });
+   return (it == mDatabases.begin()) ? nullptr : &*(--it);
 }
 
 //! The current row count of the data
@@ -105,7 +47,7 @@ void SpaceTools::SatelliteInserterModel::SetExistingData(const std::multimap<QSt
 //! @returns The number of rows
 int SpaceTools::SatelliteInserterModel::rowCount(const QModelIndex& aIndex) const
 {
-   return ut::cast_to_int(mData.size());
+   return mRowCount;
 }
 
 
@@ -131,59 +73,79 @@ QVariant SpaceTools::SatelliteInserterModel::headerData(int aSection, Qt::Orient
    {
       if (aOrientation == Qt::Horizontal)
       {
-         switch (aSection)
-         {
-         case FieldColumn::cCONSTELLATION:
-            header = "Constellation";
-            break;
-         case FieldColumn::cCOUNTRY:
-            header = "Country";
-            break;
-         case FieldColumn::cDESIGNATOR:
-            header = "Designator";
-            break;
-         case FieldColumn::cNAME:
-            header = "Name";
-            break;
-         case FieldColumn::cORBIT_TYPE:
-            header = "Orbit Type";
-            break;
-         case FieldColumn::cDEFINITION_TYPE:
-            header = "Definition Type";
-            break;
-         case FieldColumn::cPLATFORM_TYPE:
-            header = "Platform Type";
-            break;
-         case FieldColumn::cFILE:
-            header = "File";
-            break;
-         case FieldColumn::cDATABASE:
-            header = "Database";
-            break;
-         case FieldColumn::cNORAD_CATALOG_NUMBER:
-            header = "Norad Catalog Number";
-            break;
-         case FieldColumn::cLAUNCH_DATE:
-            header = "Launch Date";
-            break;
-         case FieldColumn::cLAUNCH_SITE:
-            header = "Launch Site";
-            break;
-         case FieldColumn::cRADAR_CROSS_SECTION:
-            header = "Radar Cross Section";
-            break;
-         case FieldColumn::cOPERATIONAL_STATUS:
-            header = "Operational Status";
-            break;
-         default:
-            header = aSection + 1;
-            break;
-         }
+         header = GetHeaderName(aSection);
       }
    }
    return header;
 }
 
+//! Gets the name of a column
+//!
+//! @param aSection The column
+//! @returns The name of the column or the column number if the name is undefined.
+QString SpaceTools::SatelliteInserterModel::GetHeaderName(int aSection)
+{
+   QString header;
+   switch (aSection)
+   {
+   case FieldColumn::cCONSTELLATION:
+      header = "Constellation";
+      break;
+   case FieldColumn::cCOUNTRY:
+      header = "Country";
+      break;
+   case FieldColumn::cDESIGNATOR:
+      header = "Designator";
+      break;
+   case FieldColumn::cNAME:
+      header = "Name";
+      break;
+   case FieldColumn::cORBIT_TYPE:
+      header = "Orbit Type";
+      break;
+   case FieldColumn::cDEFINITION_TYPE:
+      header = "Definition Type";
+      break;
+   case FieldColumn::cPLATFORM_TYPE:
+      header = "Platform Type";
+      break;
+   case FieldColumn::cFILE:
+      header = "File";
+      break;
+   case FieldColumn::cDATABASE:
+      header = "Database";
+      break;
+   case FieldColumn::cNORAD_CATALOG_NUMBER:
+      header = "Norad Catalog Number";
+      break;
+   case FieldColumn::cLAUNCH_DATE:
+      header = "Launch Date";
+      break;
+   case FieldColumn::cLAUNCH_SITE:
+      header = "Launch Site";
+      break;
+   case FieldColumn::cRADAR_CROSS_SECTION:
+      header = "Radar Cross Section";
+      break;
+   case FieldColumn::cOPERATIONAL_STATUS:
+      header = "Operational Status";
+      break;
+   default:
+      header = QString::number(aSection + 1);
+      break;
+   }
+   return header;
+}
+
+//! Gets the key of a column's field in a JSON database entry
+//!
+//! @param aColumn The column
+//! @returns The lower case, underscore separated header name (e.g. "norad_catalog_number")
+QString SpaceTools::SatelliteInserterModel::GetFieldKey(int aColumn)
+{
+   return GetHeaderName(aColumn).toLower().replace(' ', '_');
+}
+
 //! Gets the data from the model
 //!
 //! @param aIndex The index of the data to return
@@ -192,18 +154,26 @@ QVariant SpaceTools::SatelliteInserterModel::headerData(int aSection, Qt::Orient
 QVariant SpaceTools::SatelliteInserterModel::data(const QModelIndex& aIndex, int aRole) const
 {
    QVariant data;
-   if (aIndex.isValid() && static_cast<size_t>(aIndex.row()) < mData.size())
+   if (aIndex.isValid() && aIndex.row() < mRowCount && aIndex.column() < cLAST_COLUMN)
    {
-      auto it = mData[aIndex.row()].find(aIndex.column());
-      if (it != mData[aIndex.row()].end())
+      if (aRole == Qt::DisplayRole || aRole == Qt::UserRole)
       {
-         if (aRole == Qt::DisplayRole || aRole == Qt::UserRole)
+         const Database* databasePtr = FindDatabase(aIndex.row());
+         if (databasePtr)
          {
-            data = it->second;
-            if (aRole == Qt::DisplayRole && aIndex.column() == FieldColumn::cDATABASE)
+            if (aIndex.column() == FieldColumn::cDATABASE)
+            {
+               data = databasePtr->mPath;
+               if (aRole == Qt::DisplayRole)
+               {
+                  UtPath file{databasePtr->mPath.toStdString()};
+                  data = QString::fromStdString(file.GetFileName());
+               }
+            }
+            else
             {
-               UtPath file{data.toString().toStdString()};
-               data = QString::fromStdString(file.GetFileName());
+               auto row = static_cast<uint32_t>(aIndex.row() - databasePtr->mFirstRow);
+               data     = databasePtr->mCatalog->GetField(row, static_cast<uint32_t>(aIndex.column()));
             }
          }
       }
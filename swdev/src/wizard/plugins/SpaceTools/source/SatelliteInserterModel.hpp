@@ -13,10 +13,12 @@
 #define SATELLITEINSERTERMODEL_HPP
 
 #include <map>
+#include <memory>
 #include <vector>
 
 #include <QAbstractTableModel>
-#include <QJsonDocument>
+
+#include "SatelliteCatalog.hpp"
 
 namespace SpaceTools
 {
@@ -24,7 +26,7 @@ namespace SpaceTools
 class SatelliteInserterModel : public QAbstractTableModel
 {
 public:
-   explicit SatelliteInserterModel(const std::map<QString, QJsonDocument>& aDatabases);
+   explicit SatelliteInserterModel(const std::map<QString, std::shared_ptr<const SatelliteCatalog>>& aDatabases);
    ~SatelliteInserterModel() override = default;
 
    int      rowCount(const QModelIndex& aIndex) const override;
@@ -51,11 +53,23 @@ public:
       cLAST_COLUMN          = 14
    };
 
+   static QString GetHeaderName(int aSection);
+   static QString GetFieldKey(int aColumn);
+
 private:
-   void SetExistingData(const std::multimap<QString, int>& aInsertedPlatforms, const QSet<QString>& aInsertedDesignators);
+   //! A loaded database and the first model row of its platforms
+   struct Database
+   {
+      QString                                 mPath;
+      std::shared_ptr<const SatelliteCatalog> mCatalog;
+      int                                     mFirstRow;
+   };
+
+   const Database* FindDatabase(int aRow) const;
 
-   //! The data that is displayed in the viewer.
-   std::vector<std::map<int, QString>> mData;
+   //! The databases that are displayed in the viewer, ordered by first row.
+   std::vector<Database> mDatabases;
+   int                   mRowCount{0};
 };
 } // namespace SpaceTools
 #endif
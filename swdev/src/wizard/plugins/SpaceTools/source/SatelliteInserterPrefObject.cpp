@@ -10,22 +10,22 @@
 // ****************************************************************************
 #include "SatelliteInserterPrefObject.hpp"
 
-#include "SpaceToolsUtil.hpp"
 #include "UtPath.hpp"
 #include "WkfEnvironment.hpp"
 
 namespace // {anonymous}
 {
-std::vector<QJsonDocument> GetDefaultDatabases(const UtPath& aBasePath, std::vector<QString>& aPath)
+std::vector<std::shared_ptr<const SpaceTools::SatelliteCatalog>> GetDefaultDatabases(const UtPath&         aBasePath,
+                                                                                     std::vector<QString>& aPath)
 {
-   std::vector<QJsonDocument> retval{};
+   std::vector<std::shared_ptr<const SpaceTools::SatelliteCatalog>> retval{};
    if (aBasePath.IsDirectory())
    {
       std::vector<QString> defaultDatabases{"/satellite.json", "/satcat.json"};
       for (const auto& path : defaultDatabases)
       {
          aPath.push_back(QString::fromStdString(aBasePath.GetNormalizedPath()) + path);
-         retval.push_back(SpaceTools::Util::GetDatabase(aPath.back()));
+         retval.push_back(SpaceTools::SatelliteCatalog::Load(aPath.back()));
       }
    }
    return retval;
@@ -34,12 +34,12 @@ std::vector<QJsonDocument> GetDefaultDatabases(const UtPath& aBasePath, std::vec
 
 SpaceTools::PrefData::PrefData()
 {
-   UtPath                     basePath(wkfEnv.GetDemosDir().toStdString() + "/satellite_demos");
-   std::vector<QString>       databasePath;
-   std::vector<QJsonDocument> databases = GetDefaultDatabases(basePath, databasePath);
+   UtPath               basePath(wkfEnv.GetDemosDir().toStdString() + "/satellite_demos");
+   std::vector<QString> databasePath;
+   auto                 databases = GetDefaultDatabases(basePath, databasePath);
    for (size_t i = 0; i < databases.size(); ++i)
    {
-      if (!databases[i].isNull())
+      if (databases[i])
       {
          mLoadedDatabases.emplace_back(databases[i], databasePath[i]);
       }
@@ -79,16 +79,16 @@ void SpaceTools::PrefObject::DeleteFilter(const QString& aName)
 //! Get the checked databases from the current loaded databases
 //!
 //! @returns The checked databases from the current loaded databases
-std::map<QString, QJsonDocument> SpaceTools::PrefObject::GetCheckedDatabases()
+std::map<QString, std::shared_ptr<const SpaceTools::SatelliteCatalog>> SpaceTools::PrefObject::GetCheckedDatabases()
 {
-   std::map<QString, QJsonDocument> checkedDatabases;
+   std::map<QString, std::shared_ptr<const SatelliteCatalog>> checkedDatabases;
    for (const auto& database : mCurrentPrefs.mLoadedDatabases)
    {
       if (database.mFile.mChecked)
       {
          UtPath path(database.mFile.mPath.toStdString());
          auto   file            = QString::fromStdString(path.GetNormalizedPath());
-         checkedDatabases[file] = database.mDatabase;
+         checkedDatabases[file] = database.mCatalog;
       }
    }
    return checkedDatabases;
@@ -153,7 +153,7 @@ SpaceTools::PrefData SpaceTools::PrefObject::ReadSettings(QSettings& aSettings)
          aSettings.setArrayIndex(i);
          QString            path    = aSettings.value("path").toString();
          bool               checked = aSettings.value("checked").toBool();
-         PrefData::Database database(Util::GetDatabase(path), path, checked);
+         PrefData::Database database(SatelliteCatalog::Load(path), path, checked);
          pData.mLoadedDatabases.emplace_back(database);
       }
       aSettings.endArray();
@@ -12,14 +12,15 @@
 #define SATELLITEINSERTERPREFOBJECT_HPP
 
 #include <map>
+#include <memory>
 #include <vector>
 
-#include <QJsonDocument>
 #include <QSettings>
 #include <QString>
 #include <QStringList>
 #include <QVariant>
 
+#include "SatelliteCatalog.hpp"
 #include "UtPath.hpp"
 #include "WkfPrefObject.hpp"
 
@@ -61,14 +62,14 @@ struct PrefData
    struct Database
    {
       Database() = default;
-      Database(const QJsonDocument& aDatabase, const QString& aPath, bool aChecked = true)
-         : mDatabase(aDatabase)
+      Database(const std::shared_ptr<const SatelliteCatalog>& aCatalog, const QString& aPath, bool aChecked = true)
+         : mCatalog(aCatalog)
          , mFile(File(aPath, aChecked))
       {
       }
 
-      QJsonDocument mDatabase;
-      File          mFile;
+      std::shared_ptr<const SatelliteCatalog> mCatalog;
+      File                                    mFile;
    };
 
    std::map<QString, std::vector<Filter>> mSavedFilters;
@@ -93,8 +94,8 @@ public:
       return mCurrentPrefs.mSavedFilters;
    }
 
-   std::map<QString, QJsonDocument> GetCheckedDatabases();
-   QStringList                      GetCheckedTLE_Sets();
+   std::map<QString, std::shared_ptr<const SatelliteCatalog>> GetCheckedDatabases();
+   QStringList                                                GetCheckedTLE_Sets();
 
 signals:
    void UpdateTable();
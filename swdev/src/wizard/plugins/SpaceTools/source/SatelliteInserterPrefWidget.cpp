@@ -15,8 +15,8 @@
 #include <QFileDialog>
 #include <QMenu>
 
+#include "SatelliteCatalog.hpp"
 #include "SatelliteInserterPrefObject.hpp"
-#include "SpaceToolsUtil.hpp"
 #include "UtPath.hpp"
 
 SpaceTools::PrefWidget::PrefWidget()
@@ -103,7 +103,7 @@ void SpaceTools::PrefWidget::AddDatabase()
          itemPtr->setData(Qt::DisplayRole, GetDisplayName(database));
          itemPtr->setCheckState(Qt::Checked);
          QVariant d;
-         d.setValue(PrefData::Database(Util::GetDatabase(database), database));
+         d.setValue(PrefData::Database(SatelliteCatalog::Load(database), database));
          itemPtr->setData(Qt::UserRole, d);
          mUI.mLoadedDatabases->addItem(itemPtr);
          mUI.mDatabaseCheckAll->setChecked(false);
@@ -210,15 +210,15 @@ void SpaceTools::PrefWidget::UpdateDatabases()
    {
       auto itemPtr  = mUI.mLoadedDatabases->item(i);
       auto database = itemPtr->data(Qt::ToolTipRole).toString();
-      auto doc      = Util::GetDatabase(database);
-      if (doc.isNull())
+      auto catalog  = SatelliteCatalog::Load(database);
+      if (!catalog)
       {
          delete mUI.mLoadedDatabases->takeItem(i);
       }
       else
       {
          QVariant d;
-         d.setValue(PrefData::Database(doc, database));
+         d.setValue(PrefData::Database(catalog, database));
          itemPtr->setData(Qt::UserRole, d);
       }
    }
@@ -9,8 +9,15 @@
 // limitation or restriction. See accompanying README and LICENSE for details.
 // ****************************************************************************
 
+// C++ STL Includes
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 // Qt Includes
 #include <QDebug>
+#include <QSignalBlocker>
 #include <QString>
 #include <QStringList>
 #include <QTime>
@@ -39,7 +46,6 @@
 
 // TaskList Includes
 #include "TaskListDockWidget.hpp"
-#include "TaskListItem.hpp"
 
 namespace TaskList
 {
@@ -63,10 +69,6 @@ DockWidget::DockWidget() noexcept
 
 void DockWidget::Populate(int aIndex) noexcept
 {
-   mComments.clear();
-   // Clear the table by setting the row count to zero
-   mUi.mTaskTable->setRowCount(0);
-   // Then, rebuild the table
    auto enumIndex = static_cast<FilterIndex>(aIndex);
    switch (enumIndex)
    {
@@ -107,9 +109,13 @@ void DockWidget::OnFilterChanged(int aIndex) noexcept
    Populate(aIndex);
 }
 
-void DockWidget::OnCellDoubleClicked(int aRow, int /* aColumn */) noexcept
+void DockWidget::OnCellDoubleClicked(const QModelIndex& aIndex) noexcept
 {
-   const Task& t = mComments[aRow];
+   if (!aIndex.isValid())
+   {
+      return;
+   }
+   const Task& t{mTaskModel->GetTask(aIndex.row())};
    if (!t.IsValid())
    {
       return;
@@ -137,55 +143,8 @@ void DockWidget::OnCellDoubleClicked(int aRow, int /* aColumn */) noexcept
       return;
    }
 
-   if (!mPrefObject)
-   {
-      return;
-   }
-   int lineIndex{mPrefObject->GetColumnIndex("Line")};
-   if (lineIndex == -1)
-   {
-      return;
-   }
-   QTableWidgetItem* lineItem{mUi.mTaskTable->item(aRow, static_cast<int>(ColumnIndex::Line))};
-   if (!lineItem)
-   {
-      QDebug debugStream{&mDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  Failed to get the Line item.";
-      return;
-   }
-   QString lineItemText{lineItem->text()};
-   if (lineItemText.isEmpty())
-   {
-      QDebug debugStream{&mDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  The Line item has no text.";
-      return;
-   }
-   bool               ok;
-   unsigned long long line{lineItemText.toULongLong(&ok)};
-   if (!ok)
-   {
-      QDebug debugStream{&mDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  Conversion of line number from QString to unsigned long long failed.";
-      return;
-   }
-   if (line == 0)
-   {
-      QDebug debugStream{&mDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  Line number equal to zero.";
-      return;
-   }
-   // Change line back to zero-indexed for computational purposes
-   --line;
-
-   editor->GoToLine(line);
+   // The line is zero-indexed, as the editor expects
+   editor->GoToLine(t.mLine);
 }
 
 void DockWidget::OnColumnSectionMoved(int aLogicalIndex, int aOldVisualIndex, int aNewVisualIndex) noexcept
@@ -198,12 +157,7 @@ void DockWidget::OnColumnSectionMoved(int aLogicalIndex, int aOldVisualIndex, in
    QStringList visibleColumns{availableColumns};
    for (int columnIndex = 0; columnIndex < columnCount; ++columnIndex)
    {
-      QTableWidgetItem* columnHeaderItem{mUi.mTaskTable->horizontalHeaderItem(columnIndex)};
-      if (!columnHeaderItem)
-      {
-         continue;
-      }
-      QString columnHeaderItemText{columnHeaderItem->text()};
+      QString columnHeaderItemText{mTaskModel->headerData(columnIndex, Qt::Horizontal).toString()};
       int     visualIndex{taskTableColumnHeader->visualIndex(columnIndex)};
       bool    columnHidden{taskTableColumnHeader->isSectionHidden(columnIndex)};
       if (columnHidden)
@@ -244,22 +198,19 @@ void DockWidget::OnColumnSortIndicatorChanged(int aLogicalIndex, Qt::SortOrder a
    Qt::SortOrder sortByColumnOrder{mPrefObject->GetSortByColumnOrder()};
    // Allow the reset of the column sorting.
    // The reset happens on clicking the column header when the column header sorts in descending order.
-   if (sortByColumnIndex == aLogicalIndex && sortByColumnOrder == Qt::DescendingOrder && aOrder == Qt::AscendingOrder)
-   {
-      UnsortTaskTable();
-      // The table is unsorted
-      sortByColumnIndex = -1;
-   }
-   else
-   {
-      sortByColumnIndex = aLogicalIndex;
-   }
+   bool resetSorting{sortByColumnIndex == aLogicalIndex && sortByColumnOrder == Qt::DescendingOrder &&
+                     aOrder == Qt::AscendingOrder};
    // The sort column will be different whether the table is sorted.
    // The sort order will be the same regardless.
-   mPrefObject->SetSortByColumnIndex(sortByColumnIndex);
+   mPrefObject->SetSortByColumnIndex(resetSorting ? -1 : aLogicalIndex);
    mPrefObject->SetSortByColumnOrder(aOrder);
-   // The mComments need sorting, regardless if this is a column-sorting reset
-   SortTasks(static_cast<ColumnIndex>(aLogicalIndex), aOrder);
+   // The QTableView sorts the TaskModel itself.
+   // On a reset, repopulate the task table to restore the unsorted order.
+   if (resetSorting)
+   {
+      UnsortTaskTable();
+      Populate(mUi.mFilterBox->currentIndex());
+   }
 }
 
 void DockWidget::OnColumnResized(int aLogicalIndex, int aOldSize, int aNewSize) noexcept
@@ -344,27 +295,17 @@ void DockWidget::OnPathFormatUpdated() noexcept
 
 void DockWidget::SetUpTaskTableHeader() noexcept
 {
-   QTableWidget* taskTable{mUi.mTaskTable};
-   // Clear the header by setting the column count to zero
-   taskTable->setColumnCount(0);
-   // Then, rebuild the header
-   Qt::ItemFlags itemFlags{Qt::ItemIsSelectable | Qt::ItemIsEnabled};
-   taskTable->setColumnCount(6);
-
-   auto createHeaderItem = [itemFlags, taskTable](int aColumnIndex, const QString& aColumnName) {
-      auto* columnHeaderItem = new QTableWidgetItem{aColumnName};
-      columnHeaderItem->setFlags(itemFlags);
-      taskTable->setHorizontalHeaderItem(aColumnIndex, columnHeaderItem);
-   };
-   createHeaderItem(0, "Tag");
-   createHeaderItem(1, "Description");
-   createHeaderItem(2, "Directory");
-   createHeaderItem(3, "File");
-   createHeaderItem(4, "Line");
-   createHeaderItem(5, "Column");
+   QHeaderView*         taskTableColumnHeader{mUi.mTaskTable->horizontalHeader()};
+   const QSignalBlocker cCOLUMNS_BLOCKER{taskTableColumnHeader};
+   // Reset the column order and visibility to the default
+   for (int logicalIndex = 0; logicalIndex < taskTableColumnHeader->count(); ++logicalIndex)
+   {
+      taskTableColumnHeader->showSection(logicalIndex);
+      taskTableColumnHeader->moveSection(taskTableColumnHeader->visualIndex(logicalIndex), logicalIndex);
+   }
 
    // Stretch the Description column to take up the remaining space
-   taskTable->horizontalHeader()->setSectionResizeMode(1, QHeaderView::Stretch);
+   taskTableColumnHeader->setSectionResizeMode(static_cast<int>(ColumnIndex::Description), QHeaderView::Stretch);
    mColumnOrderRestored = false;
 }
 
@@ -385,7 +326,8 @@ void DockWidget::SetDefaultColumnSizes() noexcept
 
 void DockWidget::SetUpTaskTable() noexcept
 {
-   mUi.mTaskTable->setItemPrototype(Item::cPROTOTYPE);
+   mTaskModel = ut::qt::make_qt_ptr<TaskModel>(this);
+   mUi.mTaskTable->setModel(mTaskModel);
 
    SetUpTaskTableHeader();
 
@@ -416,7 +358,7 @@ void DockWidget::SetUpDockWidget() noexcept
 void DockWidget::UnsortTaskTable() noexcept
 {
    const QSignalBlocker cCOLUMN_BLOCKER{mUi.mTaskTable->horizontalHeader()};
-   mUi.mTaskTable->sortItems(-1, Qt::AscendingOrder);
+   mUi.mTaskTable->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
 }
 
 void DockWidget::ResortTaskTable() noexcept
@@ -431,12 +373,10 @@ void DockWidget::ResortTaskTable() noexcept
    }
    int           columnIndex{mPrefObject->GetSortByColumnIndex()};
    Qt::SortOrder columnOrder{mPrefObject->GetSortByColumnOrder()};
-   mUi.mTaskTable->sortItems(columnIndex, columnOrder);
-}
-
-void DockWidget::SortTasks(ColumnIndex aColumn, Qt::SortOrder aOrder) noexcept
-{
-   return std::sort(mComments.begin(), mComments.end(), Task::Compare{aColumn, aOrder});
+   // The QTableView only sorts on the column header's signal, so sort the TaskModel directly
+   const QSignalBlocker cCOLUMN_BLOCKER{mUi.mTaskTable->horizontalHeader()};
+   mUi.mTaskTable->horizontalHeader()->setSortIndicator(columnIndex, columnOrder);
+   mTaskModel->sort(columnIndex, columnOrder);
 }
 
 void DockWidget::ConnectFilter() noexcept
@@ -446,7 +386,7 @@ void DockWidget::ConnectFilter() noexcept
 
 void DockWidget::ConnectTaskTable() noexcept
 {
-   connect(mUi.mTaskTable, &QTableWidget::cellDoubleClicked, this, &DockWidget::OnCellDoubleClicked);
+   connect(mUi.mTaskTable, &QTableView::doubleClicked, this, &DockWidget::OnCellDoubleClicked);
 }
 
 void DockWidget::ConnectTaskTableColumnHeader() noexcept
@@ -457,7 +397,7 @@ void DockWidget::ConnectTaskTableColumnHeader() noexcept
    connect(taskTableColumnHeader, &QHeaderView::sortIndicatorChanged, this, &DockWidget::OnColumnSortIndicatorChanged);
    // Do not connect QHeaderView::sectionResized to DockWidget::OnColumnResized here.
    // This connection happens in DockWidget::OnFullParseComplete, as to avoid emissions of QHeaderView::sectionResized
-   // during internal set-up of the QTableWidget.
+   // during internal set-up of the QTableView.
 }
 
 void DockWidget::ConnectWizardCore() noexcept
@@ -575,32 +515,18 @@ bool DockWidget::Initialize() noexcept
       return false;
    }
 
-   return true;
-}
-
-void DockWidget::AddComment(int            aRow,
-                            const QString& aTag,
-                            const QString& aDescription,
-                            const QString& aDirectory,
-                            const QString& aFile,
-                            const QString& aLine,
-                            const QString& aColumn) noexcept
-{
-   const Qt::ItemFlags cDEFAULT_ITEM_FLAGS{Qt::ItemIsSelectable | Qt::ItemIsEnabled};
+   if (!mPrefObject)
+   {
+      QDebug debugStream{&mDebugLog};
+      debugStream << QTime::currentTime().toString()
+                  << "WizTaskList"
+                     "\n  TaskList::PrefObject is unavailable.";
+      return false;
+   }
+   // The TaskIndex rescans every input file if the task tags or path format changed since the last scan
+   mTaskIndex.Configure(mPrefObject->GetTaskTags(), mPrefObject->GetPathFormat(), mParser->GetWorkingDirectory());
 
-   QTableWidget* taskTable{mUi.mTaskTable};
-   auto createCellItem = [cDEFAULT_ITEM_FLAGS, taskTable](int aRowIndex, int aColumnIndex, const QString& aText) {
-      // TODO:  make a factory function for QTableWidgetItem
-      auto* cellItem = new Item(static_cast<ColumnIndex>(aColumnIndex), aText);
-      cellItem->setFlags(cDEFAULT_ITEM_FLAGS);
-      taskTable->setItem(aRowIndex, aColumnIndex, cellItem);
-   };
-   createCellItem(aRow, 0, aTag);
-   createCellItem(aRow, 1, aDescription);
-   createCellItem(aRow, 2, aDirectory);
-   createCellItem(aRow, 3, aFile);
-   createCellItem(aRow, 4, aLine);
-   createCellItem(aRow, 5, aColumn);
+   return true;
 }
 
 WsfParseSourceInclude* DockWidget::AcquireIncludeFile(const UtPath& aFile) noexcept
@@ -632,7 +558,7 @@ WsfParseSourceInclude* DockWidget::AcquireIncludeFile(const UtPath& aFile) noexc
    return sourceInclude;
 }
 
-void DockWidget::AcquireCommentsFromFile(const QString& aFile) noexcept
+void DockWidget::AcquireCommentsFromFile(const QString& aFile, std::vector<Task>& aTasks) noexcept
 {
    UtPath                 filePath{aFile.toStdString()};
    WsfParseSourceInclude* sourceInclude{AcquireIncludeFile(filePath)};
@@ -642,41 +568,17 @@ void DockWidget::AcquireCommentsFromFile(const QString& aFile) noexcept
       return;
    }
 
-   const auto& entries = sourceInclude->mEntries;
-   if (entries.empty())
+   if (sourceInclude->mEntries.empty())
    {
       QDebug debugStream{&mDebugLog};
       debugStream << QTime::currentTime().toString()
                   << "WizTaskList"
                      "\n  No WsfParseSourceInclude::Entries for "
                   << aFile << '.';
-      return;
-   }
-
-   if (!mPrefObject)
-   {
-      return;
    }
 
-   Task::mPathFormat       = mPrefObject->GetPathFormat();
-   Task::mWorkingDirectory = mParser->GetWorkingDirectory();
-   for (const auto& elem : entries)
-   {
-      if (elem.mType == WsfParseSourceInclude::cLINE_COMMENT || elem.mType == WsfParseSourceInclude::cBLOCK_COMMENT)
-      {
-         UtTextDocumentRange range{sourceInclude->mSourcePtr, elem.mLocation};
-         QStringList         taskTags{mPrefObject->GetTaskTags()};
-         for (const auto& elem : taskTags)
-         {
-            auto t = Task::RangeToTask(range, elem);
-            if (!t.IsValid())
-            {
-               continue;
-            }
-            mComments.emplace_back(t);
-         }
-      }
-   }
+   // The TaskIndex only rescans the input file if it changed since the last scan
+   mTaskIndex.AcquireTasks(*sourceInclude, aTasks);
 }
 
 void DockWidget::RestoreColumnOrder() noexcept
@@ -789,26 +691,15 @@ void DockWidget::RestoreColumnSizes() noexcept
    }
 }
 
-void DockWidget::RebuildTaskTable() noexcept
+void DockWidget::RebuildTaskTable(std::vector<Task> aTasks) noexcept
 {
-   int rowIndex{0};
    if (mColumnOrderRestored)
    {
       SaveColumnSizes();
       SetUpTaskTableHeader();
       RestoreColumnSizes();
    }
-   for (const auto& elem : mComments)
-   {
-      // Change line and column to one-indexed for display purposes
-      AddComment(rowIndex++,
-                 elem.mTag,
-                 elem.mDescription,
-                 elem.mDirectory,
-                 elem.mFile,
-                 QString::number(elem.mLine + 1),
-                 QString::number(elem.mColumn + 1));
-   }
+   mTaskModel->SetTasks(std::move(aTasks));
    RestoreColumnOrder();
 }
 
@@ -833,10 +724,10 @@ void DockWidget::PopulateFromCurrentFile() noexcept
       return;
    }
 
-   std::string file{editor->GetSource()->GetFilePath().GetNormalizedPath()};
-   AcquireCommentsFromFile(QString::fromStdString(file));
-   mUi.mTaskTable->setRowCount(ut::cast_to_int(mComments.size()));
-   RebuildTaskTable();
+   std::vector<Task> tasks;
+   std::string       file{editor->GetSource()->GetFilePath().GetNormalizedPath()};
+   AcquireCommentsFromFile(QString::fromStdString(file), tasks);
+   RebuildTaskTable(std::move(tasks));
 }
 
 void DockWidget::PopulateFromOpenDocuments() noexcept
@@ -850,13 +741,13 @@ void DockWidget::PopulateFromOpenDocuments() noexcept
       return;
    }
 
-   const auto& files = mEditorManager->GetEditorMap();
+   std::vector<Task> tasks;
+   const auto&       files = mEditorManager->GetEditorMap();
    for (const auto& elem : files)
    {
-      AcquireCommentsFromFile(elem.first);
+      AcquireCommentsFromFile(elem.first, tasks);
    }
-   mUi.mTaskTable->setRowCount(ut::cast_to_int(mComments.size()));
-   RebuildTaskTable();
+   RebuildTaskTable(std::move(tasks));
 }
 
 void DockWidget::PopulateFromCurrentScenario() noexcept
@@ -870,13 +761,17 @@ void DockWidget::PopulateFromCurrentScenario() noexcept
       return;
    }
 
-   const auto& includeCountMap = mParseIndex->GetIncludes();
+   std::vector<Task>               tasks;
+   std::unordered_set<std::string> files;
+   const auto&                     includeCountMap = mParseIndex->GetIncludes();
    for (auto& elem : includeCountMap)
    {
-      AcquireCommentsFromFile(QString::fromStdString(elem.first.Get()));
+      AcquireCommentsFromFile(QString::fromStdString(elem.first.Get()), tasks);
+      files.emplace(UtPath{elem.first.Get()}.GetNormalizedPath());
    }
-   mUi.mTaskTable->setRowCount(ut::cast_to_int(mComments.size()));
-   RebuildTaskTable();
+   // Forget the input files no longer in the scenario
+   mTaskIndex.Prune(files);
+   RebuildTaskTable(std::move(tasks));
 }
 
 } // end namespace TaskList
@@ -19,7 +19,6 @@
 #include <QRegularExpression>
 #include <QString>
 #include <QStringList>
-#include <QTableWidgetItem>
 
 // Utility Includes
 #include "UtPath.hpp"
@@ -34,6 +33,8 @@ class WsfParseSourceInclude;
 #include "TaskListPluginUtil.hpp"
 #include "TaskListPrefObject.hpp"
 #include "TaskListTask.hpp"
+#include "TaskListTaskIndex.hpp"
+#include "TaskListTaskModel.hpp"
 #include "ui_TaskListDockWidget.h"
 
 namespace wizard
@@ -50,9 +51,6 @@ class TextSourceCache;
 
 namespace TaskList
 {
-// TaskList Forward Declarations
-class Item;
-
 //! A dock widget containing a list of tasks to complete.
 //! @par Purpose:
 //!   This widget allows you to have one location containing reminders to complete tasks.
@@ -114,9 +112,8 @@ private slots:
    //@{
 
    //! Slot executed when the user double-clicks any cell in the task table
-   //! @param aRow is the row index of the cell
-   //! @param aColumn is the column index of the cell
-   void OnCellDoubleClicked(int aRow, int aColumn) noexcept;
+   //! @param aIndex is the model index of the cell
+   void OnCellDoubleClicked(const QModelIndex& aIndex) noexcept;
 
    //@}
 
@@ -175,15 +172,15 @@ private:
    //! @name Set-up routines
    //@{
 
-   //! Set up the TaskList::DockWidget's QTableWidget's horizontal (column) header
-   //! @note As this rebuilds the entire header, this resets the column order back to the default and makes all columns
-   //! visible.  To restore the preferred column order and visibility, use RestoreColumnOrder.
+   //! Set up the TaskList::DockWidget's QTableView's horizontal (column) header
+   //! @note This resets the column order back to the default and makes all columns visible.
+   //! To restore the preferred column order and visibility, use RestoreColumnOrder.
    void SetUpTaskTableHeader() noexcept;
 
    //! Set the default column sizes
    void SetDefaultColumnSizes() noexcept;
 
-   //! Set up the TaskList::DockWidget's QTableWidget
+   //! Set up the TaskList::DockWidget's QTableView
    void SetUpTaskTable() noexcept;
 
    //! Set up the TaskList::DockWidget
@@ -205,9 +202,6 @@ private:
    //! @post The task table is sorted by the preferred column
    void ResortTaskTable() noexcept;
 
-   //! Sorts the tasks by the given column and sort order
-   void SortTasks(ColumnIndex aColumn, Qt::SortOrder aOrder) noexcept;
-
    //@}
 
    //! @name Connect routines
@@ -235,23 +229,6 @@ private:
    //! @note if any member variable fails to initialize, then initialization fails
    bool Initialize() noexcept;
 
-   //! Add a comment to the list
-   //! @param aRow is the row to insert the comment
-   //! @param aTag is the task tag
-   //! @param aDescription is the task description
-   //! @param aDirectory is the input file directory
-   //! @param aFile is the input file name
-   //! @param aLine is the line number of the task
-   //! @param aColumn is the column number of the task
-   //! @post the table contains an additional task
-   void AddComment(int            aRow,
-                   const QString& aTag,
-                   const QString& aDescription,
-                   const QString& aDirectory,
-                   const QString& aFile,
-                   const QString& aLine,
-                   const QString& aColumn) noexcept;
-
    //! Acquires an include object from a input file path and name
    //! @param aFile is the input file path and name
    //! @return the include object from which to extract the comments
@@ -260,7 +237,8 @@ private:
 
    //! Acquires all the tasks from the given input file
    //! @param aFile is the input file path and name
-   void AcquireCommentsFromFile(const QString& aFile) noexcept;
+   //! @param aTasks is the list to which to append the tasks
+   void AcquireCommentsFromFile(const QString& aFile, std::vector<Task>& aTasks) noexcept;
 
    //! Restores the preferred column order and visibility
    //! @note To avoid unnecessary modifications to the column header, repeated calls to this function do nothing.
@@ -275,12 +253,12 @@ private:
    void RestoreColumnSizes() noexcept;
 
    //! Rebuilds the task table
+   //! @param aTasks are the tasks to show
    //! @par details
-   //!   This function rebuilds the column header.
-   //!   Then, it rebuilds the table.
-   //!   Finally, it restores the preferred column order and visibility.
+   //!   This function replaces the tasks in the model.
+   //!   Then, it restores the preferred column order and visibility.
    //! @post the task table is current
-   void RebuildTaskTable() noexcept;
+   void RebuildTaskTable(std::vector<Task> aTasks) noexcept;
 
    //! Populates the task table with tasks from the current file
    void PopulateFromCurrentFile() noexcept;
@@ -323,13 +301,16 @@ private:
    //! DockWidget::ConnectTaskTableHeader.
    QMetaObject::Connection mColumnResizedConnection;
 
-   //! The comments from the input files
+   //! The tasks shown in the task table
    //! @note The contents depends on the filter
-   std::vector<Task> mComments;
+   TaskModel* mTaskModel{nullptr};
+
+   //! The tasks of the input files, kept across parses so only the changed input files are rescanned
+   TaskIndex mTaskIndex;
 
    //! Prevents unnecessary modifications to the column order
    //! @par details
-   //!   Each rebuild of the column header (via SetUpTaskTableHeader) will reset the column order and visibility to the
+   //!   Each reset of the column header (via SetUpTaskTableHeader) will reset the column order and visibility to the
    //!   default. The default is to have all columns visible and in the order:  Tag, Description, Directory, File, Line,
    //!   Column. Calling SetUpTaskTableHeader will set this to false, indicating that the programmer should call
    //!   RestoreColumnOrder. RestoreColumnOrder will restore the preferred column order and visibility, setting this to
@@ -11,6 +11,7 @@
 
 // Qt Includes
 #include <QDebug>
+#include <QRegularExpression>
 #include <QTime>
 
 // WKF Includes
@@ -26,9 +27,9 @@ PathFormat Task::mPathFormat{PathFormat::Absolute};
 UtPath     Task::mWorkingDirectory{};
 QString    Task::sDebugLog{};
 
-Task Task::RangeToTask(const UtTextDocumentRange& aRange, const QString& aTag) noexcept
+std::vector<Task> Task::RangeToTasks(const UtTextDocumentRange& aRange, const QStringList& aTags) noexcept
 {
-   Task t;
+   std::vector<Task> tasks;
 
    bool ok{aRange.Valid()};
    if (!ok)
@@ -37,7 +38,7 @@ Task Task::RangeToTask(const UtTextDocumentRange& aRange, const QString& aTag) n
       debugStream << QTime::currentTime().toString()
                   << "WizTaskList"
                      "\n  aRange is invalid.";
-      return t;
+      return tasks;
    }
    auto text = QString::fromStdString(aRange.Text());
 
@@ -48,7 +49,7 @@ Task Task::RangeToTask(const UtTextDocumentRange& aRange, const QString& aTag) n
       debugStream << QTime::currentTime().toString()
                   << "WizTaskList"
                      "\n  Task::MatchCommentP failed.";
-      return t;
+      return tasks;
    }
 
    ok &= MatchCommentSymbolsAndWhitespaceP(text);
@@ -58,34 +59,42 @@ Task Task::RangeToTask(const UtTextDocumentRange& aRange, const QString& aTag) n
       debugStream << QTime::currentTime().toString()
                   << "WizTaskList"
                      "\n  Task::MatchCommentSymbolsAndWhitespaceP failed.";
-      return t;
+      return tasks;
    }
 
-   ok &= MatchIdentifierP(text, aTag);
-   if (!ok)
+   // Most comments are not tasks, so only the task tags are tested against the rest of the comment.
+   // A comment not starting with a task tag is not an error, so it is not logged.
+   for (const auto& tag : aTags)
    {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  Task::MatchIdentifierP failed.";
-      return t;
-   }
+      QString body{text};
+      if (!MatchIdentifierP(body, tag) || !MatchNonWordP(body))
+      {
+         continue;
+      }
 
-   ok &= MatchNonWordP(text);
-   if (!ok)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  Task::MatchNonWordP failed.";
-      return t;
+      // The location is the same for every task tag, so compute it once
+      if (tasks.empty())
+      {
+         Task t;
+         SetLocation(aRange, t);
+         tasks.emplace_back(std::move(t));
+      }
+      else
+      {
+         tasks.emplace_back(tasks.front());
+      }
+      tasks.back().mTag         = tag;
+      tasks.back().mDescription = body.trimmed();
    }
 
-   t.mTag         = aTag;
-   t.mDescription = text.trimmed();
+   return tasks;
+}
+
+void Task::SetLocation(const UtTextDocumentRange& aRange, Task& aTask) noexcept
+{
    UtPath path{aRange.mSource->GetFilePath()};
-   t.mPath = path;
-   t.mFile = QString::fromStdString(path.GetFileName(true));
+   aTask.mPath = path;
+   aTask.mFile = QString::fromStdString(path.GetFileName(true));
    path.Up();
 
    switch (mPathFormat)
@@ -102,119 +111,16 @@ Task Task::RangeToTask(const UtTextDocumentRange& aRange, const QString& aTag) n
       {
          relativePathString += '/';
       }
-      t.mDirectory = QString::fromStdString(relativePathString);
+      aTask.mDirectory = QString::fromStdString(relativePathString);
       break;
    }
    case PathFormat::Absolute:
-      t.mDirectory = QString::fromStdString(path.GetNormalizedPath());
+      aTask.mDirectory = QString::fromStdString(path.GetNormalizedPath());
    default:
       break;
    }
 
-   aRange.mSource->PositionToLineColumn(aRange.GetBegin(), t.mLine, t.mColumn);
-
-   return t;
-}
-
-Task Task::RowToTask(QTableWidget* aTable, int aRow) noexcept
-{
-   Task t;
-
-   QTableWidgetItem* tagItem{aTable->item(aRow, static_cast<int>(ColumnIndex::Tag))};
-   if (!tagItem)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  The Tag item for row "
-                  << QString::number(aRow) << " is unavailable.";
-      return t;
-   }
-   t.mTag = tagItem->text();
-
-   QTableWidgetItem* descriptionItem{aTable->item(aRow, static_cast<int>(ColumnIndex::Description))};
-   if (!descriptionItem)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  The Description item for row "
-                  << QString::number(aRow) << " is unavailable.";
-      return t;
-   }
-   t.mDescription = descriptionItem->text();
-
-   QTableWidgetItem* directoryItem{aTable->item(aRow, static_cast<int>(ColumnIndex::Directory))};
-   if (!directoryItem)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  The Directory item for row "
-                  << QString::number(aRow) << " is unavailable.";
-      return t;
-   }
-   t.mDirectory = directoryItem->text();
-
-   QTableWidgetItem* fileItem{aTable->item(aRow, static_cast<int>(ColumnIndex::File))};
-   if (!fileItem)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  The File item for row "
-                  << QString::number(aRow) << " is unavailable.";
-      return t;
-   }
-   t.mFile = fileItem->text();
-
-   QTableWidgetItem* lineItem{aTable->item(aRow, static_cast<int>(ColumnIndex::Line))};
-   if (!lineItem)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  The Line item for row "
-                  << QString::number(aRow) << " is unavailable.";
-      return t;
-   }
-   QString            lineText{lineItem->text()};
-   bool               lineOk{false};
-   unsigned long long lineNum{lineText.toULongLong(&lineOk)};
-   if (!lineOk)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  Conversion of line number from QString to unsigned long long failed.";
-      return t;
-   }
-   t.mLine = lineNum;
-
-   QTableWidgetItem* columnItem{aTable->item(aRow, static_cast<int>(ColumnIndex::Column))};
-   if (!columnItem)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  The Column item for row "
-                  << QString::number(aRow) << " is unavailable.";
-      return t;
-   }
-   QString            columnText{columnItem->text()};
-   bool               columnOk{false};
-   unsigned long long columnNum{columnText.toULongLong(&columnOk)};
-   if (!columnOk)
-   {
-      QDebug debugStream{&sDebugLog};
-      debugStream << QTime::currentTime().toString()
-                  << "WizTaskList"
-                     "\n  Conversion of column number from QString to unsigned long long failed.";
-      return t;
-   }
-   t.mColumn = columnNum;
-
-   return t;
+   aRange.mSource->PositionToLineColumn(aRange.GetBegin(), aTask.mLine, aTask.mColumn);
 }
 
 bool Task::IsValid() const noexcept
@@ -271,8 +177,8 @@ bool Task::IsValid() const noexcept
 bool Task::MatchCommentP(QString& aText) noexcept
 {
    // Match the (starting) comment delimiter
-   const QRegularExpression cCOMMENT_START_REGEX{"(/\\*|#|//)"};
-   QRegularExpressionMatch  commentStartMatch{cCOMMENT_START_REGEX.match(aText)};
+   static const QRegularExpression cCOMMENT_START_REGEX{"(/\\*|#|//)"};
+   QRegularExpressionMatch         commentStartMatch{cCOMMENT_START_REGEX.match(aText)};
    if (!commentStartMatch.hasMatch())
    {
       return false;
@@ -286,8 +192,8 @@ bool Task::MatchCommentP(QString& aText) noexcept
 bool Task::MatchCommentSymbolsAndWhitespaceP(QString& aText) noexcept
 {
    // Match zero or more subsequent comment symbols ('#', '*', '/') or whitespaces (' ', '\f', '\n', '\r', '\t', '\v')
-   const QRegularExpression cCOMMENT_SYMBOLS_AND_WHITESPACE_REGEX{"(#|\\*|/|\\s)*"};
-   QRegularExpressionMatch  commentSymbolsAndWhitespaceMatch{cCOMMENT_SYMBOLS_AND_WHITESPACE_REGEX.match(aText)};
+   static const QRegularExpression cCOMMENT_SYMBOLS_AND_WHITESPACE_REGEX{"(#|\\*|/|\\s)*"};
+   QRegularExpressionMatch         commentSymbolsAndWhitespaceMatch{cCOMMENT_SYMBOLS_AND_WHITESPACE_REGEX.match(aText)};
    if (!commentSymbolsAndWhitespaceMatch.hasMatch())
    {
       return false;
@@ -315,8 +221,8 @@ bool Task::MatchIdentifierP(QString& aText, const QString& aIdentifier) noexcept
 bool Task::MatchNonWordP(QString& aText) noexcept
 {
    // Match one or more symbols or non-word characters
-   const QRegularExpression cSYMBOL_REGEX{"(\\W+)"};
-   QRegularExpressionMatch  symbolMatch{cSYMBOL_REGEX.match(aText)};
+   static const QRegularExpression cSYMBOL_REGEX{"(\\W+)"};
+   QRegularExpressionMatch         symbolMatch{cSYMBOL_REGEX.match(aText)};
    if (!symbolMatch.hasMatch())
    {
       return false;
@@ -14,10 +14,11 @@
 
 // C++ STL Includes
 #include <cstddef>
+#include <vector>
 
 // Qt Includes
 #include <QString>
-#include <QTableWidget>
+#include <QStringList>
 
 // Utility Includes
 #include "UtPath.hpp"
@@ -45,21 +46,12 @@ public:
    //! The working directory
    static UtPath mWorkingDirectory;
 
-   //! Constructs a Task from the given UtTextDocumentRange and task tag
+   //! Constructs the Tasks from the given UtTextDocumentRange, one for each given task tag the comment starts with
    //! @param aRange is the given UtTextDocumentRange
-   //! @param aTag is the given task tag
-   //! @return a Task containing the data from the given UtTextDocumentRange and task tag
-   //! @retval "a valid Task" if the construction succeeds
-   //! @retval "an invalid Task" if the construction fails
-   static Task RangeToTask(const UtTextDocumentRange& aRange, const QString& aTag) noexcept;
-
-   //! Constructs a Task from the given row of the given QTableWidget
-   //! @param aTable is the given QTableWidget
-   //! @param aRow is the given row
-   //! @return a Task containing the data from the given row of the given QTableWidget
-   //! @retval "a valid Task" if the construction succeeds
-   //! @retval "an invalid Task" if the construction fails
-   static Task RowToTask(QTableWidget* aTable, int aRow) noexcept;
+   //! @param aTags are the given task tags
+   //! @return the Tasks containing the data from the given UtTextDocumentRange and the matching task tags
+   //! @note The comment delimiter and symbols are matched once, regardless of the number of task tags.
+   static std::vector<Task> RangeToTasks(const UtTextDocumentRange& aRange, const QStringList& aTags) noexcept;
 
    //! Determine whether this Task is valid
    //! @par details
@@ -127,9 +119,14 @@ private:
    //! Contains debugging information for the Task class
    static QString sDebugLog;
 
-   //! @name Helper methods for RangeToTask
+   //! @name Helper methods for RangeToTasks
    //@{
 
+   //! Sets the path, directory, file, line, and column of the given Task from the given UtTextDocumentRange
+   //! @param aRange is the given UtTextDocumentRange
+   //! @param aTask is the given Task
+   static void SetLocation(const UtTextDocumentRange& aRange, Task& aTask) noexcept;
+
    //! Determines whether the given text starts with a comment delimiter
    //! @param aText is the given text
    //! @return the index of the last match
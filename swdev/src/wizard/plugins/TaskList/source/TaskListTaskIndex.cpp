@@ -0,0 +1,89 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+// WSF Includes
+#include "WsfParseSourceInclude.hpp"
+
+// TaskList Includes
+#include "TaskListTaskIndex.hpp"
+
+namespace TaskList
+{
+void TaskIndex::Configure(const QStringList& aTaskTags,
+                          PathFormat         aPathFormat,
+                          const UtPath&      aWorkingDirectory) noexcept
+{
+   if (aTaskTags != mTaskTags || aPathFormat != mPathFormat || !(aWorkingDirectory == mWorkingDirectory))
+   {
+      mFiles.clear();
+      mTaskTags         = aTaskTags;
+      mPathFormat       = aPathFormat;
+      mWorkingDirectory = aWorkingDirectory;
+   }
+   Task::mPathFormat       = mPathFormat;
+   Task::mWorkingDirectory = mWorkingDirectory;
+}
+
+void TaskIndex::AcquireTasks(const WsfParseSourceInclude& aInclude, std::vector<Task>& aTasks) noexcept
+{
+   UtTextDocument* source{aInclude.mSourcePtr};
+   std::string     path{source->GetFilePath().GetNormalizedPath()};
+   const auto&     entries = aInclude.mEntries;
+   if (entries.empty())
+   {
+      // The file may not be parsed yet, so do not keep its (lack of) tasks
+      mFiles.erase(path);
+      return;
+   }
+
+   // Size includes the terminating null character
+   auto  hash     = wizard::Util::ComputeContentHash(source->GetPointer(), source->Size() - 1);
+   auto  inserted = mFiles.emplace(std::move(path), File{});
+   File& file     = inserted.first->second;
+   if (inserted.second || file.mHash != hash || file.mEntryCount != entries.size())
+   {
+      file.mHash       = hash;
+      file.mEntryCount = entries.size();
+      file.mTasks.clear();
+      for (const auto& elem : entries)
+      {
+         if (elem.mType == WsfParseSourceInclude::cLINE_COMMENT || elem.mType == WsfParseSourceInclude::cBLOCK_COMMENT)
+         {
+            UtTextDocumentRange range{source, elem.mLocation};
+            for (auto& t : Task::RangeToTasks(range, mTaskTags))
+            {
+               if (t.IsValid())
+               {
+                  file.mTasks.emplace_back(std::move(t));
+               }
+            }
+         }
+      }
+   }
+   aTasks.insert(aTasks.end(), file.mTasks.begin(), file.mTasks.end());
+}
+
+void TaskIndex::Prune(const std::unordered_set<std::string>& aFiles) noexcept
+{
+   for (auto it = mFiles.begin(); it != mFiles.end();)
+   {
+      if (aFiles.count(it->first) == 0)
+      {
+         it = mFiles.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+}
+
+} // end namespace TaskList
@@ -0,0 +1,94 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef TASK_LIST_TASK_INDEX_HPP
+#define TASK_LIST_TASK_INDEX_HPP
+
+// C++ STL Includes
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Qt Includes
+#include <QStringList>
+
+// Utility Includes
+#include "UtPath.hpp"
+
+// Wizard Includes
+#include "Util.hpp"
+
+// WSF Forward Declarations
+class WsfParseSourceInclude;
+
+// TaskList Includes
+#include "TaskListPluginUtil.hpp"
+#include "TaskListTask.hpp"
+
+namespace TaskList
+{
+//! Represents the tasks of the input files, indexed by file
+//! @par details
+//!   The tasks of an input file are kept with the hash of the file's text.
+//!   Acquiring the tasks of a file whose text did not change since it was last scanned returns the kept tasks instead
+//!   of scanning the file's comments again, so a parse only rescans the files that changed.
+//!   The kept tasks depend on the task tags and path format, so changing either discards all of them.
+class TaskIndex final
+{
+public:
+   //! Sets the task tags and path format with which to scan the input files
+   //! @param aTaskTags are the task tags
+   //! @param aPathFormat is the path format
+   //! @param aWorkingDirectory is the working directory against which to make relative paths
+   //! @post if any of the arguments changed, the TaskIndex is empty
+   void Configure(const QStringList& aTaskTags, PathFormat aPathFormat, const UtPath& aWorkingDirectory) noexcept;
+
+   //! Appends the tasks in the given input file to the given list
+   //! @param aInclude is the given input file
+   //! @param aTasks is the list to which to append the tasks
+   //! @note The input file is only scanned if its text changed since the last call.
+   void AcquireTasks(const WsfParseSourceInclude& aInclude, std::vector<Task>& aTasks) noexcept;
+
+   //! Removes the tasks of the input files not in the given list
+   //! @param aFiles are the normalized paths of the input files to keep
+   void Prune(const std::unordered_set<std::string>& aFiles) noexcept;
+
+   //! Removes the tasks of all input files
+   void Clear() noexcept { mFiles.clear(); }
+
+private:
+   //! Represents the tasks of an input file
+   struct File
+   {
+      //! The hash of the input file's text when it was scanned
+      wizard::Util::ContentHash mHash;
+      //! The number of parse entries of the input file when it was scanned
+      std::size_t mEntryCount;
+      //! The tasks in the input file
+      std::vector<Task> mTasks;
+   };
+
+   //! The scanned input files, keyed by normalized path
+   std::unordered_map<std::string, File> mFiles;
+
+   //! @name The settings with which the input files were scanned
+   //@{
+   QStringList mTaskTags;
+   PathFormat  mPathFormat{PathFormat::Absolute};
+   UtPath      mWorkingDirectory;
+   //@}
+};
+
+} // end namespace TaskList
+
+#endif // TASK_LIST_TASK_INDEX_HPP
@@ -0,0 +1,141 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+// C++ STL Includes
+#include <algorithm>
+
+// TaskList Includes
+#include "TaskListTaskModel.hpp"
+
+namespace TaskList
+{
+TaskModel::TaskModel(QObject* aParent /* = nullptr */) noexcept
+   : QAbstractTableModel(aParent)
+{
+}
+
+void TaskModel::SetTasks(std::vector<Task> aTasks) noexcept
+{
+   beginResetModel();
+   mTasks = std::move(aTasks);
+   endResetModel();
+}
+
+int TaskModel::rowCount(const QModelIndex& aParent /* = QModelIndex() */) const
+{
+   return aParent.isValid() ? 0 : static_cast<int>(mTasks.size());
+}
+
+int TaskModel::columnCount(const QModelIndex& aParent /* = QModelIndex() */) const
+{
+   return aParent.isValid() ? 0 : 6;
+}
+
+QVariant TaskModel::data(const QModelIndex& aIndex, int aRole /* = Qt::DisplayRole */) const
+{
+   if (!aIndex.isValid() || aRole != Qt::DisplayRole)
+   {
+      return QVariant{};
+   }
+   const Task& t{GetTask(aIndex.row())};
+   switch (static_cast<ColumnIndex>(aIndex.column()))
+   {
+   case ColumnIndex::Tag:
+      return t.mTag;
+   case ColumnIndex::Description:
+      return t.mDescription;
+   case ColumnIndex::Directory:
+      return t.mDirectory;
+   case ColumnIndex::File:
+      return t.mFile;
+   // Change line and column to one-indexed for display purposes
+   case ColumnIndex::Line:
+      return QString::number(t.mLine + 1);
+   case ColumnIndex::Column:
+      return QString::number(t.mColumn + 1);
+   default:
+      return QVariant{};
+   }
+}
+
+QVariant TaskModel::headerData(int aSection, Qt::Orientation aOrientation, int aRole /* = Qt::DisplayRole */) const
+{
+   if (aOrientation != Qt::Horizontal || aRole != Qt::DisplayRole)
+   {
+      return QAbstractTableModel::headerData(aSection, aOrientation, aRole);
+   }
+   switch (static_cast<ColumnIndex>(aSection))
+   {
+   case ColumnIndex::Tag:
+      return QString{"Tag"};
+   case ColumnIndex::Description:
+      return QString{"Description"};
+   case ColumnIndex::Directory:
+      return QString{"Directory"};
+   case ColumnIndex::File:
+      return QString{"File"};
+   case ColumnIndex::Line:
+      return QString{"Line"};
+   case ColumnIndex::Column:
+      return QString{"Column"};
+   default:
+      return QVariant{};
+   }
+}
+
+Qt::ItemFlags TaskModel::flags(const QModelIndex& aIndex) const
+{
+   return aIndex.isValid() ? Qt::ItemIsSelectable | Qt::ItemIsEnabled : Qt::NoItemFlags;
+}
+
+void TaskModel::sort(int aColumn, Qt::SortOrder aOrder /* = Qt::AscendingOrder */)
+{
+   // A negative column unsorts the table, which leaves the tasks in their current order
+   if (aColumn < 0 || aColumn >= columnCount())
+   {
+      return;
+   }
+   emit layoutAboutToBeChanged();
+
+   // Sort the rows rather than the tasks, so the persistent indexes (e.g. the selection) can follow their tasks
+   std::vector<int> order(mTasks.size());
+   for (std::size_t i = 0; i < order.size(); ++i)
+   {
+      order[i] = static_cast<int>(i);
+   }
+   Task::Compare compare{static_cast<ColumnIndex>(aColumn), aOrder};
+   std::stable_sort(order.begin(),
+                    order.end(),
+                    [&](int aLhs, int aRhs) { return compare(GetTask(aLhs), GetTask(aRhs)); });
+
+   std::vector<Task> tasks;
+   tasks.reserve(mTasks.size());
+   std::vector<int> newRows(mTasks.size());
+   for (std::size_t i = 0; i < order.size(); ++i)
+   {
+      tasks.push_back(std::move(mTasks[static_cast<std::size_t>(order[i])]));
+      newRows[static_cast<std::size_t>(order[i])] = static_cast<int>(i);
+   }
+   mTasks = std::move(tasks);
+
+   QModelIndexList oldIndexes{persistentIndexList()};
+   QModelIndexList newIndexes;
+   newIndexes.reserve(oldIndexes.size());
+   for (const QModelIndex& oldIndex : oldIndexes)
+   {
+      newIndexes.append(index(newRows[static_cast<std::size_t>(oldIndex.row())], oldIndex.column()));
+   }
+   changePersistentIndexList(oldIndexes, newIndexes);
+
+   emit layoutChanged();
+}
+
+} // end namespace TaskList
@@ -0,0 +1,66 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef TASK_LIST_TASK_MODEL_HPP
+#define TASK_LIST_TASK_MODEL_HPP
+
+// C++ STL Includes
+#include <vector>
+
+// Qt Includes
+#include <QAbstractTableModel>
+
+// TaskList Includes
+#include "TaskListTask.hpp"
+
+namespace TaskList
+{
+//! Represents the tasks shown in the task table
+//! @par details
+//!   The task table only requests the data of the visible rows, so the cost of showing the tasks does not grow with the
+//!   number of tasks.  Sorting reorders the tasks in place instead of comparing table items.
+class TaskModel final : public QAbstractTableModel
+{
+public:
+   //! Constructs a TaskModel
+   //! @param aParent is the parent object
+   explicit TaskModel(QObject* aParent = nullptr) noexcept;
+   //! Destructs a TaskModel
+   ~TaskModel() override = default;
+
+   //! Replaces the tasks in the model
+   //! @param aTasks are the new tasks
+   void SetTasks(std::vector<Task> aTasks) noexcept;
+
+   //! Get the task at the given row
+   //! @param aRow is the row
+   //! @pre aRow is in range [0, rowCount())
+   const Task& GetTask(int aRow) const noexcept { return mTasks[static_cast<std::size_t>(aRow)]; }
+
+   //! @name Overrides of QAbstractTableModel
+   //! @see https://doc.qt.io/qt-5/qabstracttablemodel.html
+   //@{
+   int           rowCount(const QModelIndex& aParent = QModelIndex()) const override;
+   int           columnCount(const QModelIndex& aParent = QModelIndex()) const override;
+   QVariant      data(const QModelIndex& aIndex, int aRole = Qt::DisplayRole) const override;
+   QVariant      headerData(int aSection, Qt::Orientation aOrientation, int aRole = Qt::DisplayRole) const override;
+   Qt::ItemFlags flags(const QModelIndex& aIndex) const override;
+   void          sort(int aColumn, Qt::SortOrder aOrder = Qt::AscendingOrder) override;
+   //@}
+
+private:
+   //! The tasks, in the order shown in the task table
+   std::vector<Task> mTasks;
+};
+
+} // end namespace TaskList
+
+#endif // TASK_LIST_TASK_MODEL_HPP
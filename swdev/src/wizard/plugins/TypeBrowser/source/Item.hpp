@@ -12,6 +12,8 @@
 #ifndef ITEM_HPP
 #define ITEM_HPP
 
+#include <string>
+
 #include "AbstractModel.hpp"
 #include "WsfPProxyNode.hpp"
 #include "WsfPProxyValue.hpp"
@@ -25,6 +27,7 @@ public:
    Item()
       : wizard::AbstractModelItem()
       , mTypeKind(0)
+      , mIsCoreType(false)
       , mToPare(false)
    {
    }
@@ -39,8 +42,10 @@ private:
 
 public:
    QString       mName;
+   std::string   mTypeName; // the key of the type in its type map
    WsfPProxyNode mTypeNode;
    int           mTypeKind;
+   bool          mIsCoreType;
    bool          mToPare;
 };
 } // namespace TypeBrowser
@@ -12,10 +12,13 @@
 #include "Model.hpp"
 
 #include <array>
+#include <initializer_list>
+#include <vector>
 
 #include "ComponentPropertyManager.hpp"
 #include "DragAndDrop.hpp"
 #include "Item.hpp"
+#include "ProxyChange.hpp"
 #include "ProxyWatcher.hpp"
 #include "Signals.hpp"
 #include "UiResources.hpp"
@@ -55,7 +58,8 @@ std::array<const char*, TypeBrowser::Model::cTYPE_KIND_COUNT> cTYPE_KIND_NAMES =
                                                                                   "Electronic Protect"};
 
 TypeBrowser::Model::Model()
-   : mProxyPtr(nullptr)
+   : mRebuildPending(false)
+   , mProxyPtr(nullptr)
 {
    mHibernate = true;
 
@@ -175,12 +179,25 @@ void TypeBrowser::Model::ProxyAvailable(WsfPProxy* aProxyPtr)
             WsfPProxyNode typeMapNode = root + typeMapName;
             if (typeMapName)
             {
+               // AnyUpdate reports the changes to the types themselves, and to any of their members
                mProxyWatcherCallbacks +=
-                  wizard::WatchProxy(typeMapNode.GetPath()).ChildUpdate.Connect(&Model::OnProxyTypeChange, this);
+                  wizard::WatchProxy(typeMapNode.GetPath()).AnyUpdate.Connect(&Model::OnProxyTypeChange, this);
             }
          }
       }
+      RebuildTypes();
    }
+   else
+   {
+      UpdateTypes();
+   }
+}
+
+void TypeBrowser::Model::RebuildTypes()
+{
+   mChangedTypes.clear();
+   mRebuildPending = false;
+
    for (std::map<std::string, Item*>::iterator i = mTypes.begin(); i != mTypes.end(); ++i)
    {
       i->second->mToPare = true;
@@ -188,10 +205,10 @@ void TypeBrowser::Model::ProxyAvailable(WsfPProxy* aProxyPtr)
 
    std::map<std::string, TypeSource> typeRoots;
 
-   if (aProxyPtr)
+   if (mProxyPtr)
    {
-      WsfPProxyRegistry* proxReg = aProxyPtr->GetRegistry().get();
-      WsfPProxyNode      root    = WsfPProxyNode::FromProxy(aProxyPtr);
+      WsfPProxyRegistry* proxReg = mProxyPtr->GetRegistry().get();
+      WsfPProxyNode      root    = WsfPProxyNode::FromProxy(mProxyPtr);
       if (proxReg)
       {
          root.SwitchToBasicTypes();
@@ -229,6 +246,54 @@ void TypeBrowser::Model::ProxyAvailable(WsfPProxy* aProxyPtr)
    }
 }
 
+// Applies the changes recorded by OnProxyTypeChange.  Only the changed types are looked up in the proxy, and the
+// items are added, removed, or moved to their new base individually, so the views keep their state.
+void TypeBrowser::Model::UpdateTypes()
+{
+   if (!mProxyPtr)
+   {
+      return;
+   }
+   if (mRebuildPending)
+   {
+      RebuildTypes();
+      return;
+   }
+
+   // The proxy values are replaced on each parse, so refresh the nodes of the items
+   for (std::map<std::string, Item*>::iterator i = mTypes.begin(); i != mTypes.end(); ++i)
+   {
+      Item* itemPtr      = i->second;
+      itemPtr->mTypeNode = FindTypeNode(TypeKey(itemPtr->mTypeKind, itemPtr->mTypeName), itemPtr->mIsCoreType);
+   }
+
+   if (mChangedTypes.empty())
+   {
+      return;
+   }
+   std::set<TypeKey> changedTypes;
+   std::swap(changedTypes, mChangedTypes);
+
+   std::set<std::string> updated;
+   for (const TypeKey& key : changedTypes)
+   {
+      TypeSource src;
+      if (FindTypeSource(key, src) && (mShowUnusedTypes || !src.mIsCoreType || mTypes.count(KindName(key)) != 0))
+      {
+         UpdateType(key, updated);
+      }
+      else
+      {
+         RemoveType(key, updated);
+      }
+   }
+
+   if (!mShowUnusedTypes)
+   {
+      RemoveUnusedCoreTypes();
+   }
+}
+
 TypeBrowser::Item* TypeBrowser::Model::RealizeType(const std::string& aName, std::map<std::string, TypeSource>& aTypeSources)
 {
    std::map<std::string, TypeSource>::iterator it = aTypeSources.find(aName);
@@ -245,20 +310,145 @@ TypeBrowser::Item* TypeBrowser::Model::RealizeType(const std::string& aName, std
          {
             basePtr = RealizeType(KindNameFromPath(src.mNode.GetRoot(), *src.mBasePathPtr), aTypeSources);
          }
-         if (!basePtr)
-         {
-            basePtr = mBaseTypeItems[src.mTypeKind];
-         }
-         itemPtr->mName = src.mNode.GetName().c_str(); //.mPath.Back().mMapKey.c_str();
-         itemPtr->SetBase(basePtr);
-         itemPtr->mTypeKind = src.mTypeKind;
-         itemPtr->mTypeNode = src.mNode;
+         SetTypeSource(*itemPtr, src, basePtr);
       }
       return itemPtr;
    }
    return nullptr;
 }
 
+void TypeBrowser::Model::SetTypeSource(Item& aItem, const TypeSource& aSource, Item* aBasePtr)
+{
+   if (!aBasePtr)
+   {
+      aBasePtr = mBaseTypeItems[aSource.mTypeKind];
+   }
+   QString name = aSource.mNode.GetName().c_str(); //.mPath.Back().mMapKey.c_str();
+   if (aItem.mName != name)
+   {
+      aItem.mName = name;
+      aItem.AbstractItemChanged();
+   }
+   aItem.mTypeName   = aSource.mNode.GetName();
+   aItem.mTypeKind   = aSource.mTypeKind;
+   aItem.mIsCoreType = aSource.mIsCoreType;
+   aItem.mTypeNode   = aSource.mNode;
+   aItem.SetBase(aBasePtr);
+}
+
+TypeBrowser::Item* TypeBrowser::Model::UpdateType(const TypeKey& aKey, std::set<std::string>& aUpdated)
+{
+   TypeSource src;
+   if (!FindTypeSource(aKey, src))
+   {
+      return nullptr;
+   }
+   std::string kindName = KindName(aKey);
+   Item*       itemPtr  = GetOrMakeType(kindName);
+   // Only set item data once per update; this also stops at inheritance cycles
+   if (aUpdated.insert(kindName).second)
+   {
+      Item* basePtr = nullptr;
+      if (src.mBasePathPtr)
+      {
+         TypeKey baseKey = TypeKeyFromPath(src.mNode.GetRoot(), *src.mBasePathPtr);
+         if (baseKey.first >= 0)
+         {
+            basePtr = UpdateType(baseKey, aUpdated);
+         }
+      }
+      SetTypeSource(*itemPtr, src, basePtr);
+   }
+   return itemPtr;
+}
+
+void TypeBrowser::Model::RemoveType(const TypeKey& aKey, std::set<std::string>& aUpdated)
+{
+   std::map<std::string, Item*>::iterator it = mTypes.find(KindName(aKey));
+   if (it == mTypes.end())
+   {
+      return;
+   }
+   Item* itemPtr = it->second;
+   mTypes.erase(it);
+
+   // The derived types remain; move them out before removing the item, then find their new base
+   std::vector<TypeKey> derivedTypes;
+   while (itemPtr->GetAbstractItemCount() > 0)
+   {
+      Item* derivedPtr = static_cast<Item*>(itemPtr->GetAbstractItem(0));
+      derivedTypes.emplace_back(derivedPtr->mTypeKind, derivedPtr->mTypeName);
+      mBaseTypeItems[derivedPtr->mTypeKind]->MoveAbstractItem(derivedPtr);
+   }
+   itemPtr->RemoveItemFromParent();
+   delete itemPtr;
+
+   for (const TypeKey& key : derivedTypes)
+   {
+      aUpdated.erase(KindName(key));
+      UpdateType(key, aUpdated);
+   }
+}
+
+// Core types are only shown as the base of another type, unless mShowUnusedTypes is set
+void TypeBrowser::Model::RemoveUnusedCoreTypes()
+{
+   bool removed = true;
+   while (removed)
+   {
+      removed = false;
+      for (std::map<std::string, Item*>::iterator i = mTypes.begin(); i != mTypes.end();)
+      {
+         Item* itemPtr = i->second;
+         if (itemPtr->mIsCoreType && itemPtr->GetAbstractItemCount() == 0)
+         {
+            itemPtr->RemoveItemFromParent();
+            mTypes.erase(i++);
+            delete itemPtr;
+            removed = true;
+         }
+         else
+         {
+            ++i;
+         }
+      }
+   }
+}
+
+bool TypeBrowser::Model::FindTypeSource(const TypeKey& aKey, TypeSource& aSource)
+{
+   // Basic types take precedence over user types of the same name, as in ScanForTypes
+   for (bool isCoreType : {true, false})
+   {
+      if (isCoreType && !TypeHasBuiltins(aKey.first))
+      {
+         continue;
+      }
+      WsfPProxyNode node = FindTypeNode(aKey, isCoreType);
+      if (node.GetValue())
+      {
+         WsfPProxyStructValue type = node.GetValue();
+         aSource.mNode             = node;
+         aSource.mBasePathPtr      = type.GetBase();
+         aSource.mTypeKind         = aKey.first;
+         aSource.mIsCoreType       = isCoreType;
+         return true;
+      }
+   }
+   return false;
+}
+
+WsfPProxyNode TypeBrowser::Model::FindTypeNode(const TypeKey& aKey, bool aIsCoreType) const
+{
+   WsfPProxyNode node = WsfPProxyNode::FromProxy(mProxyPtr);
+   if (aIsCoreType)
+   {
+      node.SwitchToBasicTypes();
+   }
+   node += cTYPE_MAPS[aKey.first];
+   return node + aKey.second;
+}
+
 TypeBrowser::Item* TypeBrowser::Model::GetOrMakeType(const std::string& aTypeKind)
 {
    Item*& typePtr = mTypes[aTypeKind];
@@ -313,6 +503,11 @@ void TypeBrowser::Model::ScanForTypes(const WsfPProxyNode&               aRoot,
    }
 }
 
+std::string TypeBrowser::Model::KindName(const TypeKey& aKey)
+{
+   return std::string(cTYPE_MAPS[aKey.first]) + '.' + aKey.second;
+}
+
 std::string TypeBrowser::Model::KindNameFromPath(const WsfPProxyStructValue& aRoot, const WsfPProxyPath& aPath)
 {
    if (aPath.size() == 2 && aPath[0].IsIndex() && aPath[1].IsString())
@@ -322,12 +517,29 @@ std::string TypeBrowser::Model::KindNameFromPath(const WsfPProxyStructValue& aRo
    return std::string();
 }
 
+TypeBrowser::Model::TypeKey TypeBrowser::Model::TypeKeyFromPath(const WsfPProxyStructValue& aRoot,
+                                                                 const WsfPProxyPath&        aPath)
+{
+   if (aPath.size() >= 2 && aPath[0].IsIndex() && aPath[1].IsString())
+   {
+      const std::string typeMapName = aRoot.GetMemberName(aPath[0].GetIndex());
+      for (int ti = 0; ti < cTYPE_KIND_COUNT; ++ti)
+      {
+         if (typeMapName == cTYPE_MAPS[ti])
+         {
+            return TypeKey(ti, aPath[1].GetMapKey());
+         }
+      }
+   }
+   return TypeKey(-1, std::string());
+}
+
 void TypeBrowser::Model::SetShowUnusedTypes(bool aVal)
 {
    mShowUnusedTypes = aVal;
-   if (wizard::ProxyWatcher::GetActiveProxy())
+   if (mProxyPtr)
    {
-      ProxyAvailable(wizard::ProxyWatcher::GetActiveProxy());
+      RebuildTypes();
    }
 }
 
@@ -382,7 +594,7 @@ Qt::ItemFlags TypeBrowser::Model::flags(const QModelIndex& index) const
 }
 
 // Eventually executes after proxy changes are made which may affect this model
-// to trigger a full update
+// applies the type changes recorded since the last update
 void TypeBrowser::Model::DeferredUpdate()
 {
    WsfPProxy* proxyPtr = wizard::ProxyWatcher::GetActiveProxy();
@@ -393,8 +605,26 @@ void TypeBrowser::Model::DeferredUpdate()
 }
 
 // Called when any proxy value for an WSF type is modified (types only, no platforms).
-// starts/restarts the timer for a deferred update
+// records the changed type and starts/restarts the timer for a deferred update
 void TypeBrowser::Model::OnProxyTypeChange(const wizard::ProxyChange& aChange)
 {
+   if (mProxyPtr)
+   {
+      WsfPProxyStructValue root = WsfPProxyNode::FromProxy(mProxyPtr).GetValue();
+      TypeKey              key  = TypeKeyFromPath(root, aChange.path());
+      if (key.first < 0)
+      {
+         // the type map itself changed
+         mRebuildPending = true;
+      }
+      else
+      {
+         if (aChange.reason() == wizard::ProxyChange::cRENAMED && aChange.path().size() == 2)
+         {
+            mChangedTypes.emplace(key.first, aChange.oldName());
+         }
+         mChangedTypes.insert(key);
+      }
+   }
    mDeferredUpdateOnProxyChange.start();
 }
@@ -12,6 +12,11 @@
 #ifndef MODEL_HPP
 #define MODEL_HPP
 
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
 #include <QTimer>
 
 #include "AbstractModel.hpp"
@@ -85,8 +90,15 @@ private slots:
    void DeferredUpdate();
 
 private:
+   // The type kind and the name of a type
+   using TypeKey = std::pair<int, std::string>;
+
    void OnProxyTypeChange(const wizard::ProxyChange&);
    void ProxyAvailable(WsfPProxy* aProxyPtr);
+   // Scans every type of the proxy and rebuilds the items
+   void RebuildTypes();
+   // Updates the items of the types changed since the last update
+   void UpdateTypes();
 
    bool TypeHasBuiltins(int aType) { return aType <= cWEAPON_EFFECT || aType == cEW_EFFECT; }
    struct TypeSource
@@ -102,8 +114,19 @@ private:
                       int                                aScenarioIndex,
                       bool                               aScanBasicTypes);
    Item* RealizeType(const std::string& aName, std::map<std::string, TypeSource>& aTypeSources);
+   void  SetTypeSource(Item& aItem, const TypeSource& aSource, Item* aBasePtr);
+
+   // Incremental update of a single type.  aUpdated holds the kind names of the types already updated.
+   Item*         UpdateType(const TypeKey& aKey, std::set<std::string>& aUpdated);
+   void          RemoveType(const TypeKey& aKey, std::set<std::string>& aUpdated);
+   void          RemoveUnusedCoreTypes();
+   bool          FindTypeSource(const TypeKey& aKey, TypeSource& aSource);
+   WsfPProxyNode FindTypeNode(const TypeKey& aKey, bool aIsCoreType) const;
 
+   static std::string KindName(const TypeKey& aKey);
    static std::string KindNameFromPath(const WsfPProxyStructValue& aRoot, const WsfPProxyPath& aPath);
+   // Returns the key of the type at or containing aPath.  The type kind is negative if there is none.
+   static TypeKey     TypeKeyFromPath(const WsfPProxyStructValue& aRoot, const WsfPProxyPath& aPath);
    Item*              GetOrMakeType(const std::string& aTypeKind);
 
 
@@ -114,6 +137,8 @@ private:
    bool                         mShowUnusedTypes;
    bool                         mHibernate;
    QTimer                       mDeferredUpdateOnProxyChange;
+   std::set<TypeKey>            mChangedTypes;
+   bool                         mRebuildPending;
    UtCallbackHolder             mCallbacks;
    UtCallbackHolder             mProxyWatcherCallbacks;
    WsfPProxy*                   mProxyPtr;
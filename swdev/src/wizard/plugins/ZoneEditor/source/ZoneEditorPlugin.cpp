@@ -63,19 +63,27 @@ ZoneEditor::Plugin::Plugin(const QString& aName, const size_t aUniqueId)
            [&](wizard::Project* aProjectPtr)
            {
               mDataContainer.ClearData();
+              mReferenceIndex.Clear();
               mDockWidgetPtr->ClearZoneProxies();
            });
 
    // The Simulation Manager plugin will trigger this signal whenever the selected executable
    // changes in Preferences. This also removes all entities from the Map Display, so we should
    // clear out the data container; the zones will be added back when the proxy becomes available again.
-   connect(wizSignals, &wizard::Signals::WsfExeChanged, [&](wizard::WsfExe* aExePtr) { mDataContainer.ClearData(); });
+   connect(wizSignals,
+           &wizard::Signals::WsfExeChanged,
+           [&](wizard::WsfExe* aExePtr)
+           {
+              mDataContainer.ClearData();
+              mReferenceIndex.Clear();
+           });
 
    connect(wizSignals,
            &wizard::Signals::ProjectStartupFilesChanged,
            [&](std::vector<UtPath>)
            {
               mDataContainer.ClearData();
+              mReferenceIndex.Clear();
               mDockWidgetPtr->ClearZoneProxies();
            });
 
@@ -251,6 +259,7 @@ void ZoneEditor::Plugin::OnProxyAvailable(WsfPProxy* aProxyPtr)
    else
    {
       mProxyCallbacks.Clear();
+      mReferenceIndex.Clear();
       mDockWidgetPtr->ClearZoneProxies();
    }
 }
@@ -281,16 +290,19 @@ void ZoneEditor::Plugin::HandleZoneProxyChange(const wizard::ProxyChange& aChang
    case wizard::ProxyChange::Reason::cADDED:
    {
       AddZoneSet(zone, true);
+      mReferenceIndex.Add(zone);
       break;
    }
    case wizard::ProxyChange::Reason::cREMOVED:
    {
       RemoveZone(zone);
+      mReferenceIndex.Remove(zone);
       break;
    }
    case wizard::ProxyChange::Reason::cUPDATED:
    {
       UpdateZone(zone);
+      mReferenceIndex.Add(zone);
       break;
    }
    default:
@@ -320,6 +332,20 @@ void ZoneEditor::Plugin::HandlePlatformProxyChange(const wizard::ProxyChange& aC
             // Don't show these automatically; they won't be drawn
             // since this platform was created just now.
             AddZoneSet(static_cast<WsfPM_Zone>(zone), false);
+            mReferenceIndex.Add(static_cast<WsfPM_Zone>(zone));
+         }
+
+         // Zones that reference this platform by name (e.g. after a rename) can now be drawn
+         for (const auto& zone : mReferenceIndex.GetReferencingZones(platform.GetName()))
+         {
+            if (mDockWidgetPtr->ZoneProxyFound(zone))
+            {
+               UpdateZone(zone);
+            }
+            else
+            {
+               AddZoneSet(zone, false);
+            }
          }
       }
       else if (std::find(types.begin(), types.end(), "ZoneDefinition") != types.end() ||
@@ -327,6 +353,7 @@ void ZoneEditor::Plugin::HandlePlatformProxyChange(const wizard::ProxyChange& aC
       {
          // The added change was a zone definition, so add it to the data container.
          AddZoneSet(static_cast<WsfPM_Zone>(aChange.changed()), true);
+         mReferenceIndex.Add(static_cast<WsfPM_Zone>(aChange.changed()));
       }
       break;
    }
@@ -344,10 +371,12 @@ void ZoneEditor::Plugin::HandlePlatformProxyChange(const wizard::ProxyChange& aC
          if (pathStringList[index] == "zone")
          {
             RemoveZone(static_cast<WsfPM_Zone>(aChange.changed()));
+            mReferenceIndex.Remove(static_cast<WsfPM_Zone>(aChange.changed()));
          }
          else if (pathStringList[index] == "platform")
          {
             mDataContainer.RemovePlatform(platform.GetName());
+            mReferenceIndex.RemovePlatform(platform.GetName());
             RemovePlatformReferenceZones(platform.GetName());
          }
       }
@@ -374,64 +403,16 @@ void ZoneEditor::Plugin::HandlePlatformProxyChange(const wizard::ProxyChange& aC
             // Don't show these automatically; they won't be drawn
             // since this platform was created just now.
             UpdateZone(static_cast<WsfPM_Zone>(zone));
+            mReferenceIndex.Add(static_cast<WsfPM_Zone>(zone));
          }
 
-         // check any and all zones that use this platform as a reference platform
-         auto pmap = proxyRoot.platforms();
-         for (auto&& it = pmap.begin(); it != pmap.end(); ++it)
-         {
-            auto curPlatform = pmap.AtT(it);
-            if (curPlatform.GetName() == platform.GetName())
-            {
-               continue;
-            }
-
-            auto                       zoneMap = curPlatform.Zone();
-            std::vector<WsfPProxyNode> platformZones;
-            zoneMap.GetAllValues(platformZones);
-            for (const auto& zoneIter : platformZones)
-            {
-               auto zoneNode = static_cast<WsfPM_Zone>(zoneIter);
-               if (zoneNode.IsDefinition())
-               {
-                  auto zoneDef = static_cast<WsfPM_ZoneDefinition>(zoneNode);
-                  if (zoneDef.ReferencePlatform() == platform.GetName())
-                  {
-                     UpdateZone(static_cast<WsfPM_Zone>(zoneNode));
-                  }
-               }
-               else if (zoneNode.IsZoneSet())
-               {
-                  UpdatePlatformZoneSet(zoneNode, platform);
-               }
-            }
-         }
-
-         // Now go through global zones
-         auto                       zoneMap = proxyRoot.zones();
-         std::vector<WsfPProxyNode> globalZones;
-         zoneMap.GetAllValues(globalZones);
-         for (const auto& zoneIter : globalZones)
-         {
-            auto zoneNode = static_cast<WsfPM_Zone>(zoneIter);
-            if (zoneNode.IsDefinition())
-            {
-               auto zoneDef = static_cast<WsfPM_ZoneDefinition>(zoneNode);
-               if (zoneDef.ReferencePlatform() == platform.GetName())
-               {
-                  UpdateZone(static_cast<WsfPM_Zone>(zoneNode));
-               }
-            }
-            else if (zoneNode.IsZoneSet())
-            {
-               UpdatePlatformZoneSet(zoneNode, platform);
-            }
-         }
+         UpdatePlatformReferenceZones(platform.GetName());
       }
       else if (std::find(types.begin(), types.end(), "ZoneDefinition") != types.end() ||
                std::find(types.begin(), types.end(), "ZoneSet") != types.end())
       {
          UpdateZone(static_cast<WsfPM_Zone>(curNode));
+         mReferenceIndex.Add(static_cast<WsfPM_Zone>(curNode));
       }
       else
       {
@@ -444,59 +425,10 @@ void ZoneEditor::Plugin::HandlePlatformProxyChange(const wizard::ProxyChange& aC
             // Don't show these automatically; they won't be drawn
             // since this platform was created just now.
             UpdateZone(static_cast<WsfPM_Zone>(zone));
+            mReferenceIndex.Add(static_cast<WsfPM_Zone>(zone));
          }
 
-         // check any and all zones that use this platform as a reference platform
-         auto pmap = proxyRoot.platforms();
-         for (auto&& it = pmap.begin(); it != pmap.end(); ++it)
-         {
-            auto curPlatform = pmap.AtT(it);
-            if (curPlatform.GetName() == platform.GetName())
-            {
-               continue;
-            }
-
-            auto                       zoneMap = curPlatform.Zone();
-            std::vector<WsfPProxyNode> platformZones;
-            zoneMap.GetAllValues(platformZones);
-            for (const auto& zoneIter : platformZones)
-            {
-               auto zoneNode = static_cast<WsfPM_Zone>(zoneIter);
-               if (zoneNode.IsDefinition())
-               {
-                  auto zoneDef = static_cast<WsfPM_ZoneDefinition>(zoneNode);
-                  if (zoneDef.ReferencePlatform() == platform.GetName())
-                  {
-                     UpdateZone(static_cast<WsfPM_Zone>(zoneNode));
-                  }
-               }
-               else if (zoneNode.IsZoneSet())
-               {
-                  UpdatePlatformZoneSet(zoneNode, platform);
-               }
-            }
-         }
-
-         // Now go through global zones
-         auto                       zoneMap = proxyRoot.zones();
-         std::vector<WsfPProxyNode> globalZones;
-         zoneMap.GetAllValues(globalZones);
-         for (const auto& zoneIter : globalZones)
-         {
-            auto zoneNode = static_cast<WsfPM_Zone>(zoneIter);
-            if (zoneNode.IsDefinition())
-            {
-               auto zoneDef = static_cast<WsfPM_ZoneDefinition>(zoneNode);
-               if (zoneDef.ReferencePlatform() == platform.GetName())
-               {
-                  UpdateZone(static_cast<WsfPM_Zone>(zoneNode));
-               }
-            }
-            else if (zoneNode.IsZoneSet())
-            {
-               UpdatePlatformZoneSet(zoneNode, platform);
-            }
-         }
+         UpdatePlatformReferenceZones(platform.GetName());
       }
       break;
    }
@@ -506,66 +438,12 @@ void ZoneEditor::Plugin::HandlePlatformProxyChange(const wizard::ProxyChange& aC
    ApplyColors(mPrefWidgetPtr->GetPreferenceObject()->GetColorChoice());
 }
 
-void ZoneEditor::Plugin::UpdatePlatformZoneSet(const WsfPM_Zone& aZone, const WsfPM_Platform& aPlatform)
+// Updates the zones that use a platform as their reference platform, or contain a zone that does.
+void ZoneEditor::Plugin::UpdatePlatformReferenceZones(const std::string& aPlatformName)
 {
-   // loop through the zones
-   auto zoneSet                = static_cast<WsfPM_ZoneSet>(aZone);
-   auto inclusionZones         = zoneSet.InclusionZones();
-   auto exclusionZones         = zoneSet.ExclusionZones();
-   auto embeddedInclusionZones = zoneSet.EmbeddedInclusionZones();
-   auto embeddedExclusionZones = zoneSet.EmbeddedExclusionZones();
-
-   for (size_t i = 0; i < inclusionZones.size(); ++i)
+   for (const auto& zone : mReferenceIndex.GetReferencingZones(aPlatformName))
    {
-      auto inclusionZoneNode = static_cast<WsfPM_Zone>(inclusionZones[i]);
-      if (inclusionZoneNode.IsDefinition())
-      {
-         auto zoneDef = static_cast<WsfPM_ZoneDefinition>(inclusionZoneNode);
-         if (zoneDef.ReferencePlatform() == aPlatform.GetName())
-         {
-            UpdateZone(aZone);
-            break;
-         }
-      }
-   }
-   for (size_t i = 0; i < exclusionZones.size(); ++i)
-   {
-      auto exclusionZoneNode = static_cast<WsfPM_Zone>(exclusionZones[i]);
-      if (exclusionZoneNode.IsDefinition())
-      {
-         auto zoneDef = static_cast<WsfPM_ZoneDefinition>(exclusionZoneNode);
-         if (zoneDef.ReferencePlatform() == aPlatform.GetName())
-         {
-            UpdateZone(aZone);
-            break;
-         }
-      }
-   }
-   for (size_t i = 0; i < embeddedInclusionZones.size(); ++i)
-   {
-      auto embeddedInclusionZoneNode = static_cast<WsfPM_Zone>(embeddedInclusionZones[i]);
-      if (embeddedInclusionZoneNode.IsDefinition())
-      {
-         auto zoneDef = static_cast<WsfPM_ZoneDefinition>(embeddedInclusionZoneNode);
-         if (zoneDef.ReferencePlatform() == aPlatform.GetName())
-         {
-            UpdateZone(aZone);
-            break;
-         }
-      }
-   }
-   for (size_t i = 0; i < embeddedExclusionZones.size(); ++i)
-   {
-      auto embeddedExclusionZoneNode = static_cast<WsfPM_Zone>(embeddedExclusionZones[i]);
-      if (embeddedExclusionZoneNode.IsDefinition())
-      {
-         auto zoneDef = static_cast<WsfPM_ZoneDefinition>(embeddedExclusionZoneNode);
-         if (zoneDef.ReferencePlatform() == aPlatform.GetName())
-         {
-            UpdateZone(aZone);
-            break;
-         }
-      }
+      UpdateZone(zone);
    }
 }
 
@@ -881,6 +759,7 @@ void ZoneEditor::Plugin::PopulateDataContainer(WsfPProxy* aProxyPtr)
    if (aProxyPtr != nullptr)
    {
       mDataContainer.ClearData();
+      mReferenceIndex.Clear();
 
       // This map will only contain the globally-defined zones.
       WsfPM_ZoneMap              zoneMap = WsfPM_Root(aProxyPtr).zones();
@@ -890,6 +769,7 @@ void ZoneEditor::Plugin::PopulateDataContainer(WsfPProxy* aProxyPtr)
       {
          WsfPM_Zone zone = static_cast<WsfPM_Zone>(zoneIter);
          AddZoneSet(zone);
+         mReferenceIndex.Add(zone);
       }
 
       // Grab all the zones that are attached to platforms.
@@ -905,6 +785,7 @@ void ZoneEditor::Plugin::PopulateDataContainer(WsfPProxy* aProxyPtr)
          {
             WsfPM_Zone zone = static_cast<WsfPM_Zone>(zoneIter);
             AddZoneSet(zone);
+            mReferenceIndex.Add(zone);
          }
       }
 
@@ -915,47 +796,12 @@ void ZoneEditor::Plugin::PopulateDataContainer(WsfPProxy* aProxyPtr)
 
 void ZoneEditor::Plugin::RemovePlatformReferenceZones(const std::string& aPlatformName)
 {
-   WsfPM_Root proxyRoot(wizard::ProxyWatcher::GetActiveProxy());
-   auto       pmap = proxyRoot.platforms();
-   for (auto&& it = pmap.begin(); it != pmap.end(); ++it)
+   // The zones stay in the reference index, so they are drawn again if a platform with this name is added
+   for (const auto& zone : mReferenceIndex.GetReferencingZones(aPlatformName))
    {
-      auto curPlatform = pmap.AtT(it);
-      if (curPlatform.GetName() == aPlatformName)
-      {
-         continue;
-      }
-
-      auto                       zoneMap = curPlatform.Zone();
-      std::vector<WsfPProxyNode> platformZones;
-      zoneMap.GetAllValues(platformZones);
-      for (const auto& zoneIter : platformZones)
+      if (zone.IsDefinition())
       {
-         auto zoneNode = static_cast<WsfPM_Zone>(zoneIter);
-         if (zoneNode.IsDefinition())
-         {
-            auto zoneDef = static_cast<WsfPM_ZoneDefinition>(zoneNode);
-            if (zoneDef.ReferencePlatform() == aPlatformName)
-            {
-               RemoveZone(zoneDef);
-            }
-         }
-      }
-   }
-
-   // now remove any global zones associated with this platform
-   auto                       zoneMap = proxyRoot.zones();
-   std::vector<WsfPProxyNode> globalZones;
-   zoneMap.GetAllValues(globalZones);
-   for (const auto& zoneIter : globalZones)
-   {
-      auto zoneNode = static_cast<WsfPM_Zone>(zoneIter);
-      if (zoneNode.IsDefinition())
-      {
-         auto zoneDef = static_cast<WsfPM_ZoneDefinition>(zoneNode);
-         if (zoneDef.ReferencePlatform() == aPlatformName)
-         {
-            RemoveZone(zoneDef);
-         }
+         RemoveZone(zone);
       }
    }
 }
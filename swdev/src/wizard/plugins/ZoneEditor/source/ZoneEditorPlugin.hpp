@@ -22,6 +22,7 @@
 #include "UtCallbackHolder.hpp"
 #include "WsfPM_Zone.hpp"
 #include "WsfPProxy.hpp"
+#include "ZoneReferenceIndex.hpp"
 #include "zone_browser/WkfZoneBrowserDataContainer.hpp"
 #include "zone_browser/WkfZoneBrowserPrefWidget.hpp"
 
@@ -50,7 +51,7 @@ private:
    void             AddZoneSet(const WsfPM_Zone& aZone, bool aShow = false);
    void             AddZone(const WsfPM_ZoneDefinition& aZone, wkf::ZoneSetData& aZoneSet);
    void             UpdateZone(const WsfPM_Zone& aZone);
-   void             UpdatePlatformZoneSet(const WsfPM_Zone& aZone, const WsfPM_Platform& aPlatform);
+   void             UpdatePlatformReferenceZones(const std::string& aPlatformName);
    void             RemoveZone(const WsfPM_Zone& aZone);
    void             RemovePlatformReferenceZones(const std::string& aPlatformName);
    void             RemovePlatformReferenceZoneSetZone(const WsfPM_Zone& aZone, const std::string& aPlatformName);
@@ -62,6 +63,7 @@ private:
    wkf::PolygonalZoneVariables  ExtractPolygonalVars(const WsfPM_ZoneDefinition& aZone);
 
    wkf::ZoneBrowserDataContainer               mDataContainer;
+   ZoneReferenceIndex                          mReferenceIndex;
    DockWidget*                                 mDockWidgetPtr;
    CreateZoneDialog*                           mDialogPtr;
    PluginUiPointer<wkf::ZoneBrowserPrefWidget> mPrefWidgetPtr;
@@ -0,0 +1,186 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#include "ZoneReferenceIndex.hpp"
+
+namespace
+{
+void AddReference(const WsfPM_Zone& aZone, std::set<std::string>& aReferences)
+{
+   if (aZone.IsDefinition())
+   {
+      auto reference = static_cast<WsfPM_ZoneDefinition>(aZone).ReferencePlatform();
+      if (!reference.empty())
+      {
+         aReferences.insert(reference);
+      }
+   }
+}
+
+// Only the zones of a zone set that are definitions have a reference platform
+template<typename ZONES>
+void AddReferences(const ZONES& aZones, std::set<std::string>& aReferences)
+{
+   for (size_t i = 0; i < aZones.size(); ++i)
+   {
+      AddReference(static_cast<WsfPM_Zone>(aZones[i]), aReferences);
+   }
+}
+
+// Finds the zone of the global or platform zone map that holds aZone, which may be embedded in a zone set.
+// The path of a global zone is ["zone", name], and the path of a platform zone is ["platform", name, "zone", name].
+bool FindMapZone(const WsfPM_Zone& aZone, WsfPM_Zone& aMapZone, bool& aEmbedded)
+{
+   std::vector<std::string> path  = aZone.GetPath().ToStringList(aZone.GetRoot());
+   size_t                   depth = (!path.empty() && path[0] == "platform") ? 4 : 2;
+   if (path.size() < depth)
+   {
+      return false;
+   }
+   WsfPProxyNode node = aZone;
+   for (size_t i = path.size(); i > depth; --i)
+   {
+      node = node.GetParent();
+   }
+   aMapZone  = static_cast<WsfPM_Zone>(node);
+   aEmbedded = (path.size() > depth);
+   return true;
+}
+} // namespace
+
+void ZoneEditor::ZoneReferenceIndex::Add(const WsfPM_Zone& aZone)
+{
+   WsfPM_Zone zone;
+   bool       embedded = false;
+   if (!FindMapZone(aZone, zone, embedded))
+   {
+      return;
+   }
+   ZoneKey key = GetKey(zone);
+   Remove(key);
+
+   ZoneEntry entry{zone, {}};
+   if (zone.IsZoneSet())
+   {
+      auto zoneSet = static_cast<WsfPM_ZoneSet>(zone);
+      AddReferences(zoneSet.InclusionZones(), entry.mReferencePlatforms);
+      AddReferences(zoneSet.ExclusionZones(), entry.mReferencePlatforms);
+      AddReferences(zoneSet.EmbeddedInclusionZones(), entry.mReferencePlatforms);
+      AddReferences(zoneSet.EmbeddedExclusionZones(), entry.mReferencePlatforms);
+   }
+   else
+   {
+      AddReference(zone, entry.mReferencePlatforms);
+   }
+
+   for (const auto& reference : entry.mReferencePlatforms)
+   {
+      mZonesByReference[reference].insert(key);
+   }
+   mZonesByPlatform[key.first].insert(key);
+   mZones.emplace(key, std::move(entry));
+}
+
+void ZoneEditor::ZoneReferenceIndex::Remove(const WsfPM_Zone& aZone)
+{
+   WsfPM_Zone zone;
+   bool       embedded = false;
+   if (FindMapZone(aZone, zone, embedded))
+   {
+      if (embedded)
+      {
+         // The zone set that held the zone remains
+         Add(zone);
+      }
+      else
+      {
+         Remove(GetKey(zone));
+      }
+   }
+}
+
+void ZoneEditor::ZoneReferenceIndex::RemovePlatform(const std::string& aPlatformName)
+{
+   auto platformIt = mZonesByPlatform.find(aPlatformName);
+   if (platformIt != mZonesByPlatform.end())
+   {
+      // Remove(key) modifies the platform's set of zones, so iterate over a copy
+      std::set<ZoneKey> keys = platformIt->second;
+      for (const auto& key : keys)
+      {
+         Remove(key);
+      }
+   }
+}
+
+void ZoneEditor::ZoneReferenceIndex::Clear()
+{
+   mZones.clear();
+   mZonesByReference.clear();
+   mZonesByPlatform.clear();
+}
+
+std::vector<WsfPM_Zone> ZoneEditor::ZoneReferenceIndex::GetReferencingZones(const std::string& aPlatformName) const
+{
+   std::vector<WsfPM_Zone> zones;
+   auto                    referenceIt = mZonesByReference.find(aPlatformName);
+   if (referenceIt != mZonesByReference.end())
+   {
+      for (const auto& key : referenceIt->second)
+      {
+         if (key.first != aPlatformName)
+         {
+            zones.push_back(mZones.at(key).mZone);
+         }
+      }
+   }
+   return zones;
+}
+
+// The platform name is found the same way as the plugin's GetPlatformName, so it matches the data container
+ZoneEditor::ZoneReferenceIndex::ZoneKey ZoneEditor::ZoneReferenceIndex::GetKey(const WsfPM_Zone& aZone)
+{
+   std::string platformName;
+   if (aZone.GetPath().size() > 2)
+   {
+      platformName = aZone.GetParent().GetParent().GetName();
+   }
+   if (platformName.empty())
+   {
+      platformName = "Global Zones";
+   }
+   return ZoneKey(platformName, aZone.GetName());
+}
+
+void ZoneEditor::ZoneReferenceIndex::Remove(const ZoneKey& aKey)
+{
+   auto zoneIt = mZones.find(aKey);
+   if (zoneIt == mZones.end())
+   {
+      return;
+   }
+   for (const auto& reference : zoneIt->second.mReferencePlatforms)
+   {
+      auto referenceIt = mZonesByReference.find(reference);
+      referenceIt->second.erase(aKey);
+      if (referenceIt->second.empty())
+      {
+         mZonesByReference.erase(referenceIt);
+      }
+   }
+   auto platformIt = mZonesByPlatform.find(aKey.first);
+   platformIt->second.erase(aKey);
+   if (platformIt->second.empty())
+   {
+      mZonesByPlatform.erase(platformIt);
+   }
+   mZones.erase(zoneIt);
+}
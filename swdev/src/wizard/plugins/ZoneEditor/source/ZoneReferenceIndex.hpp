@@ -0,0 +1,61 @@
+// ****************************************************************************
+// CUI
+//
+// The Advanced Framework for Simulation, Integration, and Modeling (AFSIM)
+//
+// Copyright 2022 Infoscitex, a DCS Company. All rights reserved.
+//
+// The use, dissemination or disclosure of data in this file is subject to
+// limitation or restriction. See accompanying README and LICENSE for details.
+// ****************************************************************************
+
+#ifndef ZONEREFERENCEINDEX_HPP
+#define ZONEREFERENCEINDEX_HPP
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "WsfPM_Zone.hpp"
+
+namespace ZoneEditor
+{
+//! Indexes the zones of the scenario (the global zones and the zones of the platforms) by the reference platforms
+//! of their definitions, so the zones affected by a platform change are found without scanning every zone.
+//! A zone set is indexed under the reference platforms of the definitions it contains.
+class ZoneReferenceIndex
+{
+public:
+   //! Indexes a zone, replacing its previous entries.  A zone embedded in a zone set indexes the zone set.
+   void Add(const WsfPM_Zone& aZone);
+   //! Removes a zone.  Removing a zone embedded in a zone set indexes the zone set again.
+   void Remove(const WsfPM_Zone& aZone);
+   //! Removes the zones of a platform
+   void RemovePlatform(const std::string& aPlatformName);
+   void Clear();
+
+   //! Returns the zones that reference a platform, other than the platform's own zones
+   std::vector<WsfPM_Zone> GetReferencingZones(const std::string& aPlatformName) const;
+
+private:
+   //! Identifies a zone by the name of its platform ("Global Zones" for a global zone) and its name
+   using ZoneKey = std::pair<std::string, std::string>;
+
+   struct ZoneEntry
+   {
+      WsfPM_Zone            mZone;
+      std::set<std::string> mReferencePlatforms;
+   };
+
+   static ZoneKey GetKey(const WsfPM_Zone& aZone);
+   void           Remove(const ZoneKey& aKey);
+
+   std::map<ZoneKey, ZoneEntry>             mZones;
+   std::map<std::string, std::set<ZoneKey>> mZonesByReference;
+   std::map<std::string, std::set<ZoneKey>> mZonesByPlatform;
+};
+} // namespace ZoneEditor
+
+#endif // !ZONEREFERENCEINDEX_HPP